@@ -21,7 +21,9 @@
  * @brief BREP file reader for importing OpenCASCADE native format
  *
  * Provides functionality to read BREP files and convert them to OCCGeometry objects
- * BREP is OpenCASCADE's native boundary representation format
+ * BREP is OpenCASCADE's native boundary representation format. Both the ASCII
+ * (BRepTools) and binary (BinTools) flavours are supported, and triangulation
+ * stored in the file is kept so it can be displayed without remeshing.
  */
 class BREPReader : public GeometryReader {
 public:
@@ -49,7 +51,7 @@ public:
     /**
      * @brief Check if a file has a valid BREP extension
      * @param filePath Path to check
-     * @return true if file has .brep extension
+     * @return true if file has a .brep, .brp or .bbrep extension
      */
     bool isValidFile(const std::string& filePath) const override;
 
@@ -71,7 +73,46 @@ public:
      */
     std::string getFileFilter() const override;
 
+    /**
+     * @brief Path of the binary BREP sidecar kept next to a source file
+     * @param sourcePath Path of the original (e.g. STEP) file
+     * @return Sidecar path (source path with ".bbrep" appended)
+     */
+    static std::string sidecarPathFor(const std::string& sourcePath);
+
+    /**
+     * @brief Check for a sidecar that is at least as new as its source file
+     */
+    static bool hasFreshSidecar(const std::string& sourcePath);
+
+    /**
+     * @brief Write a binary BREP sidecar for a source file
+     * @param sourcePath Path of the original file
+     * @param shape Shape translated from the original file
+     * @return true if the sidecar was written
+     */
+    static bool writeSidecar(const std::string& sourcePath, const TopoDS_Shape& shape);
+
 private:
+    /**
+     * @brief Check whether a file holds binary rather than ASCII BREP data
+     */
+    static bool isBinaryFile(const std::string& filePath);
+
+    /**
+     * @brief Read a BREP file of either flavour
+     * @param filePath Path to the BREP file
+     * @param shape Output shape
+     * @param errorMessage Set when reading fails
+     * @return true on success
+     */
+    static bool readShape(const std::string& filePath, TopoDS_Shape& shape, std::string& errorMessage);
+
+    /**
+     * @brief Report how many faces already carry a stored triangulation
+     */
+    static void logStoredTriangulation(const TopoDS_Shape& shape);
+
     /**
      * @brief Initialize the BREP reader
      */
@@ -120,8 +161,5 @@ private:
      */
     TopoDS_Shape fixShape(const TopoDS_Shape& shape);
 
-    // Static members for caching
-    static std::unordered_map<std::string, ReadResult> s_cache;
-    static std::mutex s_cacheMutex;
     static bool s_initialized;
 };
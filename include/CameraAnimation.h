@@ -3,12 +3,21 @@
 #include <Inventor/SbLinear.h>
 #include <wx/timer.h>
 #include <wx/event.h>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <limits>
 
 class SoCamera;
 
+/**
+ * @brief Camera interpolation driven by the monotonic clock
+ *
+ * Progress is the wall time since the start over the duration, so an animation
+ * ends on time however long frames take; when rendering lags, the states in
+ * between are skipped. A new state is sampled only after the view has drawn
+ * the previous one (see notifyFrameRendered), so at most one redraw is queued.
+ */
 class CameraAnimation : public wxEvtHandler {
 public:
     enum AnimationType {
@@ -50,12 +59,21 @@ public:
     void setAlignOrientationToOrbit(bool enable) { m_alignOrientationToOrbit = enable; }
     void updateCamera();
 
+    /**
+     * @brief Tell the animation the view has drawn a frame, so it may sample the next state
+     *
+     * Views that never call this still animate: a requested frame is assumed
+     * lost after a short timeout.
+     */
+    void notifyFrameRendered() { m_frameInFlight = false; }
+
     // Animation parameters
     void setAnimationType(AnimationType type) { m_animationType = type; }
     AnimationType getAnimationType() const { return m_animationType; }
 
 private:
     void onTimer(wxTimerEvent& event);
+    void advance();
     float calculateEasing(float t) const;
     CameraState interpolateStates(const CameraState& start, const CameraState& end, float t) const;
     void alignStateWithOrbitCenter(CameraState& state) const;
@@ -73,6 +91,9 @@ private:
     float m_duration;
     float m_elapsedTime;
     bool m_isAnimating;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::steady_clock::time_point m_frameRequestTime;
+    bool m_frameInFlight;
 
     std::function<void(float)> m_progressCallback;
     std::function<void()> m_completionCallback;
@@ -104,6 +125,9 @@ public:
     // Camera setup
     void setCamera(SoCamera* camera);
 
+    // Called by the view after each painted frame
+    void notifyFrameRendered();
+
     // View refresh callback
     void setViewRefreshCallback(std::function<void()> callback);
 
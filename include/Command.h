@@ -2,7 +2,7 @@
 #define COMMAND_H
 
 #include <string>
-#include <vector>
+#include <deque>
 #include <memory>
 
 class Command
@@ -14,6 +14,11 @@ public:
 	virtual void unexecute() = 0;
 
 	virtual std::string getDescription() const = 0;
+
+	// Approximate bytes the command keeps alive while it sits in the undo history.
+	// Commands should record what they change rather than whole scene state, and
+	// report that here so the history can stay within its byte budget.
+	virtual size_t getMemoryCost() const { return sizeof(Command); }
 };
 
 class CommandManager
@@ -33,10 +38,32 @@ public:
 	std::string getUndoCommandDescription() const;
 	std::string getRedoCommandDescription() const;
 
+	// History limits; the oldest undo entries are dropped first when either is exceeded
+	void setMaxStackSize(size_t maxStackSize);
+	void setMaxHistoryBytes(size_t maxHistoryBytes);
+	size_t getMaxHistoryBytes() const { return m_maxHistoryBytes; }
+
+	// Memory held by the undo and redo stacks, as reported by the commands
+	size_t getHistoryBytes() const { return m_undoBytes + m_redoBytes; }
+	size_t getUndoCommandCost() const;
+	size_t getRedoCommandCost() const;
+
 private:
-	std::vector<std::shared_ptr<Command>> m_undoStack;
-	std::vector<std::shared_ptr<Command>> m_redoStack;
+	struct Entry {
+		std::shared_ptr<Command> command;
+		size_t cost;
+	};
+
+	void pushUndo(Entry entry);
+	void pushRedo(Entry entry);
+	void enforceLimits();
+
+	std::deque<Entry> m_undoStack;
+	std::deque<Entry> m_redoStack;
+	size_t m_undoBytes;
+	size_t m_redoBytes;
 	size_t m_maxStackSize;
+	size_t m_maxHistoryBytes;
 };
 
-#endif // COMMAND_H
\ No newline at end of file
+#endif // COMMAND_H
@@ -13,6 +13,7 @@ public:
 	void updateCoordinateSystemSize(float sceneSize);
 	void setCoordinateSystemScale(float scale);
 	float getCoordinateSystemSize() const { return m_currentPlaneSize; }
+	SoSeparator* getRoot() const { return m_coordSystemSeparator; }
 
 	// Visibility control
 	void setVisible(bool visible);
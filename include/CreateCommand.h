@@ -15,6 +15,7 @@ public:
 	void execute() override;
 	void unexecute() override;
 	std::string getDescription() const override;
+	size_t getMemoryCost() const override;
 
 private:
 	std::unique_ptr<GeometryObject> m_object;
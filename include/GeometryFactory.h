@@ -4,6 +4,8 @@
 #include <Inventor/SbVec3f.h>
 #include <string>
 #include <memory>
+#include <functional>
+#include "viewer/ShapeBuildService.h"
 
 class SoSeparator;
 class ObjectTreePanel;
@@ -21,6 +23,9 @@ enum class GeometryType {
 
 class GeometryFactory {
 public:
+	// Called on the UI thread once a geometry is in the scene
+	using GeometryCallback = std::function<void(const std::shared_ptr<OCCGeometry>&)>;
+
 	GeometryFactory(SoSeparator* root, ObjectTreePanel* treePanel, PropertyPanel* propPanel,
 		CommandManager* cmdManager, OCCViewer* occViewer);
 	~GeometryFactory();
@@ -28,8 +33,10 @@ public:
 	// Create geometry with default parameters
 	void createOCCGeometry(const std::string& type, const SbVec3f& position);
 
-	// Create geometry with custom parameters
-	std::shared_ptr<OCCGeometry> createOCCGeometryWithParameters(const std::string& type, const SbVec3f& position, const BasicGeometryParameters& params);
+	// Create geometry with custom parameters. Types built in the background return
+	// nullptr here and report through onCreated once they are in the scene
+	std::shared_ptr<OCCGeometry> createOCCGeometryWithParameters(const std::string& type, const SbVec3f& position, const BasicGeometryParameters& params,
+		GeometryCallback onCreated = nullptr);
 
 	// Create geometry with material parameters
 	void createOCCGeometryWithMaterial(const std::string& type, const SbVec3f& position, const BasicGeometryParameters& params);
@@ -54,6 +61,18 @@ public:
 	std::shared_ptr<OCCGeometry> createOCCTruncatedCylinder(const SbVec3f& position, double bottomRadius, double topRadius, double height);
 
 	std::shared_ptr<OCCGeometry> createOCCWrench(const SbVec3f& position);
+	ShapeBuildService::JobId createOCCWrenchAsync(const SbVec3f& position, GeometryCallback onCreated = nullptr);
+
+	/**
+	 * @brief Build a shape on the viewer's ShapeBuildService and add it to the scene when done
+	 *
+	 * The build function runs on a worker thread and gets the job context for
+	 * progress and cancellation. The result is added to the object tree and the
+	 * viewer in one UI event. The factory itself may be destroyed meanwhile.
+	 * @return Job ID, or 0 if the viewer has no build service
+	 */
+	ShapeBuildService::JobId createOCCGeometryAsync(const std::string& name, const SbVec3f& position,
+		ShapeBuildService::BuildFunc build, GeometryCallback onCreated = nullptr);
 
 	std::shared_ptr<OCCGeometry> createOCCNavCube(const SbVec3f& position);
 	std::shared_ptr<OCCGeometry> createOCCNavCube(const SbVec3f& position, double size);
@@ -67,7 +86,14 @@ public:
 
 private:
 	// Helper function to build high-quality face index mapping for system-created geometries
-	void buildFaceIndexMappingForSystemGeometry(std::shared_ptr<OCCGeometry> geometry, const std::string& geometryName);
+	static void buildFaceIndexMappingForSystemGeometry(std::shared_ptr<OCCGeometry> geometry, const std::string& geometryName);
+
+	// Add a finished geometry to the object tree and the viewer, then fit the view
+	static void addToScene(ObjectTreePanel* treePanel, OCCViewer* occViewer, const std::shared_ptr<OCCGeometry>& geometry);
+
+	// Wrench solid at the origin; context is null when building synchronously.
+	// Returns a null shape on failure or cancellation
+	static TopoDS_Shape buildWrenchShape(const std::string& name, ShapeBuildService::Context* context);
 
 	SoSeparator* m_root;
 	ObjectTreePanel* m_treePanel;
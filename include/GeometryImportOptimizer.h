@@ -36,16 +36,6 @@ public:
         int threadCount = 1;
     };
 
-    /**
-     * @brief Cache entry for imported geometries
-     */
-    struct CacheEntry {
-        std::vector<std::shared_ptr<OCCGeometry>> geometries;
-        std::chrono::system_clock::time_point timestamp;
-        size_t fileHash;
-        ImportMetrics metrics;
-    };
-
     /**
      * @brief Multi-threaded import configuration
      */
@@ -109,14 +99,7 @@ public:
     );
 
     /**
-     * @brief Get cached import result if available
-     * @param filePath Path to the geometry file
-     * @return Cached result or empty result
-     */
-    static std::optional<CacheEntry> getCachedImport(const std::string& filePath);
-
-    /**
-     * @brief Clear import cache
+     * @brief Clear the shared import cache
      */
     static void clearCache();
 
@@ -153,12 +136,6 @@ public:
     static double estimateImportTime(const std::string& filePath);
 
 private:
-    // Cache management
-    static std::unordered_map<std::string, CacheEntry> s_cache;
-    static std::mutex s_cacheMutex;
-    static std::atomic<size_t> s_cacheSize;
-    static const size_t s_maxCacheSize;
-
     // Performance tracking
     static std::vector<ImportMetrics> s_performanceHistory;
     static std::mutex s_performanceMutex;
@@ -167,13 +144,6 @@ private:
     // Memory pool for efficient allocation
     static std::unique_ptr<class MemoryPool> s_memoryPool;
 
-    /**
-     * @brief Calculate file hash for caching
-     * @param filePath Path to the file
-     * @return Hash value
-     */
-    static size_t calculateFileHash(const std::string& filePath);
-
     /**
      * @brief Import with multi-threading
      * @param reader Geometry reader instance
@@ -16,6 +16,7 @@
  */
 class GeometryReader {
 public:
+    // Throwing from the callback aborts the import; parallel stages cancel their remaining work
     using ProgressCallback = std::function<void(int /*percent*/, const std::string& /*stage*/)>;
 
     /**
@@ -121,6 +122,15 @@ public:
         int tessellationMaxPoints = 100;      // Maximum points per edge
         bool enableAdaptiveTessellation = true; // Adaptive based on curvature
 
+        // Keep a binary BREP sidecar next to STEP files so reopening skips the
+        // STEP translator; the sidecar holds geometry only, not names or colors
+        bool enableBRepSidecar = false;
+
+        // Build the Coin nodes of mesh-only geometries during import. Coin is not
+        // thread-safe, so callers reading on a worker thread turn this off and call
+        // buildMeshCoinNode() on the main thread
+        bool buildCoinNodes = true;
+
         // Geometry decomposition options
         DecompositionOptions decomposition;
 
@@ -168,7 +178,57 @@ public:
      */
     virtual std::string getFileFilter() const = 0;
 
+    /**
+     * @brief Run body(i) for every index on the shared TBB worker pool
+     *
+     * Concurrency is capped at maxThreads and indices are handed out in chunks.
+     * onProgress receives the number of finished indices and is only called on
+     * the calling thread; an exception it throws cancels the remaining chunks
+     * and is rethrown.
+     * @param count Number of indices
+     * @param maxThreads Upper bound on worker threads (<= 0 uses all cores)
+     * @param body Work for one index, must be thread-safe
+     * @param onProgress Optional progress hook
+     */
+    static void parallelForEach(
+        size_t count,
+        int maxThreads,
+        const std::function<void(size_t)>& body,
+        const std::function<void(size_t)>& onProgress = nullptr
+    );
+
+    /**
+     * @brief Build the display-mode scene graph of a mesh-only geometry from its cached mesh
+     *
+     * Must run on the main thread. Does nothing if the geometry already has a
+     * Coin node or has no cached mesh.
+     * @return true if the geometry has a Coin node afterwards
+     */
+    static bool buildMeshCoinNode(OCCGeometry& geometry);
+
 protected:
+    /**
+     * @brief Convert shapes to geometries on the shared worker pool
+     *
+     * Falls back to a sequential loop when parallel processing is disabled.
+     * Results keep the input order; failed conversions are dropped.
+     * @param count Number of shapes
+     * @param convert Conversion for one shape index
+     * @param options Optimization options (maxThreads, enableParallelProcessing)
+     * @param progress Progress callback
+     * @param progressStart Percent reported before the first shape
+     * @param progressSpan Percent range covered by all shapes
+     * @return Geometries in shape order
+     */
+    static std::vector<std::shared_ptr<OCCGeometry>> convertShapesParallel(
+        size_t count,
+        const std::function<std::shared_ptr<OCCGeometry>(size_t)>& convert,
+        const OptimizationOptions& options,
+        ProgressCallback progress,
+        int progressStart,
+        int progressSpan
+    );
+
     /**
      * @brief Helper function to create OCCGeometry from TopoDS_Shape
      * @param shape The shape to convert
@@ -137,8 +137,5 @@ private:
         ProgressCallback progress = nullptr
     );
 
-    // Static members for caching
-    static std::unordered_map<std::string, ReadResult> s_cache;
-    static std::mutex s_cacheMutex;
     static bool s_initialized;
 };
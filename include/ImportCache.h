@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <OpenCASCADE/TopoDS_Shape.hxx>
+#include <OpenCASCADE/Quantity_Color.hxx>
+#include "GeometryReader.h"
+
+/**
+ * @brief Process-wide, memory-bounded cache of import results
+ *
+ * Entries are keyed by canonical path, file size, modification time, a
+ * sampled content hash and a hash of the options that influence the result.
+ * Only TopoDS_Shape handles and appearance are retained; a hit builds fresh
+ * OCCGeometry objects that share the cached BRep, so the same file can be
+ * opened twice without the two copies aliasing each other.
+ *
+ * The byte budget is measured from the BRep topology and triangulations an
+ * entry keeps alive. Eviction is GreedyDual-Size: entries that were cheap to
+ * import relative to their size go first, recently used ones last.
+ */
+class ImportCache {
+public:
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        uint64_t rejected = 0;      // results larger than the whole budget
+        size_t entries = 0;
+        size_t bytes = 0;
+        size_t budget = 0;
+    };
+
+    static ImportCache& getInstance();
+
+    /**
+     * @brief Look up a previous import of the same file with equivalent options
+     * @return Result with newly created geometries, or nothing on a miss
+     */
+    std::optional<GeometryReader::ReadResult> lookup(
+        const std::string& filePath,
+        const GeometryReader::OptimizationOptions& options);
+
+    /**
+     * @brief Store a successful import result
+     *
+     * Mesh-only results (STL/OBJ) are not cached: they carry no BRep to share
+     * and re-reading them is cheaper than holding a second copy of the mesh.
+     */
+    void store(
+        const std::string& filePath,
+        const GeometryReader::OptimizationOptions& options,
+        const GeometryReader::ReadResult& result);
+
+    void setBudget(size_t bytes);
+    size_t getBudget() const;
+
+    void clear();
+    Statistics getStatistics() const;
+    void resetStatistics();
+
+private:
+    ImportCache() = default;
+    ImportCache(const ImportCache&) = delete;
+    ImportCache& operator=(const ImportCache&) = delete;
+
+    struct Key {
+        std::string canonicalPath;
+        uint64_t fileSize = 0;
+        int64_t modifiedTime = 0;
+        uint64_t contentHash = 0;
+        uint64_t optionsHash = 0;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct CachedGeometry {
+        std::string name;
+        std::string fileName;
+        TopoDS_Shape shape;
+        Quantity_Color color;
+        double transparency = 0.0;
+        int assemblyLevel = 0;
+    };
+
+    struct Entry {
+        Key key;
+        std::vector<CachedGeometry> geometries;
+        TopoDS_Shape rootShape;
+        std::string formatName;
+        double importTime = 0.0;
+        size_t bytes = 0;
+        double priority = 0.0;     // GreedyDual-Size H value
+    };
+
+    static std::optional<Key> makeKey(const std::string& filePath, const GeometryReader::OptimizationOptions& options);
+    static uint64_t hashOptions(const GeometryReader::OptimizationOptions& options);
+    static uint64_t hashFileSample(const std::string& filePath, uint64_t fileSize);
+
+    double priorityFor(const Entry& entry) const;
+    void evictToFit(size_t incomingBytes);
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> m_entries;   // by canonical path
+    size_t m_bytes = 0;
+    size_t m_budget = 1024ull * 1024 * 1024;
+    double m_inflation = 0.0;      // GreedyDual-Size L value
+    Statistics m_stats;
+};
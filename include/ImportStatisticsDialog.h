@@ -13,6 +13,7 @@
 #include <vector>
 #include <unordered_map>
 #include <chrono>
+#include <cstdint>
 
 struct ImportFileStatistics {
     std::string fileName;
@@ -105,6 +106,14 @@ struct ImportOverallStatistics {
     bool adaptiveMeshingEnabled;
     double meshDeflection;
 
+    // Shared import cache (session totals)
+    uint64_t cacheHits;
+    uint64_t cacheMisses;
+    uint64_t cacheEvictions;
+    size_t cacheEntries;
+    size_t cacheBytes;
+    size_t cacheBudget;
+
     ImportOverallStatistics()
         : totalFilesSelected(0), totalFilesProcessed(0), totalSuccessfulFiles(0),
           totalFailedFiles(0), totalGeometriesCreated(0), totalFileSize(0),
@@ -113,7 +122,8 @@ struct ImportOverallStatistics {
           totalFacesProcessed(0), totalSolids(0), totalShells(0), totalFaces(0),
           totalWires(0), totalEdges(0), totalVertices(0), totalMeshVertices(0),
           totalMeshTriangles(0), lodEnabled(false), adaptiveMeshingEnabled(false),
-          meshDeflection(0.0) {}
+          meshDeflection(0.0), cacheHits(0), cacheMisses(0), cacheEvictions(0),
+          cacheEntries(0), cacheBytes(0), cacheBudget(0) {}
 };
 
 class ImportStatisticsDialog : public FramelessModalPopup
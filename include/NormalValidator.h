@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 #include <OpenCASCADE/TopoDS_Shape.hxx>
@@ -34,11 +37,56 @@ struct NormalValidationResult {
     }
 };
 
+/**
+ * @brief Face orientation state of a shape derived from its shell topology
+ *
+ * Faces sharing a manifold edge are consistently oriented when they traverse
+ * that edge in opposite directions. Orientation is propagated breadth-first
+ * over the edge-face adjacency of each connected shell; a closed shell is
+ * then turned outward by the sign of its enclosed volume, an open one keeps
+ * the orientation most of its faces already have.
+ */
+struct NormalOrientationAnalysis {
+    int totalFaces = 0;
+    int facesWithNormals = 0;
+    int shells = 0;             // connected face components
+    int closedShells = 0;
+    int affectedShells = 0;     // shells with at least one face to reverse
+    int conflictingEdges = 0;   // edges where propagation met itself inconsistently (non-orientable or non-manifold)
+    bool cancelled = false;
+    std::vector<TopoDS_Face> facesToReverse;
+};
+
+/**
+ * @brief Corrected shape for one geometry; produced off the UI thread, applied by the caller
+ */
+struct NormalCorrection {
+    std::shared_ptr<class OCCGeometry> geometry;
+    TopoDS_Shape correctedShape;
+    int reversedFaces = 0;
+    int affectedShells = 0;
+};
+
 /**
  * @brief Utility class for validating and correcting face normals
  */
 class NormalValidator {
 public:
+    /**
+     * @brief Called once per geometry as soon as its result is ready
+     *
+     * Invoked from worker threads, one call at a time.
+     */
+    using ProgressCallback = std::function<void(size_t completed, size_t total,
+        const std::string& name, const NormalValidationResult& result)>;
+
+    /**
+     * @brief Analyse face orientation consistency of a shape
+     * @param shape The shape to analyse
+     * @param cancel Optional flag; analysis stops early when it becomes true
+     */
+    static NormalOrientationAnalysis analyzeOrientation(const TopoDS_Shape& shape, const std::atomic<bool>* cancel = nullptr);
+
     /**
      * @brief Validate normals for a single shape
      * @param shape The shape to validate
@@ -48,11 +96,25 @@ public:
     static NormalValidationResult validateNormals(const TopoDS_Shape& shape, const std::string& shapeName = "Unknown");
     
     /**
-     * @brief Validate normals for multiple geometries
+     * @brief Validate normals for multiple geometries in parallel
      * @param geometries Vector of geometries to validate
+     * @param progress Optional per-geometry result callback
+     * @param cancel Optional cancellation flag
      * @return Combined validation result
      */
-    static NormalValidationResult validateNormals(const std::vector<std::shared_ptr<class OCCGeometry>>& geometries);
+    static NormalValidationResult validateNormals(const std::vector<std::shared_ptr<class OCCGeometry>>& geometries,
+        ProgressCallback progress = nullptr, const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief Compute corrected shapes for geometries in parallel
+     *
+     * Geometries are left untouched; only those whose quality score is below
+     * the threshold and that have faces to reverse are returned, so the caller
+     * can apply the new shapes on the UI thread.
+     * @param qualityThreshold Geometries scoring at or above this are skipped
+     */
+    static std::vector<NormalCorrection> correctNormals(const std::vector<std::shared_ptr<class OCCGeometry>>& geometries,
+        double qualityThreshold = 1.0, ProgressCallback progress = nullptr, const std::atomic<bool>* cancel = nullptr);
     
     /**
      * @brief Automatically correct normals for a shape
@@ -115,13 +177,18 @@ private:
     static void generateRecommendations(NormalValidationResult& result);
     
     /**
-     * @brief Correct face normals for a shape
+     * @brief Reverse the faces selected by an orientation analysis
      * @param shape The shape to correct
-     * @param shapeCenter Center of the shape
+     * @param analysis Result of analyzeOrientation for this shape
      * @param shapeName Name for logging
-     * @return Corrected shape
+     * @return Corrected shape; shells without reversed faces are shared with the input
+     */
+    static TopoDS_Shape correctFaceNormals(const TopoDS_Shape& shape, const NormalOrientationAnalysis& analysis, const std::string& shapeName);
+
+    /**
+     * @brief Fill face counts, metrics and recommendations from an orientation analysis
      */
-    static TopoDS_Shape correctFaceNormals(const TopoDS_Shape& shape, const gp_Pnt& shapeCenter, const std::string& shapeName);
+    static NormalValidationResult resultFromAnalysis(const NormalOrientationAnalysis& analysis);
     
     /**
      * @brief Reverse a face orientation
@@ -133,7 +200,7 @@ private:
     /**
      * @brief Rebuild shape with corrected faces
      * @param originalShape The original shape
-     * @param correctedFaces Vector of corrected faces
+     * @param correctedFaces Faces of the original shape to replace by their reversed copies
      * @return Rebuilt shape
      */
     static TopoDS_Shape rebuildShapeWithCorrectedFaces(const TopoDS_Shape& originalShape, const std::vector<TopoDS_Face>& correctedFaces);
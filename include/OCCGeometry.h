@@ -10,6 +10,7 @@
 #include "GeometryDialogTypes.h"
 #include <string>
 #include <memory>
+#include <functional>
 
 /**
  * @brief Unified geometry class combining all geometry modules
@@ -47,6 +48,15 @@ public:
     // Override wireframe mode to trigger mesh rebuild
     virtual void setWireframeMode(bool wireframe) override;
 
+    // World-space axis-aligned bounds: cached local bounds with the current
+    // position/rotation/scale applied. Returns false for empty geometry.
+    bool getWorldBounds(gp_Pnt& min, gp_Pnt& max) const;
+
+    // Called after the shape or transform changed, so the owner can refresh
+    // the scene bounds. Set by the scene while the geometry is attached.
+    using BoundsChangedCallback = std::function<void(const OCCGeometry& geometry)>;
+    void setBoundsChangedCallback(BoundsChangedCallback callback) { m_boundsChanged = std::move(callback); }
+
     // Coin3D integration - delegated to GeomCoinRepresentation
     using GeomCoinRepresentation::getCoinNode;
     using GeomCoinRepresentation::setCoinNode;
@@ -58,6 +68,7 @@ public:
     bool hasIntersectionNodes() const;
     using GeomCoinRepresentation::needsMeshRegeneration;
     using GeomCoinRepresentation::setMeshRegenerationNeeded;
+    using GeomCoinRepresentation::getLastMeshParameters;
     using GeomCoinRepresentation::updateWireframeMaterial;
     // Override updateDisplayMode to pass original color
     void updateDisplayMode(RenderingConfig::DisplayMode mode);
@@ -126,6 +137,9 @@ public:
     using GeomCoinRepresentation::getTrianglesForGeometryFace;
     using GeomCoinRepresentation::hasFaceDomainMapping;
     using GeomCoinRepresentation::hasFaceIndexMapping; // For compatibility
+    using GeomCoinRepresentation::getFaceLookupIndex;
+    using GeomCoinRepresentation::setLODSourceTriangles;
+    using GeomCoinRepresentation::resolveLODTriangle;
     void buildFaceIndexMapping(const MeshParameters& params = MeshParameters());
 
     // Assembly level
@@ -141,6 +155,14 @@ public:
     using GeomCoinRepresentation::optimizeMemory;
 
 private:
+    // Local bounds cache, invalidated whenever the shape changes
+    bool computeLocalBounds() const;
+    mutable bool m_localBoundsValid{false};
+    mutable gp_Pnt m_localMin;
+    mutable gp_Pnt m_localMax;
+    void notifyBoundsChanged();
+    BoundsChangedCallback m_boundsChanged;
+
     // Subdivision settings (legacy compatibility)
     bool m_subdivisionEnabled{false};
     int m_subdivisionLevels{2};
@@ -7,6 +7,7 @@
 #include <OpenCASCADE/gp_Pnt.hxx>
 #include <OpenCASCADE/gp_Vec.hxx>
 #include <OpenCASCADE/gp_Dir.hxx>
+#include <OpenCASCADE/Message_ProgressRange.hxx>
 
 // Forward declarations for OpenCASCADE geometry classes
 class Geom_BezierCurve;
@@ -77,14 +78,19 @@ public:
 	static TopoDS_Shape createLoft(const std::vector<TopoDS_Shape>& profiles, bool solid = true);
 	static TopoDS_Shape createPipe(const TopoDS_Shape& profile, const TopoDS_Shape& spine);
 
-	// Boolean operations
-	static TopoDS_Shape booleanUnion(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2);
-	static TopoDS_Shape booleanIntersection(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2);
-	static TopoDS_Shape booleanDifference(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2);
+	// Boolean operations; the range reports progress and lets the caller abort the operation
+	static TopoDS_Shape booleanUnion(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2,
+		const Message_ProgressRange& range = Message_ProgressRange());
+	static TopoDS_Shape booleanIntersection(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2,
+		const Message_ProgressRange& range = Message_ProgressRange());
+	static TopoDS_Shape booleanDifference(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2,
+		const Message_ProgressRange& range = Message_ProgressRange());
 
 	// Filleting and chamfering
-	static TopoDS_Shape createFillet(const TopoDS_Shape& shape, double radius);
-	static TopoDS_Shape createChamfer(const TopoDS_Shape& shape, double distance);
+	static TopoDS_Shape createFillet(const TopoDS_Shape& shape, double radius,
+		const Message_ProgressRange& range = Message_ProgressRange());
+	static TopoDS_Shape createChamfer(const TopoDS_Shape& shape, double distance,
+		const Message_ProgressRange& range = Message_ProgressRange());
 
 	// Transform operations
 	static TopoDS_Shape translate(const TopoDS_Shape& shape, const gp_Vec& translation);
@@ -3,6 +3,7 @@
 #include "OCCGeometry.h"
 #include "rendering/GeometryProcessor.h"
 #include "ViewRefreshManager.h"
+#include "ProgressiveRefinement.h"
 #include <vector>
 #include <memory>
 #include <wx/wx.h>
@@ -42,6 +43,9 @@ class ViewOperationsService;
 class GeometryFactoryService;
 class ConfigurationManager;
 class MeshQualityService;
+class MeshLODService;
+class ShapeBuildService;
+class RetessellationService;
 #include <unordered_map>
 #include <atomic>
 #include <thread>
@@ -100,8 +104,10 @@ public:
 	void addGeometry(std::shared_ptr<OCCGeometry> geometry) override;
 	void removeGeometry(std::shared_ptr<OCCGeometry> geometry) override;
 	void removeGeometry(const std::string& name) override;
+	void removeGeometries(const std::vector<std::shared_ptr<OCCGeometry>>& geometries) override;
 	void clearAll() override;
 	std::shared_ptr<OCCGeometry> findGeometry(const std::string& name) override;
+	std::vector<std::shared_ptr<OCCGeometry>> findGeometriesByFile(const std::string& fileName) override;
 	std::vector<std::shared_ptr<OCCGeometry>> getAllGeometry() const override;
 	std::vector<std::shared_ptr<OCCGeometry>> getSelectedGeometries() const override;
 
@@ -129,6 +135,10 @@ public:
 	void fitAll() override;
 	void fitGeometry(const std::string& name) override;
 
+	// Re-register world bounds after a geometry's transform changed
+	void updateGeometryBounds(const std::shared_ptr<OCCGeometry>& geometry);
+	void updateAllGeometryBounds();
+
 	// Picking
 	std::shared_ptr<OCCGeometry> pickGeometry(int x, int y);
 
@@ -166,6 +176,9 @@ public:
 	void setLODMode(bool roughMode) override;
 	bool isLODRoughMode() const override;
 	void startLODInteraction() override;
+	// Progressive refinement: swap in stale meshes rebuilt in the background, within budgetMs
+	bool isProgressiveRefinementEnabled() const;
+	ProgressiveRefinement::RefineResult refineTessellationStep(double budgetMs);
 
 	// Subdivision surface control
 	void setSubdivisionEnabled(bool enabled) override;
@@ -373,6 +386,8 @@ public:
 	gp_Pnt getCameraPosition() const override;
 	SoSeparator* getRootSeparator() const { return m_occRoot; }
 	PickingService* getPickingService() const { return m_pickingService.get(); }
+	// Background shape construction for GeometryFactory
+	ShapeBuildService* getShapeBuildService() const { return m_shapeBuildService.get(); }
 
 	// Hover silhouette API (screen-space driven)
 	void updateHoverSilhouetteAt(const wxPoint& screenPos);
@@ -411,6 +426,12 @@ private:
 	// LOD settings (controller-backed)
 	bool m_lodEnabled = false;
 	std::unique_ptr<LODController> m_lodController;
+	// Decimated LOD chains for mesh-only geometries
+	std::unique_ptr<MeshLODService> m_meshLODService;
+	// Shapes built on worker threads and committed on the UI thread
+	std::unique_ptr<ShapeBuildService> m_shapeBuildService;
+	// Fine tessellation for progressive refinement, meshed on worker threads
+	std::unique_ptr<RetessellationService> m_retessellationService;
 
 	// Structured configuration objects (now managed by ConfigurationManager)
 	// Removed: SubdivisionConfig m_subdivisionConfig;
@@ -463,6 +484,7 @@ private:
 	ExplodeParams m_explodeParams{};
 	void applyExplode();
 	void clearExplode();
+	void syncBatchedEdgePlacement();   // explode moves geometries between updateAll passes
 
 	// Slice controller (encapsulated)
 	std::unique_ptr<SliceController> m_sliceController;
@@ -9,6 +9,8 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 #include "GeometryObject.h"
 #include "PropertyPanel.h"
 #include "OCCGeometry.h"
@@ -96,73 +98,90 @@ private:
 	// Map geometry -> feature item (leaf; used for selection)
 	std::map<std::shared_ptr<OCCGeometry>, std::shared_ptr<FlatTreeItem>> m_occGeometryMap; // feature leaf
 	std::map<std::shared_ptr<OCCGeometry>, std::shared_ptr<FlatTreeItem>> m_occGeometryBodyMap; // body container
-	std::map<std::shared_ptr<FlatTreeItem>, std::shared_ptr<OCCGeometry>> m_treeItemToOCCGeometry; // reverse
+	std::unordered_map<uint64_t, std::shared_ptr<OCCGeometry>> m_itemIdToOCCGeometry; // reverse, by stable item id
 
 	// File-based organization
 	std::map<wxString, std::shared_ptr<FlatTreeItem>> m_fileNodeMap; // filename -> file node
+	std::unordered_map<uint64_t, wxString> m_fileNodeIdToName; // reverse, by stable item id
 	
-	// Tree data structure for efficient updates
+	// Tree data structure for incremental updates: added and removed geometries
+	// are queued as a diff and applied to the tree items in one pass
 	struct TreeDataStructure {
 		std::map<wxString, std::vector<std::shared_ptr<OCCGeometry>>> fileGroups;
 		std::vector<std::shared_ptr<OCCGeometry>> ungroupedGeometries;
-		bool needsUpdate;
+		std::unordered_set<const OCCGeometry*> members;
+		std::unordered_set<const OCCGeometry*> staleEntries;  // removed, still in the groups until compacted
+		std::vector<std::shared_ptr<OCCGeometry>> pendingAdded;
+		std::vector<std::shared_ptr<OCCGeometry>> pendingRemoved;
+		bool needsUpdate;        // full rebuild of the tree items
+		bool needsCompaction;    // removed geometries still sit in the groups
 		
-		TreeDataStructure() : needsUpdate(false) {}
+		TreeDataStructure() : needsUpdate(false), needsCompaction(false) {}
 		
 		void clear() {
 			fileGroups.clear();
 			ungroupedGeometries.clear();
+			members.clear();
+			staleEntries.clear();
+			pendingAdded.clear();
+			pendingRemoved.clear();
 			needsUpdate = true;
+			needsCompaction = false;
+		}
+
+		bool contains(const std::shared_ptr<OCCGeometry>& geometry) const {
+			return geometry && members.count(geometry.get()) > 0;
+		}
+
+		bool hasPendingChanges() const {
+			return needsUpdate || !pendingAdded.empty() || !pendingRemoved.empty();
 		}
 		
 		void addGeometry(std::shared_ptr<OCCGeometry> geometry) {
-			if (!geometry) return;
+			if (!geometry || members.count(geometry.get()) > 0) return;
+			// A geometry removed and added back before compaction would otherwise sit in its
+			// old group as well, possibly under a different file name
+			if (staleEntries.count(geometry.get()) > 0) compact();
+			members.insert(geometry.get());
 			
-			// Check for duplicates in file groups
 			std::string fileName = geometry->getFileName();
 			if (!fileName.empty()) {
-				auto& group = fileGroups[fileName];
-				// Check if geometry already exists in this file group
-				if (std::find(group.begin(), group.end(), geometry) == group.end()) {
-					group.push_back(geometry);
-					needsUpdate = true;
-				}
+				fileGroups[fileName].push_back(geometry);
 			} else {
-				// Check if geometry already exists in ungrouped geometries
-				if (std::find(ungroupedGeometries.begin(), ungroupedGeometries.end(), geometry) == ungroupedGeometries.end()) {
-					ungroupedGeometries.push_back(geometry);
-					needsUpdate = true;
-				}
+				ungroupedGeometries.push_back(geometry);
 			}
+			pendingAdded.push_back(geometry);
 		}
 		
 		void removeGeometry(std::shared_ptr<OCCGeometry> geometry) {
-			if (!geometry) return;
+			if (!geometry || members.erase(geometry.get()) == 0) return;
 			
-			std::string fileName = geometry->getFileName();
-			if (!fileName.empty()) {
-				auto it = fileGroups.find(fileName);
-				if (it != fileGroups.end()) {
-					auto& geometries = it->second;
-					geometries.erase(std::remove(geometries.begin(), geometries.end(), geometry), geometries.end());
-					if (geometries.empty()) {
-						fileGroups.erase(it);
-					}
-				}
-			} else {
-				ungroupedGeometries.erase(std::remove(ungroupedGeometries.begin(), ungroupedGeometries.end(), geometry), ungroupedGeometries.end());
-			}
-			needsUpdate = true;
+			// Groups are compacted in one pass before the diff is applied
+			pendingRemoved.push_back(geometry);
+			staleEntries.insert(geometry.get());
+			needsCompaction = true;
 		}
-		
-		void updateGeometry(std::shared_ptr<OCCGeometry> geometry) {
-			// For now, just mark as needing update
-			// In the future, we could implement more sophisticated change tracking
-			needsUpdate = true;
+
+		void compact() {
+			if (!needsCompaction) return;
+			auto removed = [this](const std::shared_ptr<OCCGeometry>& g) { return !g || members.count(g.get()) == 0; };
+			for (auto it = fileGroups.begin(); it != fileGroups.end();) {
+				auto& geometries = it->second;
+				geometries.erase(std::remove_if(geometries.begin(), geometries.end(), removed), geometries.end());
+				it = geometries.empty() ? fileGroups.erase(it) : std::next(it);
+			}
+			ungroupedGeometries.erase(std::remove_if(ungroupedGeometries.begin(), ungroupedGeometries.end(), removed),
+				ungroupedGeometries.end());
+			staleEntries.clear();
+			needsCompaction = false;
 		}
 	};
 	
 	TreeDataStructure m_treeData;
+	bool m_refreshPending;
+
+	// File nodes with more geometries than this get their children on first expand
+	static constexpr size_t kLazyFileNodeThreshold = 500;
 
 	// Column indices for treelist actions
 	enum Columns { COL_VISIBILITY = 1, COL_DELETE = 2, COL_COLOR = 3, COL_PROPERTIES = 4 };
@@ -194,6 +213,11 @@ private:
 	// Helper methods for OCCGeometry hierarchy management
 	void removeOCCGeometryRecursive(std::shared_ptr<OCCGeometry> geometry);
 	std::shared_ptr<FlatTreeItem> getOrCreateFileNode(const wxString& fileName);
+	void applyTreeDiff();
+	void removeFileNode(const wxString& fileName);
+	void loadFileNodeChildren(FlatTreeItem& fileNode, const wxString& fileName);
+	std::shared_ptr<FlatTreeItem> findGeometryItem(const std::shared_ptr<OCCGeometry>& geometry, bool materialize);
+	void scheduleTreeRefresh();
 	std::shared_ptr<OCCGeometry> findNextGeometryForSelection(std::shared_ptr<OCCGeometry> currentGeometry);
 
 	// File node batch operations
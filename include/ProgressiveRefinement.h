@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <wx/event.h>
+#include <wx/timer.h>
+
+/**
+ * @brief Progressive refinement state for the main view
+ *
+ * While the camera moves the scene is drawn as a coarse proxy (no edge/point
+ * overlays, single pass, unsorted transparency, bounding boxes when even that
+ * exceeds the frame budget). Once input stops, each rendered frame adds one
+ * refinement stage. Fine retessellation runs in the background; between frames
+ * only finished meshes are swapped in, within the frame budget. Any new input
+ * drops straight back to the interactive stage and abandons background work.
+ */
+class ProgressiveRefinement : public wxEvtHandler {
+public:
+	enum class Stage {
+		Interactive,       // coarse proxy while the camera moves
+		Shaded,            // full meshes, no overlays, single pass
+		Detailed,          // edge/point overlays and sorted transparency
+		Antialiased,       // smoothing and multi-pass rendering
+		FineTessellation,  // fine meshes built in the background, swapped in between frames
+		Complete
+	};
+
+	enum class RefineResult {
+		Done,       // nothing left to refine
+		MoreWork,   // call again after the next frame
+		Waiting     // meshes are being built in the background; the builder requests a frame when they are ready
+	};
+
+	// Installs finished meshes within budgetMs and starts background work for the rest
+	using RefineStep = std::function<RefineResult(double budgetMs)>;
+	// New input or disabling: background refinement is no longer wanted
+	using AbandonRefine = std::function<void()>;
+	// Asks the view for another frame
+	using FrameRequest = std::function<void()>;
+
+	ProgressiveRefinement();
+	~ProgressiveRefinement();
+
+	void setEnabled(bool enabled);
+	bool isEnabled() const { return m_enabled; }
+
+	// Input arrived: abandon refinement and render the coarse proxy
+	void beginInteraction();
+	// Called after every rendered frame with the scene render time
+	void frameRendered(double frameMs);
+	// Mesh parameters changed while idle: rerun the retessellation stage
+	void requestRetessellation();
+
+	Stage getStage() const { return m_stage; }
+	bool isInteractive() const { return m_enabled && m_stage == Stage::Interactive; }
+
+	// Render settings for the current stage (full quality when disabled)
+	bool showOverlays() const { return !m_enabled || m_stage >= Stage::Detailed; }
+	bool useSortedTransparency() const { return !m_enabled || m_stage >= Stage::Detailed; }
+	bool useAntialiasing() const { return !m_enabled || m_stage >= Stage::Antialiased; }
+	bool useBoundingBoxProxy() const;
+
+	void setFrameBudget(double milliseconds) { m_frameBudgetMs = milliseconds; }
+	double getFrameBudget() const { return m_frameBudgetMs; }
+
+	void setIdleDelay(int milliseconds) { m_idleDelayMs = milliseconds; }
+	int getIdleDelay() const { return m_idleDelayMs; }
+
+	void setRefineStep(RefineStep step) { m_refineStep = std::move(step); }
+	void setAbandonRefine(AbandonRefine abandon) { m_abandonRefine = std::move(abandon); }
+	void setFrameRequest(FrameRequest request) { m_frameRequest = std::move(request); }
+
+private:
+	void onIdleTimer(wxTimerEvent& event);
+	void runRefineStep();
+	void advanceTo(Stage stage);
+
+private:
+	bool m_enabled{ true };
+	Stage m_stage{ Stage::Complete };
+
+	double m_frameBudgetMs{ 16.0 };
+	int m_idleDelayMs{ 150 };
+
+	// Cost of the last full-mesh, overlay-free frame; decides whether the
+	// interactive stage must fall back to bounding boxes
+	double m_meshFrameMs{ 0.0 };
+	bool m_stepPending{ false };
+
+	wxTimer m_idleTimer;
+	RefineStep m_refineStep;
+	AbandonRefine m_abandonRefine;
+	FrameRequest m_frameRequest;
+};
@@ -4,6 +4,7 @@
 #include <string>
 #include <OpenCASCADE/Quantity_Color.hxx>
 #include "STEPReader.h"
+#include "STEPPreScanner.h"
 
 // Forward declarations
 class STEPControl_Reader;
@@ -41,6 +42,14 @@ public:
     static STEPReader::STEPAssemblyInfo buildAssemblyStructure(
         const STEPControl_Reader& reader);
 
+    /**
+     * @brief Build assembly structure from a pre-scan, without any transfer
+     * @param scan Result of STEPPreScanner::scan
+     * @return Product tree with names and entity IDs; shapes are left null
+     */
+    static STEPReader::STEPAssemblyInfo buildAssemblyStructure(
+        const STEPPreScanner::ScanResult& scan);
+
     /**
      * @brief Extract entity information from STEP model
      * @param reader The STEP reader instance
@@ -97,6 +106,8 @@ private:
      * @return Description or empty string
      */
     static std::string extractEntityDescription(const Handle(Standard_Transient)& entity);
+    static void appendScannedProduct(const STEPPreScanner::ScanResult& scan, size_t productIndex,
+        STEPReader::STEPAssemblyInfo& assembly, std::vector<bool>& onPath);
     static void processComponent(const TopoDS_Shape& shape, const std::string& componentName,
         int componentIndex, std::vector<std::shared_ptr<OCCGeometry>>& geometries,
         std::vector<STEPReader::STEPEntityInfo>& entityMetadata);
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Lexical pre-scan of a STEP (ISO 10303-21) file without an OCCT transfer
+ *
+ * Streams the file once in large chunks, splitting it into instances at the
+ * top-level semicolons while skipping strings and comments. Only the few
+ * instance types needed for a structure preview are parsed; every other
+ * instance is just counted by type. The result holds the header, the length
+ * unit, the product tree built from NEXT_ASSEMBLY_USAGE_OCCURRENCE, the shape
+ * representations and a per-product complexity estimate, all with byte
+ * offsets into the file. Memory use depends on the number of products and
+ * shells, not on the file size.
+ */
+class STEPPreScanner {
+public:
+    using ProgressCallback = std::function<void(int /*percent*/, const std::string& /*stage*/)>;
+
+    /**
+     * @brief Contents of the HEADER section
+     */
+    struct HeaderInfo {
+        std::vector<std::string> description;
+        std::string implementationLevel;
+        std::string fileName;
+        std::string timeStamp;
+        std::vector<std::string> authors;
+        std::vector<std::string> organizations;
+        std::string preprocessorVersion;
+        std::string originatingSystem;
+        std::string authorization;
+        std::vector<std::string> schemas;
+    };
+
+    /**
+     * @brief Shape representation and the geometry reachable through its items
+     */
+    struct RepresentationInfo {
+        int entityId = 0;
+        uint64_t offset = 0;
+        std::string type;
+        std::string name;
+        std::vector<int> items;
+        size_t solidCount = 0;
+        size_t faceCount = 0;   // Faces of the shells reachable from the items
+    };
+
+    /**
+     * @brief PRODUCT together with its definition and estimated import cost
+     */
+    struct ProductInfo {
+        int entityId = 0;
+        uint64_t offset = 0;
+        std::string id;
+        std::string name;
+        std::string description;
+        int definitionId = 0;                   // PRODUCT_DEFINITION, 0 if none
+        std::vector<size_t> representations;    // Indices into ScanResult::representations
+        std::vector<size_t> occurrences;        // Indices into ScanResult::occurrences where this is the parent
+        size_t instanceCount = 0;               // Times it is placed in a parent
+        size_t solidCount = 0;
+        size_t faceCount = 0;
+        uint64_t estimatedBytes = 0;            // Approximate share of the DATA section
+    };
+
+    /**
+     * @brief NEXT_ASSEMBLY_USAGE_OCCURRENCE placing one product in another
+     */
+    struct OccurrenceInfo {
+        int entityId = 0;
+        uint64_t offset = 0;
+        std::string id;
+        std::string name;
+        size_t parent = 0;  // Indices into ScanResult::products
+        size_t child = 0;
+    };
+
+    struct ScanResult {
+        bool success = false;
+        std::string errorMessage;
+        HeaderInfo header;
+
+        std::string lengthUnit;             // Unit assigned by the representation context, e.g. "millimetre" or "INCH"; empty if not found
+        double lengthUnitInMillimetres = 0.0;
+
+        uint64_t fileSize = 0;
+        uint64_t dataOffset = 0;            // Start and end of the DATA section
+        uint64_t dataEnd = 0;
+        size_t entityCount = 0;
+        std::unordered_map<std::string, size_t> entityCounts;  // Per type; complex instances by first type
+
+        std::vector<ProductInfo> products;
+        std::vector<OccurrenceInfo> occurrences;
+        std::vector<RepresentationInfo> representations;
+        std::vector<size_t> rootProducts;   // Products that are not placed in any other
+
+        double scanTime = 0.0;              // Milliseconds
+    };
+
+    /**
+     * @brief Scan the file
+     * @param progress Optional callback, called once per chunk read
+     */
+    static ScanResult scan(const std::string& filePath, ProgressCallback progress = nullptr);
+
+    /**
+     * @brief The product and every product below it, each listed once
+     */
+    static std::vector<size_t> collectSubtree(const ScanResult& result, size_t productIndex);
+
+    /**
+     * @brief Summed estimate over a subtree, counting each product's geometry once
+     */
+    static uint64_t estimateSubtreeBytes(const ScanResult& result, size_t productIndex);
+};
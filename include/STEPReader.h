@@ -17,6 +17,7 @@
 #include <OpenCASCADE/Bnd_Box.hxx>
 #include "OCCGeometry.h"
 #include "GeometryReader.h"
+#include "STEPPreScanner.h"
 
 // Forward declarations
 class STEPControl_Reader;
@@ -289,10 +290,12 @@ private:
 	/**
 	 * @brief Extract metadata from STEP file
 	 * @param reader The STEP reader instance
+	 * @param scan Pre-scan of the same file; its product tree is used when it succeeded
 	 * @param result ReadResult to store metadata
 	 * @param progress Progress callback
 	 */
-	static void extractMetadata(const STEPControl_Reader& reader, ReadResult& result, ProgressCallback progress);
+	static void extractMetadata(const STEPControl_Reader& reader, const STEPPreScanner::ScanResult& scan,
+		ReadResult& result, ProgressCallback progress);
 
 	/**
 	 * @brief Try to read file with CAF reader for enhanced color/material support
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Inventor/SbBox3f.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Incrementally maintained union of per-object world AABBs
+ *
+ * Objects are stored as leaves of a complete binary tree whose inner nodes
+ * hold the union of their children. Insert, update and remove walk one
+ * leaf-to-root path (O(log n)); the scene bounds are the root (O(1)).
+ * No scene traversal and no GL context are needed.
+ */
+class SceneBoundsTree {
+public:
+	SceneBoundsTree();
+
+	// Insert or replace the bounds stored for key
+	void update(const void* key, const SbBox3f& bounds);
+	// Returns false when key was not tracked
+	bool remove(const void* key);
+	void clear();
+
+	bool contains(const void* key) const { return m_slots.find(key) != m_slots.end(); }
+	std::size_t size() const { return m_slots.size(); }
+	bool isEmpty() const { return m_slots.empty(); }
+
+	// Union of all tracked bounds (empty box when nothing is tracked)
+	const SbBox3f& getBounds() const;
+
+	// Incremented whenever the root bounds change
+	uint64_t getVersion() const { return m_version; }
+
+private:
+	void grow();
+	void propagate(std::size_t slot);
+
+	std::size_t m_capacity;                 // leaf count, power of two
+	std::vector<SbBox3f> m_nodes;           // 1-based heap layout, leaves at [m_capacity, 2*m_capacity)
+	std::unordered_map<const void*, std::size_t> m_slots;
+	std::vector<std::size_t> m_freeSlots;
+	std::size_t m_nextSlot;
+	uint64_t m_version;
+	SbBox3f m_emptyBox;
+};
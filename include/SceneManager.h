@@ -13,11 +13,14 @@
 #include "rendering/RenderingToolkitAPI.h"
 #include "interfaces/ISceneManager.h"
 #include "CameraAnimation.h"
+#include "SceneBoundsTree.h"
+#include "ProgressiveRefinement.h"
 
 class Canvas;
 class CoordinateSystemRenderer;
 class PickingAidManager;
 class NavigationCube;
+class SoComplexity;
 class TopoDS_Shape; // Forward declaration for OpenCASCADE
 
 // Forward declaration for PassCallbackState
@@ -59,6 +62,9 @@ public:
 	void resetView(bool animate = false) override;
 	void toggleCameraMode();
 	void setView(const std::string& viewName);
+	// Direction the camera looks along for a named view preset ("Top", "Isometric", ...)
+	static bool getViewDirection(const std::string& viewName, SbVec3f& direction);
+	static std::vector<std::string> getViewNames();
 	void render(const wxSize& size, bool fastMode) override;
 	void updateAspectRatio(const wxSize& size) override;
 	bool screenToWorld(const wxPoint& screenPos, SbVec3f& worldPos);
@@ -70,6 +76,14 @@ public:
 
 	// Scene bounds and coordinate system management
 	void updateSceneBounds();
+
+	// Incremental per-object bounds; updateSceneBounds() reads the tree root
+	// instead of traversing the scene whenever objects are registered here
+	void setObjectBounds(const void* key, const SbBox3f& worldBounds);
+	void removeObjectBounds(const void* key);
+	void clearObjectBounds();
+	const SceneBoundsTree& getBoundsTree() const { return m_boundsTree; }
+
 	float getSceneBoundingBoxSize() const;
 	void updateCoordinateSystemScale();
 	void getSceneBoundingBoxMinMax(SbVec3f& min, SbVec3f& max) const;
@@ -115,6 +129,15 @@ public:
 	bool validateGLContextHealth();
 	void recordRenderTime();
 
+	// Progressive refinement: coarse proxy while the camera moves, refined when idle
+	ProgressiveRefinement* getProgressiveRefinement() const { return m_progressive.get(); }
+	void beginInteraction();
+
+	// Per-frame time budget for deferred updates (at least one update always runs),
+	// initialized from [Canvas] DeferredUpdateBudgetMs
+	void setDeferredUpdateBudget(double milliseconds) { m_deferredUpdateBudgetMs = milliseconds > 0.0 ? milliseconds : 4.0; }
+	double getDeferredUpdateBudget() const { return m_deferredUpdateBudgetMs; }
+
 private:
 	Canvas* m_canvas;
 	SoSeparator* m_sceneRoot;
@@ -126,6 +149,8 @@ private:
 	std::unique_ptr<PickingAidManager> m_pickingAidManager;
 	bool m_isPerspectiveCamera;
 	SbBox3f m_sceneBoundingBox;
+	SceneBoundsTree m_boundsTree;
+	uint64_t m_appliedBoundsVersion = 0;
 
 	// GL context health tracking
 	std::chrono::steady_clock::time_point m_lastRenderTime;
@@ -141,6 +166,10 @@ private:
 	// Camera clipping planes
 	void updateCameraClippingPlanes();
 
+	// Apply new scene bounds to coordinate system, reference grid and clipping planes
+	void applySceneBounds(const SbBox3f& newBounds);
+	SbBox3f computeIncrementalSceneBounds() const;
+
 	// Culling state
 	bool m_cullingEnabled;
 	bool m_lastCullingUpdateValid;
@@ -177,7 +206,7 @@ private:
 	// Public method to invalidate geometry cache (called when geometry changes)
 	void invalidateGeometryCache();
 
-	// Scene bounds optimization
+	// Scene bounds optimization (traversal fallback only, used when no object bounds are registered)
 	int m_boundsUpdateFrameSkip = 0;       // Frame counter for bounds update throttling
 	static constexpr int BOUNDS_UPDATE_INTERVAL = 60; // Update bounds every N frames
 	bool m_forceBoundsUpdate = false;       // Force bounds update flag
@@ -209,4 +238,10 @@ private:
 private:
 	// Deferred update queue
 	std::vector<DeferredUpdate> m_deferredUpdates;
+	double m_deferredUpdateBudgetMs = 4.0;
+
+	// Progressive refinement state and the complexity node used for the bounding-box proxy
+	std::unique_ptr<ProgressiveRefinement> m_progressive;
+	SoComplexity* m_proxyComplexity = nullptr;
+	void applyProxyComplexity();
 };
\ No newline at end of file
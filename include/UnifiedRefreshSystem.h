@@ -40,7 +40,8 @@ public:
     void refreshUI(const std::string& componentType = "", bool immediate = false);
 
     // Direct refresh methods (for backwards compatibility)
-    void directRefreshView(ViewRefreshManager::RefreshReason reason = ViewRefreshManager::RefreshReason::MANUAL_REQUEST);
+    void directRefreshView(ViewRefreshManager::RefreshReason reason = ViewRefreshManager::RefreshReason::MANUAL_REQUEST,
+                           const std::string& objectId = "");
     void directRefreshAll();
 
     // Getters
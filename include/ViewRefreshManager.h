@@ -1,6 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <string>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 #include <wx/timer.h>
@@ -11,7 +15,9 @@ class Canvas;
 /**
  * @brief View refresh manager with listener mechanism
  *
- * Provides centralized view refresh management with debouncing and listener pattern
+ * Provides centralized view refresh management with debouncing and listener pattern.
+ * All requests are coalesced: reasons are merged into a bitmask and dirty objects
+ * into a set, and at most one canvas refresh is issued per frame interval.
  */
 class ViewRefreshManager : public wxEvtHandler, public IViewRefresher {
 public:
@@ -25,11 +31,23 @@ public:
 		SELECTION_CHANGED,
 		RENDERING_CHANGED,
 		LIGHTING_CHANGED,
-		MANUAL_REQUEST
+		MANUAL_REQUEST,
+		SCENE_CHANGED,
+		OBJECT_CHANGED,
+		UI_CHANGED
 	};
 
 	using RefreshListener = std::function<void(RefreshReason reason)>;
 
+	/**
+	 * @brief Scheduler counters, used to verify how many redraws coalescing saves
+	 */
+	struct RefreshStats {
+		uint64_t requestedFrames = 0;   // requestRefresh calls accepted
+		uint64_t issuedRefreshes = 0;   // canvas refreshes issued after coalescing
+		uint64_t renderedFrames = 0;    // frames actually painted by the canvas
+	};
+
 public:
 	explicit ViewRefreshManager(Canvas* canvas);
 	~ViewRefreshManager();
@@ -37,23 +55,37 @@ public:
 	// Request refresh with optional debouncing
 	void requestRefresh(RefreshReason reason = RefreshReason::MANUAL_REQUEST, bool immediate = false);
 	// IViewRefresher
-	void requestRefresh(IViewRefresher::Reason reason, bool immediate) override {
-		requestRefresh(static_cast<RefreshReason>(reason), immediate);
-	}
+	void requestRefresh(IViewRefresher::Reason reason, bool immediate) override;
+	// Request refresh and mark one object dirty; listeners can query getDirtyObjects()
+	void requestObjectRefresh(const std::string& objectId, RefreshReason reason = RefreshReason::OBJECT_CHANGED,
+		bool immediate = false);
+
+	// Called by the canvas after each painted frame
+	void notifyFrameRendered();
 
 	// Listener management
 	void addRefreshListener(RefreshListener listener);
 	void removeAllListeners();
 
-	// Configuration
+	// Objects marked dirty for the refresh being dispatched (valid inside listeners)
+	const std::unordered_set<std::string>& getDirtyObjects() const { return m_flushingObjects; }
+
+	// Configuration; the debounce time is also the minimum interval between two refreshes
 	void setDebounceTime(int milliseconds) { m_debounceTime = milliseconds; }
 	int getDebounceTime() const { return m_debounceTime; }
 
 	void setEnabled(bool enabled) { m_enabled = enabled; }
 	bool isEnabled() const { return m_enabled; }
 
+	const RefreshStats& getStats() const { return m_stats; }
+	void resetStats() { m_stats = RefreshStats(); }
+
 private:
-	void performRefresh(RefreshReason reason);
+	static uint32_t reasonBit(RefreshReason reason) { return 1u << static_cast<uint32_t>(reason); }
+
+	void schedulePending(bool immediate);
+	void flushPending();
+	void performRefresh(uint32_t reasons);
 	void onDebounceTimer(wxTimerEvent& event);
 
 private:
@@ -61,8 +93,12 @@ private:
 	std::vector<RefreshListener> m_listeners;
 
 	wxTimer m_debounceTimer;
-	RefreshReason m_pendingReason;
+	uint32_t m_pendingReasons;
 	bool m_hasPendingRefresh;
+	std::unordered_set<std::string> m_pendingObjects;
+	std::unordered_set<std::string> m_flushingObjects;
+	std::chrono::steady_clock::time_point m_lastFrameTime;
+	RefreshStats m_stats;
 
 	int m_debounceTime;  // milliseconds
 	bool m_enabled;
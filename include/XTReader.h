@@ -154,8 +154,5 @@ private:
      */
     bool parseLine(const std::string& line, std::vector<TopoDS_Shape>& shapes);
 
-    // Static members for caching
-    static std::unordered_map<std::string, ReadResult> s_cache;
-    static std::mutex s_cacheMutex;
     static bool s_initialized;
 };
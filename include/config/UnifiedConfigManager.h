@@ -6,6 +6,7 @@
 #include <map>
 #include <functional>
 #include <memory>
+#include <set>
 
 class ConfigManager;
 
@@ -51,6 +52,32 @@ struct ConfigCategory {
 
 class UnifiedConfigManager {
 public:
+    using ListenerId = size_t;
+    using ChangeListener = std::function<void(const std::string&)>;
+    using BatchChangeListener = std::function<void(const std::vector<std::string>&)>;
+
+    /**
+     * @brief Groups value changes so listeners hear about them once
+     *
+     * Commits on destruction unless rollback() was called. Transactions nest;
+     * only the outermost one notifies.
+     */
+    class ScopedTransaction {
+    public:
+        explicit ScopedTransaction(UnifiedConfigManager& manager);
+        ~ScopedTransaction();
+
+        void commit();
+        void rollback();
+
+    private:
+        ScopedTransaction(const ScopedTransaction&) = delete;
+        ScopedTransaction& operator=(const ScopedTransaction&) = delete;
+
+        UnifiedConfigManager& m_manager;
+        bool m_finished;
+    };
+
     static UnifiedConfigManager& getInstance();
     
     void initialize(ConfigManager& configManager);
@@ -68,14 +95,40 @@ public:
     // Value access
     std::string getValue(const std::string& key) const;
     bool setValue(const std::string& key, const std::string& value);
+
+    /**
+     * @brief Apply several values in one transaction
+     * @return Number of values accepted
+     */
+    size_t setValues(const std::map<std::string, std::string>& values);
+
+    // Transactions: changes made in between are notified once, on commit
+    void beginTransaction();
+    void commitTransaction();
+    void rollbackTransaction();
+    bool isInTransaction() const { return m_transactionDepth > 0; }
     
     // Validation and conflict checking
     bool validateValue(const std::string& key, const std::string& value, std::string& errorMsg) const;
     std::vector<std::string> checkConflicts(const std::string& key, const std::string& value) const;
     
     // Change listeners
-    void addChangeListener(const std::string& key, std::function<void(const std::string&)> listener);
-    void removeChangeListener(const std::string& key, std::function<void(const std::string&)> listener);
+    /**
+     * @brief Call the listener with the new value whenever the key changes
+     *
+     * Inside a transaction a key changed several times is reported once, with
+     * its final value.
+     */
+    ListenerId addChangeListener(const std::string& key, ChangeListener listener);
+
+    /**
+     * @brief Call the listener once per change or committed transaction with
+     *        all changed keys starting with the prefix ("Section." or "" for all)
+     */
+    ListenerId addBatchChangeListener(const std::string& keyPrefix, BatchChangeListener listener);
+
+    bool removeChangeListener(ListenerId id);
+    void removeChangeListeners(const std::string& key);
     
     // Save and reload
     void save();
@@ -103,13 +156,31 @@ private:
     void registerEdgeConfigItems();
     void registerLoggerConfigItems();
     void registerFontConfigItems();
+    void registerSubsystemListeners();
     std::string determineCategoryFromSection(const std::string& section) const;
     ConfigValueType determineValueType(const std::string& value, const std::string& key) const;
+    void writeToConfigManager(const ConfigItem& item, const std::string& value);
+    void notifyListeners(const std::vector<std::string>& changedKeys);
+
+    struct BatchListenerEntry {
+        ListenerId id;
+        std::string keyPrefix;
+        BatchChangeListener listener;
+    };
     
     ConfigManager* m_configManager;
     std::map<std::string, ConfigCategory> m_categories;
     std::map<std::string, ConfigItem> m_items;
-    std::map<std::string, std::vector<std::function<void(const std::string&)>>> m_listeners;
+    std::map<std::string, std::vector<std::pair<ListenerId, ChangeListener>>> m_listeners;
+    std::vector<BatchListenerEntry> m_batchListeners;
+    std::set<ListenerId> m_activeListeners;  // Lets removal take effect mid-notification
+    ListenerId m_nextListenerId;
+    std::vector<ListenerId> m_subsystemListeners;  // Theme, rendering, lighting and edge refreshes
+
+    // Open transaction state
+    int m_transactionDepth;
+    std::vector<std::string> m_pendingKeys;                  // In order of first change
+    std::map<std::string, std::string> m_transactionOriginals;  // Values before the first change
 };
 
 #endif // UNIFIED_CONFIG_MANAGER_H
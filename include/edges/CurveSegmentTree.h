@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+#include <OpenCASCADE/Geom_Curve.hxx>
+#include <OpenCASCADE/gp_Pnt.hxx>
+#include <OpenCASCADE/Standard_Real.hxx>
+
+/**
+ * @brief Bounding volume hierarchy over the parameter spans of one curve
+ *
+ * The curve is cut into spans (one for a line, a few per quarter turn for
+ * conics, more for free-form curves). Each leaf box holds its span including
+ * the chord deviation, and inner nodes merge neighbouring spans. Two trees are
+ * intersected by descending only into overlapping boxes; every overlapping
+ * leaf pair is seeded from the closest points of the two chords and refined
+ * with Newton iterations on the exact curves. The work therefore follows the
+ * number of real candidates instead of the sampling density.
+ */
+class CurveSegmentTree {
+public:
+    /**
+     * @brief Point where two curves come within tolerance
+     */
+    struct Hit {
+        Standard_Real param1;
+        Standard_Real param2;
+        gp_Pnt point;      // Midpoint of the two closest curve points
+        double distance;   // Distance between the curves at the hit
+    };
+
+    CurveSegmentTree() = default;
+
+    /**
+     * @brief Build the hierarchy for the curve over [first, last]
+     * @return False if the curve is null or the range is empty
+     */
+    bool build(const Handle(Geom_Curve)& curve, Standard_Real first, Standard_Real last);
+
+    bool isEmpty() const { return m_nodes.empty(); }
+    size_t getSpanCount() const { return (m_nodes.size() + 1) / 2; }
+
+    /**
+     * @brief Find all places where the two curves are closer than tolerance
+     *
+     * Hits closer than tolerance to each other are merged. Stretches where the
+     * curves run along each other only report their end points.
+     */
+    static void intersect(const CurveSegmentTree& a, const CurveSegmentTree& b,
+                          double tolerance, std::vector<Hit>& hits);
+
+private:
+    struct Box {
+        double min[3];
+        double max[3];
+
+        void set(const gp_Pnt& point);
+        void add(const gp_Pnt& point);
+        void add(const Box& other);
+        void enlarge(double margin);
+        bool overlaps(const Box& other, double gap) const;
+        double extent() const;
+    };
+
+    struct Node {
+        Box box;
+        Standard_Real t0, t1;  // Parameter span
+        gp_Pnt p0, p1;         // Curve points at t0 and t1
+        int left = -1;         // Children; -1 for leaves
+        int right = -1;
+    };
+
+    int buildNode(const std::vector<Node>& spans, size_t begin, size_t end);
+    bool isLeaf(int node) const { return m_nodes[node].left < 0; }
+
+    static bool intersectSpans(const CurveSegmentTree& a, const Node& spanA,
+                               const CurveSegmentTree& b, const Node& spanB,
+                               double tolerance, Hit& hit);
+    static void refine(const CurveSegmentTree& a, const CurveSegmentTree& b,
+                       Standard_Real& t, Standard_Real& s);
+
+    Handle(Geom_Curve) m_curve;
+    Standard_Real m_first = 0.0;
+    Standard_Real m_last = 0.0;
+    std::vector<Node> m_nodes;  // Root at index 0
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include <Inventor/SbLinear.h>
+#include <OpenCASCADE/Quantity_Color.hxx>
+#include "EdgeTypes.h"
+
+class OCCGeometry;
+class SoSeparator;
+class SoMaterial;
+class SoDrawStyle;
+class SoCoordinate3;
+class SoIndexedLineSet;
+
+/**
+ * @brief Merges edge polylines of many geometries into a few shared line sets
+ *
+ * Every combination of edge type and appearance owns one batch: a single
+ * SoCoordinate3/SoIndexedLineSet pair holding world-space polylines of all
+ * geometries drawn that way. Each geometry and edge type owns a contiguous
+ * vertex and index range inside its batch, so hiding, filtering or
+ * highlighting one geometry rewrites only that range. Replacing a geometry's
+ * edges reuses its range when the new data fits, and a batch is compacted
+ * once more than half of it is dead space.
+ */
+class EdgeBatchManager {
+public:
+    struct Appearance {
+        Quantity_Color color{ 0.0, 0.0, 0.0, Quantity_TOC_RGB };
+        double width{ 1.0 };
+        int style{ 0 }; // 0=Solid, 1=Dashed, 2=Dotted, 3=Dash-Dot
+    };
+
+    struct Statistics {
+        size_t batches = 0;
+        size_t ranges = 0;
+        size_t vertices = 0;        // allocated, including dead space
+        size_t liveVertices = 0;
+        size_t compactions = 0;
+    };
+
+    EdgeBatchManager();
+    ~EdgeBatchManager();
+
+    EdgeBatchManager(const EdgeBatchManager&) = delete;
+    EdgeBatchManager& operator=(const EdgeBatchManager&) = delete;
+
+    /**
+     * @brief Root of all batches; attach once below the object root
+     */
+    SoSeparator* getRoot() const { return m_root; }
+
+    /**
+     * @brief Set or replace the edges of one geometry and edge type
+     * @param points Polyline vertices in geometry-local coordinates
+     * @param indices Indices into points, polylines separated by -1
+     * @param placement Local-to-world matrix of the geometry
+     */
+    void setGeometryEdges(const OCCGeometry* geometry, EdgeType type, const Appearance& appearance,
+        std::vector<SbVec3f> points, std::vector<int32_t> indices, const SbMatrix& placement);
+
+    /**
+     * @brief Copy the line set of a per-geometry edge node into the batches
+     * @return false if the node holds no SoCoordinate3/SoIndexedLineSet pair
+     */
+    bool setGeometryEdgesFromNode(const OCCGeometry* geometry, EdgeType type, const Appearance& appearance,
+        SoSeparator* edgeNode, const SbMatrix& placement);
+
+    void removeGeometryEdges(const OCCGeometry* geometry, EdgeType type);
+    void removeGeometry(const OCCGeometry* geometry);
+    bool hasGeometryEdges(const OCCGeometry* geometry, EdgeType type) const;
+
+    // Per-geometry state; each call touches only that geometry's ranges
+    void setGeometryVisible(const OCCGeometry* geometry, bool visible);
+    void setGeometryFiltered(const OCCGeometry* geometry, bool filtered);   // hidden by selected-only mode
+    void setGeometryHighlighted(const OCCGeometry* geometry, bool highlighted);
+    void setGeometryPlacement(const OCCGeometry* geometry, const SbMatrix& placement);
+
+    void setHighlightColor(const Quantity_Color& color);
+    void clear();
+
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Local-to-world matrix matching the geometry's SoTransform
+     */
+    static SbMatrix placementOf(const OCCGeometry& geometry);
+
+private:
+    struct Batch {
+        SoSeparator* root = nullptr;
+        SoMaterial* material = nullptr;
+        SoCoordinate3* coords = nullptr;
+        SoIndexedLineSet* lines = nullptr;
+        size_t usedVertices = 0;     // high-water marks
+        size_t usedIndices = 0;
+        size_t liveVertices = 0;     // capacity owned by live ranges
+        size_t liveIndices = 0;
+    };
+
+    struct Range {
+        Batch* batch = nullptr;
+        size_t firstVertex = 0;
+        size_t vertexCapacity = 0;
+        size_t firstIndex = 0;
+        size_t indexCapacity = 0;
+        std::vector<SbVec3f> localPoints;
+        std::vector<int32_t> localIndices;
+        SbMatrix placement = SbMatrix::identity();
+        bool visible = true;
+        bool filtered = false;
+        bool highlighted = false;
+    };
+
+    using BatchKey = std::tuple<int, uint32_t, int, int>;   // type, packed RGB, width * 100, style
+    using GeometryRanges = std::map<EdgeType, Range>;
+
+    Batch& batchFor(EdgeType type, const Appearance& appearance);
+    void allocate(Batch& batch, Range& range);
+    void release(Range& range);
+    void writeVertices(const Range& range);
+    void writeIndices(const Range& range);
+    void writeMaterials(const Range& range);
+    void compactIfSparse(Batch& batch);
+
+    SoSeparator* m_root = nullptr;
+    Quantity_Color m_highlightColor{ 1.0, 0.6, 0.0, Quantity_TOC_RGB };
+    std::map<BatchKey, std::unique_ptr<Batch>> m_batches;
+    std::unordered_map<const OCCGeometry*, GeometryRanges> m_ranges;
+    size_t m_compactions = 0;
+};
@@ -1,12 +1,19 @@
 #pragma once
 
 #include <vector>
+#include <deque>
 #include <memory>
 #include <atomic>
 #include <thread>
+#include <future>
+#include <cstdint>
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
 #include "EdgeTypes.h"
 #include "OCCGeometry.h"
 #include "edges/ModularEdgeComponent.h"
+#include "edges/EdgeBatchManager.h"
 #include "rendering/GeometryProcessor.h"
 
 class SceneManager;
@@ -16,6 +23,7 @@ class EdgeDisplayManager {
 public:
 	EdgeDisplayManager(SceneManager* sceneManager,
 		std::vector<std::shared_ptr<OCCGeometry>>* geometries);
+	~EdgeDisplayManager();
 
 	// Flags
 	const EdgeDisplayFlags& getFlags() const { return m_flags; }
@@ -62,8 +70,29 @@ public:
 	void setShowIntersectionNodes(bool show, const MeshParameters& meshParams);
 
 	// Update
+	// Only geometries and edge types that are dirty are revisited: types whose flag changed
+	// since the last pass, types marked with markDirty(), and geometries not seen before.
+	// Mesh-derived nodes are built in parallel off the UI thread and attached in
+	// frame-budgeted batches.
 	void updateAll(const MeshParameters& meshParams, bool forceMeshRegeneration = false);
 
+	// Request that the next updateAll revisit an edge type on all or on one geometry
+	void markDirty(EdgeType type);
+	void markDirty(const std::shared_ptr<OCCGeometry>& geometry, EdgeType type);
+
+	// Edge batching: from this many geometries on, original and feature edges of all
+	// geometries are drawn from a few shared line sets instead of one node per geometry
+	void setEdgeBatchingThreshold(size_t geometryCount) { m_batchThreshold = geometryCount; }
+	size_t getEdgeBatchingThreshold() const { return m_batchThreshold; }
+	bool isEdgeBatchingActive() const { return m_edgeBatches != nullptr; }
+	EdgeBatchManager* getEdgeBatchManager() const { return m_edgeBatches.get(); }
+
+	// Push one geometry's visibility, placement and selection into the edge batches right away
+	// instead of waiting for the next updateAll; no-op while batching is off
+	void syncGeometryState(const std::shared_ptr<OCCGeometry>& geometry);
+
+	bool isMeshEdgeGenerationRunning() const { return !m_meshEdgeInFlight.empty() || !m_pendingMeshEdges.empty(); }
+
 	// Edge component switching (for migration)
 	void setUseModularEdgeComponent(bool useModular);
 	bool isUsingModularEdgeComponent() const;
@@ -128,6 +157,36 @@ public:
 		bool highlightIntersectionNodes = false, const Quantity_Color& intersectionNodeColor = Quantity_Color(1.0, 0.0, 0.0, Quantity_TOC_RGB), double intersectionNodeSize = 3.0, IntersectionNodeShape intersectionNodeShape = IntersectionNodeShape::Point);
 
 private:
+	using EdgeTypeMask = uint32_t;
+	static EdgeTypeMask maskOf(EdgeType type) { return 1u << static_cast<uint32_t>(type); }
+	static EdgeTypeMask changedTypes(const EdgeDisplayFlags& before, const EdgeDisplayFlags& after);
+
+	// Mesh-derived edge work for one geometry; the mesh is filled in on a worker thread
+	struct MeshEdgeJob {
+		std::weak_ptr<OCCGeometry> geometry;
+		const OCCGeometry* key{ nullptr };
+		EdgeTypeMask types{ 0 };
+		bool force{ false };
+		uint64_t generation{ 0 };
+		TopoDS_Shape shape;  // Topology copy the worker meshes; the geometry's TShapes stay untouched
+		TriangleMesh mesh;
+	};
+
+	// Types being built for one geometry and the newest job queued for each type;
+	// results of older jobs are dropped instead of overwriting newer edges
+	struct MeshEdgeInFlight {
+		EdgeTypeMask types{ 0 };
+		std::array<uint64_t, static_cast<size_t>(EdgeType::Silhouette) + 1> generations{};
+	};
+
+	void updateBatchingMode();
+	EdgeDisplayFlags componentFlags() const;
+	void syncBatchedEdges(const std::shared_ptr<OCCGeometry>& geometry, EdgeTypeMask dirty);
+
+	void launchMeshEdgeJobs(std::vector<MeshEdgeJob> jobs, const MeshParameters& meshParams);
+	void attachPendingMeshEdges();
+	void requestEdgeRefresh();
+
 	SceneManager* m_sceneManager{ nullptr };
 	std::vector<std::shared_ptr<OCCGeometry>>* m_geometries{ nullptr };
 	EdgeDisplayFlags m_flags{};
@@ -173,4 +232,23 @@ private:
 	// CRITICAL FEATURES: Advanced display modes
 	bool m_showOriginalEdgesForSelectedOnly{ false };  // Show edges only for selected objects
 	bool m_showSilhouetteEdgesOnly{ false };            // Show only outline/contour edges (fast mode, silhouette = outline = contour)
+
+	// Dirty tracking for incremental updateAll
+	EdgeDisplayFlags m_appliedFlags{};
+	EdgeTypeMask m_dirtyTypes{ 0 };
+	std::unordered_map<const OCCGeometry*, EdgeTypeMask> m_dirtyGeometries;
+	std::unordered_map<const OCCGeometry*, std::weak_ptr<OCCGeometry>> m_knownGeometries;  // expired = address reused
+
+	// Parallel mesh-derived edge generation
+	std::unordered_map<const OCCGeometry*, MeshEdgeInFlight> m_meshEdgeInFlight;
+	uint64_t m_meshEdgeGeneration{ 0 };
+	std::deque<MeshEdgeJob> m_pendingMeshEdges;
+	bool m_attachScheduled{ false };
+	std::atomic<bool> m_meshEdgeCancel{ false };
+	std::vector<std::future<void>> m_meshEdgeWorkers;
+	std::shared_ptr<int> m_lifeToken{ std::make_shared<int>(0) };  // expires with this manager
+
+	// Batched original/feature edges; null while per-geometry nodes are used
+	std::unique_ptr<EdgeBatchManager> m_edgeBatches;
+	size_t m_batchThreshold{ 1000 };
 };
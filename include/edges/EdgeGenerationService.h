@@ -41,6 +41,22 @@ public:
 		bool needVerticeNormals,
 		bool needFaceNormals);
 
+	// Triangulation that mesh-derived edges are built from: the cached mesh of
+	// mesh-only geometries, otherwise a conversion of the BRep. Creates no Coin
+	// nodes, so it may run on a worker thread
+	static TriangleMesh buildEdgeMesh(const std::shared_ptr<OCCGeometry>& geom, const MeshParameters& meshParams);
+	// Same for a B-rep; BRepMesh writes into its TShapes, so workers pass a copy
+	static TriangleMesh buildEdgeMesh(const TopoDS_Shape& shape, const MeshParameters& meshParams);
+
+	// Create mesh-derived edge nodes from an already built mesh (UI thread).
+	// With force, existing nodes of the requested types are replaced
+	bool applyMeshDerivedEdges(std::shared_ptr<OCCGeometry>& geom,
+		const TriangleMesh& mesh,
+		bool needMeshEdges,
+		bool needVerticeNormals,
+		bool needFaceNormals,
+		bool force = false);
+
 	// Async intersection computation
 	void computeIntersectionsAsync(
 		std::shared_ptr<OCCGeometry>& geom,
@@ -1,6 +1,13 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
 #include <vector>
+#include <list>
+#include <memory>
+#include <string>
 #include <unordered_map>
 #include <chrono>
 #include <mutex>
@@ -8,25 +15,23 @@
 #include <optional>
 #include <OpenCASCADE/gp_Pnt.hxx>
 #include <OpenCASCADE/TopoDS_Edge.hxx>
+#include <OpenCASCADE/TopoDS_Shape.hxx>
 
 /**
  * @brief Cache for edge geometry to avoid recomputation
  * 
  * Caches extracted edge points AND intersection points to significantly 
  * speed up edge display toggling and intersection detection.
- * Thread-safe singleton implementation.
+ * 
+ * Keys are spread over independently locked shards so concurrent extractors
+ * rarely contend, and point data is shared so hits are copied outside the
+ * lock. Each shard keeps its own LRU order and evicts within its share of the
+ * byte budget. When a persistent directory is set, results are also written
+ * to disk and read back on a miss, so they survive restarts as long as the
+ * key is built from computeShapeHash() rather than object addresses.
  */
 class EdgeGeometryCache {
 public:
-    struct CacheEntry {
-        std::vector<gp_Pnt> points;
-        size_t shapeHash;
-        std::chrono::steady_clock::time_point lastAccess;
-        size_t memoryUsage;
-
-        CacheEntry() : shapeHash(0), memoryUsage(0) {}
-    };
-    
     /**
      * @brief Edge-intersection relationship for incremental updates
      */
@@ -41,24 +46,6 @@ public:
             : edge1Index(i1), edge2Index(i2), intersectionPoint(pt), distance(dist) {}
     };
     
-    /**
-     * @brief Intersection cache entry with additional metadata and edge relationships
-     */
-    struct IntersectionCacheEntry {
-        std::vector<gp_Pnt> intersectionPoints;
-        size_t shapeHash;
-        double tolerance;
-        std::chrono::steady_clock::time_point lastAccess;
-        size_t memoryUsage;
-        double computationTime;  // Track how long it took to compute
-        
-        // NEW: Edge-intersection relationships for incremental updates
-        std::vector<EdgeIntersection> edgeIntersections;  // Which edges produce which intersections
-        std::vector<size_t> edgeHashes;  // Hash of each edge for change detection
-        
-        IntersectionCacheEntry() : shapeHash(0), tolerance(0.0), memoryUsage(0), computationTime(0.0) {}
-    };
-
     static EdgeGeometryCache& getInstance() {
         static EdgeGeometryCache instance;
         return instance;
@@ -129,27 +116,61 @@ public:
     void evictOldEntries(std::chrono::seconds maxAge = std::chrono::seconds(300));
 
     // Statistics
-    size_t getHitCount() const { return m_hitCount; }
-    size_t getMissCount() const { return m_missCount; }
+    size_t getHitCount() const { return m_hitCount.load(std::memory_order_relaxed); }
+    size_t getMissCount() const { return m_missCount.load(std::memory_order_relaxed); }
+    size_t getIntersectionHitCount() const { return m_intersectionHitCount.load(std::memory_order_relaxed); }
+    size_t getIntersectionMissCount() const { return m_intersectionMissCount.load(std::memory_order_relaxed); }
+    size_t getEvictionCount() const { return m_evictionCount.load(std::memory_order_relaxed); }
+    size_t getDiskHitCount() const { return m_diskHitCount.load(std::memory_order_relaxed); }
     double getHitRate() const;
     size_t getCacheSize() const;
-    size_t getTotalMemoryUsage() const;
+    size_t getTotalMemoryUsage() const { return m_totalMemoryUsage.load(std::memory_order_relaxed); }
 
     /**
-     * @brief Estimate memory usage for a vector of points
+     * @brief Set the memory budget shared by all entries (default: 500 MB)
+     * 
+     * Each shard gets an equal share; entries beyond it are evicted least
+     * recently used first.
      */
-    size_t estimateMemoryUsage(const std::vector<gp_Pnt>& points);
+    void setMaxMemoryBytes(size_t maxBytes);
+    size_t getMaxMemoryBytes() const { return m_maxMemoryBytes.load(std::memory_order_relaxed); }
 
     /**
-     * @brief Check if we should evict entries for a new entry
+     * @brief Enable the on-disk store in the given directory; empty disables it
+     * @return False if the directory can't be created
      */
-    bool shouldEvictForNewEntry(size_t newEntrySize);
+    bool setPersistentDirectory(const std::string& directory);
+    std::string getPersistentDirectory() const;
 
     /**
-     * @brief Evict least recently used entry
+     * @brief Delete every file of the on-disk store
      */
-    void evictLRU();
-    
+    void clearPersistentStore();
+
+    /**
+     * @brief Content hash of a shape, stable across sessions
+     * 
+     * Built from the vertex positions, the type and parameter range of
+     * every edge curve and the surface type, parameter box and orientation
+     * of every face, so a reloaded model maps to the same cache keys.
+     */
+    static size_t computeShapeHash(const TopoDS_Shape& shape);
+
+    /**
+     * @brief computeShapeHash() memoized per TShape and location
+     *
+     * Extractors build every lookup key from the content hash, so it is
+     * computed once per shape rather than on every extraction. Like the
+     * feature edge classification cache, this relies on edits producing
+     * new TShapes.
+     */
+    size_t getShapeHash(const TopoDS_Shape& shape);
+
+    /**
+     * @brief Estimate memory usage for a vector of points
+     */
+    size_t estimateMemoryUsage(const std::vector<gp_Pnt>& points) const;
+
     /**
      * @brief Result of incremental intersection update
      */
@@ -183,20 +204,84 @@ public:
         std::function<std::vector<gp_Pnt>(const std::vector<size_t>&)> computeFunc);
 
 private:
-    EdgeGeometryCache() : m_hitCount(0), m_missCount(0), m_totalMemoryUsage(0), 
-                          m_intersectionHitCount(0), m_intersectionMissCount(0) {}
+    static constexpr size_t kShardCount = 16;
+
+    using PointsPtr = std::shared_ptr<const std::vector<gp_Pnt>>;
+
+    enum class EntryKind : uint8_t {
+        Edges = 0,
+        Intersections = 1
+    };
+
+    /**
+     * @brief Stored entry; edge points and intersections share one LRU order per shard
+     */
+    struct Entry {
+        PointsPtr points;
+        size_t shapeHash = 0;
+        double tolerance = 0.0;
+        double computationTime = 0.0;
+        size_t memoryUsage = 0;
+        std::chrono::steady_clock::time_point lastAccess;
+        std::vector<EdgeIntersection> edgeIntersections;
+        std::vector<size_t> edgeHashes;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, Entry> entries;  // Keyed by internalKey()
+        std::list<std::string> lru;                      // Most recently used first
+        size_t memoryUsage = 0;
+    };
+
+    EdgeGeometryCache();
     EdgeGeometryCache(const EdgeGeometryCache&) = delete;
     EdgeGeometryCache& operator=(const EdgeGeometryCache&) = delete;
 
-    std::unordered_map<std::string, CacheEntry> m_cache;
-    std::unordered_map<std::string, IntersectionCacheEntry> m_intersectionCache;
-    mutable std::mutex m_mutex;
-    size_t m_hitCount;
-    size_t m_missCount;
-    size_t m_totalMemoryUsage;
-    size_t m_intersectionHitCount;
-    size_t m_intersectionMissCount;
-};
+    static std::string internalKey(EntryKind kind, const std::string& key);
+    Shard& shardFor(const std::string& internalKey);
+
+    // Callers hold the shard lock
+    Entry* findLocked(Shard& shard, const std::string& internalKey);
+    void touchLocked(Shard& shard, Entry& entry);
+    void insertLocked(Shard& shard, const std::string& internalKey, Entry entry);
+    void eraseLocked(Shard& shard, std::unordered_map<std::string, Entry>::iterator it);
+    void trimLocked(Shard& shard, size_t incomingBytes);
 
+    PointsPtr lookup(EntryKind kind, const std::string& key, const double* tolerance,
+                     std::atomic<size_t>& hits, std::atomic<size_t>& misses);
+    PointsPtr insert(EntryKind kind, const std::string& key, std::vector<gp_Pnt> points,
+                     size_t shapeHash, double tolerance, double computationTime, bool replace);
 
+    // On-disk store
+    std::string diskPathFor(const std::string& internalKey) const;
+    PointsPtr loadFromDisk(EntryKind kind, const std::string& key, const double* tolerance,
+                           size_t& shapeHash, double& storedTolerance) const;
+    void saveToDisk(EntryKind kind, const std::string& key, const std::vector<gp_Pnt>& points,
+                    size_t shapeHash, double tolerance) const;
+    void removeFromDisk(const std::string& internalKey) const;
+
+    std::array<Shard, kShardCount> m_shards;
+    std::atomic<size_t> m_maxMemoryBytes;
+    std::atomic<size_t> m_hitCount;
+    std::atomic<size_t> m_missCount;
+    std::atomic<size_t> m_totalMemoryUsage;
+    std::atomic<size_t> m_intersectionHitCount;
+    std::atomic<size_t> m_intersectionMissCount;
+    std::atomic<size_t> m_evictionCount;
+    std::atomic<size_t> m_diskHitCount;
+
+    mutable std::mutex m_persistenceMutex;
+    std::string m_persistentDirectory;
+
+    // Memoized content hashes; entries hold the shape so a TShape address is never reused while cached
+    struct HashedShape {
+        TopoDS_Shape shape;
+        size_t hash;
+    };
+    std::mutex m_shapeHashMutex;
+    std::unordered_map<const TopoDS_TShape*, std::vector<HashedShape>> m_shapeHashes;  // One per location
+    std::deque<const TopoDS_TShape*> m_shapeHashOrder;  // Oldest first
+};
 
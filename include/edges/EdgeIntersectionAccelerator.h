@@ -8,23 +8,23 @@
 #include <OpenCASCADE/Geom_Curve.hxx>
 #include <OpenCASCADE/Bnd_Box.hxx>
 #include <OpenCASCADE/Standard_Real.hxx>
-#include "geometry/BVHAccelerator.h"
+#include "edges/CurveSegmentTree.h"
 
 /**
- * @brief Edge intersection detection accelerator using BVH
+ * @brief Edge intersection detection accelerator
  * 
- * Uses Bounding Volume Hierarchy to accelerate edge-edge intersection detection,
- * reducing complexity from O(n²) to O(n log n).
+ * Two levels of bounding volumes: candidate edge pairs come from a sweep over
+ * the edge bounding boxes, and each candidate pair is resolved by intersecting
+ * the per-edge CurveSegmentTree hierarchies, which refine every overlap with
+ * Newton iterations on the exact curves.
  * 
  * Performance characteristics:
- * - Build time: O(n log n) where n = number of edges
- * - Query time: O(n log n) for all intersection pairs
- * - Pruning efficiency: 90%+ (eliminates 99% of non-intersecting pairs)
- * - Memory overhead: ~2x edge count
+ * - Build time: O(n log n) plus one segment hierarchy per edge, built in parallel
+ * - Pair query: O(n log n + k) for k overlapping edge boxes
+ * - Narrow phase: proportional to overlapping curve spans, not sample density
  * 
  * Recommended usage:
- * - Use for models with >= 100 edges
- * - Falls back to spatial grid for smaller models
+ * - Use for models with >= 20 edges
  * - Supports parallel intersection extraction
  */
 class EdgeIntersectionAccelerator {
@@ -38,6 +38,7 @@ public:
         Bnd_Box bounds;
         size_t edgeIndex;
         TopoDS_Edge edge;  // Preserve original edge for precise calculation
+        CurveSegmentTree segments;
         
         EdgePrimitive() : first(0), last(0), edgeIndex(0) {}
     };
@@ -70,22 +71,33 @@ public:
     ~EdgeIntersectionAccelerator() = default;
     
     /**
-     * @brief Build BVH from edge collection
+     * @brief Build edge bounds and curve segment hierarchies
      * @param edges Input edges to build accelerator from
-     * @param maxPrimitivesPerLeaf Maximum edges per BVH leaf node (default: 4)
      */
-    void buildFromEdges(const std::vector<TopoDS_Edge>& edges, 
-                       size_t maxPrimitivesPerLeaf = 4);
+    void buildFromEdges(const std::vector<TopoDS_Edge>& edges);
     
     /**
      * @brief Find all potential intersecting edge pairs
      * 
-     * Uses BVH to quickly filter edge pairs whose bounding boxes intersect.
-     * This is the first phase - actual intersection testing comes later.
+     * Sweeps the edge bounding boxes along X to find pairs whose boxes come
+     * within tolerance of each other. This is the first phase - actual
+     * intersection testing comes later.
      * 
+     * @param tolerance Gap still counted as overlapping
      * @return Vector of edge pair indices that might intersect
      */
-    std::vector<EdgePair> findPotentialIntersections() const;
+    std::vector<EdgePair> findPotentialIntersections(double tolerance = 0.0) const;
+
+    /**
+     * @brief Intersect the given candidate pairs in parallel
+     * @return Intersection points in pair order; a pair can contribute several
+     */
+    std::vector<gp_Pnt> intersectPairs(const std::vector<EdgePair>& pairs, double tolerance) const;
+
+    /**
+     * @brief Merge points closer than tolerance, keeping the first of each group
+     */
+    static std::vector<gp_Pnt> mergeCoincidentPoints(const std::vector<gp_Pnt>& points, double tolerance);
     
     /**
      * @brief Extract all intersection points (single-threaded)
@@ -116,7 +128,7 @@ public:
     /**
      * @brief Check if accelerator is built and ready
      */
-    bool isBuilt() const { return m_bvh != nullptr && m_bvh->isBuilt(); }
+    bool isBuilt() const { return m_built; }
     
     /**
      * @brief Get number of edges in accelerator
@@ -124,28 +136,20 @@ public:
     size_t getEdgeCount() const { return m_edges.size(); }
 
 private:
-    std::unique_ptr<BVHAccelerator> m_bvh;
     std::vector<EdgePrimitive> m_edges;
+    bool m_built = false;
     mutable Statistics m_stats;
     
     /**
-     * @brief Compute precise intersection between two edges
+     * @brief Compute precise intersections between two edges
      * @param edge1 First edge data
      * @param edge2 Second edge data
      * @param tolerance Distance tolerance
-     * @param intersection Output intersection point
-     * @return true if intersection found within tolerance
-     */
-    bool computeEdgeIntersection(const EdgePrimitive& edge1,
-                                const EdgePrimitive& edge2,
-                                double tolerance,
-                                gp_Pnt& intersection) const;
-    
-    /**
-     * @brief Query all edges whose bounding boxes intersect with given edge
-     * @param edgeIndex Index of edge to query
-     * @return Indices of potentially intersecting edges
+     * @param intersections Receives every point where the edges come within tolerance
      */
-    std::vector<size_t> queryIntersectingEdges(size_t edgeIndex) const;
+    void computeEdgeIntersections(const EdgePrimitive& edge1,
+                                  const EdgePrimitive& edge2,
+                                  double tolerance,
+                                  std::vector<gp_Pnt>& intersections) const;
 };
 
@@ -4,6 +4,14 @@
 #include <OpenCASCADE/TopoDS_Edge.hxx>
 #include <OpenCASCADE/TopoDS_Face.hxx>
 #include <OpenCASCADE/TopTools_ListOfShape.hxx>
+#include <OpenCASCADE/gp_Vec.hxx>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+class TopoDS_TShape;
 
 /**
  * @brief Parameters for feature edge extraction
@@ -23,7 +31,12 @@ struct FeatureEdgeParams {
  * @brief Feature edge extractor
  * 
  * Extracts feature edges based on surface normal angles
- * and edge-face relationships
+ * and edge-face relationships.
+ *
+ * The dihedral angle and sampled polyline of every edge are computed once per
+ * shape, in parallel, and kept for the most recently used shapes. Extracting
+ * again with a different feature angle or filter only re-thresholds the
+ * cached records.
  */
 class FeatureEdgeExtractor : public TypedEdgeExtractor<FeatureEdgeParams> {
 public:
@@ -38,6 +51,43 @@ protected:
     std::vector<gp_Pnt> extractTyped(const TopoDS_Shape& shape, const FeatureEdgeParams* params) override;
     
 private:
+    struct EdgeRecord {
+        int faceCount = 0;
+        bool closed = false;
+        double chordLength = 0.0;  // Distance between the curve end points
+        double angle = 0.0;        // Angle between the face normals; 0 when unavailable
+        double normalDot = 0.0;    // Dot product of the unit face normals
+        uint32_t sampleOffset = 0; // Polyline range in ShapeClassification::samples
+        uint32_t sampleCount = 0;
+    };
+
+    struct ShapeClassification {
+        TopoDS_Shape shape;
+        std::vector<EdgeRecord> edges;
+        std::vector<gp_Pnt> samples;
+    };
+
+    /**
+     * @brief Cached classification of the shape's edges, computed on first use
+     */
+    std::shared_ptr<const ShapeClassification> getClassification(const TopoDS_Shape& shape);
+
+    /**
+     * @brief Evaluate face normals and sample the curve of every edge in parallel
+     */
+    std::shared_ptr<const ShapeClassification> classify(const TopoDS_Shape& shape) const;
+
+    /**
+     * @brief Unit normals of both faces at the edge midpoint
+     * @return False if either normal can't be evaluated
+     */
+    bool calculateFaceNormals(
+        const TopoDS_Edge& edge,
+        const TopoDS_Face& face1,
+        const TopoDS_Face& face2,
+        gp_Vec& normal1,
+        gp_Vec& normal2) const;
+
     /**
      * @brief Check if edge is a feature edge based on face normals
      */
@@ -55,4 +105,8 @@ private:
         const TopoDS_Edge& edge,
         const TopoDS_Face& face1,
         const TopoDS_Face& face2) const;
+
+    std::mutex m_classificationMutex;
+    std::unordered_map<const TopoDS_TShape*, std::shared_ptr<const ShapeClassification>> m_classifications;
+    std::deque<const TopoDS_TShape*> m_classificationOrder;  // Oldest first
 };
@@ -15,6 +15,8 @@
 #include <mutex>
 #include <tbb/tbb.h>
 
+class EdgeIntersectionAccelerator;
+
 /**
  * @brief Progress callback for edge extraction
  * @param progress Progress percentage (0-100)
@@ -92,22 +94,6 @@ public:
         bool isLineOnly; // Cached curve type info
     };
 
-    /**
-     * @brief Optimized edge data structure for spatial partitioning with precomputed properties
-     */
-    struct EdgeData {
-        Handle(Geom_Curve) curve;
-        Standard_Real first, last;
-        AABB bbox;
-        int gridX, gridY, gridZ;
-        double length; // Precomputed edge length
-
-        // Constructor for efficient initialization from filtered edge
-        EdgeData(const FilteredEdge& filteredEdge, double bboxMargin);
-
-        // Constructor for legacy TopoDS_Edge initialization
-        EdgeData(const TopoDS_Edge& edge, double bboxMargin);
-    };
     OriginalEdgeExtractor();
     ~OriginalEdgeExtractor() = default;
     
@@ -177,41 +163,16 @@ private:
         std::vector<gp_Pnt>& intersectionPoints,
         double tolerance);
 
-    /**
-     * @brief Check intersection between two edges
-     */
-    void checkEdgeIntersection(
-        const EdgeData& edge1,
-        const EdgeData& edge2,
-        std::vector<gp_Pnt>& intersectionPoints,
-        double tolerance);
-
     /**
      * @brief Progressive intersection detection with TBB
      */
     void findIntersectionsProgressiveTBB(
-        const std::vector<EdgeData>& edgeData,
+        const EdgeIntersectionAccelerator& accelerator,
         std::vector<gp_Pnt>& intersectionPoints,
         double tolerance,
         std::function<void(const std::vector<gp_Pnt>&)> onBatchComplete,
         std::function<void(int, const std::string&)> onProgress);
 
-    /**
-     * @brief Generate intersection tasks in batches
-     */
-    std::vector<std::vector<std::pair<size_t, size_t>>> generateTaskBatches(
-        const std::vector<std::vector<size_t>>& gridCells,
-        const std::vector<EdgeData>& edgeData,
-        size_t batchSize = 100);
-
-    /**
-     * @brief Process a batch of intersection tasks
-     */
-    std::vector<gp_Pnt> processIntersectionBatch(
-        const std::vector<std::pair<size_t, size_t>>& batch,
-        const std::vector<EdgeData>& edgeData,
-        double tolerance);
-    
 protected:
     std::vector<gp_Pnt> extractTyped(const TopoDS_Shape& shape, const OriginalEdgeParams* params) override;
 
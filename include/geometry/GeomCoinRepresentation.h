@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <OpenCASCADE/Quantity_Color.hxx>
 #include <OpenCASCADE/gp_Pnt.hxx>
@@ -13,6 +14,7 @@
 
 // Forward declarations
 class SoSeparator;
+class SoNode;
 class EdgeComponent;
 class ModularEdgeComponent;
 class TopoDS_Shape;
@@ -24,6 +26,8 @@ class DisplayModeHandler;
 class WireframeBuilder;
 class PointViewBuilder;
 class FaceDomainMapper;
+class FaceLookupIndex;
+class FaceMeshCache;
 
 
 /**
@@ -155,10 +159,21 @@ public:
 
     // Performance optimization
     bool needsMeshRegeneration() const { return m_meshRegenerationNeeded; }
-    void setMeshRegenerationNeeded(bool needed) { m_meshRegenerationNeeded = needed; }
+    void setMeshRegenerationNeeded(bool needed) { m_meshRegenerationNeeded = needed; m_surfacePatchPending = false; }
+    const MeshParameters& getLastMeshParameters() const { return m_lastMeshParams; }
     void updateCoinRepresentationIfNeeded(const TopoDS_Shape& shape, const MeshParameters& params);
     void forceCoinRepresentationRebuild(const TopoDS_Shape& shape, const MeshParameters& params);
 
+    // Shape replaced with nothing else pending: the next update may patch the changed
+    // faces into the existing surface buffers instead of rebuilding the node
+    void markShapeChanged();
+
+    // Retessellate only changed faces and write them into the current surface node.
+    // Returns false when a full rebuild is required (layout or mesh parameters changed,
+    // or shape-derived overlays such as edges or points are displayed).
+    bool patchSurfaceGeometry(const TopoDS_Shape& shape, const MeshParameters& params,
+                              const GeometryRenderContext& context);
+
     // Edge component integration
     std::unique_ptr<ModularEdgeComponent> modularEdgeComponent;  // Modular component
 
@@ -202,6 +217,9 @@ public:
     std::vector<int> getTrianglesForGeometryFace(int geometryFaceId) const;
     bool hasFaceDomainMapping() const { return !m_faceDomains.empty(); }
 
+    // Precomputed triangle/face/edge/vertex tables shared by picking, highlighting and face query
+    const FaceLookupIndex* getFaceLookupIndex() const { return m_faceLookup.get(); }
+
     // Legacy compatibility method - now delegates to domain system
     bool hasFaceIndexMapping() const { return hasFaceDomainMapping(); }
 
@@ -215,10 +233,16 @@ public:
 
     // Cached mesh storage for mesh-only geometries (STL, OBJ, etc.)
     // These geometries don't have valid BRep shapes, so we need to store the mesh directly
-    void setCachedMesh(const TriangleMesh& mesh) { m_cachedMesh = mesh; m_hasCachedMesh = true; }
+    void setCachedMesh(const TriangleMesh& mesh) { m_cachedMesh = mesh; m_hasCachedMesh = true; m_lodSourceTriangles.clear(); }
     const TriangleMesh& getCachedMesh() const { return m_cachedMesh; }
     bool hasCachedMesh() const { return m_hasCachedMesh; }
-    void clearCachedMesh() { m_cachedMesh = TriangleMesh(); m_hasCachedMesh = false; }
+    void clearCachedMesh() { m_cachedMesh = TriangleMesh(); m_hasCachedMesh = false; m_lodSourceTriangles.clear(); }
+
+    // Decimated LOD face sets of the cached mesh: for each of their triangles, the
+    // full-resolution triangle it was kept from. Picking maps hits through this so
+    // triangle and face lookups always use full-resolution indices.
+    void setLODSourceTriangles(const SoNode* lodFaceSet, std::vector<int> sourceTriangles);
+    int resolveLODTriangle(const SoNode* faceSet, int triangleIndex) const;
 
 protected:
     // Helper function for face triangulation
@@ -254,11 +278,17 @@ protected:
     // New Domain-based mapping system (FreeCAD-inspired)
     std::vector<FaceDomain> m_faceDomains;              // Independent mesh containers per face
     std::vector<TriangleSegment> m_triangleSegments;    // Triangle index ranges per face
-    std::vector<BoundaryTriangle> m_boundaryTriangles;  // Triangles shared by multiple faces
+    std::vector<BoundaryTriangle> m_boundaryTriangles;  // Triangles shared by multiple faces, sorted by triangle index
+    std::unique_ptr<FaceLookupIndex> m_faceLookup;      // Lookup tables rebuilt with the domains above
+
+    // Per-face tessellation the surface buffers are assembled from
+    std::unique_ptr<FaceMeshCache> m_faceMeshCache;
+    bool m_surfacePatchPending = false;
 
     // Cached mesh for mesh-only geometries (STL, OBJ, etc.)
     TriangleMesh m_cachedMesh;
     bool m_hasCachedMesh = false;
+    std::unordered_map<const SoNode*, std::vector<int>> m_lodSourceTriangles;
 
     // Helper classes for modular architecture
     std::unique_ptr<CoinNodeManager> m_nodeManager;
@@ -4,6 +4,7 @@
 #include <OpenCASCADE/gp_Pnt.hxx>
 #include <OpenCASCADE/Quantity_Color.hxx>
 #include <Inventor/nodes/SoSeparator.h>
+#include "geometry/VertexSpatialIndex.h"
 #include <vector>
 #include <mutex>
 
@@ -12,6 +13,8 @@
  * 
  * Extracts vertices from OpenCASCADE shapes at import time and caches them
  * for fast point rendering without async threading or GL context issues.
+ * The cache is held in a spatial hash, so snapping queries against it don't
+ * scan every vertex.
  */
 class VertexExtractor {
 public:
@@ -51,10 +54,24 @@ public:
     /**
      * @brief Get direct access to cached vertices (const)
      */
-    const std::vector<gp_Pnt>& getCachedVertices() const { return m_cachedVertices; }
+    const std::vector<gp_Pnt>& getCachedVertices() const { return m_index.getPoints(); }
+
+    /**
+     * @brief Find the cached vertex closest to a point
+     * @param point Query point in shape coordinates
+     * @param maxDistance Snapping radius
+     * @param nearest Receives the vertex position when one is found
+     * @return True if a vertex lies within maxDistance
+     */
+    bool findNearestVertex(const gp_Pnt& point, double maxDistance, gp_Pnt& nearest) const;
+
+    /**
+     * @brief Get all cached vertices within radius of a point
+     */
+    std::vector<gp_Pnt> findVerticesWithinRadius(const gp_Pnt& center, double radius) const;
 
 private:
-    std::vector<gp_Pnt> m_cachedVertices;  // Cached vertex positions
+    VertexSpatialIndex m_index;             // Cached vertex positions
     bool m_cacheValid;                      // Cache validity flag
     mutable std::mutex m_mutex;             // Thread safety
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <OpenCASCADE/gp_Pnt.hxx>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Uniform hash grid over a fixed set of points
+ *
+ * Points are bucketed into cubic cells; only occupied cells are stored, in a
+ * hash map pointing into one index array sorted by cell. Nearest-point and
+ * radius queries visit the cells around the query, so their cost depends on the
+ * local point density rather than the total count. Building and batch
+ * deduplication run in parallel.
+ */
+class VertexSpatialIndex {
+public:
+    VertexSpatialIndex();
+
+    /**
+     * @brief Index the points
+     * @param cellSize Grid cell edge; 0 picks one giving about one point per cell
+     */
+    void build(std::vector<gp_Pnt> points, double cellSize = 0.0);
+    void clear();
+
+    bool isEmpty() const { return m_points.empty(); }
+    std::size_t size() const { return m_points.size(); }
+    const std::vector<gp_Pnt>& getPoints() const { return m_points; }
+    double getCellSize() const { return m_cellSize; }
+
+    /**
+     * @brief Index of the point closest to the query within maxDistance, or -1
+     */
+    int findNearest(const gp_Pnt& query, double maxDistance) const;
+
+    /**
+     * @brief Indices of all points within radius of the center, in no particular order
+     */
+    void findWithinRadius(const gp_Pnt& center, double radius, std::vector<int>& result) const;
+
+    /**
+     * @brief Indices of the points to keep when points closer than tolerance are merged
+     *
+     * A point is dropped when an earlier point lies within tolerance of it, so the
+     * result is independent of how the work is split across threads.
+     */
+    static std::vector<std::size_t> deduplicate(const std::vector<gp_Pnt>& points, double tolerance);
+
+private:
+    struct Cell {
+        int64_t x, y, z;
+        bool operator==(const Cell& other) const { return x == other.x && y == other.y && z == other.z; }
+    };
+    struct CellHash {
+        std::size_t operator()(const Cell& cell) const;
+    };
+
+    Cell cellOf(const gp_Pnt& point) const;
+    template <typename Visitor>
+    void visitCell(const Cell& cell, Visitor&& visitor) const;
+
+    std::vector<gp_Pnt> m_points;
+    std::vector<uint32_t> m_order;  // Point indices grouped by cell
+    std::unordered_map<Cell, std::pair<uint32_t, uint32_t>, CellHash> m_cells;  // Range in m_order
+    double m_cellSize;
+    double m_inverseCellSize;
+};
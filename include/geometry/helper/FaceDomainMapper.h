@@ -9,6 +9,8 @@ struct MeshParameters;
 struct FaceDomain;
 struct TriangleSegment;
 struct BoundaryTriangle;
+class FaceLookupIndex;
+class FaceMeshCache;
 
 class FaceDomainMapper {
 public:
@@ -19,7 +21,16 @@ public:
                                 const MeshParameters& params,
                                 std::vector<FaceDomain>& faceDomains,
                                 std::vector<TriangleSegment>& triangleSegments,
-                                std::vector<BoundaryTriangle>& boundaryTriangles);
+                                std::vector<BoundaryTriangle>& boundaryTriangles,
+                                FaceLookupIndex* lookupIndex = nullptr);
+
+    // Same mapping, taken from an up-to-date per-face cache instead of converting the shape again
+    void buildFaceDomainMapping(const TopoDS_Shape& shape,
+                                const FaceMeshCache& meshCache,
+                                std::vector<FaceDomain>& faceDomains,
+                                std::vector<TriangleSegment>& triangleSegments,
+                                std::vector<BoundaryTriangle>& boundaryTriangles,
+                                FaceLookupIndex* lookupIndex = nullptr);
 
     bool triangulateFace(const TopoDS_Face& face, FaceDomain& domain);
 
@@ -31,7 +42,15 @@ private:
                          std::vector<FaceDomain>& faceDomains);
     void buildTriangleSegments(const std::vector<std::pair<int, std::vector<int>>>& faceMappings,
                                std::vector<TriangleSegment>& triangleSegments);
-    void identifyBoundaryTriangles(const std::vector<std::pair<int, std::vector<int>>>& faceMappings,
+    void buildMappingTables(const TopoDS_Shape& shape,
+                            const std::vector<TopoDS_Face>& faces,
+                            const TriangleMesh& mesh,
+                            const std::vector<std::pair<int, std::vector<int>>>& faceMappings,
+                            std::vector<TriangleSegment>& triangleSegments,
+                            std::vector<BoundaryTriangle>& boundaryTriangles,
+                            FaceLookupIndex& index,
+                            bool keepLookupIndex);
+    void identifyBoundaryTriangles(const FaceLookupIndex& lookupIndex,
                                     std::vector<BoundaryTriangle>& boundaryTriangles);
 };
 
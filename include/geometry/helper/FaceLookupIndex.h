@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <OpenCASCADE/TopoDS_Shape.hxx>
+#include <OpenCASCADE/TopoDS_Face.hxx>
+#include <OpenCASCADE/TopoDS_Edge.hxx>
+#include <OpenCASCADE/TopLoc_Location.hxx>
+#include <OpenCASCADE/Poly_Triangulation.hxx>
+#include "rendering/GeometryProcessor.h"
+
+struct BoundaryTriangle;
+
+/**
+ * @brief Precomputed face/triangle/edge/vertex lookup tables for one tessellation
+ *
+ * Built once per tessellation by FaceDomainMapper and shared by picking,
+ * highlighting and face query. One-to-many relations are stored in CSR form
+ * (offsets + flat values), so every query is O(1) or O(log n) and never allocates.
+ */
+class FaceLookupIndex {
+public:
+    static constexpr uint32_t InvalidId = 0xFFFFFFFFu;
+
+    /**
+     * @brief Read-only view over a contiguous run of ids inside a CSR table
+     */
+    struct IdRange {
+        const uint32_t* first = nullptr;
+        const uint32_t* last = nullptr;
+
+        const uint32_t* begin() const { return first; }
+        const uint32_t* end() const { return last; }
+        std::size_t size() const { return static_cast<std::size_t>(last - first); }
+        bool empty() const { return first == last; }
+    };
+
+    /**
+     * @brief Read-only view over one edge polyline, packed as x, y, z per point
+     */
+    struct PointRange {
+        const float* first = nullptr;
+        const float* last = nullptr;
+
+        const float* data() const { return first; }
+        std::size_t size() const { return static_cast<std::size_t>(last - first) / 3; }
+        bool empty() const { return first == last; }
+    };
+
+    FaceLookupIndex();
+    ~FaceLookupIndex();
+
+    // Triangle <-> face tables from the processor's face mappings
+    void buildTriangleTables(const std::vector<std::pair<int, std::vector<int>>>& faceMappings);
+    // Vertex -> face table; requires triangle tables to be built first
+    void buildVertexTable(const TriangleMesh& mesh);
+    // Face -> edge table, edge ids follow TopExp::MapShapes(shape, TopAbs_EDGE) order (0-based),
+    // plus one polyline per edge taken from the faces' current triangulation
+    void buildEdgeTable(const TopoDS_Shape& shape, const std::vector<TopoDS_Face>& faces);
+
+    void clear();
+    bool isEmpty() const { return m_faceCount == 0; }
+
+    // Triangle -> owning face, -1 when unknown
+    int faceForTriangle(int triangleIndex) const;
+    // All faces referencing a triangle (more than one only for boundary triangles)
+    IdRange facesForTriangle(int triangleIndex) const;
+
+    IdRange trianglesForFace(int geometryFaceId) const;
+    IdRange edgesForFace(int geometryFaceId) const;
+    IdRange facesForVertex(int vertexIndex) const;
+    // Polyline of an edge returned by edgesForFace, in shape coordinates
+    PointRange polylineForEdge(uint32_t edgeId) const;
+
+    // Triangles referenced by more than one face, ordered by triangle index
+    void collectBoundaryTriangles(std::vector<BoundaryTriangle>& boundaryTriangles) const;
+
+    std::size_t getFaceCount() const { return m_faceCount; }
+    std::size_t getTriangleCount() const { return m_triangleCount; }
+    bool usesRangeTable() const { return m_useRangeTable; }
+
+    // Approximate heap footprint of all tables in bytes
+    std::size_t getMemoryUsage() const;
+
+private:
+    static IdRange rangeOf(const std::vector<uint32_t>& offsets,
+                           const std::vector<uint32_t>& values, std::size_t row);
+    static void appendEdgePolyline(const TopoDS_Edge& edge, const Handle(Poly_Triangulation)& triangulation,
+                                   const TopLoc_Location& faceLocation, std::vector<float>& points);
+
+    std::size_t m_faceCount;
+    std::size_t m_triangleCount;
+
+    // Triangle -> face: either a range table (contiguous faces, binary search)
+    // or a flat per-triangle array (O(1)), whichever the tessellation allows
+    bool m_useRangeTable;
+    std::vector<uint32_t> m_rangeStarts;     // first triangle of each range, ascending
+    std::vector<uint32_t> m_rangeFaces;      // face owning each range
+    std::vector<uint32_t> m_triangleToFace;  // flat table when ranges are not contiguous
+
+    // Boundary triangles (shared by several faces), sorted by triangle index
+    std::vector<uint32_t> m_boundaryTriangles;
+    std::vector<uint32_t> m_boundaryOffsets;
+    std::vector<uint32_t> m_boundaryFaces;
+
+    // CSR relations
+    std::vector<uint32_t> m_faceTriangleOffsets;
+    std::vector<uint32_t> m_faceTriangles;
+    std::vector<uint32_t> m_faceEdgeOffsets;
+    std::vector<uint32_t> m_faceEdges;
+    std::vector<uint32_t> m_edgePointOffsets;   // Per edge id, in points
+    std::vector<float> m_edgePoints;
+    std::vector<uint32_t> m_vertexFaceOffsets;
+    std::vector<uint32_t> m_vertexFaces;
+};
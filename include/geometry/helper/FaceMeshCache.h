@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <OpenCASCADE/TopoDS_Shape.hxx>
+#include <OpenCASCADE/TopoDS_Face.hxx>
+#include <OpenCASCADE/Poly_Triangulation.hxx>
+#include "rendering/GeometryProcessor.h"
+
+class SoSeparator;
+class TopoDS_TShape;
+
+/**
+ * @brief Per-face tessellation store backing a geometry's surface buffers
+ *
+ * Each face keeps its own chunk of vertices, normals and triangles, keyed by the
+ * face's TShape. The geometry's vertex and index buffers are the chunks laid out
+ * back to back in face order. update() retessellates only faces whose TShape,
+ * location, orientation or triangulation changed (all of them when the mesh
+ * parameters change) and reuses the rest. When no chunk changed size, the
+ * changed ranges can be written straight into the existing Coin nodes with
+ * patch() instead of rebuilding the surface.
+ */
+class FaceMeshCache {
+public:
+    struct UpdateResult {
+        std::size_t faceCount = 0;
+        std::size_t retessellated = 0;  // Faces meshed and converted again
+        bool layoutChanged = false;     // Chunk offsets moved; buffers must be reassembled
+
+        bool changed() const { return retessellated > 0 || layoutChanged; }
+    };
+
+    FaceMeshCache();
+    ~FaceMeshCache();
+
+    UpdateResult update(const TopoDS_Shape& shape, const MeshParameters& params);
+
+    // Concatenate all chunks; faceMappings receives the triangle indices of each face
+    void assemble(TriangleMesh& mesh,
+                  std::vector<std::pair<int, std::vector<int>>>* faceMappings = nullptr) const;
+
+    // Surface node built from assemble(); patch() edits its coordinate, normal and face set nodes
+    void setSurfaceNode(SoSeparator* node);
+    SoSeparator* getSurfaceNode() const { return m_surfaceNode; }
+
+    // Write the chunks changed by the last update() into the surface node.
+    // Returns false when the layout changed or the node doesn't match the buffers.
+    bool patch();
+
+    // Drop all chunks so the next update() retessellates every face
+    void invalidate();
+
+    bool isEmpty() const { return m_chunks.empty(); }
+    std::size_t getFaceCount() const { return m_chunks.size(); }
+    std::size_t getVertexCount() const { return m_vertexCount; }
+    std::size_t getTriangleCount() const { return m_triangleCount; }
+
+private:
+    struct FaceChunk {
+        TopoDS_Face face;                          // Holds the TShape so its address can't be reused
+        Handle(Poly_Triangulation) triangulation;  // Triangulation the chunk was converted from
+        TriangleMesh mesh;                         // Face-local indices
+        std::size_t vertexOffset = 0;
+        std::size_t triangleOffset = 0;
+        bool dirty = true;
+    };
+
+    static bool sameParameters(const MeshParameters& a, const MeshParameters& b);
+    void layoutChunks();
+
+    std::vector<FaceChunk> m_chunks;
+    std::unordered_map<const TopoDS_TShape*, std::vector<std::size_t>> m_chunksByTShape;
+    MeshParameters m_params;
+    bool m_hasParams = false;
+    bool m_layoutChanged = true;
+    std::size_t m_vertexCount = 0;
+    std::size_t m_triangleCount = 0;
+    SoSeparator* m_surfaceNode = nullptr;
+};
@@ -16,6 +16,7 @@
 class SoSeparator;
 struct MeshParameters;
 struct TextureData;
+class FaceMeshCache;
 
 class RenderNodeBuilder {
 public:
@@ -32,7 +33,13 @@ public:
                               const MeshParameters& params, const GeometryRenderContext& context);
     SoPolygonOffset* createPolygonOffsetNode();
 
+    // When set, surface geometry is assembled from the per-face cache instead of
+    // converting the whole shape, and the built node is handed back to the cache
+    void setFaceMeshCache(FaceMeshCache* cache) { m_faceMeshCache = cache; }
+
 private:
     void setupTextureNode(SoSeparator* parent, const TextureData& texture);
+
+    FaceMeshCache* m_faceMeshCache = nullptr;
 };
 
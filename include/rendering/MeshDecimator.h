@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include "rendering/GeometryProcessor.h"
+
+/**
+ * @brief Chain of decimated levels sharing one vertex buffer
+ *
+ * Every level indexes the original vertices and normals, so attributes are
+ * never resampled. Level indices are concatenated into one buffer and each
+ * level is a range of it; level 0 is the undecimated mesh.
+ */
+struct MeshLODChain {
+	struct Level {
+		float ratio;            // triangle count relative to level 0
+		size_t firstIndex;      // offset into indices
+		size_t indexCount;      // 3 per triangle
+
+		size_t getTriangleCount() const { return indexCount / 3; }
+	};
+
+	std::vector<int> indices;   // all levels, 3 per triangle
+	std::vector<int> faceIds;   // one per triangle in indices (empty when none were given)
+	std::vector<int> sourceTriangles; // level-0 triangle each triangle in indices was kept from
+	std::vector<Level> levels;
+
+	bool isEmpty() const { return levels.empty(); }
+	size_t getLevelCount() const { return levels.size(); }
+};
+
+/**
+ * @brief Quadric error metric decimator for indexed triangle meshes
+ *
+ * Collapses edges onto one of their endpoints in order of quadric error
+ * (Garland-Heckbert), so the result keeps the original vertex buffer and
+ * per-vertex normals. Open borders and face-id boundaries are constrained:
+ * border vertices only slide along the border and corners are locked, which
+ * keeps face regions and normal seams intact.
+ */
+class MeshDecimator {
+public:
+	struct Options {
+		std::vector<float> ratios{ 0.5f, 0.25f, 0.10f, 0.02f };
+		// Meshes below this triangle count produce a single-level chain
+		size_t minTriangles{ 2000 };
+		// Levels with fewer triangles are dropped
+		size_t minLevelTriangles{ 64 };
+		// Collapses turning a triangle normal by more than acos(value) are rejected
+		double maxNormalDeviation{ 0.2 };
+		// Set from another thread to stop early; the chain built so far is returned
+		const std::atomic<bool>* cancel{ nullptr };
+	};
+
+	/**
+	 * @brief Build a LOD chain for one mesh
+	 * @param mesh Input mesh
+	 * @param options Level ratios and quality limits
+	 * @param faceIds Optional per-triangle face ids carried through every level
+	 * @return Chain whose level 0 is the input mesh
+	 */
+	static MeshLODChain buildLODChain(const TriangleMesh& mesh, const Options& options,
+		const std::vector<int>* faceIds = nullptr);
+
+	/**
+	 * @brief Build LOD chains for several meshes in parallel
+	 * @param faceIds Optional, per-mesh face ids as in buildLODChain (null entries for none)
+	 * @return One chain per mesh, in input order
+	 */
+	static std::vector<MeshLODChain> buildLODChains(const std::vector<const TriangleMesh*>& meshes,
+		const Options& options, const std::vector<const std::vector<int>*>& faceIds = {});
+};
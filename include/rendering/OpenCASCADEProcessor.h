@@ -12,6 +12,20 @@
 #include <OpenCASCADE/TopLoc_Location.hxx>
 #include <OpenCASCADE/TopAbs_Orientation.hxx>
 
+/**
+ * @brief Tessellation settings from the rendering toolkit config
+ *
+ * The config is owned by the UI thread; take a copy there with fromConfig()
+ * and hand it to triangulations running on worker threads.
+ */
+struct TessellationSettings {
+	int quality = 2;
+	bool adaptiveMeshing = false;
+	bool parallelProcessing = true;
+
+	static TessellationSettings fromConfig();
+};
+
 /**
  * @brief OpenCASCADE-based geometry processor
  *
@@ -31,6 +45,15 @@ public:
 		const MeshParameters& params,
 		std::vector<std::pair<int, std::vector<int>>>& faceMappings);
 
+	// Run BRepMesh on the shape with the configured quality adjustments;
+	// skipped entirely when the stored triangulation already meets the parameters
+	bool triangulate(const TopoDS_Shape& shape, const MeshParameters& params);
+	bool triangulate(const TopoDS_Shape& shape, const MeshParameters& params, const TessellationSettings& settings);
+
+	// Convert the face's existing triangulation with normals and smoothing applied,
+	// as convertToMesh would produce it for that face
+	TriangleMesh convertFaceToMesh(const TopoDS_Face& face);
+
 	void calculateNormals(TriangleMesh& mesh) override;
 
 	TriangleMesh smoothNormals(const TriangleMesh& mesh,
@@ -53,6 +76,7 @@ public:
 
 private:
 	// Helper methods
+	void postProcessMesh(TriangleMesh& mesh);
 	void meshFace(const TopoDS_Shape& face, TriangleMesh& mesh, const MeshParameters& params);
 	void extractAllFacesRecursive(const TopoDS_Shape& shape, std::vector<TopoDS_Face>& faces);
 	void meshFaceWithIndexTracking(const TopoDS_Face& face, TriangleMesh& mesh,
@@ -76,6 +100,9 @@ private:
 	std::vector<std::vector<int>> splitFaceByDisconnectedComponents(
 		const std::vector<int>& triangleIndices, const TriangleMesh& mesh);
 
+	// True when every face already carries a triangulation at least as fine as deflection
+	static bool hasStoredTriangulation(const TopoDS_Shape& shape, double deflection);
+
 	// Configuration
 	bool m_showEdges;
 	double m_featureEdgeAngle;
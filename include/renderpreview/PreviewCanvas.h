@@ -74,6 +74,7 @@ public:
     ObjectManager* getObjectManager() const { return m_objectManager.get(); }
     LightManager* getLightManager() const { return m_lightManager.get(); }
     BackgroundManager* getBackgroundManager() const { return m_backgroundManager.get(); }
+    SoSeparator* getObjectRoot() const { return m_objectRoot; }
     
     // Legacy methods (for backward compatibility)
     void updateLighting(float ambient, float diffuse, float specular, const wxColour& color, float intensity);
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "RenderingSettings.h"
+#include "AntiAliasingSettings.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+class SoNode;
+class SoGroup;
+
+/**
+ * @brief Measures the real cost of rendering presets on a given scene
+ *
+ * Each case renders the scene offscreen for a fixed number of frames while the
+ * camera orbits the model along the same path, so results are comparable
+ * between presets and between runs. Per frame it records the CPU time spent
+ * traversing the scene graph and the total frame time including the GL finish
+ * and read-back. Works with any GL implementation, including Mesa's software
+ * rasterizer on machines without a GPU.
+ */
+class RenderBenchmark {
+public:
+    struct Case {
+        std::string name;
+        RenderingSettings rendering;
+        AntiAliasingSettings antiAliasing;
+
+        Case() { antiAliasing.enabled = false; }
+    };
+
+    struct Options {
+        int width = 1280;
+        int height = 720;
+        int frames = 60;
+        int warmupFrames = 3;        // not recorded; first frames pay for display lists and shaders
+        float orbitDegrees = 360.0f; // camera path covered over the recorded frames
+    };
+
+    struct Percentiles {
+        double p50 = 0.0;
+        double p90 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    struct Result {
+        std::string name;
+        bool success = false;
+        int frames = 0;
+        Percentiles traversalMs;
+        Percentiles frameMs;
+
+        double getFPS() const { return frameMs.p50 > 0.0 ? 1000.0 / frameMs.p50 : 0.0; }
+        std::string toJson() const;
+    };
+
+    // Called after each case; return false to stop the run
+    using ProgressCallback = std::function<bool(size_t finished, size_t total, const Result& result)>;
+
+    /**
+     * @brief Render the scene once per case and measure it
+     * @param scene Model to render; lights and a camera are supplied by the benchmark
+     */
+    static std::vector<Result> run(SoNode* scene, const std::vector<Case>& cases,
+        const Options& options = Options(), ProgressCallback progress = nullptr);
+
+    static Result runCase(SoNode* scene, const Case& benchmarkCase, const Options& options);
+
+    static Percentiles computePercentiles(std::vector<double> samples);
+
+private:
+    static SoGroup* createStateNodes(const RenderingSettings& settings);
+};
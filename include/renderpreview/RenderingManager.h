@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RenderingSettings.h"
+#include "RenderBenchmark.h"
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -65,6 +66,8 @@ public:
     void applyPreset(const std::string& presetName);
     void saveAsPreset(int configId, const std::string& presetName);
     std::vector<std::string> getAvailablePresets() const;
+    bool hasPreset(const std::string& presetName) const;
+    RenderingSettings getPreset(const std::string& presetName) const;
     
     // Rendering application
     void applyToRenderAction(SoGLRenderAction* renderAction);
@@ -84,10 +87,13 @@ public:
     void enableGouraudShading();
     void configureMaterialProperties(const RenderingSettings& settings);
     
-    // Performance monitoring
+    // Performance monitoring; measured benchmark results replace the estimates when available
     float getPerformanceImpact() const;
     std::string getQualityDescription() const;
     int getEstimatedFPS() const;
+    void setMeasuredPerformance(const RenderBenchmark::Result& result);
+    const RenderBenchmark::Result* getMeasuredPerformance(const std::string& name) const;
+    void clearMeasuredPerformance();
     
 private:
     SoSeparator* m_sceneRoot;
@@ -99,6 +105,9 @@ private:
     
     // Preset configurations
     std::unordered_map<std::string, RenderingSettings> m_presets;
+
+    // Benchmark results keyed by preset/configuration name
+    std::unordered_map<std::string, RenderBenchmark::Result> m_measured;
     
     // Helper methods
     void initializePresets();
@@ -4,6 +4,9 @@
 #include <wx/choice.h>
 #include <wx/sizer.h>
 #include <wx/statbox.h>
+#include <wx/stattext.h>
+#include <wx/button.h>
+#include <wx/textctrl.h>
 #include <functional>
 
 class RenderPreviewDialog;
@@ -38,6 +41,8 @@ private:
     void onRenderingModeChanged(wxCommandEvent& event);
     void onLegacyModeChanged(wxCommandEvent& event);
     void updateLegacyChoiceFromCurrentMode();
+    void onBenchmark(wxCommandEvent& event);
+    void updatePerformanceLabels();
 
     RenderPreviewDialog* m_parentDialog;
     RenderingManager* m_renderingManager;
@@ -45,6 +50,10 @@ private:
 
     wxChoice* m_renderingModeChoice;
     wxChoice* m_legacyChoice;
+    wxStaticText* m_impactLabel;
+    wxStaticText* m_fpsLabel;
+    wxButton* m_benchmarkButton;
+    wxTextCtrl* m_benchmarkResults;
 
     DECLARE_EVENT_TABLE()
 };
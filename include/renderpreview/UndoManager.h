@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <vector>
 #include <memory>
 #include <string>
@@ -38,10 +39,19 @@ struct ConfigSnapshot {
     {}
 };
 
+/**
+ * @brief Undo history for render preview settings
+ *
+ * Only the current configuration is kept in full. Each history entry records
+ * the fields and lights that changed between two saved states, with their old
+ * and new values, so undo and redo cost as much as the change itself. The
+ * history is bounded by entry count and by bytes; the oldest entries are
+ * dropped first.
+ */
 class UndoManager
 {
 public:
-    UndoManager(size_t maxHistorySize = 50);
+    UndoManager(size_t maxHistorySize = 50, size_t maxHistoryBytes = 4 * 1024 * 1024);
     ~UndoManager();
     
     // Save current state
@@ -65,10 +75,56 @@ public:
     std::string getUndoDescription() const;
     std::string getRedoDescription() const;
 
+    // Memory accounting
+    void setMaxHistoryBytes(size_t maxHistoryBytes);
+    size_t getHistoryBytes() const { return m_historyBytes; }
+    size_t getUndoCost() const;
+    size_t getRedoCost() const;
+
 private:
-    std::vector<ConfigSnapshot> m_history;
-    size_t m_currentIndex;
+    enum class Field : unsigned char {
+        AntiAliasingMethod, MsaaSamples, FxaaEnabled, RenderingMode,
+        MaterialAmbient, MaterialDiffuse, MaterialSpecular, MaterialShininess, MaterialTransparency,
+        TextureEnabled, TextureMode, TextureScale
+    };
+
+    // Every scalar field fits exactly in a double
+    struct FieldChange {
+        Field field;
+        double before;
+        double after;
+    };
+
+    struct LightChange {
+        size_t index;
+        RenderLightSettings light;
+    };
+
+    struct Delta {
+        std::vector<FieldChange> fields;
+        std::vector<LightChange> lightsBefore;  // Lights to restore on undo
+        std::vector<LightChange> lightsAfter;   // Lights to restore on redo
+        size_t lightCountBefore = 0;
+        size_t lightCountAfter = 0;
+        std::string descriptionBefore;
+        std::string description;
+        size_t cost = 0;
+
+        bool isEmpty() const;
+        size_t measure() const;
+    };
+
+    static double readField(const ConfigSnapshot& state, Field field);
+    static void writeField(ConfigSnapshot& state, Field field, double value);
+    static Delta diff(const ConfigSnapshot& from, const ConfigSnapshot& to);
+    static void apply(ConfigSnapshot& state, const Delta& delta, bool forward);
+
+    std::deque<Delta> m_history;    // m_history[i] leads from state i to state i + 1
+    ConfigSnapshot m_current;
+    size_t m_currentIndex;          // Number of entries applied to reach m_current
     size_t m_maxHistorySize;
+    size_t m_maxHistoryBytes;
+    size_t m_historyBytes;
     
     void trimHistory();
-}; 
\ No newline at end of file
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <OpenCASCADE/Quantity_Color.hxx>
+#include "GeometryReader.h"
+#include "rendering/GeometryProcessor.h"
+
+class OCCGeometry;
+
+/**
+ * @brief Headless renderer producing PNG thumbnails of geometry files
+ *
+ * Loading is split from rendering so callers can parse and tessellate the
+ * next file on a worker thread while the current one renders: load() touches
+ * only OpenCASCADE and is thread-safe, render() builds Coin nodes and must
+ * stay on the thread that initialised Coin. Rendering goes through
+ * SoOffscreenRenderer, so no window or on-screen GL context is needed.
+ */
+class ThumbnailRenderer {
+public:
+	struct Options {
+		int width = 512;
+		int height = 512;
+		std::vector<std::string> views{ "Isometric" };   // SceneManager view names
+		std::string outputDir = ".";
+		Quantity_Color background{ 1.0, 1.0, 1.0, Quantity_TOC_RGB };
+		MeshParameters mesh;
+		GeometryReader::OptimizationOptions import;   // enableBRepSidecar reuses tessellation persisted next to the source file
+	};
+
+	/**
+	 * @brief Per-file stage timings in milliseconds
+	 */
+	struct Timing {
+		std::string file;
+		bool success = false;
+		std::string error;
+		double parseMs = 0.0;
+		double meshMs = 0.0;
+		double renderMs = 0.0;
+		double encodeMs = 0.0;
+		size_t geometries = 0;
+		size_t triangles = 0;
+		std::vector<std::string> images;
+
+		std::string toJson() const;
+	};
+
+	/**
+	 * @brief Parsed and tessellated file, ready for render()
+	 *
+	 * Geometries carry only their shape or cached mesh; none has Coin nodes yet.
+	 */
+	struct LoadedFile {
+		std::vector<std::shared_ptr<OCCGeometry>> geometries;
+		Timing timing;
+	};
+
+	explicit ThumbnailRenderer(const Options& options);
+
+	/**
+	 * @brief Read and tessellate a file without touching Coin
+	 *
+	 * Faces that already carry a triangulation fine enough for the requested
+	 * deflection (stored in the file or restored from a BRep sidecar) are not
+	 * meshed again.
+	 */
+	static LoadedFile load(const std::string& filePath, const Options& options);
+
+	/**
+	 * @brief Build the scene for a loaded file and write one PNG per view
+	 */
+	Timing render(LoadedFile& file);
+
+	const Options& getOptions() const { return m_options; }
+
+	/**
+	 * @brief Ask Mesa for its software rasterizer unless the environment already chose
+	 *
+	 * Must be called before the first GL context is created.
+	 */
+	static void selectSoftwareGL();
+
+private:
+	std::string imagePath(const std::string& filePath, const std::string& view) const;
+
+	Options m_options;
+};
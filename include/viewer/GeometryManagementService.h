@@ -36,6 +36,7 @@ public:
 
     // Geometry lookup
     std::shared_ptr<OCCGeometry> findGeometry(const std::string& name) const;
+    std::vector<std::shared_ptr<OCCGeometry>> findGeometriesByFile(const std::string& fileName) const;
     const std::vector<std::shared_ptr<OCCGeometry>>& getAllGeometries() const;
     const std::vector<std::shared_ptr<OCCGeometry>>& getSelectedGeometries() const;
 
@@ -47,6 +48,7 @@ public:
 
     // Batch operations
     void addGeometriesBatch(const std::vector<std::shared_ptr<OCCGeometry>>& geometries);
+    size_t removeGeometriesBatch(const std::vector<std::shared_ptr<OCCGeometry>>& geometries);
 
     // Service dependencies (injected)
     void setServices(
@@ -1,23 +1,100 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 class OCCGeometry;
 
+/**
+ * @brief Owner of the viewer's geometry list, indexed for constant-time lookup
+ *
+ * The geometries stay in the external vector shared with the display managers,
+ * in insertion order. Next to it the repository keeps hash indexes by name, by
+ * a stable ID assigned on add and by file of origin. Names are unique. All
+ * changes to the vector must go through the repository; after changing a
+ * geometry's name or file directly, call reindex() for it.
+ */
 class GeometryRepository {
 public:
-	explicit GeometryRepository(std::vector<std::shared_ptr<OCCGeometry>>* storage);
+	using GeometryPtr = std::shared_ptr<OCCGeometry>;
+	using GeometryId = uint64_t;
+	static constexpr GeometryId InvalidId = 0;
+
+	explicit GeometryRepository(std::vector<GeometryPtr>* storage);
 
 	bool existsByName(const std::string& name) const;
-	std::shared_ptr<OCCGeometry> findByName(const std::string& name) const;
-	void add(const std::shared_ptr<OCCGeometry>& geometry);
-	void remove(const std::shared_ptr<OCCGeometry>& geometry);
+	bool contains(const GeometryPtr& geometry) const;
+	GeometryPtr findByName(const std::string& name) const;
+	GeometryPtr findById(GeometryId id) const;
+	GeometryId getId(const GeometryPtr& geometry) const;
+
+	/**
+	 * @brief Geometries imported from the file, in insertion order
+	 */
+	std::vector<GeometryPtr> findByFileName(const std::string& fileName) const;
+	std::vector<std::string> getFileNames() const;
+
+	/**
+	 * @brief Add one geometry
+	 * @return False if it is null, already stored or its name is taken
+	 */
+	bool add(const GeometryPtr& geometry);
+
+	/**
+	 * @brief Add many geometries with a single reservation of list and indexes
+	 * @param skipped Optional, receives the geometries rejected as in add()
+	 * @return The geometries that were added
+	 */
+	std::vector<GeometryPtr> addBatch(const std::vector<GeometryPtr>& geometries,
+		std::vector<GeometryPtr>* skipped = nullptr);
+
+	bool remove(const GeometryPtr& geometry);
+
+	/**
+	 * @brief Remove many geometries in one pass over the list
+	 * @return Number of geometries removed
+	 */
+	size_t removeBatch(const std::vector<GeometryPtr>& geometries);
+
 	void clear();
 
-	const std::vector<std::shared_ptr<OCCGeometry>>& all() const;
+	/**
+	 * @brief Rename a stored geometry
+	 * @return False if it is not stored or the new name is taken
+	 */
+	bool rename(const GeometryPtr& geometry, const std::string& newName);
+
+	/**
+	 * @brief Pick up name and file changes made on the geometry directly
+	 */
+	void reindex(const GeometryPtr& geometry);
+
+	size_t size() const;
+	const std::vector<GeometryPtr>& all() const;
 
 private:
-	std::vector<std::shared_ptr<OCCGeometry>>* m_storage;
+	struct Record {
+		GeometryPtr geometry;
+		GeometryId id = InvalidId;
+		std::string name;       // Keys under which the geometry is indexed
+		std::string fileName;
+	};
+
+	Record* insertRecord(const GeometryPtr& geometry);
+	void eraseRecord(const OCCGeometry* key);
+	void indexFile(const std::string& fileName, const OCCGeometry* key);
+	void unindexFile(const std::string& fileName, const OCCGeometry* key);
+	std::vector<GeometryPtr> inStorageOrder(const std::unordered_set<const OCCGeometry*>& keys) const;
+
+	std::vector<GeometryPtr>* m_storage;
+	GeometryId m_nextId = 1;
+
+	std::unordered_map<const OCCGeometry*, Record> m_records;
+	std::unordered_map<std::string, const OCCGeometry*> m_byName;
+	std::unordered_map<GeometryId, const OCCGeometry*> m_byId;
+	std::unordered_map<std::string, std::unordered_set<const OCCGeometry*>> m_byFile;
 };
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+#include <wx/event.h>
+#include "rendering/MeshDecimator.h"
+
+class OCCGeometry;
+
+/**
+ * @brief Automatic decimated LOD chains for mesh-only geometries
+ *
+ * STL/OBJ geometries have no BRep to retessellate, so their cached mesh is
+ * decimated instead. Chains for all geometries queued in one event-loop turn
+ * are built in parallel on a worker thread; the result is installed on the UI
+ * thread as an SoLevelOfDetail whose children share the original coordinates
+ * and normals, switched by projected screen area.
+ */
+class MeshLODService : public wxEvtHandler {
+public:
+	using FrameRequest = std::function<void()>;
+
+	MeshLODService();
+	~MeshLODService();
+
+	void setEnabled(bool enabled) { m_enabled = enabled; }
+	bool isEnabled() const { return m_enabled; }
+
+	// Minimum on-screen pixels per triangle before the next finer level is used
+	void setPixelsPerTriangle(double pixels) { m_pixelsPerTriangle = pixels; }
+	double getPixelsPerTriangle() const { return m_pixelsPerTriangle; }
+
+	MeshDecimator::Options& getOptions() { return m_options; }
+
+	// Queue a geometry; ignored unless it is mesh-only and large enough
+	void schedule(const std::shared_ptr<OCCGeometry>& geometry);
+	size_t getPendingCount() const { return m_queued.size() + m_running; }
+
+	void setFrameRequest(FrameRequest request) { m_frameRequest = std::move(request); }
+
+private:
+	struct Job {
+		std::weak_ptr<OCCGeometry> geometry;
+		std::shared_ptr<const TriangleMesh> mesh;
+		std::shared_ptr<const std::vector<int>> faceIds;  // null when the geometry has no face mapping
+	};
+
+	void launchBatch();
+	void onBatchFinished(const std::vector<Job>& jobs, const std::vector<MeshLODChain>& chains);
+	bool install(OCCGeometry& geometry, const TriangleMesh& mesh, const MeshLODChain& chain) const;
+
+private:
+	bool m_enabled{ true };
+	double m_pixelsPerTriangle{ 2.0 };
+	MeshDecimator::Options m_options;
+
+	std::vector<Job> m_queued;
+	bool m_launchPending{ false };
+	size_t m_running{ 0 };
+
+	std::atomic<bool> m_cancel{ false };
+	std::vector<std::future<void>> m_workers;
+	FrameRequest m_frameRequest;
+};
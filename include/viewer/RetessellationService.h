@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+#include <wx/event.h>
+#include <OpenCASCADE/TopTools_MapOfShape.hxx>
+#include <OpenCASCADE/TopoDS_Shape.hxx>
+#include "ProgressiveRefinement.h"
+#include "rendering/GeometryProcessor.h"
+
+class OCCGeometry;
+
+/**
+ * @brief Background fine retessellation for progressive refinement
+ *
+ * Geometries whose mesh was built with other parameters are meshed on a worker
+ * thread. The worker triangulates a topology copy of each shape, so it never
+ * touches TShapes that the UI thread or other geometries use. Finished
+ * triangulations are moved onto the geometry's own faces on the UI thread,
+ * inside the frame budget, and the Coin representation is rebuilt from them
+ * without running BRepMesh again. Results for a geometry whose shape or
+ * parameters changed in the meantime are dropped.
+ */
+class RetessellationService : public wxEvtHandler {
+public:
+	using FrameRequest = std::function<void()>;
+
+	RetessellationService();
+	~RetessellationService();
+
+	/**
+	 * @brief Swap in finished meshes within budgetMs, then start a batch for the rest
+	 */
+	ProgressiveRefinement::RefineResult step(const std::vector<std::shared_ptr<OCCGeometry>>& geometries,
+		const MeshParameters& params, double budgetMs);
+
+	// Drop the running batch and any meshes not yet swapped in
+	void cancel();
+
+	void setFrameRequest(FrameRequest request) { m_frameRequest = std::move(request); }
+
+private:
+	struct Job {
+		std::weak_ptr<OCCGeometry> geometry;
+		TopoDS_Shape shape;     // Geometry's shape when queued
+		TopoDS_Shape meshed;    // Topology copy the worker triangulates
+	};
+
+	struct Batch {
+		MeshParameters params;
+		std::vector<Job> jobs;
+		size_t installed = 0;
+		std::atomic<bool> cancelled{ false };
+	};
+
+	static bool needsRefinement(const OCCGeometry& geometry, const MeshParameters& params);
+	static bool sameParameters(const MeshParameters& a, const MeshParameters& b);
+	// Replace the triangulation of target's faces and edges with those of its meshed copy
+	static bool transferTriangulation(const TopoDS_Shape& meshed, const TopoDS_Shape& target);
+
+	void launch(std::vector<std::shared_ptr<OCCGeometry>> geometries, const MeshParameters& params);
+	void onBatchFinished(const std::shared_ptr<Batch>& batch);
+
+private:
+	std::shared_ptr<Batch> m_running;
+	std::shared_ptr<Batch> m_finished;
+
+	// Shapes that failed to mesh with m_failedParams; not retried until the parameters change
+	TopTools_MapOfShape m_failed;
+	MeshParameters m_failedParams;
+
+	std::atomic<bool> m_shutdown{ false };
+	std::vector<std::future<void>> m_workers;
+	FrameRequest m_frameRequest;
+};
@@ -5,17 +5,26 @@
 
 class SoSeparator;
 class OCCGeometry;
+class SceneManager;
 
 class SceneAttachmentService {
 public:
 	SceneAttachmentService(SoSeparator* occRoot,
-		std::unordered_map<SoSeparator*, std::shared_ptr<OCCGeometry>>* nodeToGeom);
+		std::unordered_map<SoSeparator*, std::shared_ptr<OCCGeometry>>* nodeToGeom,
+		SceneManager* sceneManager = nullptr);
+	~SceneAttachmentService();
 
 	void attach(std::shared_ptr<OCCGeometry> geometry);
 	void detach(std::shared_ptr<OCCGeometry> geometry);
 	void detachAll();
 
+	// Push the geometry's current world bounds into the scene bounds tree.
+	// Attached geometries call this themselves when their shape or transform changes.
+	void updateBounds(const std::shared_ptr<OCCGeometry>& geometry);
+	void updateBounds(const OCCGeometry& geometry);
+
 private:
 	SoSeparator* m_occRoot;
+	SceneManager* m_sceneManager;
 	std::unordered_map<SoSeparator*, std::shared_ptr<OCCGeometry>>* m_nodeToGeom;
 };
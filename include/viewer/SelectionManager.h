@@ -8,6 +8,7 @@
 
 class SceneManager;
 class OCCGeometry;
+class EdgeDisplayManager;
 
 class SelectionManager {
 public:
@@ -27,12 +28,17 @@ public:
 
 	void onSelectionChanged();
 
+	// Batched edges follow visibility and selection changes made here
+	void setEdgeDisplayManager(EdgeDisplayManager* edgeDisplayManager) { m_edgeDisplayManager = edgeDisplayManager; }
+
 private:
 	std::shared_ptr<OCCGeometry> findGeometry(const std::string& name);
 	void requestRefreshSelectionChanged();
 	void requestRefreshMaterialChanged();
+	void syncEdges(const std::shared_ptr<OCCGeometry>& geometry);
 
 	SceneManager* m_sceneManager;
 	std::vector<std::shared_ptr<OCCGeometry>>* m_allGeometries;
 	std::vector<std::shared_ptr<OCCGeometry>>* m_selectedGeometries;
+	EdgeDisplayManager* m_edgeDisplayManager{ nullptr };
 };
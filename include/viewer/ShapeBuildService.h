@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <wx/event.h>
+#include <OpenCASCADE/Message_ProgressRange.hxx>
+#include <OpenCASCADE/Message_ProgressScope.hxx>
+#include <OpenCASCADE/TopoDS_Shape.hxx>
+
+struct MeshParameters;
+struct TessellationSettings;
+
+/**
+ * @brief Background construction of OpenCASCADE shapes
+ *
+ * Each job builds its shape on a worker thread and then triangulates it there
+ * with the viewer's mesh parameters; the triangulation stays on the faces, so
+ * displaying the shape later does not mesh it again. The commit callback runs
+ * on the UI thread inside a single event and adds the finished geometry to the
+ * scene in one go, so no frame shows it half added. Jobs can be cancelled at
+ * any time: OCCT operations that were given a range from the job context stop
+ * at their next progress check, and a cancelled job never commits.
+ */
+class ShapeBuildService : public wxEvtHandler {
+public:
+	using JobId = uint64_t;
+
+	struct JobStatus {
+		JobId id = 0;
+		std::string label;
+		int percent = 0;        // Whole job, including triangulation
+		std::string stage;
+		bool running = false;   // False while waiting in the queue
+	};
+
+	class Job;
+
+	/**
+	 * @brief Worker-side handle of a running job
+	 */
+	class Context {
+	public:
+		Context(const std::shared_ptr<Job>& job, const Message_ProgressRange& range);
+
+		bool isCancelled() const;
+
+		/**
+		 * @brief Range for the next step, covering span percent of the build
+		 *
+		 * Pass it to the OCCT operation of that step, or let it go out of scope
+		 * for steps without progress support; either way the step counts as done.
+		 */
+		Message_ProgressRange step(double span, const std::string& stage);
+
+	private:
+		std::shared_ptr<Job> m_job;
+		Message_ProgressScope m_scope;
+	};
+
+	using BuildFunc = std::function<TopoDS_Shape(Context& context)>;
+	using CommitFunc = std::function<void(const TopoDS_Shape& shape)>;
+
+	ShapeBuildService();
+	~ShapeBuildService();
+
+	// Mesh parameters to triangulate with, read when a job starts together with
+	// the toolkit's tessellation settings
+	void setMeshParameters(const MeshParameters* params) { m_meshParams = params; }
+
+	// Jobs running at the same time; further jobs wait in submission order
+	void setMaxConcurrentJobs(size_t count) { m_maxConcurrent = count > 0 ? count : 1; }
+
+	/**
+	 * @brief Queue a job
+	 * @param build Runs on a worker thread; must not touch the scene graph
+	 * @param commit Runs on the UI thread with the triangulated shape
+	 */
+	JobId submit(const std::string& label, BuildFunc build, CommitFunc commit);
+
+	bool cancel(JobId id);
+	void cancelAll();
+
+	size_t getPendingCount() const { return m_queued.size() + m_running.size(); }
+	std::vector<JobStatus> getJobs() const;
+
+private:
+	void launchQueued();
+	void run(const std::shared_ptr<Job>& job, const MeshParameters& meshParams, const TessellationSettings& tessellation);
+	void onJobFinished(const std::shared_ptr<Job>& job, const TopoDS_Shape& shape, const std::string& error);
+
+private:
+	JobId m_nextId{ 1 };
+	size_t m_maxConcurrent{ 2 };
+	const MeshParameters* m_meshParams{ nullptr };
+
+	std::deque<std::shared_ptr<Job>> m_queued;
+	std::vector<std::shared_ptr<Job>> m_running;
+
+	std::atomic<bool> m_shutdown{ false };
+	std::vector<std::future<void>> m_workers;
+};
@@ -14,8 +14,10 @@ public:
 	virtual void addGeometry(std::shared_ptr<OCCGeometry> geometry) = 0;
 	virtual void removeGeometry(std::shared_ptr<OCCGeometry> geometry) = 0;
 	virtual void removeGeometry(const std::string& name) = 0;
+	virtual void removeGeometries(const std::vector<std::shared_ptr<OCCGeometry>>& geometries) = 0;
 	virtual void clearAll() = 0;
 	virtual std::shared_ptr<OCCGeometry> findGeometry(const std::string& name) = 0;
+	virtual std::vector<std::shared_ptr<OCCGeometry>> findGeometriesByFile(const std::string& fileName) = 0;
 	virtual std::vector<std::shared_ptr<OCCGeometry>> getAllGeometry() const = 0;
 	virtual std::vector<std::shared_ptr<OCCGeometry>> getSelectedGeometries() const = 0;
 
@@ -12,6 +12,8 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <unordered_map>
+#include <cstdint>
 
 // Forward declarations
 class FlatTreeView;
@@ -44,6 +46,9 @@ public:
 	FlatTreeItem(const wxString& text, ItemType type = ItemType::FOLDER);
 	virtual ~FlatTreeItem();
 
+	// Stable identity, unique for the lifetime of the process
+	uint64_t GetId() const { return m_id; }
+
 	// Basic properties
 	void SetText(const wxString& text);
 	wxString GetText() const { return m_text; }
@@ -66,6 +71,7 @@ public:
 	// Hierarchy management
 	void AddChild(std::shared_ptr<FlatTreeItem> child);
 	void RemoveChild(std::shared_ptr<FlatTreeItem> child);
+	void RemoveChildrenIf(const std::function<bool(const std::shared_ptr<FlatTreeItem>&)>& predicate);
 	void ClearChildren();
 
 	std::vector<std::shared_ptr<FlatTreeItem>>& GetChildren() { return m_children; }
@@ -74,6 +80,11 @@ public:
 	void SetParent(FlatTreeItem* parent);
 	FlatTreeItem* GetParent() const { return m_parent; }
 
+	// Lazy children: the loader runs once, the first time the item is expanded
+	void SetChildrenLoader(std::function<void(FlatTreeItem&)> loader);
+	bool HasPendingChildren() const { return static_cast<bool>(m_childrenLoader); }
+	void EnsureChildrenLoaded();
+
 	// Column data
 	void SetColumnData(int column, const wxString& data);
 	wxString GetColumnData(int column) const;
@@ -81,12 +92,36 @@ public:
 	void SetColumnIcon(int column, const wxBitmap& icon);
 	wxBitmap GetColumnIcon(int column) const;
 
+	// SVG icons, drawn in preference to the bitmap icons
+	void SetSvgIcon(const wxString& iconName, const wxSize& size);
+	wxString GetSvgIconName() const { return m_svgIconName; }
+	wxSize GetSvgIconSize() const { return m_svgIconSize; }
+
+	void SetColumnSvgIcon(int column, const wxString& iconName, const wxSize& size);
+	wxString GetColumnSvgIconName(int column) const;
+	wxSize GetColumnSvgIconSize(int column) const;
+
+	// Text width in pixels for layout, -1 until measured
+	int GetTextWidth() const { return m_textWidth; }
+	void SetTextWidth(int width) { m_textWidth = width; }
+
 	// Utility methods
-	bool HasChildren() const { return !m_children.empty(); }
+	bool HasChildren() const { return !m_children.empty() || HasPendingChildren(); }
 	int GetLevel() const;
 	bool IsRoot() const { return m_parent == nullptr; }
 
 private:
+	struct ColumnCell {
+		wxString data;
+		wxBitmap icon;
+		wxString svgIconName;
+		wxSize svgIconSize;
+	};
+
+	const ColumnCell* FindColumnCell(int column) const;
+	ColumnCell& GetColumnCell(int column);
+
+	uint64_t m_id;
 	wxString m_text;
 	ItemType m_type;
 	wxBitmap m_icon;
@@ -96,10 +131,14 @@ private:
 
 	FlatTreeItem* m_parent;
 	std::vector<std::shared_ptr<FlatTreeItem>> m_children;
+	std::function<void(FlatTreeItem&)> m_childrenLoader;
+
+	wxString m_svgIconName;
+	wxSize m_svgIconSize;
+	int m_textWidth;
 
-	// Column data storage
-	std::map<int, wxString> m_columnData;
-	std::map<int, wxBitmap> m_columnIcons;
+	// Column data storage, indexed by column
+	std::vector<ColumnCell> m_columnCells;
 };
 
 // Column definition
@@ -278,6 +317,10 @@ public:
 	void BuildVisibleItemsList();
 	void BuildVisibleItemsRecursive(std::shared_ptr<FlatTreeItem> item, int& currentIndex, int level);
 	void InvalidateVisibleItemsList() { m_visibleItemsValid = false; }
+	int FindVisibleRowAt(int y) const;
+	int FindVisibleRow(const FlatTreeItem* item) const;
+	bool SpliceVisibleRows(std::shared_ptr<FlatTreeItem> item);
+	void UpdateVisibleRowsFrom(size_t row);
 
 	// Utility methods
 	void RefreshItem(std::shared_ptr<FlatTreeItem> item);
@@ -340,10 +383,6 @@ private:
 	wxSize m_svgIconSize;
 	std::map<int, wxString> m_columnSvgIconNames;
 	std::map<int, wxSize> m_columnSvgIconSizes;
-	std::map<std::shared_ptr<FlatTreeItem>, wxString> m_itemSvgIconNames;
-	std::map<std::shared_ptr<FlatTreeItem>, wxSize> m_itemSvgIconSizes;
-	std::map<std::pair<std::shared_ptr<FlatTreeItem>, int>, wxString> m_itemColumnSvgIconNames;
-	std::map<std::pair<std::shared_ptr<FlatTreeItem>, int>, wxSize> m_itemColumnSvgIconSizes;
 
 	// Column resizing state
 	bool m_isResizingColumn;
@@ -365,9 +404,10 @@ private:
 	struct VisibleItemInfo {
 		std::shared_ptr<FlatTreeItem> item;
 		int level;
-		int yPosition;
+		int yPosition;  // prefix sum of the row heights above
 	};
 	std::vector<VisibleItemInfo> m_visibleItems;
+	std::unordered_map<const FlatTreeItem*, size_t> m_visibleRowOf;  // item -> row in m_visibleItems
 	bool m_visibleItemsValid;
 
 	// Cached scrollbar height for consistent layout calculations
@@ -1,5 +1,7 @@
 #include <wx/wx.h>
 #include <wx/display.h>
+#include <wx/filename.h>
+#include <wx/stdpaths.h>
 #include <cstdio>  
 #include <string>
 #include <algorithm>
@@ -7,6 +9,7 @@
 #include "config/ConfigManager.h"
 #include "config/LoggerConfig.h"
 #include "config/ConstantsConfig.h"
+#include "edges/EdgeGeometryCache.h"
 #include "logger/Logger.h"
 #include "FlatFrame.h"
 #include "rendering/RenderingToolkitAPI.h"
@@ -86,6 +89,16 @@ bool MainApplication::OnInit()
     }
     ConstantsConfig::getInstance().initialize(cm);
 
+    // The on-disk edge cache is opt-in; a relative directory is kept under the per-user data directory
+    std::string edgeCacheDirectory = cm.getString("EdgeCache", "PersistentDirectory", "");
+    if (!edgeCacheDirectory.empty()) {
+        wxFileName directory = wxFileName::DirName(wxString::FromUTF8(edgeCacheDirectory));
+        if (directory.IsRelative()) {
+            directory.MakeAbsolute(wxStandardPaths::Get().GetUserDataDir());
+        }
+        EdgeGeometryCache::getInstance().setPersistentDirectory(directory.GetPath().ToStdString(wxConvUTF8));
+    }
+
     // Initialize FontManager after ConfigManager
     FontManager& fm = FontManager::getInstance();
     if (!fm.initialize("config/config.ini")) { // Pass the path to config.ini
@@ -1,9 +1,12 @@
 #include <wx/wx.h>
 #include <wx/display.h>
+#include <wx/filename.h>
+#include <wx/stdpaths.h>
 
 #include "MainApplication.h"
 #include "config/ConfigManager.h"
 #include "config/ConstantsConfig.h"
+#include "edges/EdgeGeometryCache.h"
 #include "config/FontManager.h"
 #include "interfaces/DefaultSubsystemFactory.h"
 #include "interfaces/ServiceLocator.h"
@@ -93,6 +96,16 @@ bool MainApplicationDocking::OnInit()
 
 	ConstantsConfig::getInstance().initialize(cm);
 
+	// The on-disk edge cache is opt-in; a relative directory is kept under the per-user data directory
+	std::string edgeCacheDirectory = cm.getString("EdgeCache", "PersistentDirectory", "");
+	if (!edgeCacheDirectory.empty()) {
+		wxFileName directory = wxFileName::DirName(wxString::FromUTF8(edgeCacheDirectory));
+		if (directory.IsRelative()) {
+			directory.MakeAbsolute(wxStandardPaths::Get().GetUserDataDir());
+		}
+		EdgeGeometryCache::getInstance().setPersistentDirectory(directory.GetPath().ToStdString(wxConvUTF8));
+	}
+
 	// Initialize FontManager after ConfigManager
 	showStageMessage("Initializing font subsystem...");
 	FontManager& fontManager = FontManager::getInstance();
@@ -1,9 +1,17 @@
 #include "Command.h"
+#include "logger/Logger.h"
 #include <iostream>
 #include <memory>
 
+namespace {
+	const size_t kDefaultMaxHistoryBytes = 256 * 1024 * 1024;
+}
+
 CommandManager::CommandManager()
-	: m_maxStackSize(100)
+	: m_undoBytes(0)
+	, m_redoBytes(0)
+	, m_maxStackSize(100)
+	, m_maxHistoryBytes(kDefaultMaxHistoryBytes)
 {
 }
 
@@ -19,14 +27,12 @@ void CommandManager::executeCommand(std::shared_ptr<Command> command)
 
 	command->execute();
 
-	m_undoStack.push_back(command);
-
 	m_redoStack.clear();
+	m_redoBytes = 0;
 
-	if (m_undoStack.size() > m_maxStackSize)
-	{
-		m_undoStack.erase(m_undoStack.begin());
-	}
+	// Cost is measured once here; undo and redo only move the entry between stacks
+	size_t cost = command->getMemoryCost();
+	pushUndo({ std::move(command), cost });
 }
 
 bool CommandManager::canUndo() const
@@ -44,17 +50,13 @@ void CommandManager::undo()
 	if (!canUndo())
 		return;
 
-	std::shared_ptr<Command> command = m_undoStack.back();
+	Entry entry = std::move(m_undoStack.back());
 	m_undoStack.pop_back();
+	m_undoBytes -= entry.cost;
 
-	command->unexecute();
+	entry.command->unexecute();
 
-	m_redoStack.push_back(command);
-
-	if (m_redoStack.size() > m_maxStackSize)
-	{
-		m_redoStack.erase(m_redoStack.begin());
-	}
+	pushRedo(std::move(entry));
 }
 
 void CommandManager::redo()
@@ -62,35 +64,98 @@ void CommandManager::redo()
 	if (!canRedo())
 		return;
 
-	std::shared_ptr<Command> command = m_redoStack.back();
+	Entry entry = std::move(m_redoStack.back());
 	m_redoStack.pop_back();
+	m_redoBytes -= entry.cost;
 
-	command->execute();
-
-	m_undoStack.push_back(command);
+	entry.command->execute();
 
-	if (m_undoStack.size() > m_maxStackSize)
-	{
-		m_undoStack.erase(m_undoStack.begin());
-	}
+	pushUndo(std::move(entry));
 }
 
 void CommandManager::clearHistory()
 {
 	m_undoStack.clear();
 	m_redoStack.clear();
+	m_undoBytes = 0;
+	m_redoBytes = 0;
 }
 
 std::string CommandManager::getUndoCommandDescription() const
 {
 	if (canUndo())
-		return m_undoStack.back()->getDescription();
+		return m_undoStack.back().command->getDescription();
 	return "";
 }
 
 std::string CommandManager::getRedoCommandDescription() const
 {
 	if (canRedo())
-		return m_redoStack.back()->getDescription();
+		return m_redoStack.back().command->getDescription();
 	return "";
-}
\ No newline at end of file
+}
+
+void CommandManager::setMaxStackSize(size_t maxStackSize)
+{
+	m_maxStackSize = maxStackSize;
+	enforceLimits();
+}
+
+void CommandManager::setMaxHistoryBytes(size_t maxHistoryBytes)
+{
+	m_maxHistoryBytes = maxHistoryBytes;
+	enforceLimits();
+}
+
+size_t CommandManager::getUndoCommandCost() const
+{
+	return canUndo() ? m_undoStack.back().cost : 0;
+}
+
+size_t CommandManager::getRedoCommandCost() const
+{
+	return canRedo() ? m_redoStack.back().cost : 0;
+}
+
+void CommandManager::pushUndo(Entry entry)
+{
+	m_undoBytes += entry.cost;
+	m_undoStack.push_back(std::move(entry));
+	enforceLimits();
+}
+
+void CommandManager::pushRedo(Entry entry)
+{
+	m_redoBytes += entry.cost;
+	m_redoStack.push_back(std::move(entry));
+	enforceLimits();
+}
+
+void CommandManager::enforceLimits()
+{
+	// Oldest first: the bottom of the undo stack, then the far end of the redo stack.
+	// The most recent command on each stack is always kept.
+	size_t evicted = 0;
+	size_t evictedBytes = 0;
+	while (m_undoStack.size() > 1 &&
+		(m_undoStack.size() > m_maxStackSize || getHistoryBytes() > m_maxHistoryBytes))
+	{
+		m_undoBytes -= m_undoStack.front().cost;
+		evictedBytes += m_undoStack.front().cost;
+		m_undoStack.pop_front();
+		++evicted;
+	}
+	while (m_redoStack.size() > 1 &&
+		(m_redoStack.size() > m_maxStackSize || getHistoryBytes() > m_maxHistoryBytes))
+	{
+		m_redoBytes -= m_redoStack.front().cost;
+		evictedBytes += m_redoStack.front().cost;
+		m_redoStack.pop_front();
+		++evicted;
+	}
+
+	if (evicted > 0) {
+		LOG_DBG_S("CommandManager: dropped " + std::to_string(evicted) + " oldest history entries (" +
+			std::to_string(evictedBytes) + " bytes), history now " + std::to_string(getHistoryBytes()) + " bytes");
+	}
+}
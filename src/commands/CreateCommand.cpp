@@ -37,4 +37,14 @@ std::string CreateCommand::getDescription() const
 		return "Create " + m_object->getName();
 	}
 	return "Create Object";
+}
+
+size_t CreateCommand::getMemoryCost() const
+{
+	// The command owns the object; its scene graph is shared with the scene while executed
+	size_t cost = sizeof(CreateCommand);
+	if (m_object) {
+		cost += sizeof(GeometryObject) + m_object->getName().size();
+	}
+	return cost;
 }
\ No newline at end of file
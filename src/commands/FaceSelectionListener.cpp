@@ -7,6 +7,7 @@
 #include "OCCViewer.h"
 #include "rendering/GeometryProcessor.h"
 #include "config/SelectionHighlightConfig.h"
+#include "geometry/helper/FaceLookupIndex.h"
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoSwitch.h>
 #include <Inventor/nodes/SoMaterial.h>
@@ -492,6 +493,44 @@ SoSeparator* FaceSelectionListener::createHighlightGeometry(std::shared_ptr<OCCG
 	faceSet->coordIndex.finishEditing();
 	highlightSeparator->addChild(faceSet);
 
+	// Outline the face with its edge polylines from the lookup tables
+	const FaceLookupIndex* lookup = geometry->getFaceLookupIndex();
+	FaceLookupIndex::IdRange edges = lookup ? lookup->edgesForFace(faceId) : FaceLookupIndex::IdRange();
+	if (!edges.empty()) {
+		SoSeparator* outline = new SoSeparator;
+
+		SoDrawStyle* lineStyle = new SoDrawStyle;
+		lineStyle->style = SoDrawStyle::LINES;
+		lineStyle->lineWidth = isSelection ? faceHighlight.selectionLineWidth : faceHighlight.lineWidth;
+		outline->addChild(lineStyle);
+
+		SoMaterial* lineMaterial = new SoMaterial;
+		const ColorRGB& lineColor = isSelection ? faceHighlight.selectionDiffuse : faceHighlight.hoverDiffuse;
+		lineMaterial->diffuseColor.setValue(lineColor.r, lineColor.g, lineColor.b);
+		lineMaterial->emissiveColor.setValue(lineColor.r, lineColor.g, lineColor.b);
+		outline->addChild(lineMaterial);
+
+		SoCoordinate3* lineCoords = new SoCoordinate3;
+		SoIndexedLineSet* lineSet = new SoIndexedLineSet;
+		int pointIndex = 0;
+		int lineIndex = 0;
+		for (uint32_t edgeId : edges) {
+			FaceLookupIndex::PointRange polyline = lookup->polylineForEdge(edgeId);
+			if (polyline.size() < 2) {
+				continue;
+			}
+			const float* xyz = polyline.data();
+			for (std::size_t i = 0; i < polyline.size(); ++i) {
+				lineCoords->point.set1Value(pointIndex, xyz[i * 3], xyz[i * 3 + 1], xyz[i * 3 + 2]);
+				lineSet->coordIndex.set1Value(lineIndex++, pointIndex++);
+			}
+			lineSet->coordIndex.set1Value(lineIndex++, -1);
+		}
+		outline->addChild(lineCoords);
+		outline->addChild(lineSet);
+		highlightSeparator->addChild(outline);
+	}
+
 	return highlightSeparator;
 }
 
@@ -18,28 +18,20 @@ CommandResult FixNormalsListener::executeCommand(const std::string& commandType,
 		
 		LOG_INF_S("Starting normal correction for " + std::to_string(geometries.size()) + " geometries");
 		
-		int correctedCount = 0;
 		int totalCount = geometries.size();
 		
-		// Apply normal correction to each geometry
-		for (auto& geometry : geometries) {
-			if (!geometry) continue;
-			
-			const TopoDS_Shape& originalShape = geometry->getShape();
-			if (originalShape.IsNull()) continue;
-			
-			// Apply normal correction
-			TopoDS_Shape correctedShape = NormalValidator::autoCorrectNormals(originalShape, geometry->getName());
-			
-			// Update the geometry with corrected shape
-			geometry->setShape(correctedShape);
+		// Shapes are analysed and rebuilt in parallel; only geometries that changed are updated here
+		auto corrections = NormalValidator::correctNormals(geometries);
+		int correctedCount = 0;
+		for (auto& correction : corrections) {
+			correction.geometry->setShape(correction.correctedShape);
 			correctedCount++;
 		}
 		
 		// Refresh the viewer to show changes
 		m_viewer->requestViewRefresh();
 		
-		LOG_INF_S("Normal correction completed: " + std::to_string(correctedCount) + "/" + std::to_string(totalCount) + " geometries processed");
+		LOG_INF_S("Normal correction completed: " + std::to_string(correctedCount) + "/" + std::to_string(totalCount) + " geometries corrected");
 		
 		return CommandResult(true, "Face normals fixed for " + std::to_string(correctedCount) + " geometries", commandType);
 		
@@ -17,6 +17,13 @@
 #include <gp_Pnt.hxx>
 #include <opencascade/TopExp_Explorer.hxx>
 
+namespace {
+	std::string nextWrenchName() {
+		static int wrenchCounter = 0;
+		return "OCCWrench_" + std::to_string(++wrenchCounter);
+	}
+}
+
 GeometryFactory::GeometryFactory(SoSeparator* root, ObjectTreePanel* treePanel, PropertyPanel* propPanel,
 	CommandManager* cmdManager, OCCViewer* occViewer)
 	: m_root(root)
@@ -81,7 +88,9 @@ void GeometryFactory::createOCCGeometry(const std::string& type, const SbVec3f&
 		geometry = createOCCTruncatedCylinder(position);
 	}
 	else if (type == "Wrench") {
-		geometry = createOCCWrench(position);
+		// Booleans, fillets and chamfers take long enough to block the UI; build in the background
+		createOCCWrenchAsync(position);
+		return;
 	}
 	else if (type == "NavCube") {
 		geometry = createOCCNavCube(position);
@@ -113,7 +122,8 @@ void GeometryFactory::createOCCGeometry(const std::string& type, const SbVec3f&
 	}
 }
 
-std::shared_ptr<OCCGeometry> GeometryFactory::createOCCGeometryWithParameters(const std::string& type, const SbVec3f& position, const BasicGeometryParameters& params) {
+std::shared_ptr<OCCGeometry> GeometryFactory::createOCCGeometryWithParameters(const std::string& type, const SbVec3f& position, const BasicGeometryParameters& params,
+	GeometryCallback onCreated) {
 	LOG_DBG_S("[GeometryFactoryDebug] createOCCGeometryWithParameters called with position: (" + std::to_string(position[0]) + ", " + std::to_string(position[1]) + ", " + std::to_string(position[2]) + ")");
 
 	std::shared_ptr<OCCGeometry> geometry = nullptr;
@@ -137,7 +147,8 @@ std::shared_ptr<OCCGeometry> GeometryFactory::createOCCGeometryWithParameters(co
 		geometry = createOCCTruncatedCylinder(position, params.truncatedBottomRadius, params.truncatedTopRadius, params.truncatedHeight);
 	}
 	else if (type == "Wrench") {
-		geometry = createOCCWrench(position);
+		createOCCWrenchAsync(position, std::move(onCreated));
+		return nullptr;
 	}
 	else if (type == "NavCube") {
 		geometry = createOCCNavCube(position, params.width); // Use width as size parameter
@@ -163,6 +174,10 @@ std::shared_ptr<OCCGeometry> GeometryFactory::createOCCGeometryWithParameters(co
 			LOG_DBG_S("Auto-executing fitAll after creating geometry: " + type);
 			m_occViewer->fitAll();
 		}
+
+		if (onCreated) {
+			onCreated(geometry);
+		}
 	}
 	else {
 		LOG_ERR_S("Failed to create OCC geometry with parameters: " + type);
@@ -380,305 +395,377 @@ std::shared_ptr<OCCGeometry> GeometryFactory::createOCCTruncatedCylinder(const S
 }
 
 std::shared_ptr<OCCGeometry> GeometryFactory::createOCCWrench(const SbVec3f& position) {
-	static int wrenchCounter = 0;
-	std::string name = "OCCWrench_" + std::to_string(++wrenchCounter);
+	std::string name = nextWrenchName();
 
 	try {
-		// Realistic wrench dimensions (in cm) - based on real adjustable wrenches
-		double totalLength = 25.0;           // Total length of wrench
-		double handleLength = 15.0;          // Handle length
-		double handleWidth = 2.5;            // Handle width
-		double handleThickness = 1.2;        // Handle thickness
-
-		double headLength = 10.0;            // Head length
-		double headWidth = 5.0;              // Head width
-		double headThickness = 1.5;          // Head thickness
-		double jawOpening = 1.5;             // Increased jaw opening for better visibility
-		double jawDepth = 3.5;               // Increased jaw depth
-
-		LOG_INF_S("Creating professional wrench with proper connection...");
-
-		// 1. Create main handle with ergonomic design
-		TopoDS_Shape handle = OCCShapeBuilder::createBox(
-			handleLength,
-			handleWidth,
-			handleThickness,
-			gp_Pnt(-handleLength / 2.0, -handleWidth / 2.0, -handleThickness / 2.0)
-		);
-
-		if (handle.IsNull()) {
-			LOG_ERR_S("Failed to create wrench handle");
-			return nullptr;
-		}
-
-		// 2. Create fixed jaw (left side) - more substantial and realistic
-		double fixedJawLength = headLength * 0.6;
-		TopoDS_Shape fixedJaw = OCCShapeBuilder::createBox(
-			fixedJawLength,
-			headWidth,
-			headThickness,
-			gp_Pnt(-handleLength / 2.0 - fixedJawLength, -headWidth / 2.0, -headThickness / 2.0)
-		);
-
-		if (fixedJaw.IsNull()) {
-			LOG_ERR_S("Failed to create fixed jaw");
-			return nullptr;
-		}
-
-		// 3. Create movable jaw (right side) - smaller and adjustable
-		double movableJawLength = headLength * 0.2;
-		TopoDS_Shape movableJaw = OCCShapeBuilder::createBox(
-			movableJawLength,
-			headWidth,
-			headThickness,
-			gp_Pnt(handleLength / 2.0, -headWidth / 2.0, -headThickness / 2.0)
-		);
-
-		if (movableJaw.IsNull()) {
-			LOG_ERR_S("Failed to create movable jaw");
-			return nullptr;
-		}
-
-		// 4. Create connection bridge between fixed and movable jaws
-		double bridgeLength = headLength * 0.2; // 20% of head length for connection
-		double bridgeWidth = headWidth * 0.8;   // Slightly narrower than head
-		double bridgeThickness = headThickness * 0.6; // Thinner than head for realistic look
-
-		TopoDS_Shape connectionBridge = OCCShapeBuilder::createBox(
-			bridgeLength,
-			bridgeWidth,
-			bridgeThickness,
-			gp_Pnt(-handleLength / 2.0 - fixedJawLength + bridgeLength / 2.0,
-				-bridgeWidth / 2.0,
-				-bridgeThickness / 2.0)
-		);
-
-		if (connectionBridge.IsNull()) {
-			LOG_ERR_S("Failed to create connection bridge");
-			return nullptr;
-		}
-
-		// 5. Union all main parts to create connected structure
-		TopoDS_Shape wrenchBody = OCCShapeBuilder::booleanUnion(handle, fixedJaw);
+		TopoDS_Shape wrenchBody = buildWrenchShape(name, nullptr);
 		if (wrenchBody.IsNull()) {
-			LOG_ERR_S("Failed to union handle with fixed jaw");
 			return nullptr;
 		}
 
-		wrenchBody = OCCShapeBuilder::booleanUnion(wrenchBody, connectionBridge);
-		if (wrenchBody.IsNull()) {
-			LOG_ERR_S("Failed to union with connection bridge");
-			return nullptr;
-		}
-
-		wrenchBody = OCCShapeBuilder::booleanUnion(wrenchBody, movableJaw);
-		if (wrenchBody.IsNull()) {
-			LOG_ERR_S("Failed to union with movable jaw");
-			return nullptr;
-		}
+		auto geometry = std::make_shared<OCCGeometry>(name);
+		geometry->setShape(wrenchBody);
+		// Set position to the specified location - this ensures the geometry is properly positioned
+		geometry->setPosition(gp_Pnt(position[0], position[1], position[2]));
+		LOG_INF_S("[GeometryFactoryDebug] Final wrench position set to: (" + std::to_string(position[0]) + ", " + std::to_string(position[1]) + ", " + std::to_string(position[2]) + ")");
 
-		LOG_INF_S("Connected wrench body created, now adding jaw openings...");
-
-		// 6. Create larger, more visible jaw openings
-		// Fixed jaw opening - much larger and more visible
-		double fixedSlotWidth = jawOpening * 0.8;  // Increased from 0.6
-		double fixedSlotDepth = jawDepth * 0.9;     // Increased from 0.8
-		double fixedSlotHeight = headThickness * 0.98; // Almost full height
-
-		TopoDS_Shape fixedSlot = OCCShapeBuilder::createBox(
-			fixedSlotWidth,
-			fixedSlotDepth,
-			fixedSlotHeight,
-			gp_Pnt(-handleLength / 2.0 - fixedJawLength + fixedSlotWidth / 2.0,
-				-fixedSlotDepth / 2.0,
-				-fixedSlotHeight / 2.0)
-		);
+		// Build face index mapping for system-created geometry
+		buildFaceIndexMappingForSystemGeometry(geometry, "wrench");
 
-		if (!fixedSlot.IsNull()) {
-			TopoDS_Shape tempResult = OCCShapeBuilder::booleanDifference(wrenchBody, fixedSlot);
-			if (!tempResult.IsNull()) {
-				wrenchBody = tempResult;
-				LOG_INF_S("Created large fixed jaw opening");
-			}
-		}
+		LOG_INF_S("Created connected professional wrench model: " + name);
+		return geometry;
+	}
+	catch (const std::exception& e) {
+		LOG_ERR_S("Exception creating wrench: " + std::string(e.what()));
+		return nullptr;
+	}
+}
 
-		// 7. Create movable jaw opening - also larger and more visible
-		double movableSlotWidth = jawOpening * 0.6;  // Increased from 0.4
-		double movableSlotDepth = jawDepth * 0.8;     // Increased from 0.6
-		double movableSlotHeight = headThickness * 0.98; // Almost full height
-
-		TopoDS_Shape movableSlot = OCCShapeBuilder::createBox(
-			movableSlotWidth,
-			movableSlotDepth,
-			movableSlotHeight,
-			gp_Pnt(handleLength / 2.0 - movableSlotWidth - 0.1,
-				-movableSlotDepth / 2.0,
-				-movableSlotHeight / 2.0)
-		);
+ShapeBuildService::JobId GeometryFactory::createOCCWrenchAsync(const SbVec3f& position, GeometryCallback onCreated) {
+	std::string name = nextWrenchName();
+	return createOCCGeometryAsync(name, position,
+		[name](ShapeBuildService::Context& context) {
+			return buildWrenchShape(name, &context);
+		},
+		std::move(onCreated));
+}
 
-		if (!movableSlot.IsNull() && !wrenchBody.IsNull()) {
-			TopoDS_Shape tempResult = OCCShapeBuilder::booleanDifference(wrenchBody, movableSlot);
-			if (!tempResult.IsNull()) {
-				wrenchBody = tempResult;
-				LOG_INF_S("Created large movable jaw opening");
+ShapeBuildService::JobId GeometryFactory::createOCCGeometryAsync(const std::string& name, const SbVec3f& position,
+	ShapeBuildService::BuildFunc build, GeometryCallback onCreated) {
+	ShapeBuildService* service = m_occViewer ? m_occViewer->getShapeBuildService() : nullptr;
+	if (!service) {
+		LOG_ERR_S("No shape build service available for " + name);
+		return 0;
+	}
+
+	// The factory is often a temporary, so the commit only captures long-lived objects
+	ObjectTreePanel* treePanel = m_treePanel;
+	OCCViewer* occViewer = m_occViewer;
+	gp_Pnt location(position[0], position[1], position[2]);
+	return service->submit(name, std::move(build),
+		[name, location, treePanel, occViewer, onCreated](const TopoDS_Shape& shape) {
+			auto geometry = std::make_shared<OCCGeometry>(name);
+			geometry->setShape(shape);
+			geometry->setPosition(location);
+			buildFaceIndexMappingForSystemGeometry(geometry, name);
+
+			addToScene(treePanel, occViewer, geometry);
+			if (onCreated) {
+				onCreated(geometry);
 			}
-		}
+		});
+}
 
-		// 8. Add threaded adjustment mechanism with realistic proportions
-		double threadDiameter = 1.0;
-		double threadLength = 4.0;
-
-		TopoDS_Shape adjustmentThread = OCCShapeBuilder::createCylinder(
-			threadDiameter / 2.0,
-			threadLength,
-			gp_Pnt(handleLength / 2.0 + movableJawLength + threadLength / 2.0,
-				0.0,
-				0.0),
-			gp_Dir(1, 0, 0)
+void GeometryFactory::addToScene(ObjectTreePanel* treePanel, OCCViewer* occViewer, const std::shared_ptr<OCCGeometry>& geometry) {
+	if (treePanel) {
+		treePanel->addOCCGeometry(geometry);
+	}
+	if (occViewer) {
+		occViewer->addGeometry(geometry);
+		LOG_DBG_S("Auto-executing fitAll after creating geometry: " + geometry->getName());
+		occViewer->fitAll();
+	}
+}
+
+TopoDS_Shape GeometryFactory::buildWrenchShape(const std::string& name, ShapeBuildService::Context* context) {
+	// Progress ranges and cancellation only exist when building in the background
+	auto step = [context](double span, const std::string& stage) {
+		return context ? context->step(span, stage) : Message_ProgressRange();
+	};
+	auto cancelled = [context]() {
+		return context && context->isCancelled();
+	};
+
+	// Realistic wrench dimensions (in cm) - based on real adjustable wrenches
+	double handleLength = 15.0;          // Handle length
+	double handleWidth = 2.5;            // Handle width
+	double handleThickness = 1.2;        // Handle thickness
+
+	double headLength = 10.0;            // Head length
+	double headWidth = 5.0;              // Head width
+	double headThickness = 1.5;          // Head thickness
+	double jawOpening = 1.5;             // Increased jaw opening for better visibility
+	double jawDepth = 3.5;               // Increased jaw depth
+
+	LOG_INF_S("Creating professional wrench with proper connection...");
+
+	// 1. Create main handle with ergonomic design
+	TopoDS_Shape handle = OCCShapeBuilder::createBox(
+		handleLength,
+		handleWidth,
+		handleThickness,
+		gp_Pnt(-handleLength / 2.0, -handleWidth / 2.0, -handleThickness / 2.0)
+	);
+
+	if (handle.IsNull()) {
+		LOG_ERR_S("Failed to create wrench handle");
+		return TopoDS_Shape();
+	}
+
+	// 2. Create fixed jaw (left side) - more substantial and realistic
+	double fixedJawLength = headLength * 0.6;
+	TopoDS_Shape fixedJaw = OCCShapeBuilder::createBox(
+		fixedJawLength,
+		headWidth,
+		headThickness,
+		gp_Pnt(-handleLength / 2.0 - fixedJawLength, -headWidth / 2.0, -headThickness / 2.0)
+	);
+
+	if (fixedJaw.IsNull()) {
+		LOG_ERR_S("Failed to create fixed jaw");
+		return TopoDS_Shape();
+	}
+
+	// 3. Create movable jaw (right side) - smaller and adjustable
+	double movableJawLength = headLength * 0.2;
+	TopoDS_Shape movableJaw = OCCShapeBuilder::createBox(
+		movableJawLength,
+		headWidth,
+		headThickness,
+		gp_Pnt(handleLength / 2.0, -headWidth / 2.0, -headThickness / 2.0)
+	);
+
+	if (movableJaw.IsNull()) {
+		LOG_ERR_S("Failed to create movable jaw");
+		return TopoDS_Shape();
+	}
+
+	// 4. Create connection bridge between fixed and movable jaws
+	double bridgeLength = headLength * 0.2; // 20% of head length for connection
+	double bridgeWidth = headWidth * 0.8;   // Slightly narrower than head
+	double bridgeThickness = headThickness * 0.6; // Thinner than head for realistic look
+
+	TopoDS_Shape connectionBridge = OCCShapeBuilder::createBox(
+		bridgeLength,
+		bridgeWidth,
+		bridgeThickness,
+		gp_Pnt(-handleLength / 2.0 - fixedJawLength + bridgeLength / 2.0,
+			-bridgeWidth / 2.0,
+			-bridgeThickness / 2.0)
+	);
+
+	if (connectionBridge.IsNull()) {
+		LOG_ERR_S("Failed to create connection bridge");
+		return TopoDS_Shape();
+	}
+
+	// 5. Union all main parts to create connected structure
+	TopoDS_Shape wrenchBody = OCCShapeBuilder::booleanUnion(handle, fixedJaw, step(4, "Joining jaws"));
+	if (cancelled()) return TopoDS_Shape();
+	if (wrenchBody.IsNull()) {
+		LOG_ERR_S("Failed to union handle with fixed jaw");
+		return TopoDS_Shape();
+	}
+
+	wrenchBody = OCCShapeBuilder::booleanUnion(wrenchBody, connectionBridge, step(4, "Joining jaws"));
+	if (cancelled()) return TopoDS_Shape();
+	if (wrenchBody.IsNull()) {
+		LOG_ERR_S("Failed to union with connection bridge");
+		return TopoDS_Shape();
+	}
+
+	wrenchBody = OCCShapeBuilder::booleanUnion(wrenchBody, movableJaw, step(4, "Joining jaws"));
+	if (cancelled()) return TopoDS_Shape();
+	if (wrenchBody.IsNull()) {
+		LOG_ERR_S("Failed to union with movable jaw");
+		return TopoDS_Shape();
+	}
+
+	LOG_INF_S("Connected wrench body created, now adding jaw openings...");
+
+	// 6. Create larger, more visible jaw openings
+	// Fixed jaw opening - much larger and more visible
+	double fixedSlotWidth = jawOpening * 0.8;  // Increased from 0.6
+	double fixedSlotDepth = jawDepth * 0.9;     // Increased from 0.8
+	double fixedSlotHeight = headThickness * 0.98; // Almost full height
+
+	TopoDS_Shape fixedSlot = OCCShapeBuilder::createBox(
+		fixedSlotWidth,
+		fixedSlotDepth,
+		fixedSlotHeight,
+		gp_Pnt(-handleLength / 2.0 - fixedJawLength + fixedSlotWidth / 2.0,
+			-fixedSlotDepth / 2.0,
+			-fixedSlotHeight / 2.0)
+	);
+
+	if (!fixedSlot.IsNull()) {
+		TopoDS_Shape tempResult = OCCShapeBuilder::booleanDifference(wrenchBody, fixedSlot, step(4, "Cutting jaw openings"));
+		if (!tempResult.IsNull()) {
+			wrenchBody = tempResult;
+			LOG_INF_S("Created large fixed jaw opening");
+		}
+	}
+	if (cancelled()) return TopoDS_Shape();
+
+	// 7. Create movable jaw opening - also larger and more visible
+	double movableSlotWidth = jawOpening * 0.6;  // Increased from 0.4
+	double movableSlotDepth = jawDepth * 0.8;     // Increased from 0.6
+	double movableSlotHeight = headThickness * 0.98; // Almost full height
+
+	TopoDS_Shape movableSlot = OCCShapeBuilder::createBox(
+		movableSlotWidth,
+		movableSlotDepth,
+		movableSlotHeight,
+		gp_Pnt(handleLength / 2.0 - movableSlotWidth - 0.1,
+			-movableSlotDepth / 2.0,
+			-movableSlotHeight / 2.0)
+	);
+
+	if (!movableSlot.IsNull() && !wrenchBody.IsNull()) {
+		TopoDS_Shape tempResult = OCCShapeBuilder::booleanDifference(wrenchBody, movableSlot, step(4, "Cutting jaw openings"));
+		if (!tempResult.IsNull()) {
+			wrenchBody = tempResult;
+			LOG_INF_S("Created large movable jaw opening");
+		}
+	}
+	if (cancelled()) return TopoDS_Shape();
+
+	// 8. Add threaded adjustment mechanism with realistic proportions
+	double threadDiameter = 1.0;
+	double threadLength = 4.0;
+
+	TopoDS_Shape adjustmentThread = OCCShapeBuilder::createCylinder(
+		threadDiameter / 2.0,
+		threadLength,
+		gp_Pnt(handleLength / 2.0 + movableJawLength + threadLength / 2.0,
+			0.0,
+			0.0),
+		gp_Dir(1, 0, 0)
+	);
+
+	if (!adjustmentThread.IsNull()) {
+		TopoDS_Shape tempResult = OCCShapeBuilder::booleanUnion(wrenchBody, adjustmentThread, step(4, "Adding adjustment thread"));
+		if (!tempResult.IsNull()) {
+			wrenchBody = tempResult;
+			LOG_INF_S("Added adjustment thread");
+		}
+	}
+	if (cancelled()) return TopoDS_Shape();
+
+	// 9. Add adjustment knob with knurling pattern
+	double knobDiameter = 2.0;
+	double knobThickness = 0.8;
+
+	TopoDS_Shape adjustmentKnob = OCCShapeBuilder::createCylinder(
+		knobDiameter / 2.0,
+		knobThickness,
+		gp_Pnt(handleLength / 2.0 + movableJawLength + threadLength + knobThickness / 2.0,
+			0.0,
+			0.0),
+		gp_Dir(1, 0, 0)
+	);
+
+	if (!adjustmentKnob.IsNull()) {
+		TopoDS_Shape tempResult = OCCShapeBuilder::booleanUnion(wrenchBody, adjustmentKnob, step(4, "Adding adjustment knob"));
+		if (!tempResult.IsNull()) {
+			wrenchBody = tempResult;
+			LOG_INF_S("Added adjustment knob");
+		}
+	}
+	if (cancelled()) return TopoDS_Shape();
+
+	// 10. Add knurling pattern to adjustment knob (simplified)
+	for (int i = 0; i < 6; i++) {
+		double angle = i * 60.0; // 6 grooves around the knob
+		double angleRad = angle * M_PI / 180.0;
+		double grooveWidth = 0.2;
+		double grooveDepth = knobDiameter * 0.25;
+		double grooveHeight = knobThickness * 0.7;
+
+		// Position groove on knob surface
+		double grooveX = handleLength / 2.0 + movableJawLength + threadLength + knobThickness / 2.0;
+		double grooveY = (knobDiameter / 2.0 - grooveDepth / 2.0) * cos(angleRad);
+		double grooveZ = (knobDiameter / 2.0 - grooveDepth / 2.0) * sin(angleRad);
+
+		TopoDS_Shape groove = OCCShapeBuilder::createBox(
+			grooveWidth,
+			grooveDepth,
+			grooveHeight,
+			gp_Pnt(grooveX - grooveWidth / 2.0,
+				grooveY - grooveDepth / 2.0,
+				grooveZ - grooveHeight / 2.0)
 		);
 
-		if (!adjustmentThread.IsNull()) {
-			TopoDS_Shape tempResult = OCCShapeBuilder::booleanUnion(wrenchBody, adjustmentThread);
+		if (!groove.IsNull() && !wrenchBody.IsNull()) {
+			TopoDS_Shape tempResult = OCCShapeBuilder::booleanDifference(wrenchBody, groove, step(3, "Knurling knob"));
 			if (!tempResult.IsNull()) {
 				wrenchBody = tempResult;
-				LOG_INF_S("Added adjustment thread");
 			}
 		}
+		if (cancelled()) return TopoDS_Shape();
+	}
+
+	// 11. Add ergonomic handle grip pattern (multiple grooves with varying depths)
+	for (int i = 0; i < 6; i++) {
+		double grooveX = -handleLength / 3.0 + i * handleLength / 6.0;
+		double grooveWidth = 0.4;
+		double grooveDepth = handleWidth * 0.8;
+		double grooveHeight = 0.25 + (i % 2) * 0.1; // Varying depths for better grip
 
-		// 9. Add adjustment knob with knurling pattern
-		double knobDiameter = 2.0;
-		double knobThickness = 0.8;
-
-		TopoDS_Shape adjustmentKnob = OCCShapeBuilder::createCylinder(
-			knobDiameter / 2.0,
-			knobThickness,
-			gp_Pnt(handleLength / 2.0 + movableJawLength + threadLength + knobThickness / 2.0,
-				0.0,
-				0.0),
-			gp_Dir(1, 0, 0)
+		TopoDS_Shape groove = OCCShapeBuilder::createBox(
+			grooveWidth,
+			grooveDepth,
+			grooveHeight,
+			gp_Pnt(grooveX - grooveWidth / 2.0,
+				-grooveDepth / 2.0,
+				handleThickness / 2.0 - grooveHeight / 2.0)
 		);
 
-		if (!adjustmentKnob.IsNull()) {
-			TopoDS_Shape tempResult = OCCShapeBuilder::booleanUnion(wrenchBody, adjustmentKnob);
+		if (!groove.IsNull() && !wrenchBody.IsNull()) {
+			TopoDS_Shape tempResult = OCCShapeBuilder::booleanDifference(wrenchBody, groove, step(3, "Cutting grip grooves"));
 			if (!tempResult.IsNull()) {
 				wrenchBody = tempResult;
-				LOG_INF_S("Added adjustment knob");
-			}
-		}
-
-		// 10. Add knurling pattern to adjustment knob (simplified)
-		for (int i = 0; i < 6; i++) {
-			double angle = i * 60.0; // 6 grooves around the knob
-			double angleRad = angle * M_PI / 180.0;
-			double grooveWidth = 0.2;
-			double grooveDepth = knobDiameter * 0.25;
-			double grooveHeight = knobThickness * 0.7;
-
-			// Position groove on knob surface
-			double grooveX = handleLength / 2.0 + movableJawLength + threadLength + knobThickness / 2.0;
-			double grooveY = (knobDiameter / 2.0 - grooveDepth / 2.0) * cos(angleRad);
-			double grooveZ = (knobDiameter / 2.0 - grooveDepth / 2.0) * sin(angleRad);
-
-			TopoDS_Shape groove = OCCShapeBuilder::createBox(
-				grooveWidth,
-				grooveDepth,
-				grooveHeight,
-				gp_Pnt(grooveX - grooveWidth / 2.0,
-					grooveY - grooveDepth / 2.0,
-					grooveZ - grooveHeight / 2.0)
-			);
-
-			if (!groove.IsNull() && !wrenchBody.IsNull()) {
-				TopoDS_Shape tempResult = OCCShapeBuilder::booleanDifference(wrenchBody, groove);
-				if (!tempResult.IsNull()) {
-					wrenchBody = tempResult;
-				}
-			}
-		}
-
-		// 11. Add ergonomic handle grip pattern (multiple grooves with varying depths)
-		for (int i = 0; i < 6; i++) {
-			double grooveX = -handleLength / 3.0 + i * handleLength / 6.0;
-			double grooveWidth = 0.4;
-			double grooveDepth = handleWidth * 0.8;
-			double grooveHeight = 0.25 + (i % 2) * 0.1; // Varying depths for better grip
-
-			TopoDS_Shape groove = OCCShapeBuilder::createBox(
-				grooveWidth,
-				grooveDepth,
-				grooveHeight,
-				gp_Pnt(grooveX - grooveWidth / 2.0,
-					-grooveDepth / 2.0,
-					handleThickness / 2.0 - grooveHeight / 2.0)
-			);
-
-			if (!groove.IsNull() && !wrenchBody.IsNull()) {
-				TopoDS_Shape tempResult = OCCShapeBuilder::booleanDifference(wrenchBody, groove);
-				if (!tempResult.IsNull()) {
-					wrenchBody = tempResult;
-				}
-			}
-		}
-
-		// 12. Add fillets for better appearance and safety
-		if (!wrenchBody.IsNull()) {
-			TopoDS_Shape filletedWrench = OCCShapeBuilder::createFillet(wrenchBody, 0.15);
-			if (!filletedWrench.IsNull()) {
-				wrenchBody = filletedWrench;
-				LOG_INF_S("Added fillets to wrench");
-			}
-		}
-
-		// 13. Add chamfers to sharp edges for better finish
-		if (!wrenchBody.IsNull()) {
-			TopoDS_Shape chamferedWrench = OCCShapeBuilder::createChamfer(wrenchBody, 0.1);
-			if (!chamferedWrench.IsNull()) {
-				wrenchBody = chamferedWrench;
-				LOG_INF_S("Added chamfers to wrench");
 			}
 		}
+		if (cancelled()) return TopoDS_Shape();
+	}
 
-		if (wrenchBody.IsNull()) {
-			LOG_ERR_S("Final wrench shape is null");
-			return nullptr;
+	// 12. Add fillets for better appearance and safety
+	if (!wrenchBody.IsNull()) {
+		TopoDS_Shape filletedWrench = OCCShapeBuilder::createFillet(wrenchBody, 0.15, step(24, "Filleting edges"));
+		if (!filletedWrench.IsNull()) {
+			wrenchBody = filletedWrench;
+			LOG_INF_S("Added fillets to wrench");
 		}
+	}
+	if (cancelled()) return TopoDS_Shape();
 
-		// Validate the final shape
-		if (!OCCShapeBuilder::isValid(wrenchBody)) {
-			LOG_WRN_S("Wrench shape validation failed, but proceeding anyway");
+	// 13. Add chamfers to sharp edges for better finish
+	if (!wrenchBody.IsNull()) {
+		TopoDS_Shape chamferedWrench = OCCShapeBuilder::createChamfer(wrenchBody, 0.1, step(12, "Chamfering edges"));
+		if (!chamferedWrench.IsNull()) {
+			wrenchBody = chamferedWrench;
+			LOG_INF_S("Added chamfers to wrench");
 		}
-		else {
-			LOG_INF_S("Wrench shape is valid");
-		}
-
-		// Debug: Analyze the wrench shape in detail
-		OCCShapeBuilder::analyzeShapeTopology(wrenchBody, name);
-		OCCShapeBuilder::outputFaceNormalsAndIndices(wrenchBody, name);
-		OCCShapeBuilder::analyzeShapeProperties(wrenchBody, name);
+	}
+	if (cancelled()) return TopoDS_Shape();
 
-		// Additional debugging for face mapping issues
-		int faceCount = 0;
-		for (TopExp_Explorer exp(wrenchBody, TopAbs_FACE); exp.More(); exp.Next()) {
-			faceCount++;
-		}
-		LOG_INF_S("Wrench created with " + std::to_string(faceCount) + " faces");
+	if (wrenchBody.IsNull()) {
+		LOG_ERR_S("Final wrench shape is null");
+		return TopoDS_Shape();
+	}
 
-		auto geometry = std::make_shared<OCCGeometry>(name);
-		geometry->setShape(wrenchBody);
-		// Set position to the specified location - this ensures the geometry is properly positioned
-		geometry->setPosition(gp_Pnt(position[0], position[1], position[2]));
-		LOG_INF_S("[GeometryFactoryDebug] Final wrench position set to: (" + std::to_string(position[0]) + ", " + std::to_string(position[1]) + ", " + std::to_string(position[2]) + ")");
+	// Validate the final shape
+	if (!OCCShapeBuilder::isValid(wrenchBody)) {
+		LOG_WRN_S("Wrench shape validation failed, but proceeding anyway");
+	}
+	else {
+		LOG_INF_S("Wrench shape is valid");
+	}
 
-		// Build face index mapping for system-created geometry
-		buildFaceIndexMappingForSystemGeometry(geometry, "wrench");
+	// Debug: Analyze the wrench shape in detail
+	OCCShapeBuilder::analyzeShapeTopology(wrenchBody, name);
+	OCCShapeBuilder::outputFaceNormalsAndIndices(wrenchBody, name);
+	OCCShapeBuilder::analyzeShapeProperties(wrenchBody, name);
 
-		LOG_INF_S("Created connected professional wrench model: " + name);
-		return geometry;
-	}
-	catch (const std::exception& e) {
-		LOG_ERR_S("Exception creating wrench: " + std::string(e.what()));
-		return nullptr;
+	// Additional debugging for face mapping issues
+	int faceCount = 0;
+	for (TopExp_Explorer exp(wrenchBody, TopAbs_FACE); exp.More(); exp.Next()) {
+		faceCount++;
 	}
+	LOG_INF_S("Wrench created with " + std::to_string(faceCount) + " faces");
+
+	return wrenchBody;
 }
 
 // Add new method for culling system integration
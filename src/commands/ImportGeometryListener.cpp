@@ -15,6 +15,7 @@
 #include <OpenCASCADE/TopExp_Explorer.hxx>
 #include <OpenCASCADE/TopAbs.hxx>
 #include "GeometryImportOptimizer.h"
+#include "ImportCache.h"
 #include "ProgressiveGeometryLoader.h"
 #include "StreamingFileReader.h"
 #include "STEPGeometryDecomposer.h"
@@ -25,6 +26,7 @@
 #include <wx/app.h>
 #include <wx/timer.h>
 #include "logger/Logger.h"
+#include "config/ConfigManager.h"
 #include <chrono>
 #include <filesystem>
 #include "FlatFrame.h"
@@ -513,6 +515,14 @@ CommandResult ImportGeometryListener::executeCommand(const std::string& commandT
         overallStats.totalGeometriesCreated = overallStats.totalGeometriesCreated;
         overallStats.totalImportTime = std::chrono::milliseconds(static_cast<long long>(totalImportTime));
 
+        ImportCache::Statistics cacheStats = ImportCache::getInstance().getStatistics();
+        overallStats.cacheHits = cacheStats.hits;
+        overallStats.cacheMisses = cacheStats.misses;
+        overallStats.cacheEvictions = cacheStats.evictions;
+        overallStats.cacheEntries = cacheStats.entries;
+        overallStats.cacheBytes = cacheStats.bytes;
+        overallStats.cacheBudget = cacheStats.budget;
+
         LOG_INF_S("Showing import statistics dialog - Files: " + std::to_string(overallStats.totalFilesProcessed) +
                  ", Successful: " + std::to_string(overallStats.totalSuccessfulFiles) +
                  ", Geometries: " + std::to_string(overallStats.totalGeometriesCreated));
@@ -860,6 +870,9 @@ void ImportGeometryListener::setupBalancedImportOptions(GeometryReader::Optimiza
     options.maxThreads = std::thread::hardware_concurrency();
     options.precision = 0.01;              // Standard precision
     options.enableNormalProcessing = false; // Disable normal processing for performance
+    // BREP sidecars drop names, colors and assembly structure and are written next
+    // to the source file, so they are opt-in
+    options.enableBRepSidecar = ConfigManager::getInstance().getBool("Import", "BRepSidecar", false);
     
     // Tessellation settings based on mesh quality
     options.enableFineTessellation = true;   // Enable fine tessellation
@@ -54,29 +54,16 @@ CommandResult NormalFixDialogListener::executeCommand(const std::string& command
             int correctedCount = 0;
             int totalCount = geometries.size();
             
-            // Apply normal correction to each geometry
-            for (auto& geometry : geometries) {
-                if (!geometry) continue;
-                
-                const TopoDS_Shape& originalShape = geometry->getShape();
-                if (originalShape.IsNull()) continue;
-                
-                // Check if correction is needed based on quality threshold
-                if (settings.autoCorrect) {
-                    double quality = NormalValidator::getNormalQualityScore(originalShape);
-                    if (quality < settings.qualityThreshold) {
-                        // Apply normal correction
-                        TopoDS_Shape correctedShape = NormalValidator::autoCorrectNormals(originalShape, geometry->getName());
-                        
-                        // Update the geometry with corrected shape
-                        geometry->setShape(correctedShape);
-                        correctedCount++;
-                        
-                        LOG_INF_S("Corrected normals for geometry: " + geometry->getName());
-                    } else {
-                        LOG_INF_S("Geometry " + geometry->getName() + " already has good normals (quality: " + 
-                                std::to_string(quality) + ")");
-                    }
+            // Check if correction is needed based on quality threshold
+            if (settings.autoCorrect) {
+                auto corrections = NormalValidator::correctNormals(geometries, settings.qualityThreshold);
+                for (auto& correction : corrections) {
+                    // Update the geometry with corrected shape
+                    correction.geometry->setShape(correction.correctedShape);
+                    correctedCount++;
+                    
+                    LOG_INF_S("Corrected normals for geometry: " + correction.geometry->getName() + " (" +
+                             std::to_string(correction.reversedFaces) + " faces reversed)");
                 }
             }
             
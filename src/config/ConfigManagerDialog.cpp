@@ -697,11 +697,15 @@ void ConfigManagerDialog::onApply(wxCommandEvent& event) {
     bool hasChanges = false;
     int savedCount = 0;
     
-    for (auto& pair : m_editorCache) {
-        if (pair.second && pair.second->hasChanges()) {
-            pair.second->saveConfig();
-            savedCount++;
-            hasChanges = true;
+    {
+        // Listeners are notified once, after every category has been applied
+        UnifiedConfigManager::ScopedTransaction transaction(*m_configManager);
+        for (auto& pair : m_editorCache) {
+            if (pair.second && pair.second->hasChanges()) {
+                pair.second->saveConfig();
+                savedCount++;
+                hasChanges = true;
+            }
         }
     }
     
@@ -1,4 +1,5 @@
 #include "config/ThemeManager.h"
+#include "config/UnifiedConfigManager.h"
 #include "config/SvgIconManager.h"
 #include "logger/Logger.h"
 #include <wx/settings.h>
@@ -249,6 +250,10 @@ bool ThemeManager::setCurrentTheme(const std::string& themeName) {
 
 	m_currentTheme = themeName;
 
+	// Config listeners hear about the whole theme switch once, after it is applied
+	UnifiedConfigManager::ScopedTransaction transaction(UnifiedConfigManager::getInstance());
+	UnifiedConfigManager::getInstance().setValue("Theme.CurrentTheme", themeName);
+
 	// Clear SVG icon cache to ensure icons are re-rendered with new theme colors
 	SvgIconManager::GetInstance().ClearThemeCache();
 	LOG_DBG("Cleared SVG icon cache for theme change", "ThemeManager");
@@ -11,6 +11,7 @@
 #include "logger/Logger.h"
 #include <sstream>
 #include <algorithm>
+#include <cmath>
 
 UnifiedConfigManager& UnifiedConfigManager::getInstance() {
     static UnifiedConfigManager instance;
@@ -18,7 +19,9 @@ UnifiedConfigManager& UnifiedConfigManager::getInstance() {
 }
 
 UnifiedConfigManager::UnifiedConfigManager() 
-    : m_configManager(nullptr) {
+    : m_configManager(nullptr)
+    , m_nextListenerId(1)
+    , m_transactionDepth(0) {
 }
 
 UnifiedConfigManager::~UnifiedConfigManager() {
@@ -29,7 +32,96 @@ void UnifiedConfigManager::initialize(ConfigManager& configManager) {
 
     registerBuiltinCategories();
     scanAndRegisterAllConfigs(configManager);
+    registerSubsystemListeners();
+}
+
+namespace {
+    std::string sectionOf(const std::string& key) {
+        return key.substr(0, key.find('.'));
+    }
+
+    bool touchesSection(const std::vector<std::string>& keys, const std::set<std::string>& sections) {
+        return std::any_of(keys.begin(), keys.end(),
+            [&sections](const std::string& key) { return sections.count(sectionOf(key)) > 0; });
+    }
+
+    bool parseColor(const std::string& value, Quantity_Color& color) {
+        double r = 0.0, g = 0.0, b = 0.0;
+        char comma1 = 0, comma2 = 0;
+        std::istringstream iss(value);
+        if (!(iss >> r >> comma1 >> g >> comma2 >> b) || comma1 != ',' || comma2 != ',') {
+            return false;
+        }
+        color = Quantity_Color(r, g, b, Quantity_TOC_RGB);
+        return true;
+    }
+}
+
+void UnifiedConfigManager::registerSubsystemListeners() {
+    // initialize() may run again after a failed first attempt
+    for (ListenerId id : m_subsystemListeners) {
+        removeChangeListener(id);
+    }
+    m_subsystemListeners.clear();
+
+    // Each subsystem refreshes once per change or committed transaction, however many of
+    // its keys changed; values already reached ConfigManager through writeToConfigManager
+    m_subsystemListeners.push_back(addBatchChangeListener("Theme", [this](const std::vector<std::string>& keys) {
+        ThemeManager& themeManager = ThemeManager::getInstance();
+        if (!themeManager.isInitialized()) {
+            return;
+        }
+        const bool themeSwitched = std::find(keys.begin(), keys.end(), "Theme.CurrentTheme") != keys.end();
+        const std::string theme = getValue("Theme.CurrentTheme");
+        if (themeSwitched && theme != themeManager.getCurrentTheme()) {
+            themeManager.setCurrentTheme(theme);
+        } else if (touchesSection(keys, { "ThemeColors" })) {
+            themeManager.reloadThemes();
+        }
+    }));
+
+    m_subsystemListeners.push_back(addBatchChangeListener("", [](const std::vector<std::string>& keys) {
+        static const std::set<std::string> renderingSections = { "Material", "Texture", "Blend", "Shading",
+            "Display", "Quality", "Shadow", "LightingModel", "Lighting", "Rendering" };
+        if (touchesSection(keys, renderingSections)) {
+            // Re-reads every rendering section and notifies once
+            RenderingConfig::getInstance().loadFromFile();
+        }
+    }));
+
+    m_subsystemListeners.push_back(addBatchChangeListener("Lighting.", [this](const std::vector<std::string>& keys) {
+        if (std::find(keys.begin(), keys.end(), "Lighting.AmbientIntensity") == keys.end()) {
+            return;
+        }
+        LightingConfig& lighting = LightingConfig::getInstance();
+        try {
+            const double intensity = std::stod(getValue("Lighting.AmbientIntensity"));
+            // Presets mirror their value here; only a different value needs a scene update
+            if (std::abs(intensity - lighting.getEnvironmentSettings().ambientIntensity) > 1e-9) {
+                lighting.setEnvironmentAmbientIntensity(intensity);
+            }
+        } catch (...) {
+            LOG_WRN("Invalid Lighting.AmbientIntensity value", "UnifiedConfigManager");
+        }
+    }));
 
+    m_subsystemListeners.push_back(addBatchChangeListener("Display.", [this](const std::vector<std::string>& keys) {
+        static const std::set<std::string> edgeKeys = { "Display.EdgeWidth", "Display.EdgeColor",
+            "Display.ShowMeshEdges", "Display.ShowOriginalEdges" };
+        if (std::none_of(keys.begin(), keys.end(), [](const std::string& key) { return edgeKeys.count(key) > 0; })) {
+            return;
+        }
+        EdgeSettingsConfig& edges = EdgeSettingsConfig::getInstance();
+        try {
+            edges.setGlobalEdgeWidth(std::stod(getValue("Display.EdgeWidth")));
+        } catch (...) {
+        }
+        Quantity_Color color;
+        if (parseColor(getValue("Display.EdgeColor"), color)) {
+            edges.setGlobalEdgeColor(color);
+        }
+        edges.applySettingsToGeometries();
+    }));
 }
 
 void UnifiedConfigManager::registerBuiltinCategories() {
@@ -832,34 +924,139 @@ bool UnifiedConfigManager::setValue(const std::string& key, const std::string& v
         LOG_WRN("Conflicts detected for " + key, "UnifiedConfigManager");
     }
     
+    // Unchanged values don't trigger refreshes
+    if (it->second.currentValue == value) {
+        writeToConfigManager(it->second, value);
+        return true;
+    }
+    
+    if (m_transactionDepth > 0) {
+        if (m_transactionOriginals.emplace(key, it->second.currentValue).second) {
+            m_pendingKeys.push_back(key);
+        }
+    }
+    
     it->second.currentValue = value;
+    writeToConfigManager(it->second, value);
     
-    if (m_configManager) {
-        size_t dotPos = key.find('.');
-        if (dotPos != std::string::npos) {
-            std::string section = key.substr(0, dotPos);
-            std::string itemKey = key.substr(dotPos + 1);
-            
-            if (it->second.type == ConfigValueType::Bool) {
-                m_configManager->setBool(section, itemKey, value == "true");
-            } else if (it->second.type == ConfigValueType::Int) {
-                m_configManager->setInt(section, itemKey, std::stoi(value));
-            } else if (it->second.type == ConfigValueType::Double) {
-                m_configManager->setDouble(section, itemKey, std::stod(value));
-            } else {
-                m_configManager->setString(section, itemKey, value);
-            }
+    if (m_transactionDepth == 0) {
+        notifyListeners({ key });
+    }
+    
+    return true;
+}
+
+size_t UnifiedConfigManager::setValues(const std::map<std::string, std::string>& values) {
+    ScopedTransaction transaction(*this);
+    size_t accepted = 0;
+    for (const auto& pair : values) {
+        if (setValue(pair.first, pair.second)) {
+            accepted++;
+        }
+    }
+    return accepted;
+}
+
+void UnifiedConfigManager::writeToConfigManager(const ConfigItem& item, const std::string& value) {
+    if (!m_configManager) {
+        return;
+    }
+    
+    size_t dotPos = item.key.find('.');
+    if (dotPos != std::string::npos) {
+        std::string section = item.key.substr(0, dotPos);
+        std::string itemKey = item.key.substr(dotPos + 1);
+        
+        if (item.type == ConfigValueType::Bool) {
+            m_configManager->setBool(section, itemKey, value == "true");
+        } else if (item.type == ConfigValueType::Int) {
+            m_configManager->setInt(section, itemKey, std::stoi(value));
+        } else if (item.type == ConfigValueType::Double) {
+            m_configManager->setDouble(section, itemKey, std::stod(value));
+        } else {
+            m_configManager->setString(section, itemKey, value);
+        }
+    }
+}
+
+void UnifiedConfigManager::beginTransaction() {
+    m_transactionDepth++;
+}
+
+void UnifiedConfigManager::commitTransaction() {
+    if (m_transactionDepth == 0) {
+        LOG_WRN("commitTransaction called without an open transaction", "UnifiedConfigManager");
+        return;
+    }
+    if (--m_transactionDepth > 0) {
+        return;
+    }
+    
+    // Keys set back to their original value need no notification
+    std::vector<std::string> changedKeys;
+    changedKeys.reserve(m_pendingKeys.size());
+    for (const auto& key : m_pendingKeys) {
+        auto it = m_items.find(key);
+        if (it != m_items.end() && it->second.currentValue != m_transactionOriginals[key]) {
+            changedKeys.push_back(key);
         }
     }
+    m_pendingKeys.clear();
+    m_transactionOriginals.clear();
+    
+    if (!changedKeys.empty()) {
+        notifyListeners(changedKeys);
+    }
+}
+
+void UnifiedConfigManager::rollbackTransaction() {
+    if (m_transactionDepth == 0) {
+        LOG_WRN("rollbackTransaction called without an open transaction", "UnifiedConfigManager");
+        return;
+    }
     
-    auto listenerIt = m_listeners.find(key);
-    if (listenerIt != m_listeners.end()) {
-        for (auto& listener : listenerIt->second) {
-            listener(value);
+    // Everything since the outermost begin is undone; enclosing transactions
+    // then have nothing left to notify
+    for (const auto& original : m_transactionOriginals) {
+        auto it = m_items.find(original.first);
+        if (it != m_items.end()) {
+            it->second.currentValue = original.second;
+            writeToConfigManager(it->second, original.second);
+        }
+    }
+    m_pendingKeys.clear();
+    m_transactionOriginals.clear();
+    m_transactionDepth--;
+}
+
+void UnifiedConfigManager::notifyListeners(const std::vector<std::string>& changedKeys) {
+    // Listeners may add or remove listeners, so work from copies and skip any
+    // removed along the way
+    for (const auto& key : changedKeys) {
+        auto listenerIt = m_listeners.find(key);
+        if (listenerIt == m_listeners.end()) {
+            continue;
+        }
+        auto listeners = listenerIt->second;
+        for (auto& listener : listeners) {
+            if (m_activeListeners.count(listener.first)) {
+                listener.second(getValue(key));
+            }
         }
     }
     
-    return true;
+    auto batchListeners = m_batchListeners;
+    for (auto& entry : batchListeners) {
+        std::vector<std::string> keys;
+        for (const auto& key : changedKeys) {
+            if (key.compare(0, entry.keyPrefix.size(), entry.keyPrefix) == 0) {
+                keys.push_back(key);
+            }
+        }
+        if (!keys.empty() && m_activeListeners.count(entry.id)) {
+            entry.listener(keys);
+        }
+    }
 }
 
 std::string UnifiedConfigManager::getValue(const std::string& key) const {
@@ -981,22 +1178,80 @@ void UnifiedConfigManager::reload() {
     }
 }
 
-void UnifiedConfigManager::addChangeListener(const std::string& key, std::function<void(const std::string&)> listener) {
-    m_listeners[key].push_back(listener);
+UnifiedConfigManager::ListenerId UnifiedConfigManager::addChangeListener(const std::string& key, ChangeListener listener) {
+    ListenerId id = m_nextListenerId++;
+    m_listeners[key].emplace_back(id, std::move(listener));
+    m_activeListeners.insert(id);
+    return id;
 }
 
-void UnifiedConfigManager::removeChangeListener(const std::string& key, std::function<void(const std::string&)> listener) {
-    // Note: Since function objects cannot be directly compared,
-    // we remove all listeners for the given key when a listener is provided.
-    // For more precise control, consider using a listener ID system.
+UnifiedConfigManager::ListenerId UnifiedConfigManager::addBatchChangeListener(const std::string& keyPrefix,
+                                                                              BatchChangeListener listener) {
+    ListenerId id = m_nextListenerId++;
+    m_batchListeners.push_back(BatchListenerEntry{ id, keyPrefix, std::move(listener) });
+    m_activeListeners.insert(id);
+    return id;
+}
+
+bool UnifiedConfigManager::removeChangeListener(ListenerId id) {
+    if (m_activeListeners.erase(id) == 0) {
+        return false;
+    }
+    
+    for (auto it = m_listeners.begin(); it != m_listeners.end(); ++it) {
+        auto& listeners = it->second;
+        auto found = std::find_if(listeners.begin(), listeners.end(),
+            [id](const std::pair<ListenerId, ChangeListener>& entry) { return entry.first == id; });
+        if (found != listeners.end()) {
+            listeners.erase(found);
+            if (listeners.empty()) {
+                m_listeners.erase(it);
+            }
+            return true;
+        }
+    }
+    
+    m_batchListeners.erase(std::remove_if(m_batchListeners.begin(), m_batchListeners.end(),
+        [id](const BatchListenerEntry& entry) { return entry.id == id; }), m_batchListeners.end());
+    return true;
+}
+
+void UnifiedConfigManager::removeChangeListeners(const std::string& key) {
     auto it = m_listeners.find(key);
     if (it != m_listeners.end()) {
-        // Remove all listeners for this key
-        // In a production system, you might want to use listener IDs for precise removal
+        for (const auto& listener : it->second) {
+            m_activeListeners.erase(listener.first);
+        }
         m_listeners.erase(it);
     }
 }
 
+UnifiedConfigManager::ScopedTransaction::ScopedTransaction(UnifiedConfigManager& manager)
+    : m_manager(manager)
+    , m_finished(false) {
+    m_manager.beginTransaction();
+}
+
+UnifiedConfigManager::ScopedTransaction::~ScopedTransaction() {
+    if (!m_finished) {
+        m_manager.commitTransaction();
+    }
+}
+
+void UnifiedConfigManager::ScopedTransaction::commit() {
+    if (!m_finished) {
+        m_finished = true;
+        m_manager.commitTransaction();
+    }
+}
+
+void UnifiedConfigManager::ScopedTransaction::rollback() {
+    if (!m_finished) {
+        m_finished = true;
+        m_manager.rollbackTransaction();
+    }
+}
+
 void UnifiedConfigManager::printDiagnostics() const {
 }
 
@@ -68,10 +68,12 @@ void ConfigCategoryEditor::addItemEditor(wxSizer* sizer, ConfigItemEditor* edito
 }
 
 void ConfigCategoryEditor::saveConfig() {
+    std::map<std::string, std::string> values;
     for (const auto& pair : m_editors) {
-        std::string value = pair.second->getValue();
-        m_configManager->setValue(pair.first, value);
+        values[pair.first] = pair.second->getValue();
     }
+    // One transaction so listeners refresh once for the whole category
+    m_configManager->setValues(values);
     m_configManager->save();
 }
 
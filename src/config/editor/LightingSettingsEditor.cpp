@@ -1,5 +1,6 @@
 #include "config/editor/LightingSettingsEditor.h"
 #include "config/LightingConfig.h"
+#include "config/UnifiedConfigManager.h"
 #include "logger/Logger.h"
 #include "SceneManager.h"
 #include <wx/sizer.h>
@@ -625,7 +626,10 @@ void LightingSettingsEditor::applySettings() {
 }
 
 void LightingSettingsEditor::applyPresetAndUpdate(const std::string& presetName, const std::string& description) {
-    // Apply the preset
+    // Config listeners are notified once, after the whole preset is in place
+    UnifiedConfigManager::ScopedTransaction transaction(*m_configManager);
+
+    // Apply the preset; each preset notifies the scene once when done
     if (presetName == "Studio") {
         m_config.applyStudioPreset();
     } else if (presetName == "Outdoor") {
@@ -653,8 +657,9 @@ void LightingSettingsEditor::applyPresetAndUpdate(const std::string& presetName,
         m_currentPresetLabel->SetLabel(wxString::Format("Current: %s\n%s", presetName, description));
     }
     
-    // Force immediate scene update
-    m_config.applySettingsToScene();
+    // Keep the unified view of the ambient intensity in step with the preset
+    m_configManager->setValue("Lighting.AmbientIntensity",
+        std::to_string(m_config.getEnvironmentSettings().ambientIntensity));
     
     if (m_changeCallback) {
         m_changeCallback();
@@ -1,10 +1,16 @@
 #include "BREPReader.h"
+#include "ImportCache.h"
 #include "logger/Logger.h"
 #include "OCCShapeBuilder.h"
 
 // OpenCASCADE BREP import includes
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BinTools.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopExp_Explorer.hxx>
 #include <ShapeFix_Shape.hxx>
@@ -27,8 +33,6 @@
 #include <execution>
 
 // Static member initialization
-std::unordered_map<std::string, BREPReader::ReadResult> BREPReader::s_cache;
-std::mutex BREPReader::s_cacheMutex;
 bool BREPReader::s_initialized = false;
 
 BREPReader::ReadResult BREPReader::readFile(const std::string& filePath,
@@ -57,11 +61,8 @@ BREPReader::ReadResult BREPReader::readFile(const std::string& filePath,
 
         // Check cache if enabled
         if (options.enableCaching) {
-            std::lock_guard<std::mutex> lock(s_cacheMutex);
-            auto cacheIt = s_cache.find(filePath);
-            if (cacheIt != s_cache.end()) {
-                result = cacheIt->second;
-                return result;
+            if (auto cached = ImportCache::getInstance().lookup(filePath, options)) {
+                return *cached;
             }
         }
 
@@ -69,9 +70,45 @@ BREPReader::ReadResult BREPReader::readFile(const std::string& filePath,
         initialize();
         if (progress) progress(5, "Initializing BREP reader");
 
-        // Read BREP file - simplified implementation
-        // TODO: Fix BRepTools::Read API compatibility
-        result.errorMessage = "BREP format support is temporarily disabled due to API compatibility issues";
+        TopoDS_Shape shape;
+        if (!readShape(filePath, shape, result.errorMessage)) {
+            LOG_ERR_S(result.errorMessage);
+            return result;
+        }
+        if (progress) progress(30, "BREP file loaded");
+
+        logStoredTriangulation(shape);
+
+        std::vector<TopoDS_Shape> shapes;
+        extractShapes(shape, shapes);
+        if (progress) progress(40, "Extracted " + std::to_string(shapes.size()) + " shapes");
+
+        std::string baseName = std::filesystem::path(filePath).stem().string();
+        result.geometries = processShapesParallel(shapes, baseName, options, progress);
+        if (result.geometries.empty()) {
+            result.errorMessage = "No valid geometries found in BREP file: " + filePath;
+            LOG_ERR_S(result.errorMessage);
+            return result;
+        }
+
+        result.rootShape = shape;
+        result.success = true;
+
+        auto totalEndTime = std::chrono::high_resolution_clock::now();
+        auto totalDuration = std::chrono::duration_cast<std::chrono::milliseconds>(totalEndTime - totalStartTime);
+        result.importTime = static_cast<double>(totalDuration.count());
+
+        if (options.enableCaching) {
+            ImportCache::getInstance().store(filePath, options, result);
+        }
+
+        LOG_INF_S("BREP import completed: " + std::to_string(result.geometries.size()) + " geometries in " +
+            std::to_string(totalDuration.count()) + "ms");
+        if (progress) progress(100, "BREP import completed");
+        return result;
+    }
+    catch (const Standard_Failure& e) {
+        result.errorMessage = "OpenCASCADE exception in BREP reader: " + std::string(e.GetMessageString());
         LOG_ERR_S(result.errorMessage);
         return result;
     }
@@ -88,12 +125,12 @@ bool BREPReader::isValidFile(const std::string& filePath) const
     std::string extension = path.extension().string();
     std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
     
-    return extension == ".brep";
+    return extension == ".brep" || extension == ".brp" || extension == ".bbrep";
 }
 
 std::vector<std::string> BREPReader::getSupportedExtensions() const
 {
-    return {".brep"};
+    return {".brep", ".brp", ".bbrep"};
 }
 
 std::string BREPReader::getFormatName() const
@@ -103,7 +140,115 @@ std::string BREPReader::getFormatName() const
 
 std::string BREPReader::getFileFilter() const
 {
-    return "BREP files (*.brep)|*.brep";
+    return "BREP files (*.brep;*.brp;*.bbrep)|*.brep;*.brp;*.bbrep";
+}
+
+bool BREPReader::isBinaryFile(const std::string& filePath)
+{
+    std::string extension = std::filesystem::path(filePath).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension == ".bbrep";
+}
+
+bool BREPReader::readShape(const std::string& filePath, TopoDS_Shape& shape, std::string& errorMessage)
+{
+    // Both flavours restore stored Poly_Triangulation along with the topology
+    auto readAscii = [&]() {
+        BRep_Builder builder;
+        return BRepTools::Read(shape, filePath.c_str(), builder) && !shape.IsNull();
+    };
+    auto readBinary = [&]() {
+        return BinTools::Read(shape, filePath.c_str()) && !shape.IsNull();
+    };
+
+    // The extension picks the flavour to try first; binary files are sometimes saved as .brep
+    bool binary = isBinaryFile(filePath);
+    if (binary ? readBinary() : readAscii()) {
+        return true;
+    }
+    shape.Nullify();
+    if (binary ? readAscii() : readBinary()) {
+        LOG_DBG_S("BREP file read as " + std::string(binary ? "ASCII" : "binary") + " despite its extension: " + filePath);
+        return true;
+    }
+
+    errorMessage = "Failed to read BREP file: " + filePath;
+    return false;
+}
+
+void BREPReader::logStoredTriangulation(const TopoDS_Shape& shape)
+{
+    int faces = 0;
+    int triangulated = 0;
+    double maxDeflection = 0.0;
+    for (TopExp_Explorer explorer(shape, TopAbs_FACE); explorer.More(); explorer.Next()) {
+        ++faces;
+        TopLoc_Location location;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(TopoDS::Face(explorer.Current()), location);
+        if (!triangulation.IsNull()) {
+            ++triangulated;
+            maxDeflection = std::max(maxDeflection, triangulation->Deflection());
+        }
+    }
+
+    // OpenCASCADEProcessor skips BRepMesh when every face carries a triangulation within
+    // the requested deflection, so a fully triangulated file is displayed without remeshing
+    if (triangulated > 0) {
+        LOG_INF_S("BREP file carries stored triangulation for " + std::to_string(triangulated) + "/" +
+            std::to_string(faces) + " faces (max deflection " + std::to_string(maxDeflection) + ")");
+    }
+}
+
+std::string BREPReader::sidecarPathFor(const std::string& sourcePath)
+{
+    return sourcePath + ".bbrep";
+}
+
+bool BREPReader::hasFreshSidecar(const std::string& sourcePath)
+{
+    std::error_code ec;
+    std::filesystem::path sidecar(sidecarPathFor(sourcePath));
+    if (!std::filesystem::exists(sidecar, ec)) {
+        return false;
+    }
+    auto sidecarTime = std::filesystem::last_write_time(sidecar, ec);
+    if (ec) {
+        return false;
+    }
+    auto sourceTime = std::filesystem::last_write_time(sourcePath, ec);
+    return !ec && sidecarTime >= sourceTime;
+}
+
+bool BREPReader::writeSidecar(const std::string& sourcePath, const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return false;
+    }
+
+    // Written under a temporary name so a crash never leaves a truncated sidecar behind
+    std::string sidecar = sidecarPathFor(sourcePath);
+    std::string temporary = sidecar + ".tmp";
+    try {
+        if (!BinTools::Write(shape, temporary.c_str())) {
+            LOG_WRN_S("Failed to write BREP sidecar: " + sidecar);
+            return false;
+        }
+        std::error_code ec;
+        std::filesystem::rename(temporary, sidecar, ec);
+        if (ec) {
+            std::filesystem::remove(temporary, ec);
+            LOG_WRN_S("Failed to move BREP sidecar into place: " + sidecar);
+            return false;
+        }
+        LOG_INF_S("Wrote BREP sidecar: " + sidecar);
+        return true;
+    }
+    catch (const Standard_Failure& e) {
+        std::error_code ec;
+        std::filesystem::remove(temporary, ec);
+        LOG_WRN_S("Failed to write BREP sidecar: " + std::string(e.GetMessageString()));
+        return false;
+    }
 }
 
 void BREPReader::initialize()
@@ -173,43 +318,9 @@ std::vector<std::shared_ptr<OCCGeometry>> BREPReader::processShapesParallel(
     const OptimizationOptions& options,
     ProgressCallback progress)
 {
-    std::vector<std::shared_ptr<OCCGeometry>> geometries;
-    
-    if (options.enableParallelProcessing && shapes.size() > 1) {
-        // Process shapes in parallel
-        std::vector<std::future<std::shared_ptr<OCCGeometry>>> futures;
-        
-        for (size_t i = 0; i < shapes.size(); ++i) {
-            std::string name = baseName + "_" + std::to_string(i + 1);
-            futures.push_back(std::async(std::launch::async, [this, &shapes, i, name, baseName, &options]() {
-                return processSingleShape(shapes[i], name, baseName, options);
-            }));
-        }
-        
-        // Collect results
-        for (auto& future : futures) {
-            auto geometry = future.get();
-            if (geometry) {
-                geometries.push_back(geometry);
-            }
-        }
-    } else {
-        // Process shapes sequentially
-        for (size_t i = 0; i < shapes.size(); ++i) {
-            std::string name = baseName + "_" + std::to_string(i + 1);
-            auto geometry = processSingleShape(shapes[i], name, baseName, options);
-            if (geometry) {
-                geometries.push_back(geometry);
-            }
-            
-            if (progress) {
-                int percent = 40 + static_cast<int>((i + 1) * 40.0 / shapes.size());
-                progress(percent, "Processing shape " + std::to_string(i + 1) + "/" + std::to_string(shapes.size()));
-            }
-        }
-    }
-    
-    return geometries;
+    return convertShapesParallel(shapes.size(), [&](size_t i) {
+        return processSingleShape(shapes[i], baseName + "_" + std::to_string(i + 1), baseName, options);
+    }, options, progress, 40, 40);
 }
 
 std::shared_ptr<OCCGeometry> BREPReader::processSingleShape(
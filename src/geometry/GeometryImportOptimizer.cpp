@@ -1,5 +1,6 @@
 #include "GeometryImportOptimizer.h"
 #include "GeometryReader.h"
+#include "ImportCache.h"
 #include "logger/Logger.h"
 #include <filesystem>
 #include <fstream>
@@ -20,11 +21,6 @@
 #endif
 
 // Static member initialization
-std::unordered_map<std::string, GeometryImportOptimizer::CacheEntry> GeometryImportOptimizer::s_cache;
-std::mutex GeometryImportOptimizer::s_cacheMutex;
-std::atomic<size_t> GeometryImportOptimizer::s_cacheSize(0);
-const size_t GeometryImportOptimizer::s_maxCacheSize = 1024 * 1024 * 1024; // 1GB
-
 std::vector<GeometryImportOptimizer::ImportMetrics> GeometryImportOptimizer::s_performanceHistory;
 std::mutex GeometryImportOptimizer::s_performanceMutex;
 std::atomic<bool> GeometryImportOptimizer::s_profilingEnabled(false);
@@ -120,12 +116,11 @@ GeometryReader::ReadResult GeometryImportOptimizer::importOptimized(
     try {
         // Check cache first
         if (options.enableCache) {
-            auto cached = getCachedImport(filePath);
+            ImportCache::getInstance().setBudget(options.maxCacheSize);
+            auto cached = ImportCache::getInstance().lookup(filePath, options);
             if (cached.has_value()) {
                 LOG_INF_S("Using cached import for: " + filePath);
-                GeometryReader::ReadResult result;
-                result.success = true;
-                result.geometries = cached->geometries;
+                GeometryReader::ReadResult result = std::move(*cached);
                 result.importTime = 0.0; // Instant from cache
                 
                 if (s_profilingEnabled) {
@@ -164,33 +159,22 @@ GeometryReader::ReadResult GeometryImportOptimizer::importOptimized(
         // Optimize memory usage
         optimizeMemoryUsage(result.geometries);
 
-        // Update cache
-        if (options.enableCache && result.success) {
-            CacheEntry entry;
-            entry.geometries = result.geometries;
-            entry.timestamp = std::chrono::system_clock::now();
-            entry.fileHash = calculateFileHash(filePath);
-            entry.metrics = metrics;
-
-            std::lock_guard<std::mutex> lock(s_cacheMutex);
-            // Check cache size limit
-            if (s_cacheSize + metrics.memoryUsed < s_maxCacheSize) {
-                s_cache[filePath] = entry;
-                s_cacheSize += metrics.memoryUsed;
-            }
-        }
-
         // Record metrics
         auto endTime = std::chrono::high_resolution_clock::now();
         metrics.totalTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
         metrics.geometryCount = result.geometries.size();
+        result.importTime = metrics.totalTime;
+
+        // Update cache; the import time is the eviction cost of the entry
+        if (options.enableCache && result.success) {
+            ImportCache::getInstance().store(filePath, options, result);
+        }
         
         if (s_profilingEnabled) {
             std::lock_guard<std::mutex> lock(s_performanceMutex);
             s_performanceHistory.push_back(metrics);
         }
 
-        result.importTime = metrics.totalTime;
         return result;
 
     } catch (const std::exception& e) {
@@ -219,75 +203,44 @@ std::vector<GeometryReader::ReadResult> GeometryImportOptimizer::importBatchOpti
     LOG_INF_S("Batch importing " + std::to_string(fileCount) + " files using " + 
               std::to_string(threadCount) + " threads");
 
-    // Use thread pool for parallel imports
-    std::vector<std::future<GeometryReader::ReadResult>> futures;
-    futures.reserve(fileCount);
-
-    // Launch async tasks
-    for (size_t i = 0; i < fileCount; ++i) {
-        futures.push_back(std::async(std::launch::async, [&, i]() {
-            auto result = importOptimized(filePaths[i], options, nullptr);
-            if (progress) {
-                progress(i + 1, fileCount, filePaths[i]);
-            }
-            return result;
-        }));
-    }
-
-    // Collect results
-    for (size_t i = 0; i < fileCount; ++i) {
-        results[i] = futures[i].get();
-    }
+    // Files share the bounded reader pool; each import may fan out further inside it.
+    // Imports finish out of order, so progress names the file that finished last
+    // rather than the one at the completed count.
+    std::atomic<size_t> lastFinished{0};
+    GeometryReader::parallelForEach(fileCount, static_cast<int>(threadCount), [&](size_t i) {
+        results[i] = importOptimized(filePaths[i], options, nullptr);
+        lastFinished.store(i);
+    }, [&](size_t done) {
+        if (progress) {
+            progress(done, fileCount, filePaths[lastFinished.load()]);
+        }
+    });
 
     return results;
 }
 
-std::optional<GeometryImportOptimizer::CacheEntry> GeometryImportOptimizer::getCachedImport(
-    const std::string& filePath)
-{
-    std::lock_guard<std::mutex> lock(s_cacheMutex);
-    auto it = s_cache.find(filePath);
-    if (it != s_cache.end()) {
-        // Verify file hasn't changed
-        size_t currentHash = calculateFileHash(filePath);
-        if (currentHash == it->second.fileHash) {
-            return it->second;
-        } else {
-            // File changed, invalidate cache
-            s_cacheSize -= it->second.metrics.memoryUsed;
-            s_cache.erase(it);
-        }
-    }
-    return std::nullopt;
-}
-
 void GeometryImportOptimizer::clearCache()
 {
-    std::lock_guard<std::mutex> lock(s_cacheMutex);
-    s_cache.clear();
-    s_cacheSize = 0;
+    ImportCache::getInstance().clear();
     LOG_INF_S("Geometry import cache cleared");
 }
 
 std::string GeometryImportOptimizer::getCacheStatistics()
 {
-    std::lock_guard<std::mutex> lock(s_cacheMutex);
+    ImportCache::Statistics stats = ImportCache::getInstance().getStatistics();
+    const uint64_t lookups = stats.hits + stats.misses;
     std::ostringstream oss;
     oss << "Cache Statistics:\n";
-    oss << "  Entries: " << s_cache.size() << "\n";
-    oss << "  Size: " << (s_cacheSize / (1024.0 * 1024.0)) << " MB\n";
-    oss << "  Max Size: " << (s_maxCacheSize / (1024.0 * 1024.0)) << " MB\n";
-    oss << "  Usage: " << (100.0 * s_cacheSize / s_maxCacheSize) << "%\n";
-    
-    if (!s_cache.empty()) {
-        oss << "\nCached Files:\n";
-        for (const auto& [path, entry] : s_cache) {
-            oss << "  " << std::filesystem::path(path).filename().string() 
-                << " (" << entry.geometries.size() << " geometries, "
-                << (entry.metrics.memoryUsed / 1024.0) << " KB)\n";
-        }
+    oss << "  Entries: " << stats.entries << "\n";
+    oss << "  Size: " << (stats.bytes / (1024.0 * 1024.0)) << " MB\n";
+    oss << "  Max Size: " << (stats.budget / (1024.0 * 1024.0)) << " MB\n";
+    oss << "  Usage: " << (stats.budget > 0 ? 100.0 * stats.bytes / stats.budget : 0.0) << "%\n";
+    oss << "  Hits: " << stats.hits << ", Misses: " << stats.misses;
+    if (lookups > 0) {
+        oss << " (" << (100.0 * stats.hits / lookups) << "% hit rate)";
     }
-    
+    oss << "\n";
+    oss << "  Evictions: " << stats.evictions << ", Rejected: " << stats.rejected << "\n";
     return oss.str();
 }
 
@@ -430,23 +383,6 @@ double GeometryImportOptimizer::estimateImportTime(const std::string& filePath)
     }
 }
 
-size_t GeometryImportOptimizer::calculateFileHash(const std::string& filePath)
-{
-    try {
-        // Simple hash based on file size and modification time
-        auto fileSize = std::filesystem::file_size(filePath);
-        auto modTime = std::filesystem::last_write_time(filePath);
-        
-        size_t hash = std::hash<size_t>{}(fileSize);
-        hash ^= std::hash<decltype(modTime)::rep>{}(modTime.time_since_epoch().count());
-        
-        return hash;
-    } catch (const std::exception& e) {
-        LOG_WRN_S("Failed to calculate file hash: " + std::string(e.what()));
-        return 0;
-    }
-}
-
 GeometryReader::ReadResult GeometryImportOptimizer::importWithThreading(
     std::unique_ptr<GeometryReader> reader,
     const std::string& filePath,
@@ -460,7 +396,8 @@ GeometryReader::ReadResult GeometryImportOptimizer::importWithThreading(
     GeometryReader::OptimizationOptions readerOptions;
     readerOptions.enableParallelProcessing = options.threading.enableParallelParsing;
     readerOptions.enableShapeAnalysis = options.enableShapeAnalysis;
-    readerOptions.enableCaching = options.enableCaching;
+    // importOptimized caches the finished result; a reader-level entry would only be replaced
+    readerOptions.enableCaching = options.enableCaching && !options.enableCache;
     readerOptions.enableBatchOperations = options.enableBatchOperations;
     readerOptions.enableNormalProcessing = options.enableNormalProcessing;
     readerOptions.maxThreads = options.threading.maxThreads;
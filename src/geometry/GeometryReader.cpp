@@ -22,6 +22,10 @@
 #include <future>
 #include <thread>
 #include <execution>
+#include <atomic>
+#include <tbb/task_arena.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 
 // OpenCASCADE includes for shape processing
 #include <BRep_Builder.hxx>
@@ -36,6 +40,92 @@
 #include <Inventor/nodes/SoShapeHints.h>
 #include <Inventor/nodes/SoPolygonOffset.h>
 
+void GeometryReader::parallelForEach(
+    size_t count,
+    int maxThreads,
+    const std::function<void(size_t)>& body,
+    const std::function<void(size_t)>& onProgress)
+{
+    if (count == 0) {
+        return;
+    }
+
+    const int threads = maxThreads > 0 ? maxThreads : tbb::task_arena::automatic;
+    const int concurrency = maxThreads > 0 ? maxThreads
+        : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    // Several chunks per thread keep work stealing effective when shape costs vary
+    const size_t grain = std::max<size_t>(1, count / (static_cast<size_t>(concurrency) * 8));
+
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<size_t> completed{0};
+    size_t reported = 0;
+
+    // The arena bounds this import; its threads come from the process-wide TBB pool
+    tbb::task_arena arena(threads);
+    arena.execute([&]() {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, count, grain),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    body(i);
+                }
+                size_t done = completed.fetch_add(range.size()) + range.size();
+                // Progress callbacks usually touch UI, so only the calling thread reports
+                if (onProgress && std::this_thread::get_id() == caller) {
+                    reported = done;
+                    onProgress(done);
+                }
+            });
+    });
+
+    if (onProgress && reported != count) {
+        onProgress(count);
+    }
+}
+
+std::vector<std::shared_ptr<OCCGeometry>> GeometryReader::convertShapesParallel(
+    size_t count,
+    const std::function<std::shared_ptr<OCCGeometry>(size_t)>& convert,
+    const OptimizationOptions& options,
+    ProgressCallback progress,
+    int progressStart,
+    int progressSpan)
+{
+    std::vector<std::shared_ptr<OCCGeometry>> results(count);
+    auto report = [&](size_t done) {
+        if (progress) {
+            int percent = progressStart + static_cast<int>(done * static_cast<double>(progressSpan) / count);
+            progress(percent, "Processing shape " + std::to_string(done) + "/" + std::to_string(count));
+        }
+    };
+
+    if (options.enableParallelProcessing && count > 1) {
+        try {
+            parallelForEach(count, options.maxThreads, [&](size_t i) {
+                results[i] = convert(i);
+            }, report);
+        }
+        catch (...) {
+            LOG_WRN_S("Shape conversion cancelled after progress callback failure");
+            throw;
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = convert(i);
+            report(i + 1);
+        }
+    }
+
+    // Results are stored by index, so the order matches the input regardless of scheduling
+    std::vector<std::shared_ptr<OCCGeometry>> geometries;
+    geometries.reserve(count);
+    for (auto& geometry : results) {
+        if (geometry) {
+            geometries.push_back(std::move(geometry));
+        }
+    }
+    return geometries;
+}
+
 std::shared_ptr<OCCGeometry> GeometryReader::createGeometryFromShape(
     const TopoDS_Shape& shape,
     const std::string& name,
@@ -95,6 +185,32 @@ std::shared_ptr<OCCGeometry> GeometryReader::createGeometryFromMesh(
         // This enables mesh edges, vertex normals, and face normals for mesh-only geometries
         geometry->setCachedMesh(mesh);
         
+        if (options.buildCoinNodes) {
+            buildMeshCoinNode(*geometry);
+        }
+        
+        LOG_INF_S("Created OCCGeometry from mesh: " + 
+                 std::to_string(mesh.vertices.size()) + " vertices, " + 
+                 std::to_string(mesh.triangles.size() / 3) + " triangles");
+        
+        return geometry;
+    }
+    catch (const std::exception& e) {
+        LOG_ERR_S("Failed to create geometry from mesh: " + std::string(e.what()));
+        return nullptr;
+    }
+}
+
+bool GeometryReader::buildMeshCoinNode(OCCGeometry& geometry)
+{
+    if (geometry.getCoinNode()) {
+        return true;
+    }
+    if (!geometry.hasCachedMesh()) {
+        return false;
+    }
+
+    try {
         // Create complete Coin3D node structure with all display modes using DisplayModeHandler
         SoSeparator* rootNode = new SoSeparator();
         rootNode->ref();
@@ -127,23 +243,18 @@ std::shared_ptr<OCCGeometry> GeometryReader::createGeometryFromMesh(
 
         // Use DisplayModeHandler to build scene graph with TriangleMesh
         MeshParameters defaultParams;
-        displayHandler.handleDisplayMode(rootNode, context, mesh, defaultParams,
-                                        geometry->modularEdgeComponent.get(), 
-                                        geometry->useModularEdgeComponent,
+        displayHandler.handleDisplayMode(rootNode, context, geometry.getCachedMesh(), defaultParams,
+                                        geometry.modularEdgeComponent.get(), 
+                                        geometry.useModularEdgeComponent,
                                         &renderBuilder, &wireframeBuilder, &pointViewBuilder);
 
         // Store coin node in geometry
-        geometry->setCoinNode(rootNode);
-        
-        LOG_INF_S("Created OCCGeometry from mesh with all display modes: " + 
-                 std::to_string(mesh.vertices.size()) + " vertices, " + 
-                 std::to_string(mesh.triangles.size() / 3) + " triangles");
-        
-        return geometry;
+        geometry.setCoinNode(rootNode);
+        return true;
     }
     catch (const std::exception& e) {
-        LOG_ERR_S("Failed to create geometry from mesh: " + std::string(e.what()));
-        return nullptr;
+        LOG_ERR_S("Failed to build Coin nodes for mesh geometry: " + std::string(e.what()));
+        return false;
     }
 }
 
@@ -0,0 +1,327 @@
+#include "ImportCache.h"
+#include "OCCGeometry.h"
+#include "logger/Logger.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+namespace {
+    // Rough footprint of one TShape with its geometry handle (curve/surface, location, flags)
+    constexpr size_t kTopologyBytes = 256;
+    // Bytes hashed from the start, middle and end of a file
+    constexpr size_t kSampleBytes = 64 * 1024;
+
+    constexpr uint64_t kFnvOffset = 1469598103934665603ull;
+    constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+    void hashBytes(uint64_t& hash, const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= kFnvPrime;
+        }
+    }
+
+    template <typename T>
+    void hashValue(uint64_t& hash, const T& value) {
+        hashBytes(hash, &value, sizeof(value));
+    }
+
+    size_t addTriangulationBytes(const TopTools_IndexedMapOfShape& faces) {
+        size_t bytes = 0;
+        for (int i = 1; i <= faces.Extent(); ++i) {
+            TopLoc_Location location;
+            Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(TopoDS::Face(faces(i)), location);
+            if (triangulation.IsNull()) {
+                continue;
+            }
+            const size_t nodes = static_cast<size_t>(triangulation->NbNodes());
+            bytes += nodes * 3 * sizeof(double);
+            if (triangulation->HasUVNodes()) {
+                bytes += nodes * 2 * sizeof(double);
+            }
+            if (triangulation->HasNormals()) {
+                bytes += nodes * 3 * sizeof(float);
+            }
+            bytes += static_cast<size_t>(triangulation->NbTriangles()) * 3 * sizeof(int);
+        }
+        return bytes;
+    }
+}
+
+ImportCache& ImportCache::getInstance()
+{
+    static ImportCache instance;
+    return instance;
+}
+
+bool ImportCache::Key::operator==(const Key& other) const
+{
+    return canonicalPath == other.canonicalPath &&
+        fileSize == other.fileSize &&
+        modifiedTime == other.modifiedTime &&
+        contentHash == other.contentHash &&
+        optionsHash == other.optionsHash;
+}
+
+std::optional<ImportCache::Key> ImportCache::makeKey(
+    const std::string& filePath,
+    const GeometryReader::OptimizationOptions& options)
+{
+    std::error_code ec;
+    std::filesystem::path canonical = std::filesystem::canonical(filePath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    uintmax_t size = std::filesystem::file_size(canonical, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto modified = std::filesystem::last_write_time(canonical, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    Key key;
+    key.canonicalPath = canonical.string();
+    key.fileSize = static_cast<uint64_t>(size);
+    key.modifiedTime = static_cast<int64_t>(modified.time_since_epoch().count());
+    key.contentHash = hashFileSample(key.canonicalPath, key.fileSize);
+    key.optionsHash = hashOptions(options);
+    return key;
+}
+
+uint64_t ImportCache::hashOptions(const GeometryReader::OptimizationOptions& options)
+{
+    // Only options that change the produced geometry; threading and caching flags do not
+    uint64_t hash = kFnvOffset;
+    hashValue(hash, options.enableShapeAnalysis);
+    hashValue(hash, options.enableNormalProcessing);
+    hashValue(hash, options.precision);
+    hashValue(hash, options.meshDeflection);
+    hashValue(hash, options.angularDeflection);
+    hashValue(hash, options.enableFineTessellation);
+    hashValue(hash, options.tessellationDeflection);
+    hashValue(hash, options.tessellationAngle);
+    hashValue(hash, options.tessellationMinPoints);
+    hashValue(hash, options.tessellationMaxPoints);
+    hashValue(hash, options.enableAdaptiveTessellation);
+    hashValue(hash, options.enableBRepSidecar);
+    hashValue(hash, options.buildCoinNodes);
+    hashValue(hash, options.decomposition.enableDecomposition);
+    hashValue(hash, options.decomposition.level);
+    hashValue(hash, options.decomposition.colorScheme);
+    hashValue(hash, options.decomposition.useConsistentColoring);
+    return hash;
+}
+
+uint64_t ImportCache::hashFileSample(const std::string& filePath, uint64_t fileSize)
+{
+    // Size and mtime catch ordinary edits; the sampled hash catches same-size
+    // rewrites with a preserved timestamp without reading large files in full
+    uint64_t hash = kFnvOffset;
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        return hash;
+    }
+
+    std::vector<char> buffer(kSampleBytes);
+    auto sampleAt = [&](uint64_t offset) {
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        hashBytes(hash, buffer.data(), static_cast<size_t>(file.gcount()));
+    };
+
+    sampleAt(0);
+    if (fileSize > kSampleBytes * 3) {
+        sampleAt(fileSize / 2);
+        sampleAt(fileSize - kSampleBytes);
+    }
+    else if (fileSize > kSampleBytes) {
+        sampleAt(kSampleBytes);
+    }
+    return hash;
+}
+
+std::optional<GeometryReader::ReadResult> ImportCache::lookup(
+    const std::string& filePath,
+    const GeometryReader::OptimizationOptions& options)
+{
+    auto key = makeKey(filePath, options);
+    if (!key) {
+        return std::nullopt;
+    }
+
+    std::shared_ptr<Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key->canonicalPath);
+        if (it == m_entries.end() || !(it->second->key == *key)) {
+            ++m_stats.misses;
+            return std::nullopt;
+        }
+        entry = it->second;
+        entry->priority = priorityFor(*entry);
+        ++m_stats.hits;
+    }
+
+    // Fresh geometry objects around the shared shapes; built outside the lock
+    GeometryReader::ReadResult result;
+    result.success = true;
+    result.formatName = entry->formatName;
+    result.rootShape = entry->rootShape;
+    result.geometries.reserve(entry->geometries.size());
+    for (const auto& cached : entry->geometries) {
+        auto geometry = std::make_shared<OCCGeometry>(cached.name);
+        geometry->setShape(cached.shape);
+        geometry->setFileName(cached.fileName);
+        geometry->setColor(cached.color);
+        geometry->setTransparency(cached.transparency);
+        geometry->setAssemblyLevel(cached.assemblyLevel);
+        result.geometries.push_back(geometry);
+    }
+
+    LOG_INF_S("ImportCache: Hit for " + key->canonicalPath + " (" +
+        std::to_string(result.geometries.size()) + " geometries)");
+    return result;
+}
+
+void ImportCache::store(
+    const std::string& filePath,
+    const GeometryReader::OptimizationOptions& options,
+    const GeometryReader::ReadResult& result)
+{
+    if (!result.success || result.geometries.empty()) {
+        return;
+    }
+    for (const auto& geometry : result.geometries) {
+        if (!geometry || geometry->hasCachedMesh()) {
+            return;
+        }
+    }
+
+    auto key = makeKey(filePath, options);
+    if (!key) {
+        return;
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->key = *key;
+    entry->rootShape = result.rootShape;
+    entry->formatName = result.formatName;
+    entry->importTime = result.importTime;
+    entry->geometries.reserve(result.geometries.size());
+
+    // Count each TShape once even when geometries and the root share it
+    TopTools_IndexedMapOfShape subShapes;
+    TopTools_IndexedMapOfShape faces;
+    if (!result.rootShape.IsNull()) {
+        TopExp::MapShapes(result.rootShape, subShapes);
+        TopExp::MapShapes(result.rootShape, TopAbs_FACE, faces);
+    }
+    for (const auto& geometry : result.geometries) {
+        CachedGeometry cached;
+        cached.name = geometry->getName();
+        cached.fileName = geometry->getFileName();
+        cached.shape = geometry->getShape();
+        cached.color = geometry->getColor();
+        cached.transparency = geometry->getTransparency();
+        cached.assemblyLevel = geometry->getAssemblyLevel();
+        if (!cached.shape.IsNull()) {
+            TopExp::MapShapes(cached.shape, subShapes);
+            TopExp::MapShapes(cached.shape, TopAbs_FACE, faces);
+        }
+        entry->geometries.push_back(std::move(cached));
+    }
+    entry->bytes = static_cast<size_t>(subShapes.Extent()) * kTopologyBytes + addTriangulationBytes(faces) +
+        entry->geometries.size() * sizeof(CachedGeometry);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto existing = m_entries.find(key->canonicalPath);
+    if (existing != m_entries.end()) {
+        m_bytes -= existing->second->bytes;
+        m_entries.erase(existing);
+    }
+
+    if (entry->bytes > m_budget) {
+        ++m_stats.rejected;
+        LOG_WRN_S("ImportCache: " + key->canonicalPath + " (" + std::to_string(entry->bytes / (1024 * 1024)) +
+            " MB) exceeds the cache budget, not cached");
+        return;
+    }
+
+    evictToFit(entry->bytes);
+    entry->priority = priorityFor(*entry);
+    m_bytes += entry->bytes;
+    m_entries.emplace(key->canonicalPath, std::move(entry));
+    ++m_stats.insertions;
+}
+
+double ImportCache::priorityFor(const Entry& entry) const
+{
+    // Import milliseconds saved per MB held, aged by the inflation value
+    double cost = std::max(entry.importTime, 1.0);
+    double sizeMb = std::max(static_cast<double>(entry.bytes) / (1024.0 * 1024.0), 1e-3);
+    return m_inflation + cost / sizeMb;
+}
+
+void ImportCache::evictToFit(size_t incomingBytes)
+{
+    while (!m_entries.empty() && m_bytes + incomingBytes > m_budget) {
+        auto victim = std::min_element(m_entries.begin(), m_entries.end(),
+            [](const auto& a, const auto& b) { return a.second->priority < b.second->priority; });
+        // Everything left ages relative to the evicted entry
+        m_inflation = victim->second->priority;
+        m_bytes -= victim->second->bytes;
+        LOG_DBG_S("ImportCache: Evicting " + victim->first);
+        m_entries.erase(victim);
+        ++m_stats.evictions;
+    }
+}
+
+void ImportCache::setBudget(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_budget = bytes;
+    evictToFit(0);
+}
+
+size_t ImportCache::getBudget() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_budget;
+}
+
+void ImportCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_bytes = 0;
+    m_inflation = 0.0;
+    LOG_INF_S("ImportCache: Cleared");
+}
+
+ImportCache::Statistics ImportCache::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Statistics stats = m_stats;
+    stats.entries = m_entries.size();
+    stats.bytes = m_bytes;
+    stats.budget = m_budget;
+    return stats;
+}
+
+void ImportCache::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats = Statistics();
+}
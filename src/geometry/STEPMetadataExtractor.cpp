@@ -108,6 +108,65 @@ STEPReader::STEPAssemblyInfo STEPMetadataExtractor::buildAssemblyStructure(
     return assemblyInfo;
 }
 
+STEPReader::STEPAssemblyInfo STEPMetadataExtractor::buildAssemblyStructure(
+    const STEPPreScanner::ScanResult& scan)
+{
+    STEPReader::STEPAssemblyInfo assemblyInfo;
+    assemblyInfo.name = "Root Assembly";
+    assemblyInfo.type = "ASSEMBLY";
+    if (!scan.success) {
+        return assemblyInfo;
+    }
+
+    std::vector<bool> onPath(scan.products.size(), false);
+    if (scan.rootProducts.size() == 1 && !scan.products[scan.rootProducts[0]].occurrences.empty()) {
+        // A single top-level assembly becomes the root itself
+        const size_t root = scan.rootProducts[0];
+        assemblyInfo.name = scan.products[root].name;
+        onPath[root] = true;
+        for (size_t occurrence : scan.products[root].occurrences) {
+            appendScannedProduct(scan, scan.occurrences[occurrence].child, assemblyInfo, onPath);
+        }
+        return assemblyInfo;
+    }
+
+    for (size_t root : scan.rootProducts) {
+        appendScannedProduct(scan, root, assemblyInfo, onPath);
+    }
+    return assemblyInfo;
+}
+
+void STEPMetadataExtractor::appendScannedProduct(const STEPPreScanner::ScanResult& scan, size_t productIndex,
+    STEPReader::STEPAssemblyInfo& assembly, std::vector<bool>& onPath)
+{
+    const STEPPreScanner::ProductInfo& product = scan.products[productIndex];
+    if (product.occurrences.empty()) {
+        STEPReader::STEPEntityInfo component;
+        component.name = product.name.empty() ? product.id : product.name;
+        component.type = "PRODUCT";
+        component.description = product.description;
+        component.entityId = product.entityId;
+        assembly.components.push_back(component);
+        return;
+    }
+
+    // Malformed files can make an assembly contain itself
+    if (onPath[productIndex]) {
+        return;
+    }
+    onPath[productIndex] = true;
+
+    STEPReader::STEPAssemblyInfo subAssembly;
+    subAssembly.name = product.name.empty() ? product.id : product.name;
+    subAssembly.type = "ASSEMBLY";
+    for (size_t occurrence : product.occurrences) {
+        appendScannedProduct(scan, scan.occurrences[occurrence].child, subAssembly, onPath);
+    }
+    assembly.subAssemblies.push_back(std::move(subAssembly));
+
+    onPath[productIndex] = false;
+}
+
 STEPReader::STEPEntityInfo STEPMetadataExtractor::extractEntityInfo(
     const STEPControl_Reader& reader,
     int entityId)
@@ -0,0 +1,786 @@
+#include "STEPPreScanner.h"
+#include "logger/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+
+namespace {
+    constexpr size_t kChunkSize = 4 * 1024 * 1024;
+    // Complex instances are kept only while short; units are a handful of bytes,
+    // complex geometry can be arbitrarily long
+    constexpr size_t kMaxComplexCapture = 4096;
+
+    /**
+     * @brief One parsed parameter of an instance
+     */
+    struct Param {
+        enum class Kind { Ref, String, List, Other };
+        Kind kind = Kind::Other;
+        int ref = 0;
+        std::string text;           // String contents, enum/number text, or typed-parameter keyword
+        std::vector<Param> items;   // List members or typed-parameter arguments
+    };
+
+    void appendUtf8(std::string& out, unsigned int codePoint) {
+        if (codePoint < 0x80) {
+            out += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            out += static_cast<char>(0xE0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    // Decode the Part 21 escapes that exporters commonly write for names:
+    // \X\hh (ISO 8859-1) and \X2\hhhh...\X0\ (UCS-2)
+    std::string decodeStepString(const std::string& raw) {
+        std::string out;
+        out.reserve(raw.size());
+        for (size_t i = 0; i < raw.size(); ++i) {
+            if (raw.compare(i, 3, "\\X\\") == 0 && i + 5 <= raw.size()) {
+                appendUtf8(out, static_cast<unsigned int>(std::strtoul(raw.substr(i + 3, 2).c_str(), nullptr, 16)));
+                i += 4;
+            } else if (raw.compare(i, 4, "\\X2\\") == 0) {
+                size_t end = raw.find("\\X0\\", i + 4);
+                if (end == std::string::npos) {
+                    out += raw.substr(i);
+                    break;
+                }
+                for (size_t j = i + 4; j + 4 <= end; j += 4) {
+                    appendUtf8(out, static_cast<unsigned int>(std::strtoul(raw.substr(j, 4).c_str(), nullptr, 16)));
+                }
+                i = end + 3;
+            } else {
+                out += raw[i];
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief Parser for the parameter list of one instance
+     *
+     * The text has had all whitespace outside strings removed by the scanner.
+     */
+    class ParameterParser {
+    public:
+        ParameterParser(const std::string& text, size_t pos) : m_text(text), m_pos(pos) {}
+
+        // Parses "(a,b,...)" starting at the opening parenthesis
+        bool parseList(std::vector<Param>& items) {
+            if (m_pos >= m_text.size() || m_text[m_pos] != '(') return false;
+            ++m_pos;
+            if (m_pos < m_text.size() && m_text[m_pos] == ')') {
+                ++m_pos;
+                return true;
+            }
+            while (m_pos < m_text.size()) {
+                Param param;
+                if (!parseValue(param)) return false;
+                items.push_back(std::move(param));
+                if (m_pos >= m_text.size()) return false;
+                if (m_text[m_pos] == ',') {
+                    ++m_pos;
+                } else if (m_text[m_pos] == ')') {
+                    ++m_pos;
+                    return true;
+                } else {
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        size_t position() const { return m_pos; }
+
+    private:
+        bool parseValue(Param& param) {
+            if (m_pos >= m_text.size()) return false;
+            const char c = m_text[m_pos];
+            if (c == '#') {
+                param.kind = Param::Kind::Ref;
+                ++m_pos;
+                param.ref = static_cast<int>(std::strtol(m_text.c_str() + m_pos, nullptr, 10));
+                while (m_pos < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_pos]))) ++m_pos;
+                return true;
+            }
+            if (c == '\'') {
+                param.kind = Param::Kind::String;
+                std::string raw;
+                ++m_pos;
+                while (m_pos < m_text.size()) {
+                    if (m_text[m_pos] == '\'') {
+                        if (m_pos + 1 < m_text.size() && m_text[m_pos + 1] == '\'') {
+                            raw += '\'';
+                            m_pos += 2;
+                            continue;
+                        }
+                        ++m_pos;
+                        param.text = decodeStepString(raw);
+                        return true;
+                    }
+                    raw += m_text[m_pos++];
+                }
+                return false;
+            }
+            if (c == '(') {
+                param.kind = Param::Kind::List;
+                return parseList(param.items);
+            }
+            // Enumeration, number, $, * or a typed parameter such as LENGTH_MEASURE(1.)
+            size_t start = m_pos;
+            while (m_pos < m_text.size() && m_text[m_pos] != ',' && m_text[m_pos] != ')' && m_text[m_pos] != '(') {
+                ++m_pos;
+            }
+            param.text = m_text.substr(start, m_pos - start);
+            if (m_pos < m_text.size() && m_text[m_pos] == '(') {
+                return parseList(param.items);
+            }
+            return true;
+        }
+
+        const std::string& m_text;
+        size_t m_pos;
+    };
+
+    std::string stringAt(const std::vector<Param>& params, size_t index) {
+        return index < params.size() && params[index].kind == Param::Kind::String ? params[index].text : std::string();
+    }
+
+    int refAt(const std::vector<Param>& params, size_t index) {
+        return index < params.size() && params[index].kind == Param::Kind::Ref ? params[index].ref : 0;
+    }
+
+    std::vector<int> refsAt(const std::vector<Param>& params, size_t index) {
+        std::vector<int> refs;
+        if (index < params.size() && params[index].kind == Param::Kind::List) {
+            refs.reserve(params[index].items.size());
+            for (const Param& item : params[index].items) {
+                if (item.kind == Param::Kind::Ref) refs.push_back(item.ref);
+            }
+        }
+        return refs;
+    }
+
+    std::vector<std::string> stringsAt(const std::vector<Param>& params, size_t index) {
+        std::vector<std::string> strings;
+        if (index < params.size() && params[index].kind == Param::Kind::List) {
+            for (const Param& item : params[index].items) {
+                if (item.kind == Param::Kind::String) strings.push_back(item.text);
+            }
+        }
+        return strings;
+    }
+
+    bool isShapeRepresentation(const std::string& type) {
+        static const std::string suffix = "SHAPE_REPRESENTATION";
+        return type.size() >= suffix.size() &&
+               type.compare(type.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    const std::unordered_set<std::string>& indexedTypes() {
+        static const std::unordered_set<std::string> types = {
+            "PRODUCT",
+            "PRODUCT_DEFINITION_FORMATION",
+            "PRODUCT_DEFINITION_FORMATION_WITH_SPECIFIED_SOURCE",
+            "PRODUCT_DEFINITION",
+            "PRODUCT_DEFINITION_SHAPE",
+            "NEXT_ASSEMBLY_USAGE_OCCURRENCE",
+            "SHAPE_DEFINITION_REPRESENTATION",
+            "SHAPE_REPRESENTATION_RELATIONSHIP",
+            "MANIFOLD_SOLID_BREP",
+            "BREP_WITH_VOIDS",
+            "FACETED_BREP",
+            "SHELL_BASED_SURFACE_MODEL",
+            "CLOSED_SHELL",
+            "OPEN_SHELL"
+        };
+        return types;
+    }
+
+    double siLengthScale(const std::string& prefix) {
+        if (prefix == ".MILLI.") return 1.0;
+        if (prefix == ".CENTI.") return 10.0;
+        if (prefix == ".DECI.") return 100.0;
+        if (prefix == ".KILO.") return 1.0e6;
+        if (prefix == ".MICRO.") return 1.0e-3;
+        if (prefix == ".NANO.") return 1.0e-6;
+        return 1000.0;
+    }
+
+    /**
+     * @brief Streaming splitter and indexer; one instance per scan
+     */
+    class Scanner {
+    public:
+        explicit Scanner(STEPPreScanner::ScanResult& result) : m_result(result) {}
+
+        void feed(const char* data, size_t size, uint64_t baseOffset);
+        bool finish();
+
+    private:
+        struct RawOccurrence {
+            int entityId;
+            uint64_t offset;
+            std::string id;
+            std::string name;
+            int relating;
+            int related;
+        };
+
+        struct LengthUnit {
+            std::string name;
+            double millimetres = 0.0;
+            bool conversionBased = false;
+        };
+
+        void startStatement(uint64_t offset);
+        void onOpenParen();
+        void finishStatement();
+        void handleHeader(const std::string& text);
+        void handleInstance(int id, const std::string& type, size_t paramsPos);
+        void handleComplex(int id);
+        void resolve();
+        void resolveLengthUnit();
+
+        STEPPreScanner::ScanResult& m_result;
+
+        // Lexer state
+        bool m_inString = false;
+        bool m_inComment = false;
+        bool m_started = false;
+        bool m_typeKnown = false;
+        bool m_capturing = true;
+        bool m_truncated = false;
+        bool m_complex = false;
+        char m_previous = 0;
+        uint64_t m_statementOffset = 0;
+        std::string m_statement;
+        bool m_sawIsoMarker = false;
+        bool m_inHeader = false;
+        bool m_inData = false;
+        bool m_sawData = false;
+
+        // Raw index, resolved once the whole file is seen (STEP allows forward references)
+        std::unordered_map<int, size_t> m_productById;
+        std::unordered_map<int, int> m_formationToProduct;
+        std::unordered_map<int, int> m_definitionToFormation;
+        std::unordered_map<int, int> m_shapeToDefinition;
+        std::vector<std::pair<int, int>> m_shapeDefinitionReps;   // PRODUCT_DEFINITION_SHAPE -> representation
+        std::vector<std::pair<int, int>> m_representationLinks;   // Untransformed relationships
+        std::unordered_map<int, size_t> m_representationById;
+        std::unordered_map<int, std::vector<int>> m_solidShells;
+        std::unordered_map<int, size_t> m_shellFaces;
+        std::vector<RawOccurrence> m_occurrences;
+        std::unordered_map<int, LengthUnit> m_lengthUnits;
+        std::vector<int> m_firstLengthUnits;                        // SI and conversion-based, in file order
+        std::vector<std::vector<int>> m_contextUnits;               // GLOBAL_UNIT_ASSIGNED_CONTEXT unit lists
+    };
+
+    void Scanner::feed(const char* data, size_t size, uint64_t baseOffset) {
+        for (size_t i = 0; i < size; ++i) {
+            const char c = data[i];
+
+            if (m_inComment) {
+                if (m_previous == '*' && c == '/') {
+                    m_inComment = false;
+                    m_previous = 0;
+                } else {
+                    m_previous = c;
+                }
+                continue;
+            }
+
+            if (m_inString) {
+                if (m_capturing) m_statement += c;
+                if (c == '\'') m_inString = false;
+                m_previous = c;
+                continue;
+            }
+
+            if (c == '*' && m_previous == '/') {
+                // Drop the '/' already taken as statement text
+                m_inComment = true;
+                m_previous = 0;
+                if (m_capturing && !m_statement.empty() && m_statement.back() == '/') {
+                    m_statement.pop_back();
+                    if (m_statement.empty()) m_started = false;
+                }
+                continue;
+            }
+            m_previous = c;
+
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+                continue;
+            }
+
+            if (!m_started) {
+                startStatement(baseOffset + i);
+            }
+
+            if (c == '\'') {
+                m_inString = true;
+            }
+            if (m_capturing) {
+                m_statement += c;
+                if (m_complex && m_statement.size() > kMaxComplexCapture) {
+                    m_capturing = false;
+                    m_truncated = true;
+                }
+            }
+            if (c == '(' && !m_typeKnown) {
+                m_typeKnown = true;
+                onOpenParen();
+            } else if (c == ';') {
+                finishStatement();
+            }
+        }
+    }
+
+    void Scanner::startStatement(uint64_t offset) {
+        m_started = true;
+        m_typeKnown = false;
+        m_capturing = true;
+        m_truncated = false;
+        m_complex = false;
+        m_statementOffset = offset;
+        m_statement.clear();
+    }
+
+    void Scanner::onOpenParen() {
+        // Header statements are short and always kept
+        if (!m_inData) return;
+
+        const size_t equals = m_statement.find('=');
+        if (m_statement.empty() || m_statement[0] != '#' || equals == std::string::npos) return;
+        if (equals + 2 == m_statement.size()) {
+            // Complex instance "#n=(", kept up to the cap
+            m_complex = true;
+            return;
+        }
+
+        const std::string type = m_statement.substr(equals + 1, m_statement.size() - equals - 2);
+        if (!indexedTypes().count(type) && !isShapeRepresentation(type)) {
+            // Only the prefix is needed to count it
+            m_capturing = false;
+        }
+    }
+
+    void Scanner::finishStatement() {
+        m_started = false;
+        std::string& text = m_statement;
+
+        if (!m_inData) {
+            if (!text.empty() && text.back() == ';') text.pop_back();
+            if (text == "ISO-10303-21") {
+                m_sawIsoMarker = true;
+            } else if (text == "HEADER") {
+                m_inHeader = true;
+            } else if (text == "ENDSEC") {
+                m_inHeader = false;
+            } else if (text == "DATA" || text.compare(0, 5, "DATA(") == 0) {
+                m_inData = true;
+                m_sawData = true;
+                m_result.dataOffset = m_statementOffset;
+            } else if (m_inHeader) {
+                handleHeader(text);
+            }
+            return;
+        }
+
+        if (text.empty() || text[0] != '#') {
+            if (text.compare(0, 6, "ENDSEC") == 0) {
+                m_inData = false;
+                m_result.dataEnd = m_statementOffset;
+            }
+            return;
+        }
+
+        const size_t equals = text.find('=');
+        if (equals == std::string::npos) return;
+        const int id = static_cast<int>(std::strtol(text.c_str() + 1, nullptr, 10));
+        const size_t paren = text.find('(', equals);
+        if (paren == std::string::npos) return;
+
+        m_result.entityCount++;
+        if (paren == equals + 1) {
+            // Complex instance: count it by its first partial type
+            const size_t typeEnd = text.find('(', paren + 1);
+            if (typeEnd != std::string::npos) {
+                m_result.entityCounts[text.substr(paren + 1, typeEnd - paren - 1)]++;
+            }
+            if (!m_truncated) handleComplex(id);
+            return;
+        }
+
+        const std::string type = text.substr(equals + 1, paren - equals - 1);
+        m_result.entityCounts[type]++;
+        if (m_capturing) {
+            handleInstance(id, type, paren);
+        }
+    }
+
+    void Scanner::handleHeader(const std::string& text) {
+        const size_t paren = text.find('(');
+        if (paren == std::string::npos) return;
+        const std::string type = text.substr(0, paren);
+        std::vector<Param> params;
+        ParameterParser parser(text, paren);
+        if (!parser.parseList(params)) return;
+
+        STEPPreScanner::HeaderInfo& header = m_result.header;
+        if (type == "FILE_DESCRIPTION") {
+            header.description = stringsAt(params, 0);
+            header.implementationLevel = stringAt(params, 1);
+        } else if (type == "FILE_NAME") {
+            header.fileName = stringAt(params, 0);
+            header.timeStamp = stringAt(params, 1);
+            header.authors = stringsAt(params, 2);
+            header.organizations = stringsAt(params, 3);
+            header.preprocessorVersion = stringAt(params, 4);
+            header.originatingSystem = stringAt(params, 5);
+            header.authorization = stringAt(params, 6);
+        } else if (type == "FILE_SCHEMA") {
+            header.schemas = stringsAt(params, 0);
+        }
+    }
+
+    void Scanner::handleInstance(int id, const std::string& type, size_t paramsPos) {
+        std::vector<Param> params;
+        ParameterParser parser(m_statement, paramsPos);
+        if (!parser.parseList(params)) {
+            LOG_WRN_S("STEPPreScanner: Could not parse #" + std::to_string(id) + " (" + type + ")");
+            return;
+        }
+
+        if (type == "PRODUCT") {
+            STEPPreScanner::ProductInfo product;
+            product.entityId = id;
+            product.offset = m_statementOffset;
+            product.id = stringAt(params, 0);
+            product.name = stringAt(params, 1);
+            product.description = stringAt(params, 2);
+            m_productById[id] = m_result.products.size();
+            m_result.products.push_back(std::move(product));
+        } else if (type == "PRODUCT_DEFINITION_FORMATION" ||
+                   type == "PRODUCT_DEFINITION_FORMATION_WITH_SPECIFIED_SOURCE") {
+            m_formationToProduct[id] = refAt(params, 2);
+        } else if (type == "PRODUCT_DEFINITION") {
+            m_definitionToFormation[id] = refAt(params, 2);
+        } else if (type == "PRODUCT_DEFINITION_SHAPE") {
+            m_shapeToDefinition[id] = refAt(params, 2);
+        } else if (type == "SHAPE_DEFINITION_REPRESENTATION") {
+            m_shapeDefinitionReps.emplace_back(refAt(params, 0), refAt(params, 1));
+        } else if (type == "SHAPE_REPRESENTATION_RELATIONSHIP") {
+            m_representationLinks.emplace_back(refAt(params, 2), refAt(params, 3));
+        } else if (type == "NEXT_ASSEMBLY_USAGE_OCCURRENCE") {
+            m_occurrences.push_back(RawOccurrence{ id, m_statementOffset, stringAt(params, 0),
+                                                   stringAt(params, 1), refAt(params, 3), refAt(params, 4) });
+        } else if (type == "MANIFOLD_SOLID_BREP" || type == "FACETED_BREP") {
+            m_solidShells[id] = { refAt(params, 1) };
+        } else if (type == "BREP_WITH_VOIDS") {
+            std::vector<int> shells = refsAt(params, 2);
+            shells.insert(shells.begin(), refAt(params, 1));
+            m_solidShells[id] = std::move(shells);
+        } else if (type == "SHELL_BASED_SURFACE_MODEL") {
+            m_solidShells[id] = refsAt(params, 1);
+        } else if (type == "CLOSED_SHELL" || type == "OPEN_SHELL") {
+            m_shellFaces[id] = refsAt(params, 1).size();
+        } else if (isShapeRepresentation(type)) {
+            STEPPreScanner::RepresentationInfo representation;
+            representation.entityId = id;
+            representation.offset = m_statementOffset;
+            representation.type = type;
+            representation.name = stringAt(params, 0);
+            representation.items = refsAt(params, 1);
+            m_representationById[id] = m_result.representations.size();
+            m_result.representations.push_back(std::move(representation));
+        }
+    }
+
+    void Scanner::handleComplex(int id) {
+        // Split "#n=(A(...)B(...))" into its partial types
+        std::unordered_map<std::string, std::vector<Param>> parts;
+        size_t pos = m_statement.find('(') + 1;
+        while (pos < m_statement.size() && m_statement[pos] != ')') {
+            const size_t paren = m_statement.find('(', pos);
+            if (paren == std::string::npos) return;
+            std::vector<Param> params;
+            ParameterParser parser(m_statement, paren);
+            if (!parser.parseList(params)) return;
+            parts[m_statement.substr(pos, paren - pos)] = std::move(params);
+            pos = parser.position();
+        }
+
+        auto context = parts.find("GLOBAL_UNIT_ASSIGNED_CONTEXT");
+        if (context != parts.end()) {
+            m_contextUnits.push_back(refsAt(context->second, 0));
+            return;
+        }
+
+        if (!parts.count("LENGTH_UNIT")) return;
+        LengthUnit unit;
+        auto conversion = parts.find("CONVERSION_BASED_UNIT");
+        auto si = parts.find("SI_UNIT");
+        if (conversion != parts.end()) {
+            unit.name = stringAt(conversion->second, 0);
+            unit.conversionBased = true;
+            std::string upper = unit.name;
+            std::transform(upper.begin(), upper.end(), upper.begin(),
+                           [](unsigned char ch) { return static_cast<char>(std::toupper(ch)); });
+            if (upper == "INCH") unit.millimetres = 25.4;
+            else if (upper == "FOOT") unit.millimetres = 304.8;
+            else if (upper == "YARD") unit.millimetres = 914.4;
+            else if (upper == "MILE") unit.millimetres = 1609344.0;
+        } else if (si != parts.end() && si->second.size() >= 2 && si->second[1].text == ".METRE.") {
+            const std::string& prefix = si->second[0].text;
+            unit.name = prefix.size() > 2 ? prefix.substr(1, prefix.size() - 2) + "METRE" : "METRE";
+            std::transform(unit.name.begin(), unit.name.end(), unit.name.begin(),
+                           [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+            unit.millimetres = siLengthScale(prefix);
+        } else {
+            return;
+        }
+        m_firstLengthUnits.push_back(id);
+        m_lengthUnits[id] = std::move(unit);
+    }
+
+    void Scanner::resolveLengthUnit() {
+        // The unit in force is the one a representation context assigns; an SI unit
+        // may also appear only inside the measure that defines a conversion-based one
+        const LengthUnit* chosen = nullptr;
+        for (const auto& units : m_contextUnits) {
+            for (int ref : units) {
+                auto unit = m_lengthUnits.find(ref);
+                if (unit != m_lengthUnits.end()) {
+                    chosen = &unit->second;
+                    break;
+                }
+            }
+            if (chosen) break;
+        }
+        // No context seen (or truncated): a conversion-based unit is never just a
+        // measure's unit, so prefer it over SI
+        for (int pass = 0; !chosen && pass < 2; ++pass) {
+            for (int id : m_firstLengthUnits) {
+                const LengthUnit& unit = m_lengthUnits[id];
+                if (pass == 1 || unit.conversionBased) {
+                    chosen = &unit;
+                    break;
+                }
+            }
+        }
+        if (chosen) {
+            m_result.lengthUnit = chosen->name;
+            m_result.lengthUnitInMillimetres = chosen->millimetres;
+        }
+    }
+
+    bool Scanner::finish() {
+        if (!m_sawIsoMarker) {
+            m_result.errorMessage = "Not an ISO 10303-21 file";
+            return false;
+        }
+        if (!m_sawData) {
+            m_result.errorMessage = "No DATA section found";
+            return false;
+        }
+        if (m_result.dataEnd == 0) {
+            m_result.dataEnd = m_result.fileSize;
+        }
+        resolve();
+        resolveLengthUnit();
+        return true;
+    }
+
+    void Scanner::resolve() {
+        auto productOfDefinition = [this](int definition) -> long long {
+            auto formation = m_definitionToFormation.find(definition);
+            if (formation == m_definitionToFormation.end()) return -1;
+            auto product = m_formationToProduct.find(formation->second);
+            if (product == m_formationToProduct.end()) return -1;
+            auto index = m_productById.find(product->second);
+            return index == m_productById.end() ? -1 : static_cast<long long>(index->second);
+        };
+
+        for (const auto& definition : m_definitionToFormation) {
+            long long product = productOfDefinition(definition.first);
+            if (product >= 0 && m_result.products[product].definitionId == 0) {
+                m_result.products[product].definitionId = definition.first;
+            }
+        }
+
+        // Geometry below each representation
+        size_t totalFaces = 0;
+        for (auto& representation : m_result.representations) {
+            for (int item : representation.items) {
+                auto solid = m_solidShells.find(item);
+                if (solid != m_solidShells.end()) {
+                    representation.solidCount++;
+                    for (int shell : solid->second) {
+                        auto faces = m_shellFaces.find(shell);
+                        if (faces != m_shellFaces.end()) representation.faceCount += faces->second;
+                    }
+                    continue;
+                }
+                auto faces = m_shellFaces.find(item);
+                if (faces != m_shellFaces.end()) representation.faceCount += faces->second;
+            }
+            totalFaces += representation.faceCount;
+        }
+
+        std::unordered_map<int, std::vector<int>> links;
+        for (const auto& link : m_representationLinks) {
+            links[link.first].push_back(link.second);
+            links[link.second].push_back(link.first);
+        }
+
+        // Each product's representations, following untransformed relationships
+        // (placements of child parts are complex instances and never linked here)
+        for (const auto& definitionRep : m_shapeDefinitionReps) {
+            auto definition = m_shapeToDefinition.find(definitionRep.first);
+            if (definition == m_shapeToDefinition.end()) continue;
+            long long productIndex = productOfDefinition(definition->second);
+            if (productIndex < 0) continue;
+            STEPPreScanner::ProductInfo& product = m_result.products[productIndex];
+
+            std::vector<int> pending = { definitionRep.second };
+            std::unordered_set<int> visited;
+            while (!pending.empty()) {
+                int rep = pending.back();
+                pending.pop_back();
+                if (!visited.insert(rep).second) continue;
+                auto index = m_representationById.find(rep);
+                if (index != m_representationById.end() &&
+                    std::find(product.representations.begin(), product.representations.end(), index->second) ==
+                        product.representations.end()) {
+                    product.representations.push_back(index->second);
+                    product.solidCount += m_result.representations[index->second].solidCount;
+                    product.faceCount += m_result.representations[index->second].faceCount;
+                }
+                auto linked = links.find(rep);
+                if (linked != links.end()) {
+                    pending.insert(pending.end(), linked->second.begin(), linked->second.end());
+                }
+            }
+        }
+
+        const uint64_t dataBytes = m_result.dataEnd > m_result.dataOffset ? m_result.dataEnd - m_result.dataOffset : 0;
+        const double bytesPerFace = totalFaces > 0 ? static_cast<double>(dataBytes) / totalFaces : 0.0;
+        for (auto& product : m_result.products) {
+            product.estimatedBytes = static_cast<uint64_t>(product.faceCount * bytesPerFace);
+        }
+
+        std::vector<bool> placed(m_result.products.size(), false);
+        for (const RawOccurrence& raw : m_occurrences) {
+            long long parent = productOfDefinition(raw.relating);
+            long long child = productOfDefinition(raw.related);
+            if (parent < 0 || child < 0) continue;
+
+            STEPPreScanner::OccurrenceInfo occurrence;
+            occurrence.entityId = raw.entityId;
+            occurrence.offset = raw.offset;
+            occurrence.id = raw.id;
+            occurrence.name = raw.name;
+            occurrence.parent = static_cast<size_t>(parent);
+            occurrence.child = static_cast<size_t>(child);
+            m_result.products[parent].occurrences.push_back(m_result.occurrences.size());
+            m_result.products[child].instanceCount++;
+            placed[child] = true;
+            m_result.occurrences.push_back(std::move(occurrence));
+        }
+        for (size_t i = 0; i < placed.size(); ++i) {
+            if (!placed[i]) m_result.rootProducts.push_back(i);
+        }
+    }
+}
+
+STEPPreScanner::ScanResult STEPPreScanner::scan(const std::string& filePath, ProgressCallback progress) {
+    ScanResult result;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    std::error_code ec;
+    result.fileSize = std::filesystem::file_size(filePath, ec);
+    if (ec) {
+        result.errorMessage = "Cannot access file: " + filePath;
+        LOG_ERR_S("STEPPreScanner: " + result.errorMessage);
+        return result;
+    }
+
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        result.errorMessage = "Cannot open file: " + filePath;
+        LOG_ERR_S("STEPPreScanner: " + result.errorMessage);
+        return result;
+    }
+
+    Scanner scanner(result);
+    std::vector<char> buffer(kChunkSize);
+    uint64_t offset = 0;
+    int lastPercent = -1;
+    while (file) {
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const size_t count = static_cast<size_t>(file.gcount());
+        if (count == 0) break;
+        scanner.feed(buffer.data(), count, offset);
+        offset += count;
+
+        if (progress && result.fileSize > 0) {
+            int percent = static_cast<int>(offset * 100 / result.fileSize);
+            if (percent != lastPercent) {
+                lastPercent = percent;
+                progress(percent, "Scanning STEP structure");
+            }
+        }
+    }
+
+    result.success = scanner.finish();
+    result.scanTime = std::chrono::duration<double, std::milli>(
+        std::chrono::high_resolution_clock::now() - startTime).count();
+
+    if (result.success) {
+        LOG_INF_S("STEPPreScanner: " + std::to_string(result.entityCount) + " entities, " +
+                  std::to_string(result.products.size()) + " products, " +
+                  std::to_string(result.occurrences.size()) + " occurrences in " +
+                  std::to_string(static_cast<int>(result.scanTime)) + " ms");
+    } else {
+        LOG_WRN_S("STEPPreScanner: " + filePath + ": " + result.errorMessage);
+    }
+    return result;
+}
+
+std::vector<size_t> STEPPreScanner::collectSubtree(const ScanResult& result, size_t productIndex) {
+    std::vector<size_t> products;
+    if (productIndex >= result.products.size()) {
+        return products;
+    }
+
+    std::vector<bool> visited(result.products.size(), false);
+    std::vector<size_t> pending = { productIndex };
+    while (!pending.empty()) {
+        size_t current = pending.back();
+        pending.pop_back();
+        if (visited[current]) continue;
+        visited[current] = true;
+        products.push_back(current);
+        for (size_t occurrence : result.products[current].occurrences) {
+            pending.push_back(result.occurrences[occurrence].child);
+        }
+    }
+    return products;
+}
+
+uint64_t STEPPreScanner::estimateSubtreeBytes(const ScanResult& result, size_t productIndex) {
+    uint64_t bytes = 0;
+    for (size_t product : collectSubtree(result, productIndex)) {
+        bytes += result.products[product].estimatedBytes;
+    }
+    return bytes;
+}
@@ -9,6 +9,7 @@
 #include "STEPCAFProcessor.h"
 #include "STEPReaderUtils.h"
 #include "STEPGeometryConverter.h"
+#include "BREPReader.h"
 
 // OpenCASCADE STEP import includes
 #include <STEPControl_Reader.hxx>
@@ -89,7 +90,26 @@ GeometryReader::ReadResult STEPReader::readFile(const std::string& filePath,
 	const OptimizationOptions& options,
 	ProgressCallback progress)
 {
+	// A sidecar at least as new as the STEP file replaces the translator run
+	if (options.enableBRepSidecar && BREPReader::hasFreshSidecar(filePath)) {
+		BREPReader sidecarReader;
+		GeometryReader::OptimizationOptions sidecarOptions = options;
+		sidecarOptions.enableCaching = false;
+		GeometryReader::ReadResult sidecarResult =
+			sidecarReader.readFile(BREPReader::sidecarPathFor(filePath), sidecarOptions, progress);
+		if (sidecarResult.success) {
+			LOG_INF_S("Loaded STEP geometry from BREP sidecar: " + BREPReader::sidecarPathFor(filePath));
+			sidecarResult.formatName = "STEP";
+			return sidecarResult;
+		}
+		LOG_WRN_S("BREP sidecar unreadable, falling back to STEP translation: " + sidecarResult.errorMessage);
+	}
+
 	ReadResult result = readSTEPFile(filePath, options, progress);
+	if (result.success && options.enableBRepSidecar) {
+		BREPReader::writeSidecar(filePath, result.rootShape);
+	}
+
 	GeometryReader::ReadResult baseResult;
 	baseResult.success = result.success;
 	baseResult.errorMessage = result.errorMessage;
@@ -236,10 +256,12 @@ bool STEPReader::assembleShapes(const STEPControl_Reader& reader, ReadResult& re
 	return true;
 }
 
-void STEPReader::extractMetadata(const STEPControl_Reader& reader, ReadResult& result, ProgressCallback progress) {
+void STEPReader::extractMetadata(const STEPControl_Reader& reader, const STEPPreScanner::ScanResult& scan,
+	ReadResult& result, ProgressCallback progress) {
 		try {
 			result.entityMetadata = readSTEPMetadata(reader);
-			result.assemblyStructure = buildAssemblyStructure(reader);
+			result.assemblyStructure = scan.success ? STEPMetadataExtractor::buildAssemblyStructure(scan)
+				: buildAssemblyStructure(reader);
 			if (progress) progress(60, "metadata");
 		} catch (const std::exception& e) {
 			LOG_WRN_S("Failed to read metadata: " + std::string(e.what()));
@@ -332,26 +354,34 @@ STEPReader::ReadResult STEPReader::readSTEPFile(const std::string& filePath,
 			return result;
 		}
 
-		// Step 2: Read and parse STEP file using standard OCCT reader
+		// Step 2: Pre-scan header, units and product tree without an OCCT transfer
+		STEPPreScanner::ScanResult scan = STEPPreScanner::scan(filePath);
+		if (scan.success) {
+			LOG_INF_S("STEP preview: " + std::to_string(scan.products.size()) + " products, " +
+				std::to_string(scan.rootProducts.size()) + " root(s), length unit " +
+				(scan.lengthUnit.empty() ? std::string("unknown") : scan.lengthUnit));
+		}
+
+		// Step 3: Read and parse STEP file using standard OCCT reader
 		STEPControl_Reader reader;
 		if (!readSTEPFileCore(filePath, options, result, progress)) {
 			return result;
 		}
 
-		// Step 3: Extract metadata from STEP file
-		extractMetadata(reader, result, progress);
+		// Step 4: Extract metadata from STEP file
+		extractMetadata(reader, scan, result, progress);
 
-		// Step 4: Try CAF reader for enhanced color/material support
+		// Step 5: Try CAF reader for enhanced color/material support
 		bool cafSuccess = tryCAFReader(filePath, options, result, progress);
 
-		// Step 5: Convert shape to geometries (fallback if CAF failed)
+		// Step 6: Convert shape to geometries (fallback if CAF failed)
 		if (!cafSuccess) {
 			std::string baseName = std::filesystem::path(filePath).stem().string();
 			result.geometries = STEPGeometryConverter::shapeToGeometries(
 				result.rootShape, baseName, options, progress, 70, 25);
 		}
 
-		// Step 6: Apply post-processing to geometries
+		// Step 7: Apply post-processing to geometries
 		postProcessGeometries(result, progress);
 
 		result.success = true;
@@ -1,4 +1,5 @@
 #include "XTReader.h"
+#include "ImportCache.h"
 #include "logger/Logger.h"
 #include "OCCShapeBuilder.h"
 
@@ -28,8 +29,6 @@
 #include <sstream>
 
 // Static member initialization
-std::unordered_map<std::string, XTReader::ReadResult> XTReader::s_cache;
-std::mutex XTReader::s_cacheMutex;
 bool XTReader::s_initialized = false;
 
 XTReader::ReadResult XTReader::readFile(const std::string& filePath,
@@ -58,11 +57,8 @@ XTReader::ReadResult XTReader::readFile(const std::string& filePath,
 
         // Check cache if enabled
         if (options.enableCaching) {
-            std::lock_guard<std::mutex> lock(s_cacheMutex);
-            auto cacheIt = s_cache.find(filePath);
-            if (cacheIt != s_cache.end()) {
-                result = cacheIt->second;
-                return result;
+            if (auto cached = ImportCache::getInstance().lookup(filePath, options)) {
+                return *cached;
             }
         }
 
@@ -109,16 +105,15 @@ XTReader::ReadResult XTReader::readFile(const std::string& filePath,
 
         result.success = true;
 
-        // Cache result if enabled
-        if (options.enableCaching) {
-            std::lock_guard<std::mutex> lock(s_cacheMutex);
-            s_cache[filePath] = result;
-        }
-
         auto totalEndTime = std::chrono::high_resolution_clock::now();
         auto totalDuration = std::chrono::duration_cast<std::chrono::milliseconds>(totalEndTime - totalStartTime);
         result.importTime = static_cast<double>(totalDuration.count());
 
+        // Cache result if enabled
+        if (options.enableCaching) {
+            ImportCache::getInstance().store(filePath, options, result);
+        }
+
         return result;
     }
     catch (const std::exception& e) {
@@ -308,43 +303,9 @@ std::vector<std::shared_ptr<OCCGeometry>> XTReader::processShapesParallel(
     const OptimizationOptions& options,
     ProgressCallback progress)
 {
-    std::vector<std::shared_ptr<OCCGeometry>> geometries;
-    
-    if (options.enableParallelProcessing && shapes.size() > 1) {
-        // Process shapes in parallel
-        std::vector<std::future<std::shared_ptr<OCCGeometry>>> futures;
-        
-        for (size_t i = 0; i < shapes.size(); ++i) {
-            std::string name = baseName + "_" + std::to_string(i + 1);
-            futures.push_back(std::async(std::launch::async, [this, &shapes, i, name, baseName, &options]() {
-                return processSingleShape(shapes[i], name, baseName, options);
-            }));
-        }
-        
-        // Collect results
-        for (auto& future : futures) {
-            auto geometry = future.get();
-            if (geometry) {
-                geometries.push_back(geometry);
-            }
-        }
-    } else {
-        // Process shapes sequentially
-        for (size_t i = 0; i < shapes.size(); ++i) {
-            std::string name = baseName + "_" + std::to_string(i + 1);
-            auto geometry = processSingleShape(shapes[i], name, baseName, options);
-            if (geometry) {
-                geometries.push_back(geometry);
-            }
-            
-            if (progress) {
-                int percent = 50 + static_cast<int>((i + 1) * 40.0 / shapes.size());
-                progress(percent, "Processing shape " + std::to_string(i + 1) + "/" + std::to_string(shapes.size()));
-            }
-        }
-    }
-    
-    return geometries;
+    return convertShapesParallel(shapes.size(), [&](size_t i) {
+        return processSingleShape(shapes[i], baseName + "_" + std::to_string(i + 1), baseName, options);
+    }, options, progress, 50, 40);
 }
 
 std::shared_ptr<OCCGeometry> XTReader::processSingleShape(
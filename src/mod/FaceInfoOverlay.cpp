@@ -1,5 +1,6 @@
 #include "mod/FaceInfoOverlay.h"
 #include "OCCGeometry.h"
+#include "geometry/helper/FaceLookupIndex.h"
 #include "config/FontManager.h"
 #include <wx/dcbuffer.h>
 
@@ -52,10 +53,11 @@ void FaceInfoOverlay::draw(wxDC& dc, const wxSize& canvasSize) {
 			numLines++;
 
 			// Mapping information
-			if (m_result.geometry->hasFaceDomainMapping()) {
+			const FaceLookupIndex* lookup = m_result.geometry->getFaceLookupIndex();
+			if (lookup && !lookup->isEmpty()) {
 				numLines++; // Face mapping status
 				if (m_result.geometryFaceId >= 0) {
-					numLines++; // Triangles in face
+					numLines += 2; // Triangles and edges in face
 				}
 			} else {
 				numLines++; // Mapping not available note
@@ -123,14 +125,16 @@ void FaceInfoOverlay::draw(wxDC& dc, const wxSize& canvasSize) {
 			}
 
 			// Face mapping status
-			bool hasMapping = m_result.geometry->hasFaceDomainMapping();
-			if (hasMapping) {
+			const FaceLookupIndex* lookup = m_result.geometry->getFaceLookupIndex();
+			if (lookup && !lookup->isEmpty()) {
 				dc.DrawText("Face Mapping: Available", xPos + padding, textY);
 				textY += lineHeight;
 
 				if (m_result.geometryFaceId >= 0) {
-					auto triangles = m_result.geometry->getTrianglesForGeometryFace(m_result.geometryFaceId);
-					dc.DrawText(wxString::Format("Triangles in Face: %zu", triangles.size()),
+					dc.DrawText(wxString::Format("Triangles in Face: %zu", lookup->trianglesForFace(m_result.geometryFaceId).size()),
+						xPos + padding, textY);
+					textY += lineHeight;
+					dc.DrawText(wxString::Format("Edges in Face: %zu", lookup->edgesForFace(m_result.geometryFaceId).size()),
 						xPos + padding, textY);
 					textY += lineHeight;
 				}
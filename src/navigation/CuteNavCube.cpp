@@ -1052,6 +1052,11 @@ bool CuteNavCube::handleMouseEvent(const wxMouseEvent& event, const wxSize& view
 void CuteNavCube::render(int x, int y, const wxSize& size) {
 	if (!m_enabled || !m_root) return;
 
+	// The cube's camera state for this frame is being drawn; the animation may move on
+	if (m_cameraAnimator) {
+		m_cameraAnimator->notifyFrameRendered();
+	}
+
 	// Check if geometry rebuild is needed
 	if (m_needsGeometryRebuild) {
 		setupGeometry();
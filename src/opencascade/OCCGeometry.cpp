@@ -8,6 +8,9 @@
 #include <Standard_Failure.hxx>
 #include <BRepBndLib.hxx>
 #include <Bnd_Box.hxx>
+#include <gp.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Trsf.hxx>
 #include <OpenCASCADE/TopoDS.hxx>
 #include <OpenCASCADE/TopAbs.hxx>
 #include <OpenCASCADE/TopExp_Explorer.hxx>
@@ -92,8 +95,10 @@ void OCCGeometry::setShape(const TopoDS_Shape& shape)
     try {
         // Call base class setShape
         OCCGeometryCore::setShape(shape);
-        // Mark that mesh needs regeneration
-        setMeshRegenerationNeeded(true);
+        m_localBoundsValid = false;
+        // Mark that mesh needs regeneration; unchanged faces keep their tessellation
+        markShapeChanged();
+        notifyBoundsChanged();
     }
     catch (const Standard_Failure& e) {
         LOG_ERR_S("OpenCASCADE error in setShape for " + getName() + ": " + std::string(e.GetMessageString()));
@@ -101,6 +106,79 @@ void OCCGeometry::setShape(const TopoDS_Shape& shape)
     }
 }
 
+bool OCCGeometry::computeLocalBounds() const
+{
+    if (m_localBoundsValid) {
+        return true;
+    }
+
+    Bnd_Box bbox;
+    if (!getShape().IsNull()) {
+        try {
+            BRepBndLib::Add(getShape(), bbox);
+        }
+        catch (const Standard_Failure& e) {
+            LOG_WRN_S("Failed to compute bounds for: " + getName() + ": " + std::string(e.GetMessageString()));
+            return false;
+        }
+    }
+    if (bbox.IsVoid() && hasCachedMesh()) {
+        // Mesh-only geometries (STL, OBJ) carry an empty compound; bound the mesh instead
+        for (const auto& vertex : getCachedMesh().vertices) {
+            bbox.Add(vertex);
+        }
+    }
+
+    if (bbox.IsVoid()) {
+        return false;
+    }
+
+    Standard_Real xmin, ymin, zmin, xmax, ymax, zmax;
+    bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    m_localMin.SetCoord(xmin, ymin, zmin);
+    m_localMax.SetCoord(xmax, ymax, zmax);
+    m_localBoundsValid = true;
+    return true;
+}
+
+void OCCGeometry::notifyBoundsChanged()
+{
+    if (m_boundsChanged) {
+        m_boundsChanged(*this);
+    }
+}
+
+bool OCCGeometry::getWorldBounds(gp_Pnt& min, gp_Pnt& max) const
+{
+    if (!computeLocalBounds()) {
+        return false;
+    }
+
+    // Same order as the SoTransform: scale, then rotate, then translate
+    gp_Trsf transform;
+    if (m_rotationAngle != 0.0 && m_rotationAxis.Magnitude() > gp::Resolution()) {
+        transform.SetRotation(gp_Ax1(gp::Origin(), gp_Dir(m_rotationAxis)), m_rotationAngle);
+    }
+    gp_Trsf translation;
+    translation.SetTranslation(gp_Vec(m_position.XYZ()));
+    transform.PreMultiply(translation);
+
+    Bnd_Box worldBox;
+    for (int corner = 0; corner < 8; ++corner) {
+        gp_Pnt p((corner & 1) ? m_localMax.X() : m_localMin.X(),
+                 (corner & 2) ? m_localMax.Y() : m_localMin.Y(),
+                 (corner & 4) ? m_localMax.Z() : m_localMin.Z());
+        p.SetXYZ(p.XYZ() * m_scale);
+        worldBox.Add(p.Transformed(transform));
+    }
+
+    Standard_Real xmin, ymin, zmin, xmax, ymax, zmax;
+    worldBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    min.SetCoord(xmin, ymin, zmin);
+    max.SetCoord(xmax, ymax, zmax);
+    return true;
+}
+
 void OCCGeometry::setColor(const Quantity_Color& color)
 {
     // Set color in appearance module
@@ -135,6 +213,7 @@ void OCCGeometry::setPosition(const gp_Pnt& position)
 {
     // Call base class to update position
     OCCGeometryTransform::setPosition(position);
+    notifyBoundsChanged();
     
     // Trigger mesh rebuild to apply new position (will create coinNode if needed)
     if (!getShape().IsNull()) {
@@ -150,6 +229,7 @@ void OCCGeometry::setRotation(const gp_Vec& axis, double angle)
 {
     // Call base class to update rotation
     OCCGeometryTransform::setRotation(axis, angle);
+    notifyBoundsChanged();
     
     // Trigger mesh rebuild to apply new rotation (will create coinNode if needed)
     if (!getShape().IsNull()) {
@@ -165,6 +245,7 @@ void OCCGeometry::setScale(double scale)
 {
     // Call base class to update scale
     OCCGeometryTransform::setScale(scale);
+    notifyBoundsChanged();
     
     // Trigger mesh rebuild to apply new scale (will create coinNode if needed)
     if (!getShape().IsNull()) {
@@ -198,6 +279,10 @@ void OCCGeometry::updateCoinRepresentationIfNeeded(const MeshParameters& params)
 {
     // Use the new modular interface instead of legacy version
     if (needsMeshRegeneration() && !getShape().IsNull()) {
+        // A shape edit alone only rewrites the ranges of the faces it touched
+        if (patchSurfaceGeometry(getShape(), params, GeometryRenderContext::fromGeometry(*this))) {
+            return;
+        }
         buildCoinRepresentation(params);
     }
 }
@@ -178,7 +178,8 @@ TopoDS_Shape OCCShapeBuilder::createTorus(double majorRadius, double minorRadius
 	}
 }
 
-TopoDS_Shape OCCShapeBuilder::booleanUnion(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2)
+TopoDS_Shape OCCShapeBuilder::booleanUnion(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2,
+	const Message_ProgressRange& range)
 {
 	try {
 		if (shape1.IsNull() || shape2.IsNull()) {
@@ -186,7 +187,7 @@ TopoDS_Shape OCCShapeBuilder::booleanUnion(const TopoDS_Shape& shape1, const Top
 			return TopoDS_Shape();
 		}
 
-		BRepAlgoAPI_Fuse fuseMaker(shape1, shape2);
+		BRepAlgoAPI_Fuse fuseMaker(shape1, shape2, range);
 		if (!fuseMaker.IsDone()) {
 			LOG_ERR_S("Boolean union failed");
 			return TopoDS_Shape();
@@ -200,7 +201,8 @@ TopoDS_Shape OCCShapeBuilder::booleanUnion(const TopoDS_Shape& shape1, const Top
 	}
 }
 
-TopoDS_Shape OCCShapeBuilder::booleanIntersection(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2)
+TopoDS_Shape OCCShapeBuilder::booleanIntersection(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2,
+	const Message_ProgressRange& range)
 {
 	try {
 		if (shape1.IsNull() || shape2.IsNull()) {
@@ -208,7 +210,7 @@ TopoDS_Shape OCCShapeBuilder::booleanIntersection(const TopoDS_Shape& shape1, co
 			return TopoDS_Shape();
 		}
 
-		BRepAlgoAPI_Common commonMaker(shape1, shape2);
+		BRepAlgoAPI_Common commonMaker(shape1, shape2, range);
 		if (!commonMaker.IsDone()) {
 			LOG_ERR_S("Boolean intersection failed");
 			return TopoDS_Shape();
@@ -222,7 +224,8 @@ TopoDS_Shape OCCShapeBuilder::booleanIntersection(const TopoDS_Shape& shape1, co
 	}
 }
 
-TopoDS_Shape OCCShapeBuilder::booleanDifference(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2)
+TopoDS_Shape OCCShapeBuilder::booleanDifference(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2,
+	const Message_ProgressRange& range)
 {
 	try {
 		if (shape1.IsNull() || shape2.IsNull()) {
@@ -230,7 +233,7 @@ TopoDS_Shape OCCShapeBuilder::booleanDifference(const TopoDS_Shape& shape1, cons
 			return TopoDS_Shape();
 		}
 
-		BRepAlgoAPI_Cut cutMaker(shape1, shape2);
+		BRepAlgoAPI_Cut cutMaker(shape1, shape2, range);
 		if (!cutMaker.IsDone()) {
 			LOG_ERR_S("Boolean difference failed");
 			return TopoDS_Shape();
@@ -399,7 +402,8 @@ void OCCShapeBuilder::getBoundingBox(const TopoDS_Shape& shape, gp_Pnt& minPoint
 }
 
 // Filleting and chamfering implementations
-TopoDS_Shape OCCShapeBuilder::createFillet(const TopoDS_Shape& shape, double radius)
+TopoDS_Shape OCCShapeBuilder::createFillet(const TopoDS_Shape& shape, double radius,
+	const Message_ProgressRange& range)
 {
 	try {
 		if (shape.IsNull()) {
@@ -409,6 +413,7 @@ TopoDS_Shape OCCShapeBuilder::createFillet(const TopoDS_Shape& shape, double rad
 		for (TopExp_Explorer ex(shape, TopAbs_EDGE); ex.More(); ex.Next()) {
 			filletMaker.Add(radius, TopoDS::Edge(ex.Current()));
 		}
+		filletMaker.Build(range);
 		if (!filletMaker.IsDone()) {
 			LOG_ERR_S("Fillet creation failed");
 			return TopoDS_Shape();
@@ -421,7 +426,8 @@ TopoDS_Shape OCCShapeBuilder::createFillet(const TopoDS_Shape& shape, double rad
 	}
 }
 
-TopoDS_Shape OCCShapeBuilder::createChamfer(const TopoDS_Shape& shape, double distance)
+TopoDS_Shape OCCShapeBuilder::createChamfer(const TopoDS_Shape& shape, double distance,
+	const Message_ProgressRange& range)
 {
 	try {
 		if (shape.IsNull()) {
@@ -431,6 +437,7 @@ TopoDS_Shape OCCShapeBuilder::createChamfer(const TopoDS_Shape& shape, double di
 		for (TopExp_Explorer ex(shape, TopAbs_EDGE); ex.More(); ex.Next()) {
 			chamferMaker.Add(distance, TopoDS::Edge(ex.Current()));
 		}
+		chamferMaker.Build(range);
 		if (!chamferMaker.IsDone()) {
 			LOG_ERR_S("Chamfer creation failed");
 			return TopoDS_Shape();
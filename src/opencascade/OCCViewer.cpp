@@ -50,6 +50,9 @@
 #include "viewer/SliceController.h"
 #include "viewer/ExplodeController.h"
 #include "viewer/LODController.h"
+#include "viewer/MeshLODService.h"
+#include "viewer/ShapeBuildService.h"
+#include "viewer/RetessellationService.h"
 #include "viewer/PickingService.h"
 #include "viewer/SelectionManager.h"
 #include "viewer/ObjectTreeSync.h"
@@ -106,10 +109,17 @@ OCCViewer::OCCViewer(SceneManager* sceneManager)
 
 	// Create LOD controller
 	m_lodController = std::make_unique<LODController>(this);
+	m_meshLODService = std::make_unique<MeshLODService>();
+	m_meshLODService->setFrameRequest([this]() { requestViewRefresh(); });
+	m_shapeBuildService = std::make_unique<ShapeBuildService>();
+	m_shapeBuildService->setMeshParameters(&m_meshParams);
+	m_retessellationService = std::make_unique<RetessellationService>();
+	m_retessellationService->setFrameRequest([this]() { requestViewRefresh(); });
 	// Create edge display manager
 	m_edgeDisplayManager = std::make_unique<EdgeDisplayManager>(m_sceneManager, &m_geometries);
 	// Create selection manager and object tree sync
 	m_selectionManager = std::make_unique<SelectionManager>(m_sceneManager, &m_geometries, &m_selectedGeometries);
+	m_selectionManager->setEdgeDisplayManager(m_edgeDisplayManager.get());
 	m_objectTreeSync = std::make_unique<ObjectTreeSync>(m_sceneManager, &m_pendingObjectTreeUpdates);
 	// Create selection outline manager (geometry-layer outlines)
 	m_outlineManager = std::make_unique<OutlineDisplayManager>(m_sceneManager, m_occRoot, &m_geometries);
@@ -118,7 +128,7 @@ OCCViewer::OCCViewer(SceneManager* sceneManager)
 	// if (m_selectionOutline) m_selectionOutline->setEnabled(true);
 	// Create geometry repo and scene attachment helper
 	m_geometryRepo = std::make_unique<GeometryRepository>(&m_geometries);
-	m_sceneAttach = std::make_unique<SceneAttachmentService>(m_occRoot, &m_nodeToGeom);
+	m_sceneAttach = std::make_unique<SceneAttachmentService>(m_occRoot, &m_nodeToGeom, m_sceneManager);
 	m_viewUpdater = std::make_unique<ViewUpdateService>(m_sceneManager);
 
 	// Set up geometry management service dependencies
@@ -139,6 +149,17 @@ OCCViewer::OCCViewer(SceneManager* sceneManager)
 	m_meshingService = std::make_unique<MeshingService>();
 	m_meshController = std::make_unique<MeshParameterController>(this, m_meshingService.get(), &m_meshParams, &m_geometries);
 	m_batchManager = std::make_unique<BatchOperationManager>(m_sceneManager, m_objectTreeSync.get(), m_viewUpdater.get());
+
+	// Idle retessellation runs as time-budgeted slices of progressive refinement
+	if (m_sceneManager && m_sceneManager->getProgressiveRefinement()) {
+		m_sceneManager->getProgressiveRefinement()->setRefineStep([this](double budgetMs) {
+			return refineTessellationStep(budgetMs);
+		});
+		// New input makes the running batch stale
+		m_sceneManager->getProgressiveRefinement()->setAbandonRefine([this]() {
+			m_retessellationService->cancel();
+		});
+	}
 	
 	// Initialize selection accelerator service
 	m_selectionAcceleratorService = std::make_unique<SelectionAcceleratorService>();
@@ -150,6 +171,17 @@ OCCViewer::OCCViewer(SceneManager* sceneManager)
 
 OCCViewer::~OCCViewer()
 {
+	// Running builds stop at their next progress check instead of delaying shutdown
+	if (m_shapeBuildService) {
+		m_shapeBuildService->cancelAll();
+	}
+	if (m_retessellationService) {
+		m_retessellationService->cancel();
+	}
+	if (m_sceneManager && m_sceneManager->getProgressiveRefinement()) {
+		m_sceneManager->getProgressiveRefinement()->setRefineStep(nullptr);
+		m_sceneManager->getProgressiveRefinement()->setAbandonRefine(nullptr);
+	}
 	clearAll();
 	if (m_occRoot) {
 		m_occRoot->unref();
@@ -192,6 +224,9 @@ void OCCViewer::addGeometry(std::shared_ptr<OCCGeometry> geometry)
 			if (m_outlineManager) {
 				m_outlineManager->onGeometryAdded(geometry);
 			}
+			if (m_meshLODService) {
+				m_meshLODService->schedule(geometry);
+			}
 
 			// Apply current edge display settings to the newly added geometry
 			// This ensures that settings configured during initialization (e.g., NoShading mode with original edges)
@@ -242,6 +277,13 @@ void OCCViewer::removeGeometry(const std::string& name)
 	}
 }
 
+void OCCViewer::removeGeometries(const std::vector<std::shared_ptr<OCCGeometry>>& geometries)
+{
+	if (m_geometryManagementService) {
+		m_geometryManagementService->removeGeometriesBatch(geometries);
+	}
+}
+
 void OCCViewer::clearAll()
 {
 	if (m_geometryManagementService) {
@@ -310,6 +352,14 @@ std::shared_ptr<OCCGeometry> OCCViewer::findGeometry(const std::string& name)
 	return nullptr;
 }
 
+std::vector<std::shared_ptr<OCCGeometry>> OCCViewer::findGeometriesByFile(const std::string& fileName)
+{
+	if (m_geometryManagementService) {
+		return m_geometryManagementService->findGeometriesByFile(fileName);
+	}
+	return {};
+}
+
 std::vector<std::shared_ptr<OCCGeometry>> OCCViewer::getAllGeometry() const
 {
 	if (m_geometryManagementService) {
@@ -404,7 +454,9 @@ void OCCViewer::fitAll()
 		return;
 	}
 
-	// Update scene bounds first to ensure we have accurate bounding information
+	// Attached geometries push their own bounds on transform changes; refreshing
+	// them all here is a cheap safety net before reading the bounds tree
+	updateAllGeometryBounds();
 	m_sceneManager->updateSceneBounds();
 
 	// Reset view to fit all geometries
@@ -841,6 +893,22 @@ void OCCViewer::startLODInteraction()
 	if (m_lodEnabled && m_lodController) m_lodController->startInteraction();
 }
 
+bool OCCViewer::isProgressiveRefinementEnabled() const
+{
+	return m_sceneManager && m_sceneManager->getProgressiveRefinement() &&
+		m_sceneManager->getProgressiveRefinement()->isEnabled();
+}
+
+ProgressiveRefinement::RefineResult OCCViewer::refineTessellationStep(double budgetMs)
+{
+	if (m_lodController && m_lodController->isRoughMode()) {
+		// Current parameters are the rough LOD ones; the fine switch requests another pass
+		return ProgressiveRefinement::RefineResult::Done;
+	}
+	// Meshing runs on a worker; this only swaps in finished meshes
+	return m_retessellationService->step(m_geometries, m_meshParams, budgetMs);
+}
+
 // Batch operations for performance optimization
 void OCCViewer::beginBatchOperation()
 {
@@ -875,30 +943,23 @@ void OCCViewer::addGeometries(const std::vector<std::shared_ptr<OCCGeometry>>& g
 
 	auto batchAddStartTime = std::chrono::high_resolution_clock::now();
 
-	// Pre-allocate space to avoid reallocations
-	m_geometries.reserve(m_geometries.size() + geometries.size());
-
-	// Collect all Coin3D nodes for batch addition
-	std::vector<SoSeparator*> coinNodes;
-	coinNodes.reserve(geometries.size());
-
-	for (const auto& geometry : geometries) {
+	// Store all geometries with one repository index update; nulls and taken names are skipped
+	std::vector<std::shared_ptr<OCCGeometry>> skipped;
+	const auto added = m_geometryRepo->addBatch(geometries, &skipped);
+	for (const auto& geometry : skipped) {
 		if (!geometry) {
 			LOG_ERR_S("Attempted to add null geometry in batch operation");
-			continue;
 		}
-
-		// Quick validation (no logging in batch mode)
-		auto it = std::find_if(m_geometries.begin(), m_geometries.end(),
-			[&](const std::shared_ptr<OCCGeometry>& g) {
-				return g->getName() == geometry->getName();
-			});
-
-		if (it != m_geometries.end()) {
+		else {
 			LOG_WRN_S("Geometry with name '" + geometry->getName() + "' already exists (skipping in batch)");
-			continue;
 		}
+	}
+
+	// Collect all Coin3D nodes for batch addition
+	std::vector<SoSeparator*> coinNodes;
+	coinNodes.reserve(added.size());
 
+	for (const auto& geometry : added) {
 		// Regenerate mesh (lazy)
 		geometry->updateCoinRepresentationIfNeeded(m_meshParams);
 
@@ -912,9 +973,6 @@ void OCCViewer::addGeometries(const std::vector<std::shared_ptr<OCCGeometry>>& g
 			}
 		}
 
-		// Store geometry
-		m_geometries.push_back(geometry);
-
 		// Don't update slice geometries here - will be updated when slice is enabled
 
 		// Add to object tree sync (batch mode)
@@ -935,14 +993,23 @@ void OCCViewer::addGeometries(const std::vector<std::shared_ptr<OCCGeometry>>& g
 
 	// Batch add all Coin3D nodes to scene
 	if (m_sceneAttach && !coinNodes.empty()) {
-		for (const auto& geometry : geometries) {
+		for (const auto& geometry : added) {
 			if (geometry) m_sceneAttach->attach(geometry);
 		}
 	}
 
+	// Mesh-only geometries get their LOD chains built as one parallel batch
+	if (m_meshLODService) {
+		for (const auto& geometry : added) {
+			if (geometry && m_nodeToGeom.count(geometry->getCoinNode())) {
+				m_meshLODService->schedule(geometry);
+			}
+		}
+	}
+
 	// Queue geometries for deferred ObjectTree update in batch mode
 	if (m_batchOperationActive) {
-		for (const auto& geometry : geometries) {
+		for (const auto& geometry : added) {
 			if (geometry) {
 				m_pendingObjectTreeUpdates.push_back(geometry);
 			}
@@ -1469,11 +1536,31 @@ void OCCViewer::applyExplode() {
 	if (!m_explodeController) m_explodeController = std::make_unique<ExplodeController>(m_occRoot);
 	m_explodeController->setParams(m_explodeMode, m_explodeFactor);
 	m_explodeController->apply(m_geometries);
+	syncBatchedEdgePlacement();
 }
 
 void OCCViewer::clearExplode() {
 	if (!m_explodeController) return;
 	m_explodeController->clear(m_geometries);
+	syncBatchedEdgePlacement();
+}
+
+void OCCViewer::syncBatchedEdgePlacement() {
+	if (!m_edgeDisplayManager || !m_edgeDisplayManager->isEdgeBatchingActive()) return;
+	for (auto& g : m_geometries) {
+		m_edgeDisplayManager->syncGeometryState(g);
+	}
+}
+
+void OCCViewer::updateGeometryBounds(const std::shared_ptr<OCCGeometry>& geometry) {
+	if (m_sceneAttach) m_sceneAttach->updateBounds(geometry);
+}
+
+void OCCViewer::updateAllGeometryBounds() {
+	if (!m_sceneAttach) return;
+	for (const auto& geometry : m_geometries) {
+		m_sceneAttach->updateBounds(geometry);
+	}
 }
 
 void OCCViewer::setSliceEnabled(bool enabled) {
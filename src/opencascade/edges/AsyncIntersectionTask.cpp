@@ -227,7 +227,7 @@ std::vector<gp_Pnt> AsyncIntersectionTask::computeIntersections() {
     
     updateProgress(30, "Checking cache...", "Phase 3/3: Checking if intersection result is cached");
     
-    size_t shapeHash = reinterpret_cast<size_t>(m_shape.TShape().get());
+    size_t shapeHash = EdgeGeometryCache::getInstance().getShapeHash(m_shape);
     std::ostringstream keyStream;
     keyStream << "intersections_" << shapeHash << "_" << std::fixed << std::setprecision(6) << adaptiveTolerance;
     std::string cacheKey = keyStream.str();
@@ -0,0 +1,381 @@
+#include "edges/CurveSegmentTree.h"
+#include <GeomAdaptor_Curve.hxx>
+#include <GeomAbs_CurveType.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
+#include <TColStd_Array1OfReal.hxx>
+#include <gp_Vec.hxx>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+    constexpr double kPi = 3.14159265358979323846;
+    constexpr int kMinFreeFormSpans = 16;
+    constexpr int kMaxSpans = 512;
+    constexpr int kMaxNewtonIterations = 12;
+    // Chords closer to parallel than this are treated as running along each other
+    constexpr double kParallelSine = 1e-3;
+
+    // Closest points of segments [p0, p1] and [q0, q1] as fractions along each
+    void closestSegmentParameters(const gp_Pnt& p0, const gp_Pnt& p1, const gp_Pnt& q0, const gp_Pnt& q1,
+                                  double& u, double& v) {
+        const gp_Vec d1(p0, p1);
+        const gp_Vec d2(q0, q1);
+        const gp_Vec r(q0, p0);
+        const double a = d1.SquareMagnitude();
+        const double e = d2.SquareMagnitude();
+        const double f = d2.Dot(r);
+        const double eps = 1e-24;
+
+        if (a <= eps && e <= eps) {
+            u = v = 0.0;
+            return;
+        }
+        if (a <= eps) {
+            u = 0.0;
+            v = std::clamp(f / e, 0.0, 1.0);
+            return;
+        }
+        const double c = d1.Dot(r);
+        if (e <= eps) {
+            v = 0.0;
+            u = std::clamp(-c / a, 0.0, 1.0);
+            return;
+        }
+        const double b = d1.Dot(d2);
+        const double denom = a * e - b * b;
+        u = denom > eps ? std::clamp((b * f - c * e) / denom, 0.0, 1.0) : 0.0;
+        v = (b * u + f) / e;
+        if (v < 0.0) {
+            v = 0.0;
+            u = std::clamp(-c / a, 0.0, 1.0);
+        }
+        else if (v > 1.0) {
+            v = 1.0;
+            u = std::clamp((b - c) / a, 0.0, 1.0);
+        }
+    }
+}
+
+void CurveSegmentTree::Box::set(const gp_Pnt& point) {
+    min[0] = max[0] = point.X();
+    min[1] = max[1] = point.Y();
+    min[2] = max[2] = point.Z();
+}
+
+void CurveSegmentTree::Box::add(const gp_Pnt& point) {
+    const double coord[3] = { point.X(), point.Y(), point.Z() };
+    for (int axis = 0; axis < 3; ++axis) {
+        min[axis] = std::min(min[axis], coord[axis]);
+        max[axis] = std::max(max[axis], coord[axis]);
+    }
+}
+
+void CurveSegmentTree::Box::add(const Box& other) {
+    for (int axis = 0; axis < 3; ++axis) {
+        min[axis] = std::min(min[axis], other.min[axis]);
+        max[axis] = std::max(max[axis], other.max[axis]);
+    }
+}
+
+void CurveSegmentTree::Box::enlarge(double margin) {
+    for (int axis = 0; axis < 3; ++axis) {
+        min[axis] -= margin;
+        max[axis] += margin;
+    }
+}
+
+bool CurveSegmentTree::Box::overlaps(const Box& other, double gap) const {
+    for (int axis = 0; axis < 3; ++axis) {
+        if (max[axis] + gap < other.min[axis] || other.max[axis] + gap < min[axis]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double CurveSegmentTree::Box::extent() const {
+    return std::max({ max[0] - min[0], max[1] - min[1], max[2] - min[2] });
+}
+
+bool CurveSegmentTree::build(const Handle(Geom_Curve)& curve, Standard_Real first, Standard_Real last) {
+    m_nodes.clear();
+    m_curve = curve;
+    m_first = first;
+    m_last = last;
+    if (curve.IsNull() || !(last > first)) {
+        return false;
+    }
+
+    // Span boundaries: knots of free-form curves are kept so every span is smooth
+    std::vector<Standard_Real> params;
+    try {
+        GeomAdaptor_Curve adaptor(curve, first, last);
+        switch (adaptor.GetType()) {
+        case GeomAbs_Line:
+            params = { first, last };
+            break;
+        case GeomAbs_Circle:
+        case GeomAbs_Ellipse: {
+            // Parameter is the angle; eight spans per full turn
+            const int spans = std::max(1, static_cast<int>(std::ceil((last - first) / (kPi / 4.0))));
+            for (int i = 0; i <= spans; ++i) {
+                params.push_back(first + (last - first) * i / spans);
+            }
+            break;
+        }
+        default: {
+            const int intervalCount = std::max(1, adaptor.NbIntervals(GeomAbs_C2));
+            TColStd_Array1OfReal intervals(1, intervalCount + 1);
+            adaptor.Intervals(intervals, GeomAbs_C2);
+            const int perInterval = std::max(1, std::min(kMinFreeFormSpans / intervalCount + 1,
+                                                         kMaxSpans / intervalCount));
+            params.push_back(first);
+            for (int i = 1; i <= intervalCount; ++i) {
+                const Standard_Real t0 = intervals(i);
+                const Standard_Real t1 = intervals(i + 1);
+                for (int j = 1; j <= perInterval; ++j) {
+                    params.push_back(t0 + (t1 - t0) * j / perInterval);
+                }
+            }
+            params.back() = last;
+            break;
+        }
+        }
+    }
+    catch (const Standard_Failure&) {
+        params.clear();
+        for (int i = 0; i <= kMinFreeFormSpans; ++i) {
+            params.push_back(first + (last - first) * i / kMinFreeFormSpans);
+        }
+    }
+
+    std::vector<Node> spans;
+    spans.reserve(params.size());
+    try {
+        gp_Pnt previous = curve->Value(params.front());
+        for (size_t i = 0; i + 1 < params.size(); ++i) {
+            if (!(params[i + 1] > params[i])) {
+                continue;
+            }
+            Node span;
+            span.t0 = params[i];
+            span.t1 = params[i + 1];
+            span.p0 = previous;
+            span.p1 = curve->Value(span.t1);
+            const gp_Pnt middle = curve->Value(0.5 * (span.t0 + span.t1));
+
+            // The box of the end points and midpoint, grown by the midpoint's
+            // distance from the chord, holds the smooth span between them
+            span.box.set(span.p0);
+            span.box.add(span.p1);
+            span.box.add(middle);
+            const gp_Pnt chordMiddle((span.p0.XYZ() + span.p1.XYZ()) * 0.5);
+            span.box.enlarge(middle.Distance(chordMiddle));
+
+            spans.push_back(span);
+            previous = span.p1;
+        }
+    }
+    catch (const Standard_Failure&) {
+        return false;
+    }
+    if (spans.empty()) {
+        return false;
+    }
+
+    m_nodes.reserve(spans.size() * 2 - 1);
+    buildNode(spans, 0, spans.size());
+    return true;
+}
+
+int CurveSegmentTree::buildNode(const std::vector<Node>& spans, size_t begin, size_t end) {
+    const int index = static_cast<int>(m_nodes.size());
+    if (end - begin == 1) {
+        m_nodes.push_back(spans[begin]);
+        return index;
+    }
+
+    // Spans are in curve order, so halving the range keeps neighbours together
+    m_nodes.emplace_back();
+    const size_t middle = begin + (end - begin) / 2;
+    const int left = buildNode(spans, begin, middle);
+    const int right = buildNode(spans, middle, end);
+
+    Node& node = m_nodes[index];
+    node.left = left;
+    node.right = right;
+    node.t0 = m_nodes[left].t0;
+    node.t1 = m_nodes[right].t1;
+    node.p0 = m_nodes[left].p0;
+    node.p1 = m_nodes[right].p1;
+    node.box = m_nodes[left].box;
+    node.box.add(m_nodes[right].box);
+    return index;
+}
+
+void CurveSegmentTree::intersect(const CurveSegmentTree& a, const CurveSegmentTree& b,
+                                 double tolerance, std::vector<Hit>& hits) {
+    if (a.isEmpty() || b.isEmpty()) {
+        return;
+    }
+
+    const size_t firstHit = hits.size();
+    std::vector<std::pair<int, int>> stack;
+    stack.emplace_back(0, 0);
+    while (!stack.empty()) {
+        const auto [nodeA, nodeB] = stack.back();
+        stack.pop_back();
+        const Node& na = a.m_nodes[nodeA];
+        const Node& nb = b.m_nodes[nodeB];
+        if (!na.box.overlaps(nb.box, tolerance)) {
+            continue;
+        }
+
+        const bool leafA = a.isLeaf(nodeA);
+        const bool leafB = b.isLeaf(nodeB);
+        if (leafA && leafB) {
+            Hit hit;
+            if (!intersectSpans(a, na, b, nb, tolerance, hit)) {
+                continue;
+            }
+            // Neighbouring span pairs converge on the same point
+            bool merged = false;
+            for (size_t k = firstHit; k < hits.size(); ++k) {
+                if (hits[k].point.Distance(hit.point) < tolerance) {
+                    if (hit.distance < hits[k].distance) {
+                        hits[k] = hit;
+                    }
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged) {
+                hits.push_back(hit);
+            }
+        }
+        else if (leafB || (!leafA && na.box.extent() >= nb.box.extent())) {
+            stack.emplace_back(na.left, nodeB);
+            stack.emplace_back(na.right, nodeB);
+        }
+        else {
+            stack.emplace_back(nodeA, nb.left);
+            stack.emplace_back(nodeA, nb.right);
+        }
+    }
+}
+
+bool CurveSegmentTree::intersectSpans(const CurveSegmentTree& a, const Node& spanA,
+                                      const CurveSegmentTree& b, const Node& spanB,
+                                      double tolerance, Hit& hit) {
+    double u = 0.0;
+    double v = 0.0;
+    closestSegmentParameters(spanA.p0, spanA.p1, spanB.p0, spanB.p1, u, v);
+    Standard_Real t = spanA.t0 + (spanA.t1 - spanA.t0) * u;
+    Standard_Real s = spanB.t0 + (spanB.t1 - spanB.t0) * v;
+
+    try {
+        refine(a, b, t, s);
+        const gp_Pnt pa = a.m_curve->Value(t);
+        const gp_Pnt pb = b.m_curve->Value(s);
+        const double distance = pa.Distance(pb);
+        if (distance >= tolerance) {
+            return false;
+        }
+
+        // Curves running along each other have no isolated crossing; only
+        // report where one of them ends
+        const gp_Vec chordA(spanA.p0, spanA.p1);
+        const gp_Vec chordB(spanB.p0, spanB.p1);
+        const double lengths = chordA.Magnitude() * chordB.Magnitude();
+        if (lengths > 0.0 && chordA.Crossed(chordB).Magnitude() < kParallelSine * lengths) {
+            const double pTol = Precision::PConfusion();
+            const bool atEnd = std::abs(t - a.m_first) < pTol || std::abs(t - a.m_last) < pTol ||
+                               std::abs(s - b.m_first) < pTol || std::abs(s - b.m_last) < pTol;
+            if (!atEnd) {
+                return false;
+            }
+        }
+
+        hit.param1 = t;
+        hit.param2 = s;
+        hit.point = gp_Pnt((pa.XYZ() + pb.XYZ()) * 0.5);
+        hit.distance = distance;
+        return true;
+    }
+    catch (const Standard_Failure&) {
+        return false;
+    }
+}
+
+void CurveSegmentTree::refine(const CurveSegmentTree& a, const CurveSegmentTree& b,
+                              Standard_Real& t, Standard_Real& s) {
+    // Newton on f(t, s) = |A(t) - B(s)|^2 / 2, kept inside both parameter ranges
+    const double pTol = Precision::PConfusion();
+    double best = a.m_curve->Value(t).SquareDistance(b.m_curve->Value(s));
+
+    for (int iteration = 0; iteration < kMaxNewtonIterations && best > 0.0; ++iteration) {
+        gp_Pnt pa, pb;
+        gp_Vec da, dda, db, ddb;
+        a.m_curve->D2(t, pa, da, dda);
+        b.m_curve->D2(s, pb, db, ddb);
+        const gp_Vec f(pb, pa);
+
+        const double ga = f.Dot(da);
+        const double gb = -f.Dot(db);
+        const double haa = da.SquareMagnitude() + f.Dot(dda);
+        const double hbb = db.SquareMagnitude() - f.Dot(ddb);
+        const double hab = -da.Dot(db);
+        const double det = haa * hbb - hab * hab;
+
+        double dt = 0.0;
+        double ds = 0.0;
+        if (std::abs(det) > 1e-12 * da.SquareMagnitude() * db.SquareMagnitude() && det > 0.0) {
+            dt = -(hbb * ga - hab * gb) / det;
+            ds = -(haa * gb - hab * ga) / det;
+        }
+        // Singular or indefinite Hessian: fall back to minimising along each curve
+        else {
+            if (haa > 0.0) dt = -ga / haa;
+            if (hbb > 0.0) ds = -gb / hbb;
+        }
+
+        // A step pushing one parameter past its end pins it there; the other
+        // then follows a one-dimensional Newton step
+        const bool pinA = (t + dt < a.m_first && t <= a.m_first + pTol) || (t + dt > a.m_last && t >= a.m_last - pTol);
+        const bool pinB = (s + ds < b.m_first && s <= b.m_first + pTol) || (s + ds > b.m_last && s >= b.m_last - pTol);
+        if (pinA && !pinB) {
+            dt = 0.0;
+            ds = hbb > 0.0 ? -gb / hbb : 0.0;
+        }
+        else if (pinB && !pinA) {
+            ds = 0.0;
+            dt = haa > 0.0 ? -ga / haa : 0.0;
+        }
+
+        bool improved = false;
+        Standard_Real nextT = t;
+        Standard_Real nextS = s;
+        for (double step = 1.0; step > 0.05; step *= 0.5) {
+            nextT = std::clamp(t + step * dt, a.m_first, a.m_last);
+            nextS = std::clamp(s + step * ds, b.m_first, b.m_last);
+            const double distance = a.m_curve->Value(nextT).SquareDistance(b.m_curve->Value(nextS));
+            if (distance <= best) {
+                best = distance;
+                improved = true;
+                break;
+            }
+        }
+        if (!improved) {
+            break;
+        }
+
+        const bool converged = std::abs(nextT - t) < pTol && std::abs(nextS - s) < pTol;
+        t = nextT;
+        s = nextS;
+        if (converged) {
+            break;
+        }
+    }
+}
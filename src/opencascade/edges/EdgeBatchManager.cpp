@@ -0,0 +1,439 @@
+#include "edges/EdgeBatchManager.h"
+#include "OCCGeometry.h"
+#include "logger/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Inventor/nodes/SoCoordinate3.h>
+#include <Inventor/nodes/SoDrawStyle.h>
+#include <Inventor/nodes/SoIndexedLineSet.h>
+#include <Inventor/nodes/SoMaterial.h>
+#include <Inventor/nodes/SoMaterialBinding.h>
+#include <Inventor/nodes/SoPickStyle.h>
+#include <Inventor/nodes/SoSeparator.h>
+
+namespace {
+    // Spare room per range so small edits are patched in place
+    size_t withSlack(size_t count) {
+        return count + count / 8 + 4;
+    }
+
+    // Batches smaller than this are never worth compacting
+    constexpr size_t kMinCompactVertices = 4096;
+
+    uint16_t linePatternFor(int style) {
+        switch (style) {
+        case 1: return 0x0F0F;  // Dashed
+        case 2: return 0xAAAA;  // Dotted
+        case 3: return 0x0C0C;  // Dash-dot
+        default: return 0xFFFF; // Solid
+        }
+    }
+
+    uint32_t packColor(const Quantity_Color& color) {
+        auto channel = [](double value) {
+            return static_cast<uint32_t>(std::lround(std::clamp(value, 0.0, 1.0) * 255.0));
+        };
+        return (channel(color.Red()) << 16) | (channel(color.Green()) << 8) | channel(color.Blue());
+    }
+
+    SbColor toSbColor(const Quantity_Color& color) {
+        return SbColor(static_cast<float>(color.Red()), static_cast<float>(color.Green()), static_cast<float>(color.Blue()));
+    }
+}
+
+EdgeBatchManager::EdgeBatchManager()
+{
+    m_root = new SoSeparator;
+    m_root->ref();
+    m_root->setName("EdgeBatches");
+    m_root->renderCaching.setValue(SoSeparator::OFF);
+
+    // Batches span many geometries, so a pick on them could not be mapped back to one
+    SoPickStyle* pickStyle = new SoPickStyle;
+    pickStyle->style.setValue(SoPickStyle::UNPICKABLE);
+    m_root->addChild(pickStyle);
+}
+
+EdgeBatchManager::~EdgeBatchManager()
+{
+    clear();
+    m_root->unref();
+}
+
+SbMatrix EdgeBatchManager::placementOf(const OCCGeometry& geometry)
+{
+    gp_Pnt position = geometry.getPosition();
+    gp_Vec axis;
+    double angle = 0.0;
+    geometry.getRotation(axis, angle);
+    float scale = static_cast<float>(geometry.getScale());
+
+    SbRotation rotation = SbRotation::identity();
+    if (angle != 0.0 && axis.Magnitude() > 0.0) {
+        rotation.setValue(SbVec3f(static_cast<float>(axis.X()), static_cast<float>(axis.Y()), static_cast<float>(axis.Z())),
+            static_cast<float>(angle));
+    }
+
+    SbMatrix matrix;
+    matrix.setTransform(
+        SbVec3f(static_cast<float>(position.X()), static_cast<float>(position.Y()), static_cast<float>(position.Z())),
+        rotation, SbVec3f(scale, scale, scale));
+    return matrix;
+}
+
+EdgeBatchManager::Batch& EdgeBatchManager::batchFor(EdgeType type, const Appearance& appearance)
+{
+    BatchKey key(static_cast<int>(type), packColor(appearance.color),
+        static_cast<int>(std::lround(appearance.width * 100.0)), appearance.style);
+    auto it = m_batches.find(key);
+    if (it != m_batches.end()) {
+        return *it->second;
+    }
+
+    auto batch = std::make_unique<Batch>();
+    batch->root = new SoSeparator;
+    batch->root->renderCaching.setValue(SoSeparator::OFF);
+
+    // Index 0 is the edge color, index 1 the highlight color
+    batch->material = new SoMaterial;
+    batch->material->diffuseColor.setNum(2);
+    batch->material->diffuseColor.set1Value(0, toSbColor(appearance.color));
+    batch->material->diffuseColor.set1Value(1, toSbColor(m_highlightColor));
+    batch->root->addChild(batch->material);
+
+    SoMaterialBinding* binding = new SoMaterialBinding;
+    binding->value.setValue(SoMaterialBinding::PER_VERTEX_INDEXED);
+    batch->root->addChild(binding);
+
+    SoDrawStyle* drawStyle = new SoDrawStyle;
+    drawStyle->style.setValue(SoDrawStyle::LINES);
+    drawStyle->lineWidth.setValue(static_cast<float>(appearance.width));
+    drawStyle->linePattern.setValue(linePatternFor(appearance.style));
+    batch->root->addChild(drawStyle);
+
+    batch->coords = new SoCoordinate3;
+    batch->coords->point.setNum(0);
+    batch->root->addChild(batch->coords);
+
+    batch->lines = new SoIndexedLineSet;
+    batch->lines->coordIndex.setNum(0);
+    batch->lines->materialIndex.setNum(0);
+    batch->root->addChild(batch->lines);
+
+    m_root->addChild(batch->root);
+    Batch& result = *batch;
+    m_batches.emplace(key, std::move(batch));
+    return result;
+}
+
+void EdgeBatchManager::allocate(Batch& batch, Range& range)
+{
+    const size_t vertices = range.localPoints.size();
+    const size_t indices = range.localIndices.size();
+
+    // Patch in place while the new data fits the old range
+    if (range.batch == &batch && vertices <= range.vertexCapacity && indices <= range.indexCapacity) {
+        return;
+    }
+
+    release(range);
+    range.batch = &batch;
+    range.vertexCapacity = withSlack(vertices);
+    range.indexCapacity = withSlack(indices);
+    range.firstVertex = batch.usedVertices;
+    range.firstIndex = batch.usedIndices;
+    batch.usedVertices += range.vertexCapacity;
+    batch.usedIndices += range.indexCapacity;
+    batch.liveVertices += range.vertexCapacity;
+    batch.liveIndices += range.indexCapacity;
+
+    batch.coords->point.setNum(static_cast<int>(batch.usedVertices));
+    batch.lines->coordIndex.setNum(static_cast<int>(batch.usedIndices));
+    batch.lines->materialIndex.setNum(static_cast<int>(batch.usedIndices));
+}
+
+void EdgeBatchManager::release(Range& range)
+{
+    if (!range.batch) {
+        return;
+    }
+    // Dead space draws nothing; it is reclaimed by compaction
+    Batch& batch = *range.batch;
+    int32_t* indices = batch.lines->coordIndex.startEditing();
+    std::fill(indices + range.firstIndex, indices + range.firstIndex + range.indexCapacity, -1);
+    batch.lines->coordIndex.finishEditing();
+
+    batch.liveVertices -= range.vertexCapacity;
+    batch.liveIndices -= range.indexCapacity;
+    range.batch = nullptr;
+    range.vertexCapacity = 0;
+    range.indexCapacity = 0;
+}
+
+void EdgeBatchManager::writeVertices(const Range& range)
+{
+    SbVec3f* points = range.batch->coords->point.startEditing();
+    for (size_t i = 0; i < range.localPoints.size(); ++i) {
+        range.placement.multVecMatrix(range.localPoints[i], points[range.firstVertex + i]);
+    }
+    range.batch->coords->point.finishEditing();
+}
+
+void EdgeBatchManager::writeIndices(const Range& range)
+{
+    int32_t* indices = range.batch->lines->coordIndex.startEditing();
+    int32_t* out = indices + range.firstIndex;
+    const bool shown = range.visible && !range.filtered;
+    size_t written = 0;
+    if (shown) {
+        const int32_t base = static_cast<int32_t>(range.firstVertex);
+        for (int32_t index : range.localIndices) {
+            out[written++] = index < 0 ? -1 : base + index;
+        }
+    }
+    std::fill(out + written, out + range.indexCapacity, -1);
+    range.batch->lines->coordIndex.finishEditing();
+}
+
+void EdgeBatchManager::writeMaterials(const Range& range)
+{
+    int32_t* materials = range.batch->lines->materialIndex.startEditing();
+    std::fill(materials + range.firstIndex, materials + range.firstIndex + range.indexCapacity,
+        range.highlighted ? 1 : 0);
+    range.batch->lines->materialIndex.finishEditing();
+}
+
+void EdgeBatchManager::setGeometryEdges(const OCCGeometry* geometry, EdgeType type, const Appearance& appearance,
+    std::vector<SbVec3f> points, std::vector<int32_t> indices, const SbMatrix& placement)
+{
+    if (!geometry) {
+        return;
+    }
+    if (points.empty() || indices.empty()) {
+        removeGeometryEdges(geometry, type);
+        return;
+    }
+
+    Range& range = m_ranges[geometry][type];
+    range.localPoints = std::move(points);
+    range.localIndices = std::move(indices);
+    range.placement = placement;
+
+    // An appearance change moves the range to another batch
+    Batch* previous = range.batch;
+    Batch& batch = batchFor(type, appearance);
+    allocate(batch, range);
+    writeVertices(range);
+    writeIndices(range);
+    writeMaterials(range);
+    compactIfSparse(batch);
+    if (previous && previous != &batch) {
+        compactIfSparse(*previous);
+    }
+}
+
+bool EdgeBatchManager::setGeometryEdgesFromNode(const OCCGeometry* geometry, EdgeType type, const Appearance& appearance,
+    SoSeparator* edgeNode, const SbMatrix& placement)
+{
+    if (!geometry || !edgeNode) {
+        return false;
+    }
+
+    SoCoordinate3* coords = nullptr;
+    SoIndexedLineSet* lines = nullptr;
+    for (int i = 0; i < edgeNode->getNumChildren(); ++i) {
+        SoNode* child = edgeNode->getChild(i);
+        if (!coords && child->isOfType(SoCoordinate3::getClassTypeId())) {
+            coords = static_cast<SoCoordinate3*>(child);
+        }
+        else if (!lines && child->isOfType(SoIndexedLineSet::getClassTypeId())) {
+            lines = static_cast<SoIndexedLineSet*>(child);
+        }
+    }
+    if (!coords || !lines) {
+        return false;
+    }
+
+    const SbVec3f* sourcePoints = coords->point.getValues(0);
+    std::vector<SbVec3f> points(sourcePoints, sourcePoints + coords->point.getNum());
+    const int32_t* sourceIndices = lines->coordIndex.getValues(0);
+    std::vector<int32_t> indices(sourceIndices, sourceIndices + lines->coordIndex.getNum());
+    if (!indices.empty() && indices.back() >= 0) {
+        indices.push_back(-1);
+    }
+
+    setGeometryEdges(geometry, type, appearance, std::move(points), std::move(indices), placement);
+    return true;
+}
+
+void EdgeBatchManager::removeGeometryEdges(const OCCGeometry* geometry, EdgeType type)
+{
+    auto it = m_ranges.find(geometry);
+    if (it == m_ranges.end()) {
+        return;
+    }
+    auto rangeIt = it->second.find(type);
+    if (rangeIt != it->second.end()) {
+        release(rangeIt->second);
+        it->second.erase(rangeIt);
+    }
+    if (it->second.empty()) {
+        m_ranges.erase(it);
+    }
+}
+
+void EdgeBatchManager::removeGeometry(const OCCGeometry* geometry)
+{
+    auto it = m_ranges.find(geometry);
+    if (it == m_ranges.end()) {
+        return;
+    }
+    for (auto& entry : it->second) {
+        release(entry.second);
+    }
+    m_ranges.erase(it);
+}
+
+bool EdgeBatchManager::hasGeometryEdges(const OCCGeometry* geometry, EdgeType type) const
+{
+    auto it = m_ranges.find(geometry);
+    return it != m_ranges.end() && it->second.count(type) > 0;
+}
+
+void EdgeBatchManager::setGeometryVisible(const OCCGeometry* geometry, bool visible)
+{
+    auto it = m_ranges.find(geometry);
+    if (it == m_ranges.end()) {
+        return;
+    }
+    for (auto& entry : it->second) {
+        Range& range = entry.second;
+        if (range.visible != visible) {
+            range.visible = visible;
+            writeIndices(range);
+        }
+    }
+}
+
+void EdgeBatchManager::setGeometryFiltered(const OCCGeometry* geometry, bool filtered)
+{
+    auto it = m_ranges.find(geometry);
+    if (it == m_ranges.end()) {
+        return;
+    }
+    for (auto& entry : it->second) {
+        Range& range = entry.second;
+        if (range.filtered != filtered) {
+            range.filtered = filtered;
+            writeIndices(range);
+        }
+    }
+}
+
+void EdgeBatchManager::setGeometryHighlighted(const OCCGeometry* geometry, bool highlighted)
+{
+    auto it = m_ranges.find(geometry);
+    if (it == m_ranges.end()) {
+        return;
+    }
+    for (auto& entry : it->second) {
+        Range& range = entry.second;
+        if (range.highlighted != highlighted) {
+            range.highlighted = highlighted;
+            writeMaterials(range);
+        }
+    }
+}
+
+void EdgeBatchManager::setGeometryPlacement(const OCCGeometry* geometry, const SbMatrix& placement)
+{
+    auto it = m_ranges.find(geometry);
+    if (it == m_ranges.end()) {
+        return;
+    }
+    for (auto& entry : it->second) {
+        Range& range = entry.second;
+        if (range.placement != placement) {
+            range.placement = placement;
+            writeVertices(range);
+        }
+    }
+}
+
+void EdgeBatchManager::setHighlightColor(const Quantity_Color& color)
+{
+    m_highlightColor = color;
+    for (auto& entry : m_batches) {
+        entry.second->material->diffuseColor.set1Value(1, toSbColor(color));
+    }
+}
+
+void EdgeBatchManager::compactIfSparse(Batch& batch)
+{
+    if (batch.usedVertices < kMinCompactVertices || batch.liveVertices * 2 > batch.usedVertices) {
+        return;
+    }
+
+    // Lay the live ranges of this batch out again, back to back
+    std::vector<Range*> ranges;
+    for (auto& geometryRanges : m_ranges) {
+        for (auto& entry : geometryRanges.second) {
+            if (entry.second.batch == &batch) {
+                ranges.push_back(&entry.second);
+            }
+        }
+    }
+    std::sort(ranges.begin(), ranges.end(), [](const Range* a, const Range* b) { return a->firstVertex < b->firstVertex; });
+
+    batch.usedVertices = 0;
+    batch.usedIndices = 0;
+    batch.liveVertices = 0;
+    batch.liveIndices = 0;
+    for (Range* range : ranges) {
+        range->vertexCapacity = withSlack(range->localPoints.size());
+        range->indexCapacity = withSlack(range->localIndices.size());
+        range->firstVertex = batch.usedVertices;
+        range->firstIndex = batch.usedIndices;
+        batch.usedVertices += range->vertexCapacity;
+        batch.usedIndices += range->indexCapacity;
+    }
+    batch.liveVertices = batch.usedVertices;
+    batch.liveIndices = batch.usedIndices;
+
+    batch.coords->point.setNum(static_cast<int>(batch.usedVertices));
+    batch.lines->coordIndex.setNum(static_cast<int>(batch.usedIndices));
+    batch.lines->materialIndex.setNum(static_cast<int>(batch.usedIndices));
+    for (Range* range : ranges) {
+        writeVertices(*range);
+        writeIndices(*range);
+        writeMaterials(*range);
+    }
+    ++m_compactions;
+    LOG_DBG_S("EdgeBatchManager: Compacted batch to " + std::to_string(ranges.size()) + " ranges, " +
+        std::to_string(batch.usedVertices) + " vertices");
+}
+
+void EdgeBatchManager::clear()
+{
+    m_ranges.clear();
+    for (auto& entry : m_batches) {
+        m_root->removeChild(entry.second->root);
+    }
+    m_batches.clear();
+}
+
+EdgeBatchManager::Statistics EdgeBatchManager::getStatistics() const
+{
+    Statistics stats;
+    stats.batches = m_batches.size();
+    for (const auto& entry : m_ranges) {
+        stats.ranges += entry.second.size();
+    }
+    for (const auto& entry : m_batches) {
+        stats.vertices += entry.second->usedVertices;
+        stats.liveVertices += entry.second->liveVertices;
+    }
+    stats.compactions = m_compactions;
+    return stats;
+}
@@ -11,6 +11,7 @@
 #include "edges/EdgeRenderApplier.h"
 #include "logger/AsyncLogger.h"
 #include "logger/Logger.h"
+#include "config/SelectionHighlightConfig.h"
 #include <OpenCASCADE/TopExp_Explorer.hxx>
 #include <OpenCASCADE/TopoDS.hxx>
 #include <OpenCASCADE/TopAbs.hxx>
@@ -20,6 +21,12 @@
 #include "OCCViewer.h"
 #include "RenderingEngine.h"
 #include <Inventor/nodes/SoCamera.h>
+#include <OpenCASCADE/BRepBuilderAPI_Copy.hxx>
+#include <OpenCASCADE/Standard_Failure.hxx>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <algorithm>
+#include <chrono>
 #include <set>
 #include <atomic>
 #include <wx/app.h>
@@ -29,6 +36,16 @@ EdgeDisplayManager::EdgeDisplayManager(SceneManager* sceneManager,
 	: m_sceneManager(sceneManager), m_geometries(geometries) {
 }
 
+EdgeDisplayManager::~EdgeDisplayManager() {
+	// Mesh edge workers reference this manager until they finish
+	m_meshEdgeCancel = true;
+	for (auto& worker : m_meshEdgeWorkers) {
+		if (worker.valid()) {
+			worker.wait();
+		}
+	}
+}
+
 void EdgeDisplayManager::toggleEdgeType(EdgeType type, bool show, const MeshParameters& meshParams) {
 	switch (type) {
 	case EdgeType::Original: m_flags.showOriginalEdges = show; break;
@@ -84,6 +101,7 @@ void EdgeDisplayManager::setShowOriginalEdges(bool show, const MeshParameters& m
 
 void EdgeDisplayManager::setShowOriginalEdgesForSelectedOnly(bool selectedOnly, const MeshParameters& meshParams) {
     m_showOriginalEdgesForSelectedOnly = selectedOnly;
+    markDirty(EdgeType::Original);
     
     // CRITICAL FEATURE: Show original edges only for selected objects (performance optimization)
     // This dramatically reduces rendering load for large assemblies
@@ -94,6 +112,7 @@ void EdgeDisplayManager::setShowOriginalEdgesForSelectedOnly(bool selectedOnly,
 
 void EdgeDisplayManager::setShowSilhouetteEdgesOnly(bool silhouetteOnly, const MeshParameters& meshParams) {
     m_showSilhouetteEdgesOnly = silhouetteOnly;
+    markDirty(EdgeType::Original);
     
     // CRITICAL FEATURE: Show only outline/contour edges (fast mode, similar to FreeCAD)
     // Note: silhouette = outline = contour (unified naming convention)
@@ -203,6 +222,7 @@ void EdgeDisplayManager::setOriginalEdgesParameters(double samplingDensity, doub
 
 	// Update the intersection nodes display flag
 	m_flags.showIntersectionNodes = highlightIntersectionNodes;
+	markDirty(EdgeType::Original);
 
 	// Apply the new parameters immediately if original edges are currently shown
 	if (m_flags.showOriginalEdges) {
@@ -222,6 +242,10 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 
 	if (meshParamsChanged) {
 		m_originalEdgeCacheValid = false;
+		m_dirtyTypes |= maskOf(EdgeType::Original);
+	}
+	if (forceMeshRegeneration) {
+		m_dirtyTypes |= maskOf(EdgeType::Mesh) | maskOf(EdgeType::VerticeNormal) | maskOf(EdgeType::FaceNormal);
 	}
 
 	m_lastOriginalMeshParams = meshParams;
@@ -235,12 +259,27 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 			LOG_WRN_S("EdgeDisplayManager::updateAll: GL context invalid, delaying node creation");
 			// Delay execution until GL context is valid
 			// Use wxTheApp->CallAfter() to ensure execution on main thread
-			wxTheApp->CallAfter([this, meshParams, forceMeshRegeneration]() {
-				updateAll(meshParams, forceMeshRegeneration);
+			// Dirty state is kept, so the delayed pass sees the same work
+			std::weak_ptr<int> alive = m_lifeToken;
+			wxTheApp->CallAfter([this, alive, meshParams, forceMeshRegeneration]() {
+				if (alive.lock()) {
+					updateAll(meshParams, forceMeshRegeneration);
+				}
 			});
 			return;
 		}
 	}
+
+	updateBatchingMode();
+
+	// Consume the dirty state of this pass
+	const EdgeTypeMask changed = m_dirtyTypes | changedTypes(m_appliedFlags, m_flags);
+	const EdgeTypeMask allTypes = ~EdgeTypeMask(0);
+	const EdgeTypeMask meshDerivedTypes = maskOf(EdgeType::Mesh) | maskOf(EdgeType::VerticeNormal) | maskOf(EdgeType::FaceNormal);
+	m_dirtyTypes = 0;
+	m_appliedFlags = m_flags;
+	auto dirtyGeometries = std::move(m_dirtyGeometries);
+	m_dirtyGeometries.clear();
 	
 	EdgeGenerationService generator;
 	EdgeRenderApplier applier;
@@ -278,6 +317,9 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 		}
 	}
 	
+	std::unordered_set<const OCCGeometry*> liveGeometries;
+	std::vector<MeshEdgeJob> meshJobs;
+	bool originalExtractionStarted = false;
 	size_t processedCount = 0;
 	for (auto& g : *m_geometries) {
 		if (!g) continue;
@@ -286,9 +328,35 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 		if (m_showOriginalEdgesForSelectedOnly) {
 			if (selectedGeometryNames.find(g->getName()) == selectedGeometryNames.end()) {
 				// Not selected, skip original edges for this geometry
+				// It stays unknown, so it is fully processed once it is shown again
+				if (m_edgeBatches) {
+					m_edgeBatches->setGeometryFiltered(g.get(), true);
+				}
 				continue;
 			}
 		}
+
+		// Work out which edge types of this geometry need attention
+		const OCCGeometry* key = g.get();
+		liveGeometries.insert(key);
+		if (m_edgeBatches) {
+			// Visibility, filtering and placement only rewrite this geometry's batch ranges when they change
+			m_edgeBatches->setGeometryFiltered(key, false);
+			m_edgeBatches->setGeometryVisible(key, g->isVisible());
+			m_edgeBatches->setGeometryPlacement(key, EdgeBatchManager::placementOf(*g));
+			m_edgeBatches->setGeometryHighlighted(key, g->isSelected());
+		}
+		EdgeTypeMask dirty = changed;
+		auto dirtyIt = dirtyGeometries.find(key);
+		if (dirtyIt != dirtyGeometries.end()) {
+			dirty |= dirtyIt->second;
+		}
+		auto known = m_knownGeometries.find(key);
+		if (known == m_knownGeometries.end() || known->second.expired()) {
+			m_knownGeometries[key] = g;
+			dirty = allTypes;
+		}
+		if (dirty == 0) continue;
 		
 		// REMOVED wxYield() - it can corrupt GL state during batch operations
 		// Processing Windows messages while building Coin3D nodes causes GL context issues
@@ -300,11 +368,14 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 		if (!g->modularEdgeComponent) {
 			g->modularEdgeComponent = std::make_unique<ModularEdgeComponent>();
 		}
-		g->modularEdgeComponent->edgeFlags = m_flags;
+		g->modularEdgeComponent->edgeFlags = componentFlags();
+
+		// Original and silhouette edges are only revisited when they are dirty for this geometry
+		const bool touchOriginal = (dirty & (maskOf(EdgeType::Original) | maskOf(EdgeType::IntersectionNodes))) != 0;
 
 		// CRITICAL FEATURE: Show silhouette edges only (fast mode, following FreeCAD's approach)
 		// Silhouette edges are view-dependent and provide much better performance for large models
-		if (m_showSilhouetteEdgesOnly && m_flags.showOriginalEdges) {
+		if (touchOriginal && m_showSilhouetteEdgesOnly && m_flags.showOriginalEdges) {
 			if (!g->getShape().IsNull()) {
 				// Extract silhouette edges (view-dependent, fast mode)
 				g->modularEdgeComponent->extractSilhouetteEdges(
@@ -315,7 +386,7 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 				// Clear original edge node to ensure silhouette takes priority
 				g->modularEdgeComponent->clearEdgeNode(EdgeType::Original);
 			}
-		} else if (m_flags.showOriginalEdges) {
+		} else if (touchOriginal && m_flags.showOriginalEdges) {
 			// Clear silhouette edge node when showing original edges
 			g->modularEdgeComponent->clearSilhouetteEdgeNode();
 			
@@ -346,6 +417,7 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 					RenderingEngine* renderingEngine = canvas->getRenderingEngine();
 					if (!renderingEngine || !renderingEngine->isGLContextValid()) {
 						LOG_WRN_S("EdgeDisplayManager::updateAll: GL context invalid before creating edge node, skipping");
+						m_dirtyGeometries[key] |= dirty; // Retried on the next pass
 						continue; // Skip this geometry, try next one
 					}
 				}
@@ -358,16 +430,18 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 						m_originalEdgeParams.color, m_originalEdgeParams.width);
 				} catch (const std::exception& e) {
 					LOG_ERR_S("EdgeDisplayManager::updateAll: Exception creating edge node: " + std::string(e.what()));
+					m_dirtyGeometries[key] |= dirty & ~maskOf(EdgeType::Original);
 					continue; // Skip this geometry, try next one
 				} catch (...) {
 					LOG_ERR_S("EdgeDisplayManager::updateAll: Unknown exception creating edge node");
+					m_dirtyGeometries[key] |= dirty & ~maskOf(EdgeType::Original);
 					continue; // Skip this geometry, try next one
 				}
 				
 				// If no cached data exists and extraction is not running, trigger async extraction
 				// Following FreeCAD's CoinThread approach: extract in background thread, create nodes on main thread
 				// This prevents UI blocking and GL context crashes for large models
-				if (!edgeNode && !g->getShape().IsNull() && !m_originalEdgeRunning.load() && !m_originalEdgeCacheValid) {
+				if (!edgeNode && !originalExtractionStarted && !g->getShape().IsNull() && !m_originalEdgeRunning.load() && !m_originalEdgeCacheValid) {
 					// Start async extraction - this will extract data in background thread, then create nodes on main thread
 					startAsyncOriginalEdgeExtraction(
 						m_originalEdgeParams.samplingDensity,
@@ -380,9 +454,9 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 						m_originalEdgeParams.intersectionNodeShape,
 						currentParams,
 						nullptr);
-					// Break after starting extraction to avoid starting multiple threads
-					// The extraction will process all geometries in the background thread
-					break;
+					// Only one extraction is started; it processes all geometries in the background
+					// thread and marks original edges dirty again when it completes
+					originalExtractionStarted = true;
 				}
 			} else {
 				// Node exists, just update appearance
@@ -398,56 +472,324 @@ void EdgeDisplayManager::updateAll(const MeshParameters& meshParams, bool forceM
 				// They will be created when computation completes
 			}
 		}
-		bool needMesh = false;
-		if (m_flags.showMeshEdges) {
-			// Check if mesh edge node exists
-			SoSeparator* meshNode = nullptr;
-			if (g->modularEdgeComponent) {
-				meshNode = g->modularEdgeComponent->getEdgeNode(EdgeType::Mesh);
+		// Mesh-derived nodes are queued for the parallel workers instead of being built here
+		if (dirty & meshDerivedTypes) {
+			const bool force = forceMeshRegeneration;
+			EdgeTypeMask needed = 0;
+			auto needs = [&](EdgeType type, bool shown) {
+				if (!shown || !(dirty & maskOf(type))) return;
+				if (force || g->modularEdgeComponent->getEdgeNode(type) == nullptr) {
+					needed |= maskOf(type);
+				}
+			};
+			needs(EdgeType::Mesh, m_flags.showMeshEdges);
+			needs(EdgeType::VerticeNormal, m_flags.showVerticeNormals);
+			needs(EdgeType::FaceNormal, m_flags.showFaceNormals);
+
+			// Types already being built for this geometry are not queued twice; a forced
+			// job supersedes the ones in flight, whose results are then dropped
+			auto inFlight = m_meshEdgeInFlight.find(key);
+			if (!force && inFlight != m_meshEdgeInFlight.end()) {
+				needed &= ~inFlight->second.types;
 			}
-			if (!meshNode) {
-				needMesh = true;
-				LOG_INF_S("EdgeDisplayManager: Need mesh edges for '" + g->getName() + "' (node is null)");
+			if (needed) {
+				MeshEdgeJob job;
+				job.geometry = g;
+				job.key = key;
+				job.types = needed;
+				job.force = force;
+				job.generation = ++m_meshEdgeGeneration;
+
+				MeshEdgeInFlight& state = m_meshEdgeInFlight[key];
+				state.types |= needed;
+				for (size_t bit = 0; bit < state.generations.size(); ++bit) {
+					if (needed & (1u << bit)) {
+						state.generations[bit] = job.generation;
+					}
+				}
+				meshJobs.push_back(std::move(job));
 			}
 		}
-		// For vertex normals (verticeNormals), we also need mesh data. Ensure we treat "show normals" as enabling normal lines.
-		if (m_flags.showVerticeNormals) {
-			SoSeparator* normalNode = nullptr;
-			if (g->modularEdgeComponent) {
-				normalNode = g->modularEdgeComponent->getEdgeNode(EdgeType::VerticeNormal);
+		if ((dirty & maskOf(EdgeType::Feature)) && m_flags.showFeatureEdges && m_featureCacheValid) {
+			generator.ensureFeatureEdges(g, m_lastFeatureParams.angleDeg, m_lastFeatureParams.minLength, m_lastFeatureParams.onlyConvex, m_lastFeatureParams.onlyConcave,
+				m_featureEdgeAppearance.color, m_featureEdgeAppearance.width);
+		}
+		if (m_edgeBatches) {
+			syncBatchedEdges(g, dirty);
+		}
+		applier.applyFlagsAndAttach(g, componentFlags());
+	}
+
+	// Forget geometries that were removed from the viewer
+	for (auto it = m_knownGeometries.begin(); it != m_knownGeometries.end();) {
+		if (liveGeometries.count(it->first) && !it->second.expired()) {
+			++it;
+		} else {
+			if (m_edgeBatches) {
+				m_edgeBatches->removeGeometry(it->first);
 			}
-			if (!normalNode) {
-				needMesh = true;
-				LOG_INF_S("EdgeDisplayManager: Need vertice normals for '" + g->getName() + "' (node is null)");
+			it = m_knownGeometries.erase(it);
+		}
+	}
+
+	if (!meshJobs.empty()) {
+		LOG_INF_S("EdgeDisplayManager: Building mesh-derived edges for " + std::to_string(meshJobs.size()) + " geometries");
+		launchMeshEdgeJobs(std::move(meshJobs), currentParams);
+	}
+	if (processedCount > 0) {
+		requestEdgeRefresh();
+	}
+}
+
+void EdgeDisplayManager::markDirty(EdgeType type) {
+	m_dirtyTypes |= maskOf(type);
+}
+
+void EdgeDisplayManager::markDirty(const std::shared_ptr<OCCGeometry>& geometry, EdgeType type) {
+	if (geometry) {
+		m_dirtyGeometries[geometry.get()] |= maskOf(type);
+	}
+}
+
+EdgeDisplayManager::EdgeTypeMask EdgeDisplayManager::changedTypes(const EdgeDisplayFlags& before, const EdgeDisplayFlags& after) {
+	EdgeTypeMask mask = 0;
+	if (before.showOriginalEdges != after.showOriginalEdges) mask |= maskOf(EdgeType::Original);
+	if (before.showFeatureEdges != after.showFeatureEdges) mask |= maskOf(EdgeType::Feature);
+	if (before.showMeshEdges != after.showMeshEdges) mask |= maskOf(EdgeType::Mesh);
+	if (before.showHighlightEdges != after.showHighlightEdges) mask |= maskOf(EdgeType::Highlight);
+	if (before.showVerticeNormals != after.showVerticeNormals) mask |= maskOf(EdgeType::VerticeNormal);
+	if (before.showFaceNormals != after.showFaceNormals) mask |= maskOf(EdgeType::FaceNormal);
+	if (before.showSilhouetteEdges != after.showSilhouetteEdges) mask |= maskOf(EdgeType::Silhouette);
+	if (before.showIntersectionNodes != after.showIntersectionNodes) mask |= maskOf(EdgeType::IntersectionNodes);
+	return mask;
+}
+
+void EdgeDisplayManager::launchMeshEdgeJobs(std::vector<MeshEdgeJob> jobs, const MeshParameters& meshParams) {
+	// Drop workers that already delivered their results
+	m_meshEdgeWorkers.erase(std::remove_if(m_meshEdgeWorkers.begin(), m_meshEdgeWorkers.end(),
+		[](std::future<void>& worker) {
+			return !worker.valid() || worker.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}), m_meshEdgeWorkers.end());
+
+	// Inputs are copied here, where the UI thread owns them: the cached mesh of
+	// mesh-only geometries, otherwise the topology with its stored triangulation.
+	// BRepMesh writes into the TShapes it meshes, so meshing a copy keeps workers
+	// of other batches and UI-thread meshing of shared TShapes from racing
+	for (auto& job : jobs) {
+		auto geometry = job.geometry.lock();
+		if (!geometry) continue;
+		if (geometry->hasCachedMesh()) {
+			job.mesh = geometry->getCachedMesh();
+		} else if (!geometry->getShape().IsNull()) {
+			try {
+				BRepBuilderAPI_Copy copier(geometry->getShape(), Standard_False, Standard_True);
+				job.shape = copier.Shape();
+			} catch (const Standard_Failure& e) {
+				LOG_ERR_S("EdgeDisplayManager: Copying '" + geometry->getName() + "' for edges failed: " + e.GetMessageString());
+			}
+		}
+	}
+
+	auto batch = std::make_shared<std::vector<MeshEdgeJob>>(std::move(jobs));
+	std::weak_ptr<int> alive = m_lifeToken;
+	m_meshEdgeWorkers.push_back(std::async(std::launch::async, [this, batch, alive, meshParams]() {
+		// Every job meshes its own copy, so jobs run independently even when
+		// instances of one part share a TShape
+		tbb::parallel_for(tbb::blocked_range<size_t>(0, batch->size()),
+			[&](const tbb::blocked_range<size_t>& range) {
+				for (size_t index = range.begin(); index != range.end() && !m_meshEdgeCancel.load(); ++index) {
+					MeshEdgeJob& job = (*batch)[index];
+					if (job.shape.IsNull() || !job.mesh.triangles.empty()) continue;
+					try {
+						job.mesh = EdgeGenerationService::buildEdgeMesh(job.shape, meshParams);
+					} catch (const std::exception& e) {
+						LOG_ERR_S("EdgeDisplayManager: Mesh for edges failed: " + std::string(e.what()));
+					} catch (const Standard_Failure& e) {
+						LOG_ERR_S("EdgeDisplayManager: Mesh for edges failed: " + std::string(e.GetMessageString()));
+					}
+					job.shape.Nullify();
+				}
+			});
+
+		if (m_meshEdgeCancel.load()) return;
+		wxTheApp->CallAfter([this, batch, alive]() {
+			if (!alive.lock()) return;
+			for (auto& job : *batch) {
+				m_pendingMeshEdges.push_back(std::move(job));
 			}
+			attachPendingMeshEdges();
+		});
+	}));
+}
+
+void EdgeDisplayManager::attachPendingMeshEdges() {
+	m_attachScheduled = false;
+	if (m_pendingMeshEdges.empty()) return;
+
+	// Coin3D nodes need a valid GL context; try again on a later turn
+	if (m_sceneManager && m_sceneManager->getCanvas()) {
+		RenderingEngine* renderingEngine = m_sceneManager->getCanvas()->getRenderingEngine();
+		if (renderingEngine && !renderingEngine->isGLContextValid()) {
+			m_attachScheduled = true;
+			std::weak_ptr<int> alive = m_lifeToken;
+			wxTheApp->CallAfter([this, alive]() {
+				if (alive.lock()) attachPendingMeshEdges();
+			});
+			return;
 		}
-		if (m_flags.showFaceNormals) {
-			SoSeparator* faceNormalNode = nullptr;
-			if (g->modularEdgeComponent) {
-				faceNormalNode = g->modularEdgeComponent->getEdgeNode(EdgeType::FaceNormal);
+	}
+
+	// Attach in batches that fit a frame, so thousands of parts never stall the UI
+	constexpr auto kFrameBudget = std::chrono::milliseconds(8);
+	const auto start = std::chrono::steady_clock::now();
+	EdgeGenerationService generator;
+	EdgeRenderApplier applier;
+	size_t attached = 0;
+	while (!m_pendingMeshEdges.empty()) {
+		MeshEdgeJob job = std::move(m_pendingMeshEdges.front());
+		m_pendingMeshEdges.pop_front();
+
+		// Types that a newer job was queued for since this one are left to it
+		EdgeTypeMask current = 0;
+		auto inFlight = m_meshEdgeInFlight.find(job.key);
+		if (inFlight != m_meshEdgeInFlight.end()) {
+			MeshEdgeInFlight& state = inFlight->second;
+			for (size_t bit = 0; bit < state.generations.size(); ++bit) {
+				if ((job.types & (1u << bit)) && state.generations[bit] == job.generation) {
+					current |= 1u << bit;
+				}
 			}
-			if (!faceNormalNode) {
-				needMesh = true;
-				LOG_INF_S("EdgeDisplayManager: Need face normals for '" + g->getName() + "' (node is null)");
+			state.types &= ~current;
+			if (state.types == 0) {
+				m_meshEdgeInFlight.erase(inFlight);
 			}
 		}
-		if (needMesh) {
-			LOG_INF_S("EdgeDisplayManager: Generating mesh-derived edges for '" + g->getName() + "'");
-			if (forceMeshRegeneration) {
-				generator.forceRegenerateMeshDerivedEdges(g, currentParams, m_flags.showMeshEdges, m_flags.showVerticeNormals, m_flags.showFaceNormals);
-			} else {
-				generator.ensureMeshDerivedEdges(g, currentParams, m_flags.showMeshEdges, m_flags.showVerticeNormals, m_flags.showFaceNormals);
+		job.types = current;
+
+		// Skip geometries that were removed and types that were switched off meanwhile
+		auto geometry = job.geometry.lock();
+		if (!geometry) continue;
+		const bool meshEdges = (job.types & maskOf(EdgeType::Mesh)) && m_flags.showMeshEdges;
+		const bool verticeNormals = (job.types & maskOf(EdgeType::VerticeNormal)) && m_flags.showVerticeNormals;
+		const bool faceNormals = (job.types & maskOf(EdgeType::FaceNormal)) && m_flags.showFaceNormals;
+		if (!meshEdges && !verticeNormals && !faceNormals) continue;
+
+		try {
+			if (generator.applyMeshDerivedEdges(geometry, job.mesh, meshEdges, verticeNormals, faceNormals, job.force)) {
+				applier.applyFlagsAndAttach(geometry, componentFlags());
+				++attached;
 			}
+		} catch (const std::exception& e) {
+			LOG_ERR_S("EdgeDisplayManager: Exception attaching mesh-derived edges: " + std::string(e.what()));
 		}
-		if (m_flags.showFeatureEdges && m_featureCacheValid) {
-			generator.ensureFeatureEdges(g, m_lastFeatureParams.angleDeg, m_lastFeatureParams.minLength, m_lastFeatureParams.onlyConvex, m_lastFeatureParams.onlyConcave,
-				m_featureEdgeAppearance.color, m_featureEdgeAppearance.width);
+
+		if (std::chrono::steady_clock::now() - start >= kFrameBudget) {
+			break;
 		}
-		applier.applyFlagsAndAttach(g, m_flags);
 	}
+
+	if (attached > 0) {
+		requestEdgeRefresh();
+	}
+	if (!m_pendingMeshEdges.empty() && !m_attachScheduled) {
+		m_attachScheduled = true;
+		std::weak_ptr<int> alive = m_lifeToken;
+		wxTheApp->CallAfter([this, alive]() {
+			if (alive.lock()) attachPendingMeshEdges();
+		});
+	}
+}
+
+void EdgeDisplayManager::updateBatchingMode() {
+	const bool wanted = m_batchThreshold > 0 && m_geometries->size() >= m_batchThreshold;
+	SoSeparator* objectRoot = m_sceneManager ? m_sceneManager->getObjectRoot() : nullptr;
+
+	if (wanted && !m_edgeBatches) {
+		m_edgeBatches = std::make_unique<EdgeBatchManager>();
+		// Selected geometries draw their batched edges in the configured edge selection color
+		const auto& selection = SelectionHighlightConfigManager::getInstance().getEdgeHighlight().selectionDiffuse;
+		m_edgeBatches->setHighlightColor(Quantity_Color(selection.r, selection.g, selection.b, Quantity_TOC_RGB));
+		LOG_INF_S("EdgeDisplayManager: Batching original and feature edges of " + std::to_string(m_geometries->size()) + " geometries");
+	} else if (!wanted && m_edgeBatches) {
+		if (objectRoot) {
+			int index = objectRoot->findChild(m_edgeBatches->getRoot());
+			if (index >= 0) objectRoot->removeChild(index);
+		}
+		m_edgeBatches.reset();
+		LOG_INF_S("EdgeDisplayManager: Edge batching off, using per-geometry edge nodes");
+	} else {
+		// Scene clears can detach the batch root; re-attach below
+		if (m_edgeBatches && objectRoot && objectRoot->findChild(m_edgeBatches->getRoot()) < 0) {
+			objectRoot->addChild(m_edgeBatches->getRoot());
+		}
+		return;
+	}
+
+	if (m_edgeBatches && objectRoot) {
+		objectRoot->addChild(m_edgeBatches->getRoot());
+	}
+	// Every geometry switches between its own nodes and the batches
+	m_dirtyTypes |= maskOf(EdgeType::Original) | maskOf(EdgeType::Feature);
+}
+
+EdgeDisplayFlags EdgeDisplayManager::componentFlags() const {
+	// While batching, per-geometry original and feature nodes stay detached
+	EdgeDisplayFlags flags = m_flags;
+	if (m_edgeBatches) {
+		flags.showOriginalEdges = flags.showOriginalEdges && m_showSilhouetteEdgesOnly;
+		flags.showFeatureEdges = false;
+	}
+	return flags;
+}
+
+void EdgeDisplayManager::syncGeometryState(const std::shared_ptr<OCCGeometry>& geometry) {
+	if (!m_edgeBatches || !geometry) return;
+	const OCCGeometry* key = geometry.get();
+	m_edgeBatches->setGeometryVisible(key, geometry->isVisible());
+	m_edgeBatches->setGeometryPlacement(key, EdgeBatchManager::placementOf(*geometry));
+	m_edgeBatches->setGeometryHighlighted(key, geometry->isSelected());
+}
+
+void EdgeDisplayManager::syncBatchedEdges(const std::shared_ptr<OCCGeometry>& geometry, EdgeTypeMask dirty) {
+	if (!m_edgeBatches || !geometry || !geometry->modularEdgeComponent) return;
+	auto& comp = geometry->modularEdgeComponent;
+	const OCCGeometry* key = geometry.get();
+	const SbMatrix placement = EdgeBatchManager::placementOf(*geometry);
+
+	if (dirty & maskOf(EdgeType::Original)) {
+		SoSeparator* node = comp->getEdgeNode(EdgeType::Original);
+		if (m_flags.showOriginalEdges && !m_showSilhouetteEdgesOnly && node) {
+			EdgeBatchManager::Appearance appearance;
+			appearance.color = m_originalEdgeParams.color;
+			appearance.width = m_originalEdgeParams.width;
+			m_edgeBatches->setGeometryEdgesFromNode(key, EdgeType::Original, appearance, node, placement);
+		} else {
+			m_edgeBatches->removeGeometryEdges(key, EdgeType::Original);
+		}
+	}
+	if (dirty & maskOf(EdgeType::Feature)) {
+		SoSeparator* node = comp->getEdgeNode(EdgeType::Feature);
+		if (m_flags.showFeatureEdges && node) {
+			EdgeBatchManager::Appearance appearance;
+			appearance.color = m_featureEdgeAppearance.color;
+			appearance.width = m_featureEdgeAppearance.width;
+			appearance.style = m_featureEdgeAppearance.style;
+			m_edgeBatches->setGeometryEdgesFromNode(key, EdgeType::Feature, appearance, node, placement);
+		} else {
+			m_edgeBatches->removeGeometryEdges(key, EdgeType::Feature);
+		}
+	}
+	// Fresh ranges start visible and unhighlighted
+	syncGeometryState(geometry);
+}
+
+void EdgeDisplayManager::requestEdgeRefresh() {
 	if (m_sceneManager && m_sceneManager->getCanvas()) {
-		m_sceneManager->getCanvas()->Refresh();
-		if (auto* rm = m_sceneManager->getCanvas()->getRefreshManager()) rm->requestRefresh(ViewRefreshManager::RefreshReason::EDGES_TOGGLED, true);
+		if (auto* rm = m_sceneManager->getCanvas()->getRefreshManager()) {
+			rm->requestRefresh(ViewRefreshManager::RefreshReason::EDGES_TOGGLED, true);
+		} else {
+			m_sceneManager->getCanvas()->Refresh();
+		}
 	}
 }
 
@@ -475,6 +817,7 @@ void EdgeDisplayManager::startAsyncFeatureEdgeGeneration(double featureAngleDeg,
 		// Back to UI thread to apply appearance/attach and refresh
 		if (m_sceneManager && m_sceneManager->getCanvas()) {
 			m_sceneManager->getCanvas()->CallAfter([this, meshParams]() {
+				markDirty(EdgeType::Feature);
 				updateAll(meshParams);
 				// Apply stored appearance parameters after feature edges are generated
 				if (m_flags.showFeatureEdges) {
@@ -482,6 +825,7 @@ void EdgeDisplayManager::startAsyncFeatureEdgeGeneration(double featureAngleDeg,
 				}
 			});
 		} else {
+			markDirty(EdgeType::Feature);
 			updateAll(meshParams);
 			// Apply stored appearance parameters after feature edges are generated
 			if (m_flags.showFeatureEdges) {
@@ -572,6 +916,7 @@ void EdgeDisplayManager::startAsyncOriginalEdgeExtraction(double samplingDensity
 									RenderingEngine* renderingEngine = canvas->getRenderingEngine();
 									if (renderingEngine && renderingEngine->isGLContextValid()) {
 										try {
+											markDirty(EdgeType::Original);
 											updateAll(meshParams);
 											LOG_INF_S("EdgeDisplayManager: Original edge nodes created on main thread (retry)");
 											if (onComplete) onComplete(true, "");
@@ -591,6 +936,7 @@ void EdgeDisplayManager::startAsyncOriginalEdgeExtraction(double samplingDensity
 						try {
 							// Now create Coin3D nodes from cached data on main thread
 							// This is safe because GL context is verified to be valid
+							markDirty(EdgeType::Original);
 							updateAll(meshParams);
 							
 							LOG_INF_S("EdgeDisplayManager: Original edge nodes created on main thread");
@@ -609,6 +955,7 @@ void EdgeDisplayManager::startAsyncOriginalEdgeExtraction(double samplingDensity
 				});
 			} else {
 				// Fallback if canvas not available
+				markDirty(EdgeType::Original);
 				updateAll(meshParams);
 				if (onComplete) {
 					onComplete(true, "");
@@ -667,11 +1014,13 @@ void EdgeDisplayManager::applyFeatureEdgeAppearance(const Quantity_Color& color,
 		g->buildCoinRepresentation();
 
 		if (g->modularEdgeComponent) {
-			g->modularEdgeComponent->edgeFlags = m_flags;
+			g->modularEdgeComponent->edgeFlags = componentFlags();
 			// If feature edge node exists, apply appearance immediately
 			if (g->modularEdgeComponent->getEdgeNode(EdgeType::Feature)) {
 				g->modularEdgeComponent->applyAppearanceToEdgeNode(EdgeType::Feature, color, width, style);
 			}
+			// Batched feature edges move to the batch of the new appearance
+			syncBatchedEdges(g, maskOf(EdgeType::Feature));
 			g->modularEdgeComponent->updateEdgeDisplay(g->getCoinNode());
 		}
 	}
@@ -77,138 +77,105 @@ bool EdgeGenerationService::ensureFeatureEdges(std::shared_ptr<OCCGeometry>& geo
 	return true;
 }
 
-bool EdgeGenerationService::ensureMeshDerivedEdges(std::shared_ptr<OCCGeometry>& geom,
-	const MeshParameters& meshParams,
-	bool needMeshEdges,
-	bool needVerticeNormals,
-	bool needFaceNormals) {
-	if (!geom) return false;
-
-	bool generated = false;
-	bool needMesh = false;
-
-	// Migration completed - always use modular edge component
-	if (!geom->modularEdgeComponent) {
-		geom->modularEdgeComponent = std::make_unique<ModularEdgeComponent>();
-	}
-	if (needMeshEdges && geom->modularEdgeComponent->getEdgeNode(EdgeType::Mesh) == nullptr) needMesh = true;
-	if (needVerticeNormals && geom->modularEdgeComponent->getEdgeNode(EdgeType::VerticeNormal) == nullptr) needMesh = true;
-	if (needFaceNormals && geom->modularEdgeComponent->getEdgeNode(EdgeType::FaceNormal) == nullptr) needMesh = true;
-
-	if (!needMesh) return false;
+TriangleMesh EdgeGenerationService::buildEdgeMesh(const std::shared_ptr<OCCGeometry>& geom, const MeshParameters& meshParams) {
+	if (!geom) return TriangleMesh();
 
-	LOG_INF_S("EdgeGenerationService::ensureMeshDerivedEdges called for '" + geom->getName() + 
-	         "', needMeshEdges=" + std::string(needMeshEdges ? "true" : "false") +
-	         ", needVerticeNormals=" + std::string(needVerticeNormals ? "true" : "false") +
-	         ", needFaceNormals=" + std::string(needFaceNormals ? "true" : "false"));
-	
 	// CRITICAL FIX: For mesh-only geometries (STL, OBJ), use cached mesh instead of converting from shape
 	// This enables mesh edges, vertex normals, and face normals for mesh-only geometries
-	TriangleMesh mesh;
 	if (geom->hasCachedMesh()) {
-		// Use cached mesh for mesh-only geometries
-		mesh = geom->getCachedMesh();
-		LOG_INF_S("EdgeGenerationService: Using cached mesh for '" + geom->getName() + "' (" + 
-		         std::to_string(mesh.vertices.size()) + " vertices, " + 
-		         std::to_string(mesh.triangles.size() / 3) + " triangles)");
-	} else {
-		// Convert from BRep shape for standard geometries
-		LOG_INF_S("EdgeGenerationService: Converting from BRep shape for '" + geom->getName() + "'");
-		auto& manager = RenderingToolkitAPI::getManager();
-		auto processor = manager.getGeometryProcessor("OpenCASCADE");
-		if (!processor) {
-			LOG_ERR_S("EdgeGenerationService: Failed to get OpenCASCADE processor");
-			return false;
-		}
-		mesh = processor->convertToMesh(geom->getShape(), meshParams);
-		LOG_INF_S("EdgeGenerationService: Converted mesh has " + 
-		         std::to_string(mesh.vertices.size()) + " vertices, " + 
-		         std::to_string(mesh.triangles.size() / 3) + " triangles");
+		return geom->getCachedMesh();
 	}
-	
+
+	return buildEdgeMesh(geom->getShape(), meshParams);
+}
+
+TriangleMesh EdgeGenerationService::buildEdgeMesh(const TopoDS_Shape& shape, const MeshParameters& meshParams) {
+	if (shape.IsNull()) return TriangleMesh();
+
+	auto& manager = RenderingToolkitAPI::getManager();
+	auto processor = manager.getGeometryProcessor("OpenCASCADE");
+	if (!processor) {
+		LOG_ERR_S("EdgeGenerationService: Failed to get OpenCASCADE processor");
+		return TriangleMesh();
+	}
+	return processor->convertToMesh(shape, meshParams);
+}
+
+bool EdgeGenerationService::applyMeshDerivedEdges(std::shared_ptr<OCCGeometry>& geom,
+	const TriangleMesh& mesh,
+	bool needMeshEdges,
+	bool needVerticeNormals,
+	bool needFaceNormals,
+	bool force) {
+	if (!geom) return false;
+
 	// Check if mesh is valid
 	if (mesh.vertices.empty() || mesh.triangles.empty()) {
 		LOG_WRN_S("EdgeGenerationService: Empty mesh for '" + geom->getName() + "', cannot generate mesh-derived edges");
 		return false;
 	}
 
+	// Migration completed - always use modular edge component
+	if (!geom->modularEdgeComponent) {
+		geom->modularEdgeComponent = std::make_unique<ModularEdgeComponent>();
+	}
+
 	auto& comp = geom->modularEdgeComponent;
-	if (needMeshEdges && comp->getEdgeNode(EdgeType::Mesh) == nullptr) {
+	bool generated = false;
+	if (needMeshEdges && (force || comp->getEdgeNode(EdgeType::Mesh) == nullptr)) {
+		comp->clearEdgeNode(EdgeType::Mesh);
 		Quantity_Color meshColor(0.0, 0.0, 0.0, Quantity_TOC_RGB);
 		comp->extractMeshEdges(mesh, meshColor, 1.0);
 		generated = true;
 	}
-	if (needVerticeNormals && comp->getEdgeNode(EdgeType::VerticeNormal) == nullptr) {
+	if (needVerticeNormals && (force || comp->getEdgeNode(EdgeType::VerticeNormal) == nullptr)) {
+		comp->clearEdgeNode(EdgeType::VerticeNormal);
 		comp->generateNormalLineNode(mesh, 0.5);
 		generated = true;
 	}
-	if (needFaceNormals && comp->getEdgeNode(EdgeType::FaceNormal) == nullptr) {
+	if (needFaceNormals && (force || comp->getEdgeNode(EdgeType::FaceNormal) == nullptr)) {
+		comp->clearEdgeNode(EdgeType::FaceNormal);
 		comp->generateFaceNormalLineNode(mesh, 0.5);
 		generated = true;
 	}
-
 	return generated;
 }
 
-bool EdgeGenerationService::forceRegenerateMeshDerivedEdges(std::shared_ptr<OCCGeometry>& geom,
+bool EdgeGenerationService::ensureMeshDerivedEdges(std::shared_ptr<OCCGeometry>& geom,
 	const MeshParameters& meshParams,
 	bool needMeshEdges,
 	bool needVerticeNormals,
 	bool needFaceNormals) {
 	if (!geom) return false;
 
-	bool generated = false;
-
-	// CRITICAL FIX: For mesh-only geometries (STL, OBJ), use cached mesh instead of converting from shape
-	TriangleMesh mesh;
-	if (geom->hasCachedMesh()) {
-		// Use cached mesh for mesh-only geometries
-		mesh = geom->getCachedMesh();
-		LOG_INF_S("EdgeGenerationService: Using cached mesh for force regeneration '" + geom->getName() + "'");
-	} else {
-		// Convert from BRep shape for standard geometries
-		auto& manager = RenderingToolkitAPI::getManager();
-		auto processor = manager.getGeometryProcessor("OpenCASCADE");
-		if (!processor) return false;
-		mesh = processor->convertToMesh(geom->getShape(), meshParams);
-	}
-	
-	// Check if mesh is valid
-	if (mesh.vertices.empty() || mesh.triangles.empty()) {
-		LOG_WRN_S("EdgeGenerationService: Empty mesh for force regeneration '" + geom->getName() + "'");
-		return false;
-	}
-
 	// Migration completed - always use modular edge component
 	if (!geom->modularEdgeComponent) {
 		geom->modularEdgeComponent = std::make_unique<ModularEdgeComponent>();
 	}
-
 	auto& comp = geom->modularEdgeComponent;
+	bool needMesh = (needMeshEdges && comp->getEdgeNode(EdgeType::Mesh) == nullptr) ||
+		(needVerticeNormals && comp->getEdgeNode(EdgeType::VerticeNormal) == nullptr) ||
+		(needFaceNormals && comp->getEdgeNode(EdgeType::FaceNormal) == nullptr);
+	if (!needMesh) return false;
 
-	// Force regenerate mesh edges if requested
-	if (needMeshEdges) {
-		comp->clearEdgeNode(EdgeType::Mesh);
-		Quantity_Color meshColor(0.0, 0.0, 0.0, Quantity_TOC_RGB);
-		comp->extractMeshEdges(mesh, meshColor, 1.0);
-		generated = true;
-	}
+	LOG_INF_S("EdgeGenerationService::ensureMeshDerivedEdges called for '" + geom->getName() + 
+	         "', needMeshEdges=" + std::string(needMeshEdges ? "true" : "false") +
+	         ", needVerticeNormals=" + std::string(needVerticeNormals ? "true" : "false") +
+	         ", needFaceNormals=" + std::string(needFaceNormals ? "true" : "false"));
 
-	// Force regenerate normal lines if requested
-	if (needVerticeNormals) {
-		comp->clearEdgeNode(EdgeType::VerticeNormal);
-		comp->generateNormalLineNode(mesh, 0.5);
-		generated = true;
-	}
+	TriangleMesh mesh = buildEdgeMesh(geom, meshParams);
+	return applyMeshDerivedEdges(geom, mesh, needMeshEdges, needVerticeNormals, needFaceNormals, false);
+}
 
-	// Force regenerate face normal lines if requested
-	if (needFaceNormals) {
-		comp->clearEdgeNode(EdgeType::FaceNormal);
-		comp->generateFaceNormalLineNode(mesh, 0.5);
-		generated = true;
-	}
+bool EdgeGenerationService::forceRegenerateMeshDerivedEdges(std::shared_ptr<OCCGeometry>& geom,
+	const MeshParameters& meshParams,
+	bool needMeshEdges,
+	bool needVerticeNormals,
+	bool needFaceNormals) {
+	if (!geom) return false;
 
-	return generated;
+	TriangleMesh mesh = buildEdgeMesh(geom, meshParams);
+	return applyMeshDerivedEdges(geom, mesh, needMeshEdges, needVerticeNormals, needFaceNormals, true);
 }
 
 void EdgeGenerationService::computeIntersectionsAsync(
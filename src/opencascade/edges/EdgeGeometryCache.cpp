@@ -1,178 +1,306 @@
 #include "edges/EdgeGeometryCache.h"
 #include <BRep_Tool.hxx>
+#include <BRepTools.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 #include <functional>
 #include <string>
 #include "logger/Logger.h"
 #include <sstream>
+#include <iomanip>
+#include <fstream>
+#include <filesystem>
+#include <thread>
+#include <cmath>
+#include <cstring>
 #include <algorithm>
 
-std::vector<gp_Pnt> EdgeGeometryCache::getOrCompute(
-    const std::string& key,
-    std::function<std::vector<gp_Pnt>()> computeFunc)
-{
-    // First, check if key exists in cache (with lock)
-    bool cacheHit = false;
-    std::vector<gp_Pnt> cachedPoints;
-    size_t pointsSize = 0;
+namespace {
+    constexpr size_t kDefaultMaxMemoryBytes = 500ull * 1024 * 1024;
 
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        auto it = m_cache.find(key);
-        if (it != m_cache.end()) {
-            // Cache hit - update access time and get cached data
-            it->second.lastAccess = std::chrono::steady_clock::now();
-            m_hitCount++;
-            cacheHit = true;
-            cachedPoints = it->second.points;
-            pointsSize = cachedPoints.size();
-        } else {
-            // Cache miss - increment counter
-            m_missCount++;
+    // On-disk entry layout: magic, version, kind, key, shape hash, tolerance,
+    // point count, then x/y/z doubles per point
+    constexpr char kDiskMagic[4] = { 'E', 'G', 'C', '1' };
+    constexpr uint32_t kDiskVersion = 1;
+    constexpr const char* kDiskExtension = ".egc";
+
+    // Memoized shape hashes: distinct TShapes, and located instances of each
+    constexpr size_t kMaxHashedShapes = 1024;
+    constexpr size_t kMaxHashedLocations = 16;
+
+    constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+    constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+    // FNV-1a; unlike std::hash its value is fixed, so it can name files
+    uint64_t fnv1a(uint64_t hash, const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= kFnvPrime;
         }
+        return hash;
     }
-    // Lock is released here
 
-    if (cacheHit) {
-        return cachedPoints;
+    uint64_t mixInteger(uint64_t hash, int64_t value) {
+        return fnv1a(hash, &value, sizeof(value));
     }
 
-    // Compute new data WITHOUT holding the lock
-    // This prevents recursive locking if computeFunc accesses the cache
-    auto points = computeFunc();
+    // Round to 1e-7 so reading the same file twice gives the same hash
+    uint64_t mixReal(uint64_t hash, double value) {
+        if (std::abs(value) < 1e11) {
+            return mixInteger(hash, static_cast<int64_t>(std::llround(value * 1e7)));
+        }
+        int64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return mixInteger(hash, bits);
+    }
 
-    // Re-acquire lock to insert into cache
-    size_t cacheSize = 0;
-    bool insertedNew = false;
+    uint64_t mixPoint(uint64_t hash, const gp_Pnt& point) {
+        hash = mixReal(hash, point.X());
+        hash = mixReal(hash, point.Y());
+        return mixReal(hash, point.Z());
+    }
 
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
+    template <typename T>
+    void writeValue(std::ofstream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
 
-        // Double-check: another thread might have computed and cached it while we were computing
-        auto it = m_cache.find(key);
-        if (it != m_cache.end()) {
-            // Another thread already cached it, use that version
+    template <typename T>
+    bool readValue(std::ifstream& in, T& value) {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
+
+EdgeGeometryCache::EdgeGeometryCache()
+    : m_maxMemoryBytes(kDefaultMaxMemoryBytes)
+    , m_hitCount(0)
+    , m_missCount(0)
+    , m_totalMemoryUsage(0)
+    , m_intersectionHitCount(0)
+    , m_intersectionMissCount(0)
+    , m_evictionCount(0)
+    , m_diskHitCount(0) {
+}
+
+std::string EdgeGeometryCache::internalKey(EntryKind kind, const std::string& key) {
+    return (kind == EntryKind::Edges ? "e:" : "i:") + key;
+}
+
+EdgeGeometryCache::Shard& EdgeGeometryCache::shardFor(const std::string& internalKey) {
+    return m_shards[std::hash<std::string>{}(internalKey) % kShardCount];
+}
+
+EdgeGeometryCache::Entry* EdgeGeometryCache::findLocked(Shard& shard, const std::string& internalKey) {
+    auto it = shard.entries.find(internalKey);
+    if (it == shard.entries.end()) {
+        return nullptr;
+    }
+    touchLocked(shard, it->second);
+    return &it->second;
+}
+
+void EdgeGeometryCache::touchLocked(Shard& shard, Entry& entry) {
+    // Move to the front of the LRU order
+    shard.lru.splice(shard.lru.begin(), shard.lru, entry.lruPosition);
+    entry.lastAccess = std::chrono::steady_clock::now();
+}
+
+void EdgeGeometryCache::insertLocked(Shard& shard, const std::string& internalKey, Entry entry) {
+    shard.lru.push_front(internalKey);
+    entry.lruPosition = shard.lru.begin();
+    entry.lastAccess = std::chrono::steady_clock::now();
+    shard.memoryUsage += entry.memoryUsage;
+    m_totalMemoryUsage += entry.memoryUsage;
+    shard.entries.emplace(internalKey, std::move(entry));
+}
+
+void EdgeGeometryCache::eraseLocked(Shard& shard, std::unordered_map<std::string, Entry>::iterator it) {
+    shard.lru.erase(it->second.lruPosition);
+    shard.memoryUsage -= it->second.memoryUsage;
+    m_totalMemoryUsage -= it->second.memoryUsage;
+    shard.entries.erase(it);
+}
+
+void EdgeGeometryCache::trimLocked(Shard& shard, size_t incomingBytes) {
+    const size_t shardBudget = m_maxMemoryBytes.load(std::memory_order_relaxed) / kShardCount;
+    while (!shard.lru.empty() && shard.memoryUsage + incomingBytes > shardBudget) {
+        eraseLocked(shard, shard.entries.find(shard.lru.back()));
+        m_evictionCount++;
+    }
+}
+
+EdgeGeometryCache::PointsPtr EdgeGeometryCache::lookup(
+    EntryKind kind,
+    const std::string& key,
+    const double* tolerance,
+    std::atomic<size_t>& hits,
+    std::atomic<size_t>& misses)
+{
+    const std::string storedKey = internalKey(kind, key);
+    Shard& shard = shardFor(storedKey);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(storedKey);
+    if (it != shard.entries.end()) {
+        // Verify tolerance matches (important for precision)
+        if (tolerance && std::abs(it->second.tolerance - *tolerance) >= 1e-9) {
+            eraseLocked(shard, it);
+        } else {
+            hits++;
+            touchLocked(shard, it->second);
             return it->second.points;
         }
+    }
+    misses++;
+    return nullptr;
+}
 
-        // Check memory usage before inserting
-        size_t estimatedMemory = estimateMemoryUsage(points);
-        if (shouldEvictForNewEntry(estimatedMemory)) {
-            evictLRU();
+EdgeGeometryCache::PointsPtr EdgeGeometryCache::insert(
+    EntryKind kind,
+    const std::string& key,
+    std::vector<gp_Pnt> points,
+    size_t shapeHash,
+    double tolerance,
+    double computationTime,
+    bool replace)
+{
+    Entry entry;
+    entry.memoryUsage = estimateMemoryUsage(points);
+    entry.points = std::make_shared<const std::vector<gp_Pnt>>(std::move(points));
+    entry.shapeHash = shapeHash;
+    entry.tolerance = tolerance;
+    entry.computationTime = computationTime;
+    PointsPtr result = entry.points;
+
+    const std::string storedKey = internalKey(kind, key);
+    Shard& shard = shardFor(storedKey);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(storedKey);
+    if (it != shard.entries.end()) {
+        if (!replace) {
+            // Another thread cached it while we were computing, use that version
+            touchLocked(shard, it->second);
+            return it->second.points;
         }
+        eraseLocked(shard, it);
+    }
 
-        CacheEntry entry;
-        entry.points = points;
-        entry.shapeHash = 0;
-        entry.lastAccess = std::chrono::steady_clock::now();
-        entry.memoryUsage = estimatedMemory;
+    trimLocked(shard, entry.memoryUsage);
+    insertLocked(shard, storedKey, std::move(entry));
+    return result;
+}
 
-        m_cache[key] = std::move(entry);
-        m_totalMemoryUsage += estimatedMemory;
-        cacheSize = m_cache.size();
-        insertedNew = true;
+std::vector<gp_Pnt> EdgeGeometryCache::getOrCompute(
+    const std::string& key,
+    std::function<std::vector<gp_Pnt>()> computeFunc)
+{
+    // Points are shared, so the copy handed back is made outside the shard lock
+    if (PointsPtr cached = lookup(EntryKind::Edges, key, nullptr, m_hitCount, m_missCount)) {
+        return *cached;
     }
 
-    return points;
+    size_t shapeHash = 0;
+    double storedTolerance = 0.0;
+    if (PointsPtr stored = loadFromDisk(EntryKind::Edges, key, nullptr, shapeHash, storedTolerance)) {
+        m_diskHitCount++;
+        return *insert(EntryKind::Edges, key, *stored, shapeHash, storedTolerance, 0.0, false);
+    }
+
+    // Compute new data WITHOUT holding a lock
+    // This prevents recursive locking if computeFunc accesses the cache
+    auto points = computeFunc();
+    saveToDisk(EntryKind::Edges, key, points, 0, 0.0);
+
+    return *insert(EntryKind::Edges, key, std::move(points), 0, 0.0, 0.0, false);
 }
 
 void EdgeGeometryCache::invalidate(const std::string& key) {
-    bool found = false;
-    size_t freedMemory = 0;
+    const std::string storedKey = internalKey(EntryKind::Edges, key);
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto it = m_cache.find(key);
-        if (it != m_cache.end()) {
-            freedMemory = it->second.memoryUsage;
-            m_cache.erase(it);
-            m_totalMemoryUsage -= freedMemory;
-            found = true;
+        Shard& shard = shardFor(storedKey);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(storedKey);
+        if (it != shard.entries.end()) {
+            eraseLocked(shard, it);
         }
     }
-
-    if (found) {
-        // Cache invalidated
-    }
+    removeFromDisk(storedKey);
 }
 
 void EdgeGeometryCache::clear() {
-    size_t oldSize = 0;
-    size_t freedMemory = 0;
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        oldSize = m_cache.size();
-        freedMemory = m_totalMemoryUsage;
-        m_cache.clear();
-        m_totalMemoryUsage = 0;
-        m_hitCount = 0;
-        m_missCount = 0;
+    for (Shard& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        m_totalMemoryUsage -= shard.memoryUsage;
+        shard.entries.clear();
+        shard.lru.clear();
+        shard.memoryUsage = 0;
     }
+    m_hitCount = 0;
+    m_missCount = 0;
+    m_intersectionHitCount = 0;
+    m_intersectionMissCount = 0;
+    m_evictionCount = 0;
+    m_diskHitCount = 0;
+
+    std::lock_guard<std::mutex> lock(m_shapeHashMutex);
+    m_shapeHashes.clear();
+    m_shapeHashOrder.clear();
 }
 
 void EdgeGeometryCache::evictOldEntries(std::chrono::seconds maxAge) {
-    size_t evicted = 0;
-    size_t freedMemory = 0;
-    size_t remaining = 0;
-
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto now = std::chrono::steady_clock::now();
-
-        for (auto it = m_cache.begin(); it != m_cache.end();) {
-            if (now - it->second.lastAccess > maxAge) {
-                freedMemory += it->second.memoryUsage;
-                it = m_cache.erase(it);
-                evicted++;
-            } else {
-                ++it;
+    auto now = std::chrono::steady_clock::now();
+    for (Shard& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        // The LRU list is ordered by access time, so stale entries sit at the back
+        while (!shard.lru.empty()) {
+            auto it = shard.entries.find(shard.lru.back());
+            if (now - it->second.lastAccess <= maxAge) {
+                break;
             }
+            eraseLocked(shard, it);
+            m_evictionCount++;
         }
+    }
+}
+
+double EdgeGeometryCache::getHitRate() const {
+    const size_t hits = getHitCount() + getIntersectionHitCount();
+    const size_t total = hits + getMissCount() + getIntersectionMissCount();
+    return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
 
-        m_totalMemoryUsage -= freedMemory;
-        remaining = m_cache.size();
+size_t EdgeGeometryCache::getCacheSize() const {
+    size_t size = 0;
+    for (const Shard& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size += shard.entries.size();
     }
+    return size;
+}
 
-    if (evicted > 0) {
-        // Cache entries evicted
+void EdgeGeometryCache::setMaxMemoryBytes(size_t maxBytes) {
+    m_maxMemoryBytes = maxBytes;
+    for (Shard& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        trimLocked(shard, 0);
     }
 }
 
-size_t EdgeGeometryCache::estimateMemoryUsage(const std::vector<gp_Pnt>& points) {
+size_t EdgeGeometryCache::estimateMemoryUsage(const std::vector<gp_Pnt>& points) const {
     // Estimate memory usage: vector overhead + point data
     // Each gp_Pnt has 3 doubles (8 bytes each) = 24 bytes
     // Vector has some overhead for size/capacity
     return sizeof(std::vector<gp_Pnt>) + points.capacity() * sizeof(gp_Pnt) + 32; // Add some buffer
 }
 
-bool EdgeGeometryCache::shouldEvictForNewEntry(size_t newEntrySize) {
-    // Simple memory limit check - can be made configurable
-    const size_t maxMemoryMB = 500; // 500MB limit
-    const size_t maxMemoryBytes = maxMemoryMB * 1024 * 1024;
-
-    return (m_totalMemoryUsage + newEntrySize) > maxMemoryBytes;
-}
-
-void EdgeGeometryCache::evictLRU() {
-    if (m_cache.empty()) return;
-
-    // Find least recently used entry
-    auto lruIt = m_cache.begin();
-
-    for (auto it = m_cache.begin(); it != m_cache.end(); ++it) {
-        if (it->second.lastAccess < lruIt->second.lastAccess) {
-            lruIt = it;
-        }
-    }
-
-    if (lruIt != m_cache.end()) {
-        size_t freedMemory = lruIt->second.memoryUsage;
-        m_totalMemoryUsage -= freedMemory;
-        std::string key = lruIt->first;
-        m_cache.erase(lruIt);
-    }
-}
-
 // Intersection cache implementation
 std::vector<gp_Pnt> EdgeGeometryCache::getOrComputeIntersections(
     const std::string& key,
@@ -181,42 +309,20 @@ std::vector<gp_Pnt> EdgeGeometryCache::getOrComputeIntersections(
     double tolerance)
 {
     // Check cache first
-    bool cacheHit = false;
-    std::vector<gp_Pnt> cachedPoints;
-    size_t pointsSize = 0;
-    double cachedComputationTime = 0.0;
-
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        auto it = m_intersectionCache.find(key);
-        if (it != m_intersectionCache.end()) {
-            // Verify tolerance matches (important for precision)
-            if (std::abs(it->second.tolerance - tolerance) < 1e-9) {
-                it->second.lastAccess = std::chrono::steady_clock::now();
-                m_intersectionHitCount++;
-                cacheHit = true;
-                cachedPoints = it->second.intersectionPoints;
-                pointsSize = cachedPoints.size();
-                cachedComputationTime = it->second.computationTime;
-                LOG_INF_S("IntersectionCache: Found entry for key=" + key + 
-                         ", shapeHash=" + std::to_string(shapeHash) + 
-                         ", tolerance=" + std::to_string(tolerance));
-            }
-            else {
-                // Tolerance mismatch - invalidate and recompute
-                m_totalMemoryUsage -= it->second.memoryUsage;
-                m_intersectionCache.erase(it);
-                m_intersectionMissCount++;
-            }
-        }
-        else {
-            m_intersectionMissCount++;
-        }
+    if (PointsPtr cached = lookup(EntryKind::Intersections, key, &tolerance,
+                                  m_intersectionHitCount, m_intersectionMissCount)) {
+        LOG_INF_S("IntersectionCache: Found entry for key=" + key +
+                 ", shapeHash=" + std::to_string(shapeHash) +
+                 ", tolerance=" + std::to_string(tolerance));
+        return *cached;
     }
 
-    if (cacheHit) {
-        return cachedPoints;
+    size_t storedShapeHash = 0;
+    double storedTolerance = 0.0;
+    if (PointsPtr stored = loadFromDisk(EntryKind::Intersections, key, &tolerance, storedShapeHash, storedTolerance)) {
+        m_diskHitCount++;
+        LOG_INF_S("IntersectionCache: Loaded entry for key=" + key + " from disk");
+        return *insert(EntryKind::Intersections, key, *stored, shapeHash, tolerance, 0.0, false);
     }
 
     // Compute with timing
@@ -225,90 +331,347 @@ std::vector<gp_Pnt> EdgeGeometryCache::getOrComputeIntersections(
     auto endTime = std::chrono::high_resolution_clock::now();
     double computationTime = std::chrono::duration<double>(endTime - startTime).count();
 
-    // Cache the result
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        // Double-check
-        auto it = m_intersectionCache.find(key);
-        if (it != m_intersectionCache.end()) {
-            return it->second.intersectionPoints;
-        }
-
-        IntersectionCacheEntry entry;
-        entry.intersectionPoints = points;
-        entry.shapeHash = shapeHash;
-        entry.tolerance = tolerance;
-        entry.lastAccess = std::chrono::steady_clock::now();
-        entry.memoryUsage = estimateMemoryUsage(points);
-        entry.computationTime = computationTime;
-
-        m_intersectionCache[key] = std::move(entry);
-        m_totalMemoryUsage += entry.memoryUsage;
-    }
-
-    return points;
+    saveToDisk(EntryKind::Intersections, key, points, shapeHash, tolerance);
+    return *insert(EntryKind::Intersections, key, std::move(points), shapeHash, tolerance, computationTime, false);
 }
 
 std::optional<std::vector<gp_Pnt>> EdgeGeometryCache::tryGetCached(const std::string& key) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    auto it = m_intersectionCache.find(key);
-    if (it != m_intersectionCache.end()) {
-        m_intersectionHitCount++;
-        return it->second.intersectionPoints;
-    }
-    
-    m_intersectionMissCount++;
+    if (PointsPtr cached = lookup(EntryKind::Intersections, key, nullptr,
+                                  m_intersectionHitCount, m_intersectionMissCount)) {
+        return *cached;
+    }
+
+    size_t shapeHash = 0;
+    double tolerance = 0.0;
+    if (PointsPtr stored = loadFromDisk(EntryKind::Intersections, key, nullptr, shapeHash, tolerance)) {
+        m_diskHitCount++;
+        return *insert(EntryKind::Intersections, key, *stored, shapeHash, tolerance, 0.0, false);
+    }
     return std::nullopt;
 }
 
 void EdgeGeometryCache::storeCached(const std::string& key, const std::vector<gp_Pnt>& points,
                                    size_t shapeHash, double tolerance) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    IntersectionCacheEntry entry;
-    entry.intersectionPoints = points;
-    entry.shapeHash = shapeHash;
-    entry.tolerance = tolerance;
-    entry.computationTime = 0.0;
-    entry.memoryUsage = estimateMemoryUsage(points);
-    
-    m_intersectionCache[key] = entry;
-    m_totalMemoryUsage += entry.memoryUsage;
-    
+    insert(EntryKind::Intersections, key, points, shapeHash, tolerance, 0.0, true);
+    saveToDisk(EntryKind::Intersections, key, points, shapeHash, tolerance);
+
     LOG_INF_S("IntersectionCache STORED: " + key + " (" + std::to_string(points.size()) + " points)");
 }
 
 void EdgeGeometryCache::invalidateIntersections(size_t shapeHash) {
-    size_t removedCount = 0;
-    size_t freedMemory = 0;
+    // Files on disk are left alone: their keys carry the shape's content hash,
+    // so a changed shape never looks them up again
+    const std::string prefix = internalKey(EntryKind::Intersections, "");
+    for (Shard& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+            auto next = std::next(it);
+            if (it->second.shapeHash == shapeHash && it->first.compare(0, prefix.size(), prefix) == 0) {
+                eraseLocked(shard, it);
+            }
+            it = next;
+        }
+    }
+}
 
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        for (auto it = m_intersectionCache.begin(); it != m_intersectionCache.end();) {
-            if (it->second.shapeHash == shapeHash) {
-                freedMemory += it->second.memoryUsage;
-                m_totalMemoryUsage -= it->second.memoryUsage;
-                it = m_intersectionCache.erase(it);
-                removedCount++;
+size_t EdgeGeometryCache::computeShapeHash(const TopoDS_Shape& shape) {
+    if (shape.IsNull()) {
+        return 0;
+    }
+
+    TopTools_IndexedMapOfShape vertices;
+    TopTools_IndexedMapOfShape edges;
+    TopTools_IndexedMapOfShape faces;
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertices);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+    TopExp::MapShapes(shape, TopAbs_FACE, faces);
+
+    uint64_t hash = kFnvOffset;
+    hash = mixInteger(hash, vertices.Extent());
+    hash = mixInteger(hash, edges.Extent());
+    hash = mixInteger(hash, faces.Extent());
+    for (int i = 1; i <= vertices.Extent(); ++i) {
+        hash = mixPoint(hash, BRep_Tool::Pnt(TopoDS::Vertex(vertices(i))));
+    }
+
+    // Curves are evaluated in parallel, then combined in map order
+    const int edgeCount = edges.Extent();
+    std::vector<uint64_t> edgeHashes(edgeCount, kFnvOffset);
+    tbb::parallel_for(tbb::blocked_range<int>(0, edgeCount, 64),
+        [&](const tbb::blocked_range<int>& range) {
+            for (int i = range.begin(); i != range.end(); ++i) {
+                Standard_Real first, last;
+                Handle(Geom_Curve) curve = BRep_Tool::Curve(TopoDS::Edge(edges(i + 1)), first, last);
+                if (curve.IsNull()) continue;
+
+                uint64_t edgeHash = kFnvOffset;
+                const char* typeName = curve->DynamicType()->Name();
+                edgeHash = fnv1a(edgeHash, typeName, std::strlen(typeName));
+                edgeHash = mixReal(edgeHash, first);
+                edgeHash = mixReal(edgeHash, last);
+                try {
+                    edgeHash = mixPoint(edgeHash, curve->Value((first + last) / 2.0));
+                } catch (...) {
+                }
+                edgeHashes[i] = edgeHash;
             }
-            else {
-                ++it;
+        });
+    for (uint64_t edgeHash : edgeHashes) {
+        hash = mixInteger(hash, static_cast<int64_t>(edgeHash));
+    }
+
+    // Faces: surface type, parameter box and a sample point, plus orientation, so a
+    // reversed or re-fitted face with unchanged edges still gives a different hash
+    const int faceCount = faces.Extent();
+    std::vector<uint64_t> faceHashes(faceCount, kFnvOffset);
+    tbb::parallel_for(tbb::blocked_range<int>(0, faceCount, 64),
+        [&](const tbb::blocked_range<int>& range) {
+            for (int i = range.begin(); i != range.end(); ++i) {
+                const TopoDS_Face& face = TopoDS::Face(faces(i + 1));
+                uint64_t faceHash = mixInteger(kFnvOffset, static_cast<int64_t>(face.Orientation()));
+                Handle(Geom_Surface) surface = BRep_Tool::Surface(face);
+                if (!surface.IsNull()) {
+                    const char* typeName = surface->DynamicType()->Name();
+                    faceHash = fnv1a(faceHash, typeName, std::strlen(typeName));
+                    try {
+                        Standard_Real uMin, uMax, vMin, vMax;
+                        BRepTools::UVBounds(face, uMin, uMax, vMin, vMax);
+                        faceHash = mixReal(faceHash, uMin);
+                        faceHash = mixReal(faceHash, uMax);
+                        faceHash = mixReal(faceHash, vMin);
+                        faceHash = mixReal(faceHash, vMax);
+                        faceHash = mixPoint(faceHash, surface->Value((uMin + uMax) / 2.0, (vMin + vMax) / 2.0));
+                    } catch (...) {
+                    }
+                }
+                faceHashes[i] = faceHash;
+            }
+        });
+    for (uint64_t faceHash : faceHashes) {
+        hash = mixInteger(hash, static_cast<int64_t>(faceHash));
+    }
+
+    return static_cast<size_t>(hash);
+}
+
+size_t EdgeGeometryCache::getShapeHash(const TopoDS_Shape& shape) {
+    if (shape.IsNull()) {
+        return 0;
+    }
+
+    const TopoDS_TShape* key = shape.TShape().get();
+    {
+        std::lock_guard<std::mutex> lock(m_shapeHashMutex);
+        auto it = m_shapeHashes.find(key);
+        if (it != m_shapeHashes.end()) {
+            for (const HashedShape& hashed : it->second) {
+                if (hashed.shape.IsEqual(shape)) {
+                    return hashed.hash;
+                }
             }
         }
     }
 
-    if (removedCount > 0) {
-        // Cache entries invalidated
+    // Hash outside the lock so other shapes aren't held up
+    const size_t hash = computeShapeHash(shape);
+
+    std::lock_guard<std::mutex> lock(m_shapeHashMutex);
+    auto it = m_shapeHashes.find(key);
+    if (it == m_shapeHashes.end()) {
+        it = m_shapeHashes.emplace(key, std::vector<HashedShape>()).first;
+        m_shapeHashOrder.push_back(key);
+    }
+    std::vector<HashedShape>& located = it->second;
+    if (located.size() >= kMaxHashedLocations) {
+        located.erase(located.begin());
+    }
+    located.push_back({ shape, hash });
+    while (m_shapeHashOrder.size() > kMaxHashedShapes) {
+        m_shapeHashes.erase(m_shapeHashOrder.front());
+        m_shapeHashOrder.pop_front();
+    }
+    return hash;
+}
+
+bool EdgeGeometryCache::setPersistentDirectory(const std::string& directory) {
+    if (!directory.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+        if (ec) {
+            LOG_ERR_S("EdgeGeometryCache: Cannot create persistent directory " + directory + ": " + ec.message());
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_persistenceMutex);
+    m_persistentDirectory = directory;
+    if (!directory.empty()) {
+        LOG_INF_S("EdgeGeometryCache: Persisting results to " + directory);
+    }
+    return true;
+}
+
+std::string EdgeGeometryCache::getPersistentDirectory() const {
+    std::lock_guard<std::mutex> lock(m_persistenceMutex);
+    return m_persistentDirectory;
+}
+
+void EdgeGeometryCache::clearPersistentStore() {
+    const std::string directory = getPersistentDirectory();
+    if (directory.empty()) {
+        return;
+    }
+
+    std::error_code ec;
+    size_t removed = 0;
+    for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() == kDiskExtension && std::filesystem::remove(it->path(), ec)) {
+            removed++;
+        }
+    }
+    LOG_INF_S("EdgeGeometryCache: Removed " + std::to_string(removed) + " persisted entries");
+}
+
+std::string EdgeGeometryCache::diskPathFor(const std::string& internalKey) const {
+    const std::string directory = getPersistentDirectory();
+    if (directory.empty()) {
+        return std::string();
+    }
+
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0')
+         << fnv1a(kFnvOffset, internalKey.data(), internalKey.size()) << kDiskExtension;
+    return (std::filesystem::path(directory) / name.str()).string();
+}
+
+EdgeGeometryCache::PointsPtr EdgeGeometryCache::loadFromDisk(
+    EntryKind kind,
+    const std::string& key,
+    const double* tolerance,
+    size_t& shapeHash,
+    double& storedTolerance) const
+{
+    const std::string storedKey = internalKey(kind, key);
+    const std::string path = diskPathFor(storedKey);
+    if (path.empty()) {
+        return nullptr;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return nullptr;
+    }
+
+    char magic[sizeof(kDiskMagic)];
+    uint32_t version = 0;
+    uint8_t storedKind = 0;
+    uint32_t keyLength = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, kDiskMagic, sizeof(kDiskMagic)) != 0 ||
+        !readValue(in, version) || version != kDiskVersion ||
+        !readValue(in, storedKind) || storedKind != static_cast<uint8_t>(kind) ||
+        !readValue(in, keyLength) || keyLength != storedKey.size()) {
+        return nullptr;
+    }
+
+    // The file name is only a hash; the stored key rules out collisions
+    std::string fileKey(keyLength, '\0');
+    uint64_t fileShapeHash = 0;
+    uint64_t pointCount = 0;
+    if (!in.read(&fileKey[0], keyLength) || fileKey != storedKey ||
+        !readValue(in, fileShapeHash) || !readValue(in, storedTolerance) ||
+        !readValue(in, pointCount)) {
+        return nullptr;
+    }
+    if (tolerance && std::abs(storedTolerance - *tolerance) >= 1e-9) {
+        return nullptr;
+    }
+
+    std::vector<double> coordinates;
+    try {
+        coordinates.resize(pointCount * 3);
+    } catch (const std::exception&) {
+        LOG_WRN_S("EdgeGeometryCache: Ignoring corrupt persisted entry " + path);
+        return nullptr;
+    }
+    if (!in.read(reinterpret_cast<char*>(coordinates.data()),
+                 static_cast<std::streamsize>(coordinates.size() * sizeof(double)))) {
+        LOG_WRN_S("EdgeGeometryCache: Ignoring truncated persisted entry " + path);
+        return nullptr;
+    }
+
+    std::vector<gp_Pnt> points;
+    points.reserve(pointCount);
+    for (size_t i = 0; i < pointCount; ++i) {
+        points.emplace_back(coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2]);
+    }
+    shapeHash = static_cast<size_t>(fileShapeHash);
+    return std::make_shared<const std::vector<gp_Pnt>>(std::move(points));
+}
+
+void EdgeGeometryCache::saveToDisk(
+    EntryKind kind,
+    const std::string& key,
+    const std::vector<gp_Pnt>& points,
+    size_t shapeHash,
+    double tolerance) const
+{
+    const std::string storedKey = internalKey(kind, key);
+    const std::string path = diskPathFor(storedKey);
+    if (path.empty()) {
+        return;
+    }
+
+    // Write to a per-thread temporary and rename, so readers never see a partial file
+    const std::string tempPath = path + "." +
+        std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            LOG_WRN_S("EdgeGeometryCache: Cannot write " + tempPath);
+            return;
+        }
+
+        out.write(kDiskMagic, sizeof(kDiskMagic));
+        writeValue(out, kDiskVersion);
+        writeValue(out, static_cast<uint8_t>(kind));
+        writeValue(out, static_cast<uint32_t>(storedKey.size()));
+        out.write(storedKey.data(), static_cast<std::streamsize>(storedKey.size()));
+        writeValue(out, static_cast<uint64_t>(shapeHash));
+        writeValue(out, tolerance);
+        writeValue(out, static_cast<uint64_t>(points.size()));
+        for (const gp_Pnt& point : points) {
+            const double coordinates[3] = { point.X(), point.Y(), point.Z() };
+            out.write(reinterpret_cast<const char*>(coordinates), sizeof(coordinates));
+        }
+        if (!out) {
+            LOG_WRN_S("EdgeGeometryCache: Failed writing " + tempPath);
+            out.close();
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        LOG_WRN_S("EdgeGeometryCache: Cannot store " + path + ": " + ec.message());
+        std::filesystem::remove(tempPath, ec);
+    }
+}
+
+void EdgeGeometryCache::removeFromDisk(const std::string& internalKey) const {
+    const std::string path = diskPathFor(internalKey);
+    if (!path.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
     }
 }
 
 size_t EdgeGeometryCache::computeEdgeHash(const TopoDS_Edge& edge) {
     // Use TShape pointer as primary hash (unique per edge instance)
     size_t hash = std::hash<const void*>{}(edge.TShape().get());
-    
+
     // Add curve type and parameter range for better change detection
     Standard_Real first, last;
     Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, first, last);
@@ -319,7 +682,7 @@ size_t EdgeGeometryCache::computeEdgeHash(const TopoDS_Edge& edge) {
         hash ^= std::hash<double>{}(first);
         hash ^= std::hash<double>{}(last);
     }
-    
+
     return hash;
 }
 
@@ -328,74 +691,74 @@ EdgeGeometryCache::IncrementalUpdateResult EdgeGeometryCache::updateIntersection
     const std::vector<TopoDS_Edge>& currentEdges,
     double tolerance,
     std::function<std::vector<gp_Pnt>(const std::vector<size_t>&)> computeFunc) {
-    
+
     IncrementalUpdateResult result;
     std::vector<size_t> changedEdgeIndices;
     bool needFullComputation = false;
-    
+
+    // Compute hashes for current edges before taking the shard lock
+    std::vector<size_t> currentHashes;
+    currentHashes.reserve(currentEdges.size());
+    for (const auto& edge : currentEdges) {
+        currentHashes.push_back(computeEdgeHash(edge));
+    }
+
     // Lock scope for cache access
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        auto it = m_intersectionCache.find(key);
-        if (it == m_intersectionCache.end()) {
+        const std::string storedKey = internalKey(EntryKind::Intersections, key);
+        Shard& shard = shardFor(storedKey);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        Entry* entry = findLocked(shard, storedKey);
+        if (!entry) {
             // Cache miss - need full computation
             LOG_INF_S("IncrementalUpdate: Cache miss for " + key + ", full computation needed");
             needFullComputation = true;
         } else {
-            auto& entry = it->second;
-            
             // Check tolerance match
-            if (std::abs(entry.tolerance - tolerance) > 1e-9) {
+            if (std::abs(entry->tolerance - tolerance) > 1e-9) {
                 LOG_INF_S("IncrementalUpdate: Tolerance mismatch, full recomputation");
                 needFullComputation = true;
             } else {
                 // Check which edges changed
                 std::vector<bool> edgeChanged(currentEdges.size(), true);
-                
-                // Compute hashes for current edges
-                std::vector<size_t> currentHashes;
-                currentHashes.reserve(currentEdges.size());
-                for (const auto& edge : currentEdges) {
-                    currentHashes.push_back(computeEdgeHash(edge));
-                }
-                
+
                 // Compare with cached hashes
-                if (currentEdges.size() != entry.edgeHashes.size()) {
+                if (currentEdges.size() != entry->edgeHashes.size()) {
                     needFullComputation = true;
                 } else {
                     for (size_t i = 0; i < currentEdges.size(); ++i) {
-                        if (currentHashes[i] == entry.edgeHashes[i]) {
+                        if (currentHashes[i] == entry->edgeHashes[i]) {
                             edgeChanged[i] = false;
                         } else {
                             changedEdgeIndices.push_back(i);
                         }
                     }
-                    
+
                     // Keep valid intersections (both edges unchanged)
-                    for (const auto& ei : entry.edgeIntersections) {
+                    for (const auto& ei : entry->edgeIntersections) {
                         if (ei.edge1Index < edgeChanged.size() && ei.edge2Index < edgeChanged.size()) {
                             if (!edgeChanged[ei.edge1Index] && !edgeChanged[ei.edge2Index]) {
                                 result.validIntersections.push_back(ei.intersectionPoint);
                             }
                         }
                     }
-                    
+
                     // If no edges changed, return cached results
                     if (changedEdgeIndices.empty()) {
-                        LOG_INF_S("IncrementalUpdate: No edges changed, using " + 
+                        LOG_INF_S("IncrementalUpdate: No edges changed, using " +
                                   std::to_string(result.validIntersections.size()) + " cached intersections");
                         return result;
                     }
-                    
-                    LOG_INF_S("IncrementalUpdate: " + std::to_string(changedEdgeIndices.size()) + 
-                              " edges changed, " + std::to_string(result.validIntersections.size()) + 
+
+                    LOG_INF_S("IncrementalUpdate: " + std::to_string(changedEdgeIndices.size()) +
+                              " edges changed, " + std::to_string(result.validIntersections.size()) +
                               " intersections still valid");
                 }
             }
         }
     } // Lock released here
-    
+
     // Compute intersections (outside lock)
     if (needFullComputation) {
         result.newIntersections = computeFunc({});
@@ -403,8 +766,6 @@ EdgeGeometryCache::IncrementalUpdateResult EdgeGeometryCache::updateIntersection
         result.invalidatedEdgeIndices = changedEdgeIndices;
         result.newIntersections = computeFunc(changedEdgeIndices);
     }
-    
+
     return result;
 }
-
-
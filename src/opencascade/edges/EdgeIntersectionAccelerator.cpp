@@ -1,15 +1,14 @@
 #include "edges/EdgeIntersectionAccelerator.h"
+#include "geometry/VertexSpatialIndex.h"
 #include "logger/Logger.h"
 #include <BRep_Tool.hxx>
 #include <BRepBndLib.hxx>
-#include <GeomAPI_ExtremaCurveCurve.hxx>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 #include <algorithm>
-#include <execution>
 #include <chrono>
 #include <sstream>
 #include <iomanip>
-#include <mutex>
-#include <thread>
 
 void EdgeIntersectionAccelerator::Statistics::print() const {
     std::ostringstream oss;
@@ -24,22 +23,16 @@ void EdgeIntersectionAccelerator::Statistics::print() const {
     LOG_INF_S(oss.str());
 }
 
-EdgeIntersectionAccelerator::EdgeIntersectionAccelerator()
-    : m_bvh(std::make_unique<BVHAccelerator>()) {
+EdgeIntersectionAccelerator::EdgeIntersectionAccelerator() {
 }
 
-void EdgeIntersectionAccelerator::buildFromEdges(
-    const std::vector<TopoDS_Edge>& edges,
-    size_t maxPrimitivesPerLeaf) {
+void EdgeIntersectionAccelerator::buildFromEdges(const std::vector<TopoDS_Edge>& edges) {
     
     auto startTime = std::chrono::high_resolution_clock::now();
     
     m_edges.clear();
     m_edges.reserve(edges.size());
     
-    std::vector<TopoDS_Shape> shapeEdges;
-    shapeEdges.reserve(edges.size());
-    
     // Extract edge data
     for (size_t i = 0; i < edges.size(); ++i) {
         const auto& edge = edges[i];
@@ -63,20 +56,23 @@ void EdgeIntersectionAccelerator::buildFromEdges(
         }
         
         // Compute bounding box
-        Bnd_Box box;
-        BRepBndLib::Add(edge, box);
-        if (!box.IsVoid()) {
-            prim.bounds = box;
+        BRepBndLib::Add(edge, prim.bounds);
+        if (prim.bounds.IsVoid()) {
+            continue;
         }
         
         m_edges.push_back(prim);
-        shapeEdges.push_back(edge);
     }
     
-    // Build BVH
-    if (!m_edges.empty()) {
-        m_bvh->build(shapeEdges, maxPrimitivesPerLeaf);
-    }
+    // Curve hierarchies are independent per edge
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_edges.size(), 16),
+        [this](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                EdgePrimitive& prim = m_edges[i];
+                prim.segments.build(prim.curve, prim.first, prim.last);
+            }
+        });
+    m_built = true;
     
     auto endTime = std::chrono::high_resolution_clock::now();
     m_stats.totalEdges = m_edges.size();
@@ -88,7 +84,7 @@ void EdgeIntersectionAccelerator::buildFromEdges(
 }
 
 std::vector<EdgeIntersectionAccelerator::EdgePair> 
-EdgeIntersectionAccelerator::findPotentialIntersections() const {
+EdgeIntersectionAccelerator::findPotentialIntersections(double tolerance) const {
     
     if (!isBuilt()) {
         LOG_WRN_S("EdgeIntersectionAccelerator: Not built, returning empty list");
@@ -97,18 +93,30 @@ EdgeIntersectionAccelerator::findPotentialIntersections() const {
     
     auto startTime = std::chrono::high_resolution_clock::now();
     
-    std::vector<EdgePair> pairs;
-    size_t worstCasePairs = (m_edges.size() * (m_edges.size() - 1)) / 2;
-    pairs.reserve(std::min(worstCasePairs, size_t(10000))); // Reserve reasonable size
-    
-    // Query BVH for each edge to find potential intersecting edges
+    struct Extent {
+        double minX, minY, minZ, maxX, maxY, maxZ;
+        size_t index;
+    };
+    std::vector<Extent> extents(m_edges.size());
     for (size_t i = 0; i < m_edges.size(); ++i) {
-        auto candidates = queryIntersectingEdges(i);
-        
-        for (size_t j : candidates) {
-            if (j > i) { // Avoid duplicates and self-intersection
-                pairs.push_back(EdgePair(i, j));
+        Extent& extent = extents[i];
+        m_edges[i].bounds.Get(extent.minX, extent.minY, extent.minZ, extent.maxX, extent.maxY, extent.maxZ);
+        extent.index = i;
+    }
+    std::sort(extents.begin(), extents.end(),
+        [](const Extent& a, const Extent& b) { return a.minX < b.minX; });
+    
+    // Sweep along X; only boxes whose X ranges overlap are compared on Y and Z
+    std::vector<EdgePair> pairs;
+    for (size_t i = 0; i < extents.size(); ++i) {
+        const Extent& a = extents[i];
+        for (size_t j = i + 1; j < extents.size() && extents[j].minX <= a.maxX + tolerance; ++j) {
+            const Extent& b = extents[j];
+            if (a.maxY + tolerance < b.minY || b.maxY + tolerance < a.minY ||
+                a.maxZ + tolerance < b.minZ || b.maxZ + tolerance < a.minZ) {
+                continue;
             }
+            pairs.push_back(EdgePair(std::min(a.index, b.index), std::max(a.index, b.index)));
         }
     }
     
@@ -116,7 +124,7 @@ EdgeIntersectionAccelerator::findPotentialIntersections() const {
     m_stats.queryTime = std::chrono::duration<double>(endTime - startTime).count();
     m_stats.potentialPairs = pairs.size();
     
-    size_t totalPairs = (m_edges.size() * (m_edges.size() - 1)) / 2;
+    size_t totalPairs = m_edges.size() > 1 ? (m_edges.size() * (m_edges.size() - 1)) / 2 : 0;
     m_stats.pruningRatio = totalPairs > 0 ? 
         1.0 - (double)pairs.size() / totalPairs : 0.0;
     
@@ -130,20 +138,17 @@ EdgeIntersectionAccelerator::findPotentialIntersections() const {
 std::vector<gp_Pnt> EdgeIntersectionAccelerator::extractIntersections(
     double tolerance) const {
     
-    auto potentialPairs = findPotentialIntersections();
+    auto potentialPairs = findPotentialIntersections(tolerance);
     std::vector<gp_Pnt> intersections;
-    intersections.reserve(potentialPairs.size() / 10); // Heuristic: ~10% actual intersections
     
     for (const auto& pair : potentialPairs) {
-        gp_Pnt intersection;
-        if (computeEdgeIntersection(m_edges[pair.edge1Index],
-                                    m_edges[pair.edge2Index],
-                                    tolerance,
-                                    intersection)) {
-            intersections.push_back(intersection);
-        }
+        computeEdgeIntersections(m_edges[pair.edge1Index],
+                                 m_edges[pair.edge2Index],
+                                 tolerance,
+                                 intersections);
     }
     
+    intersections = mergeCoincidentPoints(intersections, tolerance);
     m_stats.actualIntersections = intersections.size();
     
     return intersections;
@@ -152,42 +157,17 @@ std::vector<gp_Pnt> EdgeIntersectionAccelerator::extractIntersections(
 std::vector<gp_Pnt> EdgeIntersectionAccelerator::extractIntersectionsParallel(
     double tolerance, size_t numThreads) const {
     
-    if (numThreads == 0) {
-        numThreads = std::thread::hardware_concurrency();
-    }
+    // TBB sizes its own thread pool
+    (void)numThreads;
     
-    auto potentialPairs = findPotentialIntersections();
+    auto potentialPairs = findPotentialIntersections(tolerance);
     
     if (potentialPairs.empty()) {
         return {};
     }
     
-    // Thread-safe result collection using mutex
-    // For better performance, could use lock-free structures or thread-local storage
-    std::vector<gp_Pnt> allIntersections;
-    std::mutex resultMutex;
-    
-    // Parallel processing using std::for_each with execution policy
-    // Note: This requires C++17 and may need TBB or other parallel STL implementation
-    try {
-        std::for_each(std::execution::par_unseq,
-            potentialPairs.begin(), potentialPairs.end(),
-            [&](const EdgePair& pair) {
-                gp_Pnt intersection;
-                if (computeEdgeIntersection(m_edges[pair.edge1Index],
-                                           m_edges[pair.edge2Index],
-                                           tolerance,
-                                           intersection)) {
-                    std::lock_guard<std::mutex> lock(resultMutex);
-                    allIntersections.push_back(intersection);
-                }
-            });
-    }
-    catch (...) {
-        // Fallback to sequential if parallel execution fails
-        LOG_WRN_S("EdgeIntersectionAccelerator: Parallel execution failed, falling back to sequential");
-        return extractIntersections(tolerance);
-    }
+    std::vector<gp_Pnt> allIntersections = mergeCoincidentPoints(
+        intersectPairs(potentialPairs, tolerance), tolerance);
     
     m_stats.actualIntersections = allIntersections.size();
     
@@ -197,84 +177,55 @@ std::vector<gp_Pnt> EdgeIntersectionAccelerator::extractIntersectionsParallel(
     return allIntersections;
 }
 
-bool EdgeIntersectionAccelerator::computeEdgeIntersection(
-    const EdgePrimitive& edge1,
-    const EdgePrimitive& edge2,
-    double tolerance,
-    gp_Pnt& intersection) const {
-    
-    try {
-        // Use OpenCASCADE's curve-curve extrema algorithm
-        GeomAPI_ExtremaCurveCurve extrema(
-            edge1.curve, edge2.curve,
-            edge1.first, edge1.last,
-            edge2.first, edge2.last
-        );
-        
-        if (extrema.NbExtrema() > 0) {
-            double minDist = std::numeric_limits<double>::max();
-            int minIndex = -1;
-            
-            for (int i = 1; i <= extrema.NbExtrema(); ++i) {
-                double dist = extrema.Distance(i);
-                if (dist < minDist) {
-                    minDist = dist;
-                    minIndex = i;
-                }
-            }
-            
-            if (minIndex > 0 && minDist < tolerance) {
-                gp_Pnt p1, p2;
-                extrema.Points(minIndex, p1, p2);
-                
-                // Use midpoint as intersection
-                intersection.SetX((p1.X() + p2.X()) / 2.0);
-                intersection.SetY((p1.Y() + p2.Y()) / 2.0);
-                intersection.SetZ((p1.Z() + p2.Z()) / 2.0);
-                
-                return true;
+std::vector<gp_Pnt> EdgeIntersectionAccelerator::intersectPairs(
+    const std::vector<EdgePair>& pairs, double tolerance) const {
+    
+    // One slot per pair keeps the output order independent of scheduling
+    std::vector<std::vector<gp_Pnt>> pairResults(pairs.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, pairs.size(), 32),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                computeEdgeIntersections(m_edges[pairs[i].edge1Index],
+                                         m_edges[pairs[i].edge2Index],
+                                         tolerance,
+                                         pairResults[i]);
             }
-        }
-    }
-    catch (const Standard_Failure&) {
-        // Silent failure - some edge pairs cannot be computed
-        // This is normal and expected
-    }
+        });
     
-    return false;
+    std::vector<gp_Pnt> intersections;
+    for (const auto& points : pairResults) {
+        intersections.insert(intersections.end(), points.begin(), points.end());
+    }
+    return intersections;
 }
 
-std::vector<size_t> EdgeIntersectionAccelerator::queryIntersectingEdges(
-    size_t edgeIndex) const {
-    
-    if (edgeIndex >= m_edges.size()) {
-        return {};
+std::vector<gp_Pnt> EdgeIntersectionAccelerator::mergeCoincidentPoints(
+    const std::vector<gp_Pnt>& points, double tolerance) {
+    
+    std::vector<gp_Pnt> merged;
+    std::vector<size_t> kept = VertexSpatialIndex::deduplicate(points, tolerance);
+    merged.reserve(kept.size());
+    for (size_t index : kept) {
+        merged.push_back(points[index]);
     }
+    return merged;
+}
+
+void EdgeIntersectionAccelerator::computeEdgeIntersections(
+    const EdgePrimitive& edge1,
+    const EdgePrimitive& edge2,
+    double tolerance,
+    std::vector<gp_Pnt>& intersections) const {
     
-    const auto& edge = m_edges[edgeIndex];
-    std::vector<size_t> results;
-    
-    // Query BVH: find all edges whose bounding boxes intersect with this edge
-    // Note: This is a simplified implementation
-    // For full BVH query support, BVHAccelerator would need to expose
-    // a bounding box query interface
-    
-    // Current fallback: test all edges (can be optimized with BVH box query)
-    for (size_t i = 0; i < m_edges.size(); ++i) {
-        if (i == edgeIndex) continue;
-        
-        // Check bounding box intersection
-        if (!edge.bounds.IsOut(m_edges[i].bounds)) {
-            results.push_back(i);
-        }
+    std::vector<CurveSegmentTree::Hit> hits;
+    CurveSegmentTree::intersect(edge1.segments, edge2.segments, tolerance, hits);
+    for (const auto& hit : hits) {
+        intersections.push_back(hit.point);
     }
-    
-    return results;
 }
 
 void EdgeIntersectionAccelerator::clear() {
     m_edges.clear();
-    m_bvh->clear();
+    m_built = false;
     m_stats = Statistics();
 }
-
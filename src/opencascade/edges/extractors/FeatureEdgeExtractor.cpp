@@ -10,9 +10,18 @@
 #include <BRepAdaptor_Surface.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <gp_Vec.hxx>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <algorithm>
+#include <chrono>
 #include <sstream>
 #include <iomanip>
 
+namespace {
+    // Shapes whose edge classification is kept for re-thresholding
+    constexpr size_t kMaxClassifiedShapes = 8;
+}
+
 FeatureEdgeExtractor::FeatureEdgeExtractor() {}
 
 bool FeatureEdgeExtractor::canExtract(const TopoDS_Shape& shape) const {
@@ -31,9 +40,10 @@ std::vector<gp_Pnt> FeatureEdgeExtractor::extractTyped(
     const FeatureEdgeParams& p = params ? *params : defaultParams;
     
     // Generate cache key based on shape and parameters
+    auto& cache = EdgeGeometryCache::getInstance();
     std::ostringstream keyStream;
     keyStream << "feature_" 
-              << reinterpret_cast<uintptr_t>(&shape.TShape()) << "_"
+              << cache.getShapeHash(shape) << "_"
               << std::fixed << std::setprecision(6)
               << p.featureAngle << "_"
               << p.minLength << "_"
@@ -42,122 +52,159 @@ std::vector<gp_Pnt> FeatureEdgeExtractor::extractTyped(
     std::string cacheKey = keyStream.str();
     
     // Use cache to avoid recomputation
-    auto& cache = EdgeGeometryCache::getInstance();
     return cache.getOrCompute(cacheKey, [&]() {
-        // Cache miss - perform actual feature edge extraction
-        LOG_INF_S("FeatureEdgeExtractor: Computing feature edges (cache miss)");
+        // Cache miss - threshold the per-edge classification, which is itself
+        // cached per shape so a new feature angle needs no geometry evaluation
+        std::shared_ptr<const ShapeClassification> classification = getClassification(shape);
         
         std::vector<gp_Pnt> points;
-    
-    TopTools_IndexedDataMapOfShapeListOfShape edgeFaceMap;
-    TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edgeFaceMap);
-    
-    double angleThreshold = p.featureAngle * M_PI / 180.0;
-    
-    for (int i = 1; i <= edgeFaceMap.Extent(); ++i) {
-        const TopoDS_Edge& edge = TopoDS::Edge(edgeFaceMap.FindKey(i));
-        const TopTools_ListOfShape& faces = edgeFaceMap.FindFromIndex(i);
+        double angleThreshold = p.featureAngle * M_PI / 180.0;
         
-        Standard_Real first, last;
-        Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, first, last);
-        if (curve.IsNull()) continue;
-        
-        // Check length filter
-        BRepAdaptor_Curve adaptor(edge);
-        bool isClosed = (edge.Closed() || adaptor.IsClosed());
-        
-        if (!isClosed) {
-            gp_Pnt p1 = curve->Value(first);
-            gp_Pnt p2 = curve->Value(last);
-            if (p1.Distance(p2) < p.minLength) continue;
+        for (const EdgeRecord& record : classification->edges) {
+            if (record.sampleCount < 2) continue;
+            
+            // Check length filter
+            if (!record.closed && record.chordLength < p.minLength) continue;
+            
+            bool isFeature = false;
+            
+            // Boundary edges (only one face) are always features
+            if (record.faceCount == 1) {
+                isFeature = true;
+            }
+            // Edges between two faces - check angle
+            else if (record.faceCount == 2 && record.angle >= angleThreshold) {
+                if (!p.onlyConvex && !p.onlyConcave) {
+                    isFeature = true;
+                } else if (p.onlyConvex && record.normalDot > 0) {
+                    isFeature = true;
+                } else if (p.onlyConcave && record.normalDot < 0) {
+                    isFeature = true;
+                }
+            }
+            
+            if (isFeature) {
+                // Convert to line segments
+                const gp_Pnt* edgePoints = classification->samples.data() + record.sampleOffset;
+                for (uint32_t j = 0; j + 1 < record.sampleCount; ++j) {
+                    points.push_back(edgePoints[j]);
+                    points.push_back(edgePoints[j + 1]);
+                }
+            }
         }
         
-        bool isFeature = false;
-        
-        // Boundary edges (only one face) are always features
-        if (faces.Extent() == 1) {
-            isFeature = true;
-        }
-        // Edges between two faces - check angle
-        else if (faces.Extent() == 2) {
-            TopoDS_Face face1 = TopoDS::Face(faces.First());
-            TopoDS_Face face2 = TopoDS::Face(faces.Last());
-
-            double angle = calculateFaceAngle(edge, face1, face2);
+        return points;
+    });  // End of cache lambda
+}
 
-            // Skip if normals couldn't be calculated (angle = 0.0)
-            if (angle < 1e-10) continue;
+std::shared_ptr<const FeatureEdgeExtractor::ShapeClassification> FeatureEdgeExtractor::getClassification(
+    const TopoDS_Shape& shape) {
+    
+    const TopoDS_TShape* key = shape.TShape().get();
+    {
+        std::lock_guard<std::mutex> lock(m_classificationMutex);
+        auto it = m_classifications.find(key);
+        if (it != m_classifications.end() && it->second->shape.IsEqual(shape)) {
+            return it->second;
+        }
+    }
+    
+    // Classify outside the lock so other shapes aren't held up
+    std::shared_ptr<const ShapeClassification> classification = classify(shape);
+    
+    std::lock_guard<std::mutex> lock(m_classificationMutex);
+    auto it = m_classifications.find(key);
+    if (it == m_classifications.end()) {
+        m_classificationOrder.push_back(key);
+    }
+    m_classifications[key] = classification;
+    while (m_classificationOrder.size() > kMaxClassifiedShapes) {
+        m_classifications.erase(m_classificationOrder.front());
+        m_classificationOrder.pop_front();
+    }
+    return classification;
+}
 
-            if (angle >= angleThreshold) {
-                // Calculate normals to determine convex/concave
-                gp_Pnt midPoint = curve->Value((first + last) / 2.0);
+std::shared_ptr<const FeatureEdgeExtractor::ShapeClassification> FeatureEdgeExtractor::classify(
+    const TopoDS_Shape& shape) const {
+    
+    auto startTime = std::chrono::high_resolution_clock::now();
+    auto classification = std::make_shared<ShapeClassification>();
+    classification->shape = shape;
+    
+    TopTools_IndexedDataMapOfShapeListOfShape edgeFaceMap;
+    TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edgeFaceMap);
+    
+    const int edgeCount = edgeFaceMap.Extent();
+    std::vector<EdgeRecord> records(edgeCount);
+    std::vector<std::vector<gp_Pnt>> edgeSamples(edgeCount);
+    
+    // The map is only read here; each edge writes its own slot
+    tbb::parallel_for(tbb::blocked_range<int>(0, edgeCount, 16),
+        [&](const tbb::blocked_range<int>& range) {
+            for (int i = range.begin(); i != range.end(); ++i) {
+                const TopoDS_Edge& edge = TopoDS::Edge(edgeFaceMap.FindKey(i + 1));
+                const TopTools_ListOfShape& faces = edgeFaceMap.FindFromIndex(i + 1);
+                EdgeRecord& record = records[i];
+                record.faceCount = faces.Extent();
                 
-                BRepAdaptor_Surface surf1(face1);
-                BRepAdaptor_Surface surf2(face2);
+                // Edges shared by more than two faces are never features
+                if (record.faceCount < 1 || record.faceCount > 2) continue;
                 
-                gp_Vec normal1, normal2;
-                Standard_Real u, v;
+                Standard_Real first, last;
+                Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, first, last);
+                if (curve.IsNull()) continue;
                 
                 try {
-                    // Skip expensive normal calculations if we don't need to check convex/concave
-                    if (!p.onlyConvex && !p.onlyConcave) {
-                        isFeature = true;
-                    } else {
-                        // Only compute normals when needed for convex/concave filtering
-                        GeomAPI_ProjectPointOnSurf proj1(midPoint, BRep_Tool::Surface(face1));
-                        if (proj1.NbPoints() > 0) {
-                            proj1.Parameters(1, u, v);
-                            gp_Pnt pt; gp_Vec d1u, d1v;
-                            surf1.D1(u, v, pt, d1u, d1v);
-                            normal1 = d1u.Crossed(d1v);
-                            if (face1.Orientation() == TopAbs_REVERSED) normal1.Reverse();
-                            normal1.Normalize();
-                        }
-
-                        GeomAPI_ProjectPointOnSurf proj2(midPoint, BRep_Tool::Surface(face2));
-                        if (proj2.NbPoints() > 0) {
-                            proj2.Parameters(1, u, v);
-                            gp_Pnt pt; gp_Vec d1u, d1v;
-                            surf2.D1(u, v, pt, d1u, d1v);
-                            normal2 = d1u.Crossed(d1v);
-                            if (face2.Orientation() == TopAbs_REVERSED) normal2.Reverse();
-                            normal2.Normalize();
-                        }
-
-                        double dotProduct = normal1.Dot(normal2);
-
-                        if (p.onlyConvex && dotProduct > 0) {
-                            isFeature = true;
-                        } else if (p.onlyConcave && dotProduct < 0) {
-                            isFeature = true;
+                    BRepAdaptor_Curve adaptor(edge);
+                    record.closed = (edge.Closed() || adaptor.IsClosed());
+                    record.chordLength = curve->Value(first).Distance(curve->Value(last));
+                    
+                    if (record.faceCount == 2) {
+                        gp_Vec normal1, normal2;
+                        if (!calculateFaceNormals(edge, TopoDS::Face(faces.First()), TopoDS::Face(faces.Last()),
+                                                  normal1, normal2)) {
+                            continue;
                         }
+                        record.angle = normal1.Angle(normal2);
+                        record.normalDot = normal1.Dot(normal2);
+                        
+                        // Tangent faces can never pass a feature angle threshold
+                        if (record.angle < 1e-10) continue;
+                    }
+                    
+                    int numSamples = std::max(10, static_cast<int>(adaptor.LastParameter() - adaptor.FirstParameter()) * 10);
+                    numSamples = std::min(numSamples, 50);
+                    
+                    std::vector<gp_Pnt>& samples = edgeSamples[i];
+                    samples.reserve(numSamples + 1);
+                    for (int j = 0; j <= numSamples; ++j) {
+                        Standard_Real t = first + (last - first) * j / numSamples;
+                        samples.push_back(curve->Value(t));
                     }
                 } catch (...) {
-                    continue;
+                    edgeSamples[i].clear();
                 }
             }
-        }
-        
-        if (isFeature) {
-            int numSamples = std::max(10, static_cast<int>(adaptor.LastParameter() - adaptor.FirstParameter()) * 10);
-            numSamples = std::min(numSamples, 50);
-            
-            std::vector<gp_Pnt> edgePoints;
-            for (int j = 0; j <= numSamples; ++j) {
-                Standard_Real t = first + (last - first) * j / numSamples;
-                edgePoints.push_back(curve->Value(t));
-            }
-            
-            // Convert to line segments
-            for (size_t j = 0; j + 1 < edgePoints.size(); ++j) {
-                points.push_back(edgePoints[j]);
-                points.push_back(edgePoints[j + 1]);
-            }
-        }
+        });
+    
+    size_t sampleTotal = 0;
+    for (const auto& samples : edgeSamples) {
+        sampleTotal += samples.size();
     }
-        
-        return points;
-    });  // End of cache lambda
+    classification->samples.reserve(sampleTotal);
+    for (int i = 0; i < edgeCount; ++i) {
+        records[i].sampleOffset = static_cast<uint32_t>(classification->samples.size());
+        records[i].sampleCount = static_cast<uint32_t>(edgeSamples[i].size());
+        classification->samples.insert(classification->samples.end(), edgeSamples[i].begin(), edgeSamples[i].end());
+    }
+    classification->edges = std::move(records);
+    
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - startTime);
+    LOG_INF_S("FeatureEdgeExtractor: Classified " + std::to_string(edgeCount) + " edges in " +
+              std::to_string(duration.count()) + " ms");
+    return classification;
 }
 
 bool FeatureEdgeExtractor::isFeatureEdge(
@@ -177,21 +224,24 @@ bool FeatureEdgeExtractor::isFeatureEdge(
     return angle >= angleThreshold;
 }
 
-double FeatureEdgeExtractor::calculateFaceAngle(
+bool FeatureEdgeExtractor::calculateFaceNormals(
     const TopoDS_Edge& edge,
     const TopoDS_Face& face1,
-    const TopoDS_Face& face2) const {
+    const TopoDS_Face& face2,
+    gp_Vec& normal1,
+    gp_Vec& normal2) const {
     
     Standard_Real first, last;
     Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, first, last);
-    if (curve.IsNull()) return 0.0;
+    if (curve.IsNull()) return false;
     
     gp_Pnt midPoint = curve->Value((first + last) / 2.0);
     
     BRepAdaptor_Surface surf1(face1);
     BRepAdaptor_Surface surf2(face2);
     
-    gp_Vec normal1, normal2;
+    normal1 = gp_Vec();
+    normal2 = gp_Vec();
     Standard_Real u, v;
     
     try {
@@ -213,14 +263,22 @@ double FeatureEdgeExtractor::calculateFaceAngle(
             if (face2.Orientation() == TopAbs_REVERSED) normal2.Reverse();
         }
     } catch (...) {
-        return 0.0;
+        return false;
     }
     
-    if (normal1.Magnitude() < 1e-7 || normal2.Magnitude() < 1e-7) return 0.0;
+    if (normal1.Magnitude() < 1e-7 || normal2.Magnitude() < 1e-7) return false;
     
     normal1.Normalize();
     normal2.Normalize();
+    return true;
+}
+
+double FeatureEdgeExtractor::calculateFaceAngle(
+    const TopoDS_Edge& edge,
+    const TopoDS_Face& face1,
+    const TopoDS_Face& face2) const {
     
+    gp_Vec normal1, normal2;
+    if (!calculateFaceNormals(edge, face1, face2, normal1, normal2)) return 0.0;
     return normal1.Angle(normal2);
 }
-
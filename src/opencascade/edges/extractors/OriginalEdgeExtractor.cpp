@@ -10,7 +10,6 @@
 #include <BRepBndLib.hxx>
 #include <Bnd_Box.hxx>
 #include <GeomAbs_CurveType.hxx>
-#include <execution>
 #include <mutex>
 #include <atomic>
 #include <sstream>
@@ -27,51 +26,6 @@
 
 OriginalEdgeExtractor::OriginalEdgeExtractor() {}
 
-// EdgeData constructor implementation
-OriginalEdgeExtractor::EdgeData::EdgeData(const FilteredEdge& filteredEdge, double bboxMargin) {
-    curve = filteredEdge.curve;
-    first = filteredEdge.first;
-    last = filteredEdge.last;
-    length = filteredEdge.length;
-
-    // Pre-compute bounding box
-    Bnd_Box bndBox;
-    TopoDS_Edge edge = filteredEdge.edge;
-    BRepBndLib::Add(edge, bndBox);
-
-    double exmin, eymin, ezmin, exmax, eymax, ezmax;
-    bndBox.Get(exmin, eymin, ezmin, exmax, eymax, ezmax);
-
-    bbox.Add(gp_Pnt(exmin, eymin, ezmin));
-    bbox.Add(gp_Pnt(exmax, eymax, ezmax));
-    bbox.Enlarge(bboxMargin);
-}
-
-// EdgeData constructor for TopoDS_Edge
-OriginalEdgeExtractor::EdgeData::EdgeData(const TopoDS_Edge& edge, double bboxMargin) {
-    // Get curve and parameters
-    Standard_Real first, last;
-    curve = BRep_Tool::Curve(edge, first, last);
-    this->first = first;
-    this->last = last;
-
-    // Calculate length
-    gp_Pnt startPoint = curve->Value(first);
-    gp_Pnt endPoint = curve->Value(last);
-    length = startPoint.Distance(endPoint);
-
-    // Pre-compute bounding box
-    Bnd_Box bndBox;
-    BRepBndLib::Add(edge, bndBox);
-
-    double exmin, eymin, ezmin, exmax, eymax, ezmax;
-    bndBox.Get(exmin, eymin, ezmin, exmax, eymax, ezmax);
-
-    bbox.Add(gp_Pnt(exmin, eymin, ezmin));
-    bbox.Add(gp_Pnt(exmax, eymax, ezmax));
-    bbox.Enlarge(bboxMargin);
-}
-
 bool OriginalEdgeExtractor::canExtract(const TopoDS_Shape& shape) const {
     // Can extract from any shape containing edges
     for (TopExp_Explorer exp(shape, TopAbs_EDGE); exp.More(); exp.Next()) {
@@ -89,15 +43,15 @@ std::vector<gp_Pnt> OriginalEdgeExtractor::extractTyped(
     const OriginalEdgeParams& p = params ? *params : defaultParams;
     
     // Try to use cache
+    auto& cache = EdgeGeometryCache::getInstance();
     std::ostringstream keyStream;
     keyStream << "original_" 
-              << reinterpret_cast<uintptr_t>(&shape.TShape()) << "_"
+              << cache.getShapeHash(shape) << "_"
               << p.samplingDensity << "_"
               << p.minLength << "_"
               << (p.showLinesOnly ? "1" : "0");
     std::string cacheKey = keyStream.str();
     
-    auto& cache = EdgeGeometryCache::getInstance();
     return cache.getOrCompute(cacheKey, [&]() {
         // Single-pass edge collection and filtering
         std::vector<FilteredEdge> filteredEdges;
@@ -596,8 +550,8 @@ void OriginalEdgeExtractor::findEdgeIntersections(
         edges.push_back(TopoDS::Edge(exp.Current()));
     }
 
-    // Generate cache key based on shape pointer and tolerance
-    size_t shapeHash = reinterpret_cast<size_t>(shape.TShape().get());
+    // Generate cache key based on shape content and tolerance
+    size_t shapeHash = EdgeGeometryCache::getInstance().getShapeHash(shape);
     std::ostringstream keyStream;
     keyStream << "intersections_" << shapeHash << "_" 
               << std::fixed << std::setprecision(6) << adaptiveTolerance;
@@ -634,230 +588,12 @@ void OriginalEdgeExtractor::findEdgeIntersectionsFromEdges(
         return;
     }
     
-    // For larger models (>= 100 edges), use BVH acceleration
-    if (edges.size() >= 100) {
-        EdgeIntersectionAccelerator accelerator;
-        accelerator.buildFromEdges(edges);
-        
-        // Extract intersections using BVH (handles duplicate checking internally)
-        intersectionPoints = accelerator.extractIntersectionsParallel(tolerance);
-        return;
-    }
-
-    // For larger models, use the optimized spatial approach
-    // Calculate global bounding box from edges
-    Bnd_Box globalBbox;
-    for (const auto& edge : edges) {
-        BRepBndLib::Add(edge, globalBbox);
-    }
-    double xmin, ymin, zmin, xmax, ymax, zmax;
-    globalBbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-
-    double diagonal = sqrt((xmax - xmin) * (xmax - xmin) + (ymax - ymin) * (ymax - ymin) + (zmax - zmin) * (zmax - zmin));
-    const double bboxMargin = tolerance * 2.0;
-
-    // Create edge data with bounding boxes
-    std::vector<EdgeData> allEdgeData;
-    allEdgeData.reserve(edges.size());
-
-    // Determine optimal grid size for spatial partitioning
-    // Use aspect ratio aware grid sizing instead of simple cubic root
-    double sizeX = xmax - xmin + 2 * bboxMargin;
-    double sizeY = ymax - ymin + 2 * bboxMargin;
-    double sizeZ = zmax - zmin + 2 * bboxMargin;
-
-    // Calculate grid dimensions based on aspect ratios and target cell count
-    const int targetEdgesPerCell = 8; // Reduced for better performance
-    double totalVolume = sizeX * sizeY * sizeZ;
-    double avgCellVolume = totalVolume / (edges.size() / targetEdgesPerCell);
-    double cellSize = std::cbrt(avgCellVolume);
-
-    int gridSizeX = std::max(1, static_cast<int>(sizeX / cellSize));
-    int gridSizeY = std::max(1, static_cast<int>(sizeY / cellSize));
-    int gridSizeZ = std::max(1, static_cast<int>(sizeZ / cellSize));
-
-    // Cap maximum grid size to prevent excessive memory usage
-    const int maxGridSize = 32;
-    gridSizeX = std::min(gridSizeX, maxGridSize);
-    gridSizeY = std::min(gridSizeY, maxGridSize);
-    gridSizeZ = std::min(gridSizeZ, maxGridSize);
-
-    // Process edges and prepare data
-    std::vector<EdgeData> edgeData;
-    edgeData.reserve(edges.size());
-
-    // Create efficient grid storage: vector of vectors for each grid cell
-    int totalGridCells = gridSizeX * gridSizeY * gridSizeZ;
-    std::vector<std::vector<size_t>> gridCells(totalGridCells);
-
-    for (size_t i = 0; i < edges.size(); ++i) {
-        const TopoDS_Edge& edge = edges[i];
-
-        // Skip invalid edges
-        Standard_Real first, last;
-        Handle(Geom_Curve) testCurve = BRep_Tool::Curve(edge, first, last);
-        if (testCurve.IsNull()) continue;
-
-        // Use optimized constructor
-        EdgeData data(edge, bboxMargin);
-
-        // Assign to grid cell based on bounding box center
-        double centerX = (data.bbox.minX + data.bbox.maxX) / 2.0 - xmin + bboxMargin;
-        double centerY = (data.bbox.minY + data.bbox.maxY) / 2.0 - ymin + bboxMargin;
-        double centerZ = (data.bbox.minZ + data.bbox.maxZ) / 2.0 - zmin + bboxMargin;
-
-        data.gridX = std::max(0, std::min(gridSizeX - 1, static_cast<int>(centerX / (sizeX / gridSizeX))));
-        data.gridY = std::max(0, std::min(gridSizeY - 1, static_cast<int>(centerY / (sizeY / gridSizeY))));
-        data.gridZ = std::max(0, std::min(gridSizeZ - 1, static_cast<int>(centerZ / (sizeZ / gridSizeZ))));
-
-        // Store edge data and assign to grid cell
-        size_t dataIndex = edgeData.size();
-        edgeData.push_back(data);
-
-        // Calculate flat grid index
-        int gridIndex = data.gridX * (gridSizeY * gridSizeZ) + data.gridY * gridSizeZ + data.gridZ;
-        gridCells[gridIndex].push_back(dataIndex);
-    }
-
-    // Thread-safe intersection point management
-    std::mutex intersectionMutex;
-    auto addIntersectionPoint = [&](const gp_Pnt& point) {
-        std::lock_guard<std::mutex> lock(intersectionMutex);
-        // Check if already found (optimize by checking recent points first)
-        const size_t maxCheck = std::min(size_t(20), intersectionPoints.size());
-        bool alreadyFound = false;
-        for (size_t k = intersectionPoints.size() - maxCheck; k < intersectionPoints.size(); ++k) {
-            if (point.Distance(intersectionPoints[k]) < tolerance) {
-                alreadyFound = true;
-                break;
-            }
-        }
-        if (!alreadyFound) {
-            intersectionPoints.push_back(point);
-        }
-    };
-
-    // Collect all potential intersection checks
-    std::vector<std::pair<size_t, size_t>> intersectionChecks;
-
-    for (int x = 0; x < gridSizeX; ++x) {
-        for (int y = 0; y < gridSizeY; ++y) {
-            for (int z = 0; z < gridSizeZ; ++z) {
-                // Calculate current cell index
-                int currentCellIndex = x * (gridSizeY * gridSizeZ) + y * gridSizeZ + z;
-                const auto& cellEdges = gridCells[currentCellIndex];
-                if (cellEdges.empty()) continue;
-
-                // Check intersections within this cell
-                for (size_t i = 0; i < cellEdges.size(); ++i) {
-                    for (size_t j = i + 1; j < cellEdges.size(); ++j) {
-                        intersectionChecks.emplace_back(cellEdges[i], cellEdges[j]);
-                    }
-                }
-
-                // Check intersections with neighboring cells (27-cell neighborhood)
-                for (int dx = -1; dx <= 1; ++dx) {
-                    for (int dy = -1; dy <= 1; ++dy) {
-                        for (int dz = -1; dz <= 1; ++dz) {
-                            if (dx == 0 && dy == 0 && dz == 0) continue;
-
-                            int nx = x + dx, ny = y + dy, nz = z + dz;
-                            if (nx < 0 || nx >= gridSizeX || ny < 0 || ny >= gridSizeY || nz < 0 || nz >= gridSizeZ) continue;
-
-                            int neighborCellIndex = nx * (gridSizeY * gridSizeZ) + ny * gridSizeZ + nz;
-                            const auto& neighborEdges = gridCells[neighborCellIndex];
-
-                            // Only check edges that could potentially intersect (bbox check first)
-                            for (size_t i : cellEdges) {
-                                for (size_t j : neighborEdges) {
-                                    // Ensure consistent ordering to avoid duplicate checks
-                                    if (i < j && edgeData[i].bbox.intersects(edgeData[j].bbox)) {
-                                        intersectionChecks.emplace_back(i, j);
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Perform accurate intersection checks in parallel using OpenCASCADE
-    std::for_each(std::execution::par, intersectionChecks.begin(), intersectionChecks.end(),
-        [&](const std::pair<size_t, size_t>& check) {
-            size_t idx1 = check.first;
-            size_t idx2 = check.second;
-
-            // Use OpenCASCADE's accurate intersection calculation
-            const EdgeData& data1 = edgeData[idx1];
-            const EdgeData& data2 = edgeData[idx2];
-
-            try {
-                // Use improved distance-based intersection detection with higher accuracy
-                const int fineSamples = 16; // Increased samples for better accuracy
-                double minDistance = std::numeric_limits<double>::max();
-                gp_Pnt closestPoint1, closestPoint2;
-
-                for (int i = 0; i <= fineSamples; ++i) {
-                    Standard_Real t1 = data1.first + (data1.last - data1.first) * i / fineSamples;
-                    gp_Pnt p1 = data1.curve->Value(t1);
-
-                    for (int j = 0; j <= fineSamples; ++j) {
-                        Standard_Real t2 = data2.first + (data2.last - data2.first) * j / fineSamples;
-                        gp_Pnt p2 = data2.curve->Value(t2);
-
-                        double dist = p1.Distance(p2);
-                        if (dist < minDistance) {
-                            minDistance = dist;
-                            closestPoint1 = p1;
-                            closestPoint2 = p2;
-                        }
-                    }
-                }
-
-                if (minDistance < tolerance) {
-                    // Use simple average for intersection point
-                    gp_Pnt intersectionPoint(
-                        (closestPoint1.X() + closestPoint2.X()) / 2.0,
-                        (closestPoint1.Y() + closestPoint2.Y()) / 2.0,
-                        (closestPoint1.Z() + closestPoint2.Z()) / 2.0
-                    );
-                    addIntersectionPoint(intersectionPoint);
-                }
-            } catch (...) {
-                // If geometric intersection fails, use fallback method
-                const int fineSamples = 8;
-                double minDistance = std::numeric_limits<double>::max();
-                gp_Pnt closestPoint1, closestPoint2;
-
-                for (int i = 0; i <= fineSamples; ++i) {
-                    Standard_Real t1 = data1.first + (data1.last - data1.first) * i / fineSamples;
-                    gp_Pnt p1 = data1.curve->Value(t1);
-
-                    for (int j = 0; j <= fineSamples; ++j) {
-                        Standard_Real t2 = data2.first + (data2.last - data2.first) * j / fineSamples;
-                        gp_Pnt p2 = data2.curve->Value(t2);
-
-                        double dist = p1.Distance(p2);
-                        if (dist < minDistance) {
-                            minDistance = dist;
-                            closestPoint1 = p1;
-                            closestPoint2 = p2;
-                        }
-                    }
-                }
-
-                if (minDistance < tolerance) {
-                    gp_Pnt intersectionPoint(
-                        (closestPoint1.X() + closestPoint2.X()) / 2.0,
-                        (closestPoint1.Y() + closestPoint2.Y()) / 2.0,
-                        (closestPoint1.Z() + closestPoint2.Z()) / 2.0
-                    );
-                    addIntersectionPoint(intersectionPoint);
-                }
-            }
-        });
+    // Edge boxes find the candidate pairs; curve segment hierarchies resolve them
+    EdgeIntersectionAccelerator accelerator;
+    accelerator.buildFromEdges(edges);
+    
+    // Extract intersections (handles duplicate checking internally)
+    intersectionPoints = accelerator.extractIntersectionsParallel(tolerance);
 }
 
 void OriginalEdgeExtractor::findEdgeIntersectionsFromFilteredEdges(
@@ -865,241 +601,22 @@ void OriginalEdgeExtractor::findEdgeIntersectionsFromFilteredEdges(
     std::vector<gp_Pnt>& intersectionPoints,
     double tolerance) {
 
+    // Convert FilteredEdge back to TopoDS_Edge
+    std::vector<TopoDS_Edge> edges;
+    edges.reserve(filteredEdges.size());
+    for (const auto& filteredEdge : filteredEdges) {
+        edges.push_back(filteredEdge.edge);
+    }
+
     // For small number of edges, use simpler approach
     if (filteredEdges.size() < 50) {
-        // Convert FilteredEdge back to TopoDS_Edge for simple method
-        std::vector<TopoDS_Edge> edges;
-        edges.reserve(filteredEdges.size());
-        for (const auto& filteredEdge : filteredEdges) {
-            edges.push_back(filteredEdge.edge);
-        }
         findEdgeIntersectionsSimple(edges, intersectionPoints, tolerance);
         return;
     }
 
-    // For larger models, use the optimized spatial approach
-    // Calculate global bounding box from filtered edges
-    AABB globalBbox;
-    for (const auto& filteredEdge : filteredEdges) {
-        // Use edge length to estimate bounding box (approximation)
-        // For more accuracy, we could compute actual bbox here, but FilteredEdge doesn't store it
-        // This is a trade-off between memory usage and computation
-        double approxSize = filteredEdge.length * 0.5; // Rough approximation
-        globalBbox.Add(gp_Pnt(-approxSize, -approxSize, -approxSize));
-        globalBbox.Add(gp_Pnt(approxSize, approxSize, approxSize));
-    }
-
-    double diagonal = sqrt((globalBbox.maxX - globalBbox.minX) * (globalBbox.maxX - globalBbox.minX) +
-                          (globalBbox.maxY - globalBbox.minY) * (globalBbox.maxY - globalBbox.minY) +
-                          (globalBbox.maxZ - globalBbox.minZ) * (globalBbox.maxZ - globalBbox.minZ));
-    const double bboxMargin = tolerance * 2.0;
-
-    // Create edge data with bounding boxes using pre-filtered edges
-    std::vector<EdgeData> allEdgeData;
-    allEdgeData.reserve(filteredEdges.size());
-
-    // Determine optimal grid size for spatial partitioning
-    // Use aspect ratio aware grid sizing instead of simple cubic root
-    double sizeX = globalBbox.maxX - globalBbox.minX + 2 * bboxMargin;
-    double sizeY = globalBbox.maxY - globalBbox.minY + 2 * bboxMargin;
-    double sizeZ = globalBbox.maxZ - globalBbox.minZ + 2 * bboxMargin;
-
-    // Calculate grid dimensions based on aspect ratios and target cell count
-    const int targetEdgesPerCell = 8; // Reduced for better performance
-    double totalVolume = sizeX * sizeY * sizeZ;
-    double avgCellVolume = totalVolume / (filteredEdges.size() / targetEdgesPerCell);
-    double cellSize = std::cbrt(avgCellVolume);
-
-    int gridSizeX = std::max(1, static_cast<int>(sizeX / cellSize));
-    int gridSizeY = std::max(1, static_cast<int>(sizeY / cellSize));
-    int gridSizeZ = std::max(1, static_cast<int>(sizeZ / cellSize));
-
-    // Cap maximum grid size to prevent excessive memory usage
-    const int maxGridSize = 32;
-    gridSizeX = std::min(gridSizeX, maxGridSize);
-    gridSizeY = std::min(gridSizeY, maxGridSize);
-    gridSizeZ = std::min(gridSizeZ, maxGridSize);
-
-    // Process filtered edges and prepare data using optimized EdgeData constructor
-    std::vector<EdgeData> edgeData;
-    edgeData.reserve(filteredEdges.size());
-
-    // Create efficient grid storage: vector of vectors for each grid cell
-    int totalGridCells = gridSizeX * gridSizeY * gridSizeZ;
-    std::vector<std::vector<size_t>> gridCells(totalGridCells);
-
-    double xmin = globalBbox.minX - bboxMargin;
-    double ymin = globalBbox.minY - bboxMargin;
-    double zmin = globalBbox.minZ - bboxMargin;
-
-    for (size_t i = 0; i < filteredEdges.size(); ++i) {
-        const FilteredEdge& filteredEdge = filteredEdges[i];
-
-        // Use optimized constructor that pre-computes bounding box
-        EdgeData data(filteredEdge, bboxMargin);
-
-        // Assign to grid cell based on bounding box center
-        double centerX = (data.bbox.minX + data.bbox.maxX) / 2.0 - xmin;
-        double centerY = (data.bbox.minY + data.bbox.maxY) / 2.0 - ymin;
-        double centerZ = (data.bbox.minZ + data.bbox.maxZ) / 2.0 - zmin;
-
-        data.gridX = std::max(0, std::min(gridSizeX - 1, static_cast<int>(centerX / (sizeX / gridSizeX))));
-        data.gridY = std::max(0, std::min(gridSizeY - 1, static_cast<int>(centerY / (sizeY / gridSizeY))));
-        data.gridZ = std::max(0, std::min(gridSizeZ - 1, static_cast<int>(centerZ / (sizeZ / gridSizeZ))));
-
-        // Store edge data and assign to grid cell
-        size_t dataIndex = edgeData.size();
-        edgeData.push_back(data);
-
-        // Calculate flat grid index
-        int gridIndex = data.gridX * (gridSizeY * gridSizeZ) + data.gridY * gridSizeZ + data.gridZ;
-        gridCells[gridIndex].push_back(dataIndex);
-    }
-
-    // Thread-safe intersection point management
-    std::mutex intersectionMutex;
-    auto addIntersectionPoint = [&](const gp_Pnt& point) {
-        std::lock_guard<std::mutex> lock(intersectionMutex);
-        // Check if already found (optimize by checking recent points first)
-        const size_t maxCheck = std::min(size_t(20), intersectionPoints.size());
-        bool alreadyFound = false;
-        for (size_t k = intersectionPoints.size() - maxCheck; k < intersectionPoints.size(); ++k) {
-            if (point.Distance(intersectionPoints[k]) < tolerance) {
-                alreadyFound = true;
-                break;
-            }
-        }
-        if (!alreadyFound) {
-            intersectionPoints.push_back(point);
-        }
-    };
-
-    // Collect all potential intersection checks
-    std::vector<std::pair<size_t, size_t>> intersectionChecks;
-
-    for (int x = 0; x < gridSizeX; ++x) {
-        for (int y = 0; y < gridSizeY; ++y) {
-            for (int z = 0; z < gridSizeZ; ++z) {
-                // Calculate current cell index
-                int currentCellIndex = x * (gridSizeY * gridSizeZ) + y * gridSizeZ + z;
-                const auto& cellEdges = gridCells[currentCellIndex];
-                if (cellEdges.empty()) continue;
-
-                // Check intersections within this cell
-                for (size_t i = 0; i < cellEdges.size(); ++i) {
-                    for (size_t j = i + 1; j < cellEdges.size(); ++j) {
-                        intersectionChecks.emplace_back(cellEdges[i], cellEdges[j]);
-                    }
-                }
-
-                // Check intersections with neighboring cells (27-cell neighborhood)
-                for (int dx = -1; dx <= 1; ++dx) {
-                    for (int dy = -1; dy <= 1; ++dy) {
-                        for (int dz = -1; dz <= 1; ++dz) {
-                            if (dx == 0 && dy == 0 && dz == 0) continue;
-
-                            int nx = x + dx, ny = y + dy, nz = z + dz;
-                            if (nx < 0 || nx >= gridSizeX || ny < 0 || ny >= gridSizeY || nz < 0 || nz >= gridSizeZ) continue;
-
-                            int neighborCellIndex = nx * (gridSizeY * gridSizeZ) + ny * gridSizeZ + nz;
-                            const auto& neighborEdges = gridCells[neighborCellIndex];
-
-                            // Only check edges that could potentially intersect (optimized bbox check)
-                            for (size_t i : cellEdges) {
-                                const AABB& bbox1 = edgeData[i].bbox;
-                                for (size_t j : neighborEdges) {
-                                    // Ensure consistent ordering to avoid duplicate checks
-                                    if (i < j) {
-                                        const AABB& bbox2 = edgeData[j].bbox;
-                                        // Fast bbox intersection check with early exit
-                                        if (bbox1.intersects(bbox2)) {
-                                            intersectionChecks.emplace_back(i, j);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Perform accurate intersection checks in parallel using OpenCASCADE
-    std::for_each(std::execution::par, intersectionChecks.begin(), intersectionChecks.end(),
-        [&](const std::pair<size_t, size_t>& check) {
-            size_t idx1 = check.first;
-            size_t idx2 = check.second;
-
-            // Use OpenCASCADE's accurate intersection calculation
-            const EdgeData& data1 = edgeData[idx1];
-            const EdgeData& data2 = edgeData[idx2];
-
-            try {
-                // Use improved distance-based intersection detection with higher accuracy
-                const int fineSamples = 16; // Increased samples for better accuracy
-                double minDistance = std::numeric_limits<double>::max();
-                gp_Pnt closestPoint1, closestPoint2;
-
-                for (int i = 0; i <= fineSamples; ++i) {
-                    Standard_Real t1 = data1.first + (data1.last - data1.first) * i / fineSamples;
-                    gp_Pnt p1 = data1.curve->Value(t1);
-
-                    for (int j = 0; j <= fineSamples; ++j) {
-                        Standard_Real t2 = data2.first + (data2.last - data2.first) * j / fineSamples;
-                        gp_Pnt p2 = data2.curve->Value(t2);
-
-                        double dist = p1.Distance(p2);
-                        if (dist < minDistance) {
-                            minDistance = dist;
-                            closestPoint1 = p1;
-                            closestPoint2 = p2;
-                        }
-                    }
-                }
-
-                if (minDistance < tolerance) {
-                    // Use simple average for intersection point
-                    gp_Pnt intersectionPoint(
-                        (closestPoint1.X() + closestPoint2.X()) / 2.0,
-                        (closestPoint1.Y() + closestPoint2.Y()) / 2.0,
-                        (closestPoint1.Z() + closestPoint2.Z()) / 2.0
-                    );
-                    addIntersectionPoint(intersectionPoint);
-                }
-            } catch (...) {
-                // If geometric intersection fails, use fallback method
-                const int fineSamples = 8;
-                double minDistance = std::numeric_limits<double>::max();
-                gp_Pnt closestPoint1, closestPoint2;
-
-                for (int i = 0; i <= fineSamples; ++i) {
-                    Standard_Real t1 = data1.first + (data1.last - data1.first) * i / fineSamples;
-                    gp_Pnt p1 = data1.curve->Value(t1);
-
-                    for (int j = 0; j <= fineSamples; ++j) {
-                        Standard_Real t2 = data2.first + (data2.last - data2.first) * j / fineSamples;
-                        gp_Pnt p2 = data2.curve->Value(t2);
-
-                        double dist = p1.Distance(p2);
-                        if (dist < minDistance) {
-                            minDistance = dist;
-                            closestPoint1 = p1;
-                            closestPoint2 = p2;
-                        }
-                    }
-                }
-
-                if (minDistance < tolerance) {
-                    gp_Pnt intersectionPoint(
-                        (closestPoint1.X() + closestPoint2.X()) / 2.0,
-                        (closestPoint1.Y() + closestPoint2.Y()) / 2.0,
-                        (closestPoint1.Z() + closestPoint2.Z()) / 2.0
-                    );
-                    addIntersectionPoint(intersectionPoint);
-                }
-            }
-        });
+    EdgeIntersectionAccelerator accelerator;
+    accelerator.buildFromEdges(edges);
+    intersectionPoints = accelerator.extractIntersectionsParallel(tolerance);
 }
 
 void OriginalEdgeExtractor::findEdgeIntersectionsSimple(
@@ -1164,62 +681,6 @@ void OriginalEdgeExtractor::findEdgeIntersectionsSimple(
     }
 }
 
-void OriginalEdgeExtractor::checkEdgeIntersection(
-    const EdgeData& edge1, const EdgeData& edge2,
-    std::vector<gp_Pnt>& intersectionPoints, double tolerance) {
-
-    // Use OpenCASCADE's native extrema algorithm for accurate intersection
-    try {
-        GeomAPI_ExtremaCurveCurve extrema(
-            edge1.curve, edge2.curve,
-            edge1.first, edge1.last,
-            edge2.first, edge2.last
-        );
-        
-        if (extrema.NbExtrema() > 0) {
-            double minDist = std::numeric_limits<double>::max();
-            int minIndex = -1;
-            
-            for (int i = 1; i <= extrema.NbExtrema(); ++i) {
-                double dist = extrema.Distance(i);
-                if (dist < minDist) {
-                    minDist = dist;
-                    minIndex = i;
-                }
-            }
-            
-            if (minIndex > 0 && minDist < tolerance) {
-                gp_Pnt p1, p2;
-                extrema.Points(minIndex, p1, p2);
-                
-                // Use midpoint as intersection point
-                gp_Pnt intersectionPoint(
-                    (p1.X() + p2.X()) / 2.0,
-                    (p1.Y() + p2.Y()) / 2.0,
-                    (p1.Z() + p2.Z()) / 2.0
-                );
-
-                // Check if already found (optimize by checking recent points first)
-                bool alreadyFound = false;
-                const size_t maxCheck = std::min(size_t(10), intersectionPoints.size()); // Only check last 10 points
-                for (size_t k = intersectionPoints.size() - maxCheck; k < intersectionPoints.size(); ++k) {
-                    if (intersectionPoint.Distance(intersectionPoints[k]) < tolerance) {
-                        alreadyFound = true;
-                        break;
-                    }
-                }
-
-                if (!alreadyFound) {
-                    intersectionPoints.push_back(intersectionPoint);
-                }
-            }
-        }
-    } catch (const Standard_Failure&) {
-        // Some edge pairs cannot be computed - this is normal
-        return;
-    }
-}
-
 // ============================================================================
 // Progressive Display Implementation
 // ============================================================================
@@ -1232,7 +693,7 @@ void OriginalEdgeExtractor::findEdgeIntersectionsProgressive(
     std::function<void(int, const std::string&)> onProgress) {
     
     // Check cache first - if cached, use cached results and call batch callback
-    size_t shapeHash = reinterpret_cast<size_t>(shape.TShape().get());
+    size_t shapeHash = EdgeGeometryCache::getInstance().getShapeHash(shape);
     std::ostringstream keyStream;
     keyStream << "intersections_" << shapeHash << "_" 
               << std::fixed << std::setprecision(6) << tolerance;
@@ -1283,30 +744,15 @@ void OriginalEdgeExtractor::findEdgeIntersectionsProgressive(
         return;
     }
     
-    // Build spatial grid and edge data
-    std::vector<EdgeData> edgeData;
-    edgeData.reserve(edges.size());
-    
-    // Calculate global bounding box
-    AABB globalBbox;
-    for (const auto& edge : edges) {
-        Standard_Real first, last;
-        Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, first, last);
-        if (curve.IsNull()) continue;
-        
-        EdgeData data(edge, tolerance * 2.0);
-        edgeData.push_back(data);
-        globalBbox.Add(gp_Pnt(data.bbox.minX, data.bbox.minY, data.bbox.minZ));
-        globalBbox.Add(gp_Pnt(data.bbox.maxX, data.bbox.maxY, data.bbox.maxZ));
-    }
-    
-    if (edgeData.empty()) {
+    EdgeIntersectionAccelerator accelerator;
+    accelerator.buildFromEdges(edges);
+    if (accelerator.getEdgeCount() == 0) {
         LOG_WRN_S("OriginalEdgeExtractor: No valid edges found");
         return;
     }
     
     // Use progressive TBB implementation
-    findIntersectionsProgressiveTBB(edgeData, intersectionPoints, tolerance, onBatchComplete, onProgress);
+    findIntersectionsProgressiveTBB(accelerator, intersectionPoints, tolerance, onBatchComplete, onProgress);
     
     // Store in cache after computation
     if (!intersectionPoints.empty()) {
@@ -1317,7 +763,7 @@ void OriginalEdgeExtractor::findEdgeIntersectionsProgressive(
 }
 
 void OriginalEdgeExtractor::findIntersectionsProgressiveTBB(
-    const std::vector<EdgeData>& edgeData,
+    const EdgeIntersectionAccelerator& accelerator,
     std::vector<gp_Pnt>& intersectionPoints,
     double tolerance,
     std::function<void(const std::vector<gp_Pnt>&)> onBatchComplete,
@@ -1325,126 +771,31 @@ void OriginalEdgeExtractor::findIntersectionsProgressiveTBB(
     
     LOG_INF_S_ASYNC("OriginalEdgeExtractor: Starting TBB progressive intersection detection");
     
-    // Calculate optimal grid dimensions
-    AABB globalBbox;
-    for (const auto& data : edgeData) {
-        globalBbox.Add(gp_Pnt(data.bbox.minX, data.bbox.minY, data.bbox.minZ));
-        globalBbox.Add(gp_Pnt(data.bbox.maxX, data.bbox.maxY, data.bbox.maxZ));
-    }
-    
-    double sizeX = globalBbox.maxX - globalBbox.minX;
-    double sizeY = globalBbox.maxY - globalBbox.minY;
-    double sizeZ = globalBbox.maxZ - globalBbox.minZ;
+    auto candidatePairs = accelerator.findPotentialIntersections(tolerance);
     
-    const int targetEdgesPerCell = 8;
-    double totalVolume = sizeX * sizeY * sizeZ;
-    double avgCellVolume = totalVolume / (edgeData.size() / targetEdgesPerCell);
-    double cellSize = std::cbrt(avgCellVolume);
-    
-    int gridSizeX = std::max(1, static_cast<int>(sizeX / cellSize));
-    int gridSizeY = std::max(1, static_cast<int>(sizeY / cellSize));
-    int gridSizeZ = std::max(1, static_cast<int>(sizeZ / cellSize));
-    
-    // Build spatial grid
-    int totalGridCells = gridSizeX * gridSizeY * gridSizeZ;
-    std::vector<std::vector<size_t>> gridCells(totalGridCells);
-    
-    double xmin = globalBbox.minX;
-    double ymin = globalBbox.minY;
-    double zmin = globalBbox.minZ;
-    
-    for (size_t i = 0; i < edgeData.size(); ++i) {
-        const EdgeData& data = edgeData[i];
-        
-        // Assign to grid cell based on bounding box center
-        double centerX = (data.bbox.minX + data.bbox.maxX) / 2.0 - xmin;
-        double centerY = (data.bbox.minY + data.bbox.maxY) / 2.0 - ymin;
-        double centerZ = (data.bbox.minZ + data.bbox.maxZ) / 2.0 - zmin;
-        
-        int gridX = std::max(0, std::min(gridSizeX - 1, static_cast<int>(centerX / (sizeX / gridSizeX))));
-        int gridY = std::max(0, std::min(gridSizeY - 1, static_cast<int>(centerY / (sizeY / gridSizeY))));
-        int gridZ = std::max(0, std::min(gridSizeZ - 1, static_cast<int>(centerZ / (sizeZ / gridSizeZ))));
-        
-        int gridIndex = gridX * (gridSizeY * gridSizeZ) + gridY * gridSizeZ + gridZ;
-        gridCells[gridIndex].push_back(i);
-    }
-    
-    // Generate task batches
-    auto taskBatches = generateTaskBatches(gridCells, edgeData, 100); // 100 tasks per batch
-    
-    // Process batches progressively
+    // Process candidate pairs in batches so markers appear while the rest runs
+    const size_t batchSize = 256;
+    const size_t batchCount = (candidatePairs.size() + batchSize - 1) / batchSize;
     std::vector<gp_Pnt> allIntersections;
-    std::atomic<size_t> totalProcessed{0};
     
-    for (size_t batchIndex = 0; batchIndex < taskBatches.size(); ++batchIndex) {
-        const auto& batch = taskBatches[batchIndex];
-        if (batch.empty()) continue;
+    for (size_t batchIndex = 0; batchIndex < batchCount; ++batchIndex) {
+        const size_t begin = batchIndex * batchSize;
+        const size_t end = std::min(begin + batchSize, candidatePairs.size());
+        std::vector<EdgeIntersectionAccelerator::EdgePair> batch(
+            candidatePairs.begin() + begin, candidatePairs.begin() + end);
         
         // Process batch in parallel using TBB
-        tbb::concurrent_vector<gp_Pnt> batchIntersections;
-        
-        tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, batch.size()),
-            [&](const tbb::blocked_range<size_t>& range) {
-                for (size_t i = range.begin(); i < range.end(); ++i) {
-                    const auto& task = batch[i];
-                    size_t idx1 = task.first;
-                    size_t idx2 = task.second;
-                    
-                    // Check intersection
-                    const EdgeData& data1 = edgeData[idx1];
-                    const EdgeData& data2 = edgeData[idx2];
-                    
-                    // Use improved distance-based intersection detection
-                    const int fineSamples = 16;
-                    double minDistance = std::numeric_limits<double>::max();
-                    gp_Pnt closestPoint1, closestPoint2;
-                    
-                    for (int i = 0; i <= fineSamples; ++i) {
-                        Standard_Real t1 = data1.first + (data1.last - data1.first) * i / fineSamples;
-                        gp_Pnt p1 = data1.curve->Value(t1);
-                        
-                        for (int j = 0; j <= fineSamples; ++j) {
-                            Standard_Real t2 = data2.first + (data2.last - data2.first) * j / fineSamples;
-                            gp_Pnt p2 = data2.curve->Value(t2);
-                            
-                            double dist = p1.Distance(p2);
-                            if (dist < minDistance) {
-                                minDistance = dist;
-                                closestPoint1 = p1;
-                                closestPoint2 = p2;
-                            }
-                        }
-                    }
-                    
-                    if (minDistance < tolerance) {
-                        gp_Pnt intersectionPoint(
-                            (closestPoint1.X() + closestPoint2.X()) / 2.0,
-                            (closestPoint1.Y() + closestPoint2.Y()) / 2.0,
-                            (closestPoint1.Z() + closestPoint2.Z()) / 2.0
-                        );
-                        
-                        batchIntersections.push_back(intersectionPoint);
-                    }
-                }
-            }
-        );
-        
-        // Convert concurrent vector to regular vector
-        std::vector<gp_Pnt> batchResults(batchIntersections.begin(), batchIntersections.end());
+        std::vector<gp_Pnt> batchResults = EdgeIntersectionAccelerator::mergeCoincidentPoints(
+            accelerator.intersectPairs(batch, tolerance), tolerance);
         
         // Add to total results
         allIntersections.insert(allIntersections.end(), batchResults.begin(), batchResults.end());
         
-        // Update progress
-        totalProcessed += batch.size();
-        int progress = static_cast<int>(((batchIndex + 1) * 100) / taskBatches.size());
-        std::string message = "Processed batch " + std::to_string(batchIndex + 1) + 
-                            "/" + std::to_string(taskBatches.size()) + 
-                            ", found " + std::to_string(batchResults.size()) + " intersections";
-        
         // Update progress callback only when computation is complete
-        if (onProgress && batchIndex + 1 == taskBatches.size()) {
+        if (onProgress && batchIndex + 1 == batchCount) {
+            std::string message = "Processed batch " + std::to_string(batchIndex + 1) + 
+                                "/" + std::to_string(batchCount) + 
+                                ", found " + std::to_string(batchResults.size()) + " intersections";
             onProgress(100, message);
         }
         
@@ -1454,74 +805,6 @@ void OriginalEdgeExtractor::findIntersectionsProgressiveTBB(
         }
     }
     
-    intersectionPoints = std::move(allIntersections);
-}
-
-std::vector<std::vector<std::pair<size_t, size_t>>> OriginalEdgeExtractor::generateTaskBatches(
-    const std::vector<std::vector<size_t>>& gridCells,
-    const std::vector<EdgeData>& edgeData,
-    size_t batchSize) {
-    
-    std::vector<std::pair<size_t, size_t>> allTasks;
-    
-    // Generate all intersection tasks
-    for (size_t cellIndex = 0; cellIndex < gridCells.size(); ++cellIndex) {
-        const auto& cellEdges = gridCells[cellIndex];
-        if (cellEdges.empty()) continue;
-        
-        // Within-cell intersections
-        for (size_t i = 0; i < cellEdges.size(); ++i) {
-            for (size_t j = i + 1; j < cellEdges.size(); ++j) {
-                allTasks.emplace_back(cellEdges[i], cellEdges[j]);
-            }
-        }
-        
-        // Cross-cell intersections with neighbors (simplified - check all cells for now)
-        for (size_t otherCellIndex = cellIndex + 1; otherCellIndex < gridCells.size(); ++otherCellIndex) {
-            const auto& otherEdges = gridCells[otherCellIndex];
-            if (otherEdges.empty()) continue;
-            
-            for (size_t i : cellEdges) {
-                for (size_t j : otherEdges) {
-                    if (i < j && edgeData[i].bbox.intersects(edgeData[j].bbox)) {
-                        allTasks.emplace_back(i, j);
-                    }
-                }
-            }
-        }
-    }
-    
-    // Split into batches
-    std::vector<std::vector<std::pair<size_t, size_t>>> batches;
-    for (size_t i = 0; i < allTasks.size(); i += batchSize) {
-        size_t end = std::min(i + batchSize, allTasks.size());
-        batches.emplace_back(allTasks.begin() + i, allTasks.begin() + end);
-    }
-    
-    return batches;
+    // Points where several edges meet are found once per edge pair
+    intersectionPoints = EdgeIntersectionAccelerator::mergeCoincidentPoints(allIntersections, tolerance);
 }
-
-std::vector<gp_Pnt> OriginalEdgeExtractor::processIntersectionBatch(
-    const std::vector<std::pair<size_t, size_t>>& batch,
-    const std::vector<EdgeData>& edgeData,
-    double tolerance) {
-    
-    std::vector<gp_Pnt> intersections;
-    
-    for (const auto& task : batch) {
-        size_t idx1 = task.first;
-        size_t idx2 = task.second;
-        
-        const EdgeData& data1 = edgeData[idx1];
-        const EdgeData& data2 = edgeData[idx2];
-        
-        // Check intersection using existing method
-        std::vector<gp_Pnt> tempIntersections;
-        checkEdgeIntersection(data1, data2, tempIntersections, tolerance);
-        
-        intersections.insert(intersections.end(), tempIntersections.begin(), tempIntersections.end());
-    }
-    
-    return intersections;
-}
-
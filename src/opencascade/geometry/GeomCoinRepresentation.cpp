@@ -13,6 +13,8 @@
 #include "geometry/helper/WireframeBuilder.h"
 #include "geometry/helper/PointViewBuilder.h"
 #include "geometry/helper/FaceDomainMapper.h"
+#include "geometry/helper/FaceLookupIndex.h"
+#include "geometry/helper/FaceMeshCache.h"
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoTransform.h>
 #include <Inventor/nodes/SoMaterial.h>
@@ -69,6 +71,9 @@ GeomCoinRepresentation::GeomCoinRepresentation()
     m_wireframeBuilder = std::make_unique<WireframeBuilder>();
     m_pointViewBuilder = std::make_unique<PointViewBuilder>();
     m_faceMapper = std::make_unique<FaceDomainMapper>();
+    m_faceLookup = std::make_unique<FaceLookupIndex>();
+    m_faceMeshCache = std::make_unique<FaceMeshCache>();
+    m_renderBuilder->setFaceMeshCache(m_faceMeshCache.get());
 }
 
 GeomCoinRepresentation::~GeomCoinRepresentation()
@@ -106,6 +111,9 @@ void GeomCoinRepresentation::buildCoinRepresentation(const TopoDS_Shape& shape,
         return;
     }
     
+    // The surface built below doesn't come from the face cache, so it can't be patched
+    m_faceMeshCache->setSurfaceNode(nullptr);
+
     // Create or clear coin node
     // CRITICAL FIX: Following FreeCAD's approach - disable render caching
     if (!m_coinNode) {
@@ -171,6 +179,9 @@ void GeomCoinRepresentation::buildCoinRepresentation(
         return;
     }
 
+    // The surface built below doesn't come from the face cache, so it can't be patched
+    m_faceMeshCache->setSurfaceNode(nullptr);
+
     // Create or clear coin node
     // CRITICAL FIX: Following FreeCAD's approach - disable render caching
     if (!m_coinNode) {
@@ -230,9 +241,85 @@ void GeomCoinRepresentation::forceCoinRepresentationRebuild(const TopoDS_Shape&
 {
     m_meshRegenerationNeeded = true;
     m_coinNeedsUpdate = true;
+    m_faceMeshCache->invalidate();
     buildCoinRepresentation(shape, params);
 }
 
+void GeomCoinRepresentation::markShapeChanged()
+{
+    // Anything else already pending (material, transform, display mode) needs the full rebuild
+    m_surfacePatchPending = !m_meshRegenerationNeeded && m_coinNode != nullptr;
+    m_meshRegenerationNeeded = true;
+}
+
+bool GeomCoinRepresentation::patchSurfaceGeometry(const TopoDS_Shape& shape, const MeshParameters& params,
+                                                  const GeometryRenderContext& context)
+{
+    if (!m_surfacePatchPending || !m_coinNode || shape.IsNull()) {
+        return false;
+    }
+    m_surfacePatchPending = false;
+
+    SoSeparator* surfaceNode = m_faceMeshCache->getSurfaceNode();
+    if (!surfaceNode || m_coinNode->findChild(surfaceNode) < 0) {
+        return false;
+    }
+
+    // Only the shaded surface is patched; wireframe, point and edge overlays are
+    // derived from the shape separately and come back with a full rebuild
+    const RenderingConfig::DisplayMode mode = context.display.displayMode;
+    if (context.display.wireframeMode || context.display.showPointView ||
+        (mode != RenderingConfig::DisplayMode::Solid &&
+         mode != RenderingConfig::DisplayMode::NoShading &&
+         mode != RenderingConfig::DisplayMode::Transparent)) {
+        return false;
+    }
+    if (modularEdgeComponent) {
+        const EdgeDisplayFlags& flags = modularEdgeComponent->edgeFlags;
+        if (flags.showOriginalEdges || flags.showFeatureEdges || flags.showMeshEdges ||
+            flags.showHighlightEdges || flags.showVerticeNormals || flags.showFaceNormals) {
+            return false;
+        }
+    }
+    const EdgeSettingsConfig& edgeCfg = EdgeSettingsConfig::getInstance();
+    if (edgeCfg.getGlobalSettings().showEdges || edgeCfg.getSelectedSettings().showEdges ||
+        edgeCfg.getHoverSettings().showEdges) {
+        return false;
+    }
+    if (m_lastMeshParams.deflection != params.deflection ||
+        m_lastMeshParams.angularDeflection != params.angularDeflection) {
+        return false;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    FaceMeshCache::UpdateResult update = m_faceMeshCache->update(shape, params);
+    if (!m_faceMeshCache->patch()) {
+        return false;
+    }
+
+    // Picking and highlighting tables follow the new faces
+    if (update.changed() || !hasFaceDomainMapping()) {
+        m_faceMapper->buildFaceDomainMapping(shape, *m_faceMeshCache, m_faceDomains, m_triangleSegments,
+                                             m_boundaryTriangles, m_faceLookup.get());
+    }
+    if (m_vertexExtractor) {
+        try {
+            m_vertexExtractor->extractAndCache(shape);
+        } catch (const std::exception& e) {
+            LOG_ERR_S("GeomCoinRepresentation: Failed to cache vertices: " + std::string(e.what()));
+        }
+    }
+
+    m_coinNeedsUpdate = false;
+    m_meshRegenerationNeeded = false;
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - startTime);
+    LOG_DBG_S("GeomCoinRepresentation: patched " + std::to_string(update.retessellated) + " of " +
+              std::to_string(update.faceCount) + " faces in " + std::to_string(duration.count()) + " ms");
+    return true;
+}
+
 void GeomCoinRepresentation::setEdgeDisplayType(EdgeType type, bool show)
 {
     if (modularEdgeComponent) {
@@ -331,6 +418,8 @@ void GeomCoinRepresentation::buildCoinRepresentation(
     if (!m_coinNode) {
                 return;
     }
+    m_faceMeshCache->setSurfaceNode(nullptr);
+    m_surfacePatchPending = false;
 
     // Check if mesh parameters changed - if so, clear mesh-dependent edge nodes
     // This ensures that when edges are re-enabled, they will be regenerated with new mesh quality
@@ -348,9 +437,13 @@ void GeomCoinRepresentation::buildCoinRepresentation(
         // Clear reverse mapping when mesh parameters change
     }
     
+    // Bring the per-face tessellation up to date; unchanged faces keep their chunks
+    FaceMeshCache::UpdateResult meshUpdate = m_faceMeshCache->update(shape, params);
+
     // Build face domain mapping using helper
-    if (!hasFaceDomainMapping() || meshParamsChanged) {
-        m_faceMapper->buildFaceDomainMapping(shape, params, m_faceDomains, m_triangleSegments, m_boundaryTriangles);
+    if (!hasFaceDomainMapping() || meshParamsChanged || meshUpdate.changed()) {
+        m_faceMapper->buildFaceDomainMapping(shape, *m_faceMeshCache, m_faceDomains, m_triangleSegments,
+                                             m_boundaryTriangles, m_faceLookup.get());
         if (!hasFaceDomainMapping()) {
             LOG_WRN_S("Face domain mapping is empty - face highlighting may not work");
         }
@@ -498,13 +591,36 @@ void GeomCoinRepresentation::updateDisplayMode(RenderingConfig::DisplayMode mode
 
 
 
+void GeomCoinRepresentation::setLODSourceTriangles(const SoNode* lodFaceSet, std::vector<int> sourceTriangles)
+{
+    if (lodFaceSet) {
+        m_lodSourceTriangles[lodFaceSet] = std::move(sourceTriangles);
+    }
+}
+
+int GeomCoinRepresentation::resolveLODTriangle(const SoNode* faceSet, int triangleIndex) const
+{
+    auto it = m_lodSourceTriangles.find(faceSet);
+    if (it == m_lodSourceTriangles.end()) {
+        return triangleIndex; // full-resolution face set
+    }
+    if (triangleIndex < 0 || static_cast<size_t>(triangleIndex) >= it->second.size()) {
+        return -1;
+    }
+    return it->second[triangleIndex];
+}
+
 int GeomCoinRepresentation::getGeometryFaceIdForTriangle(int triangleIndex) const {
     // Use domain system to find which face contains this triangle
     if (!hasFaceDomainMapping()) {
         return -1;
     }
 
-    // Search through triangle segments to find which face contains this triangle
+    if (m_faceLookup && !m_faceLookup->isEmpty()) {
+        return m_faceLookup->faceForTriangle(triangleIndex);
+    }
+
+    // Fallback when the lookup tables were not built (e.g. segments set directly)
     for (const auto& segment : m_triangleSegments) {
         if (segment.contains(triangleIndex)) {
             return segment.geometryFaceId;
@@ -562,26 +678,20 @@ void GeomCoinRepresentation::buildTriangleSegments(const std::vector<std::pair<i
 
 void GeomCoinRepresentation::identifyBoundaryTriangles(const std::vector<std::pair<int, std::vector<int>>>& faceMappings)
 {
-    std::map<int, std::vector<int>> triangleToFacesMap;
-    for (const auto& [faceId, triangleIndices] : faceMappings) {
-        for (int triangleIndex : triangleIndices) {
-            triangleToFacesMap[triangleIndex].push_back(faceId);
-        }
-    }
-    for (const auto& [triangleIndex, faceIds] : triangleToFacesMap) {
-        if (faceIds.size() > 1) {
-            BoundaryTriangle boundaryTri(triangleIndex);
-            boundaryTri.faceIds = faceIds;
-            boundaryTri.isBoundary = true;
-            m_boundaryTriangles.push_back(boundaryTri);
-        }
-    }
+    m_faceLookup->buildTriangleTables(faceMappings);
+    m_boundaryTriangles.clear();
+    m_faceLookup->collectBoundaryTriangles(m_boundaryTriangles);
 }
 
 // ===== Query Methods for New Domain System =====
 
 const FaceDomain* GeomCoinRepresentation::getFaceDomain(int geometryFaceId) const
 {
+    // Domains are built in face order, so the id is normally the slot
+    if (geometryFaceId >= 0 && static_cast<std::size_t>(geometryFaceId) < m_faceDomains.size() &&
+        m_faceDomains[geometryFaceId].geometryFaceId == geometryFaceId) {
+        return &m_faceDomains[geometryFaceId];
+    }
     for (const auto& domain : m_faceDomains) {
         if (domain.geometryFaceId == geometryFaceId) {
             return &domain;
@@ -592,6 +702,10 @@ const FaceDomain* GeomCoinRepresentation::getFaceDomain(int geometryFaceId) cons
 
 const TriangleSegment* GeomCoinRepresentation::getTriangleSegment(int geometryFaceId) const
 {
+    if (geometryFaceId >= 0 && static_cast<std::size_t>(geometryFaceId) < m_triangleSegments.size() &&
+        m_triangleSegments[geometryFaceId].geometryFaceId == geometryFaceId) {
+        return &m_triangleSegments[geometryFaceId];
+    }
     for (const auto& segment : m_triangleSegments) {
         if (segment.geometryFaceId == geometryFaceId) {
             return &segment;
@@ -602,28 +716,27 @@ const TriangleSegment* GeomCoinRepresentation::getTriangleSegment(int geometryFa
 
 bool GeomCoinRepresentation::isBoundaryTriangle(int triangleIndex) const
 {
-    for (const auto& boundaryTri : m_boundaryTriangles) {
-        if (boundaryTri.triangleIndex == triangleIndex) {
-            return boundaryTri.isBoundary;
-        }
-    }
-    return false;
+    const BoundaryTriangle* boundaryTri = getBoundaryTriangle(triangleIndex);
+    return boundaryTri && boundaryTri->isBoundary;
 }
 
 const BoundaryTriangle* GeomCoinRepresentation::getBoundaryTriangle(int triangleIndex) const
 {
-    for (const auto& boundaryTri : m_boundaryTriangles) {
-        if (boundaryTri.triangleIndex == triangleIndex) {
-            return &boundaryTri;
-        }
+    // Boundary triangles are kept sorted by triangle index
+    auto it = std::lower_bound(m_boundaryTriangles.begin(), m_boundaryTriangles.end(), triangleIndex,
+        [](const BoundaryTriangle& boundaryTri, int index) { return boundaryTri.triangleIndex < index; });
+    if (it != m_boundaryTriangles.end() && it->triangleIndex == triangleIndex) {
+        return &*it;
     }
     return nullptr;
 }
 
 std::vector<int> GeomCoinRepresentation::getGeometryFaceIdsForTriangle(int triangleIndex) const
 {
-    // Domain system doesn't support multiple faces per triangle efficiently
-    // Return single face if found
+    if (m_faceLookup && !m_faceLookup->isEmpty()) {
+        FaceLookupIndex::IdRange faces = m_faceLookup->facesForTriangle(triangleIndex);
+        return std::vector<int>(faces.begin(), faces.end());
+    }
     int faceId = getGeometryFaceIdForTriangle(triangleIndex);
     if (faceId >= 0) {
         return {faceId};
@@ -633,8 +746,10 @@ std::vector<int> GeomCoinRepresentation::getGeometryFaceIdsForTriangle(int trian
 
 std::vector<int> GeomCoinRepresentation::getTrianglesForGeometryFace(int geometryFaceId) const
 {
-    // Deprecated: Now we use FaceDomain directly instead of triangle indices
-    // This method is kept for backward compatibility but should not be used
-    LOG_WRN_S("getTrianglesForGeometryFace is deprecated - use getFaceDomain instead for face " + std::to_string(geometryFaceId));
-    return {};
+    if (m_faceLookup && !m_faceLookup->isEmpty()) {
+        FaceLookupIndex::IdRange triangles = m_faceLookup->trianglesForFace(geometryFaceId);
+        return std::vector<int>(triangles.begin(), triangles.end());
+    }
+    const TriangleSegment* segment = getTriangleSegment(geometryFaceId);
+    return segment ? segment->triangleIndices : std::vector<int>();
 }
@@ -1,6 +1,5 @@
 #include "geometry/VertexExtractor.h"
 #include "logger/Logger.h"
-#include <OpenCASCADE/TopExp_Explorer.hxx>
 #include <OpenCASCADE/TopoDS.hxx>
 #include <OpenCASCADE/TopoDS_Vertex.hxx>
 #include <OpenCASCADE/TopAbs.hxx>
@@ -10,7 +9,14 @@
 #include <Inventor/nodes/SoDrawStyle.h>
 #include <Inventor/nodes/SoCoordinate3.h>
 #include <Inventor/nodes/SoPointSet.h>
-#include <set>
+#include <OpenCASCADE/TopExp.hxx>
+#include <OpenCASCADE/TopTools_IndexedMapOfShape.hxx>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+namespace {
+    constexpr double kMergeTolerance = 1e-4;
+}
 
 VertexExtractor::VertexExtractor()
     : m_cacheValid(false)
@@ -27,7 +33,7 @@ size_t VertexExtractor::extractAndCache(const TopoDS_Shape& shape)
     std::lock_guard<std::mutex> lock(m_mutex);
     
     // Clear previous cache
-    m_cachedVertices.clear();
+    m_index.clear();
     m_cacheValid = false;
     
     if (shape.IsNull()) {
@@ -36,37 +42,35 @@ size_t VertexExtractor::extractAndCache(const TopoDS_Shape& shape)
     }
     
     try {
-        // Use a set to track unique vertices (based on rounded coordinates)
-        std::set<std::tuple<double, double, double>> uniquePoints;
+        // Each shared TopoDS_Vertex once, instead of once per edge using it
+        TopTools_IndexedMapOfShape vertexMap;
+        TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
         
-        // Extract all vertices from the shape
-        for (TopExp_Explorer exp(shape, TopAbs_VERTEX); exp.More(); exp.Next()) {
-            const TopoDS_Vertex& vertex = TopoDS::Vertex(exp.Current());
-            
-            if (vertex.IsNull()) continue;
-            
-            gp_Pnt point = BRep_Tool::Pnt(vertex);
-            
-            // Round coordinates for deduplication (tolerance: 0.0001)
-            double x = std::round(point.X() * 10000.0) / 10000.0;
-            double y = std::round(point.Y() * 10000.0) / 10000.0;
-            double z = std::round(point.Z() * 10000.0) / 10000.0;
-            
-            auto key = std::make_tuple(x, y, z);
-            
-            // Only add unique vertices
-            if (uniquePoints.find(key) == uniquePoints.end()) {
-                uniquePoints.insert(key);
-                m_cachedVertices.push_back(point);
-            }
+        std::vector<gp_Pnt> points(static_cast<size_t>(vertexMap.Extent()));
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, points.size(), 1024),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    points[i] = BRep_Tool::Pnt(TopoDS::Vertex(vertexMap(static_cast<int>(i) + 1)));
+                }
+            });
+        
+        // Merge distinct vertices that coincide within tolerance (0.0001)
+        std::vector<size_t> kept = VertexSpatialIndex::deduplicate(points, kMergeTolerance);
+        std::vector<gp_Pnt> uniquePoints;
+        uniquePoints.reserve(kept.size());
+        for (size_t index : kept) {
+            uniquePoints.push_back(points[index]);
         }
         
+        m_index.build(std::move(uniquePoints));
         m_cacheValid = true;
-        return m_cachedVertices.size();
+        return m_index.size();
         
     } catch (const std::exception& e) {
         LOG_ERR_S("VertexExtractor::extractAndCache: Exception: " + std::string(e.what()));
-        clearCache();
+        // m_mutex is already held here, so don't go through clearCache()
+        m_index.clear();
+        m_cacheValid = false;
         return 0;
     }
 }
@@ -75,7 +79,8 @@ SoSeparator* VertexExtractor::createPointNode(const Quantity_Color& color, doubl
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    if (!m_cacheValid || m_cachedVertices.empty()) {
+    const std::vector<gp_Pnt>& cachedVertices = m_index.getPoints();
+    if (!m_cacheValid || cachedVertices.empty()) {
         LOG_WRN_S("VertexExtractor::createPointNode: No cached vertex data available");
         return nullptr;
     }
@@ -107,9 +112,9 @@ SoSeparator* VertexExtractor::createPointNode(const Quantity_Color& color, doubl
         
         // Add coordinates
         SoCoordinate3* coords = new SoCoordinate3();
-        coords->point.setNum(m_cachedVertices.size());
-        for (size_t i = 0; i < m_cachedVertices.size(); ++i) {
-            const gp_Pnt& pt = m_cachedVertices[i];
+        coords->point.setNum(cachedVertices.size());
+        for (size_t i = 0; i < cachedVertices.size(); ++i) {
+            const gp_Pnt& pt = cachedVertices[i];
             coords->point.set1Value(i,
                 static_cast<float>(pt.X()),
                 static_cast<float>(pt.Y()),
@@ -120,7 +125,7 @@ SoSeparator* VertexExtractor::createPointNode(const Quantity_Color& color, doubl
         
         // Add point set
         SoPointSet* pointSet = new SoPointSet();
-        pointSet->numPoints.setValue(m_cachedVertices.size());
+        pointSet->numPoints.setValue(cachedVertices.size());
         pointNode->addChild(pointSet);
         
         return pointNode;
@@ -134,29 +139,55 @@ SoSeparator* VertexExtractor::createPointNode(const Quantity_Color& color, doubl
 bool VertexExtractor::hasCache() const
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return m_cacheValid && !m_cachedVertices.empty();
+    return m_cacheValid && !m_index.isEmpty();
 }
 
 size_t VertexExtractor::getCachedCount() const
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return m_cachedVertices.size();
+    return m_index.size();
 }
 
 void VertexExtractor::clearCache()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_cachedVertices.clear();
+    m_index.clear();
     m_cacheValid = false;
 }
 
 bool VertexExtractor::isDuplicate(const gp_Pnt& point, double tolerance) const
 {
-    for (const auto& cached : m_cachedVertices) {
-        if (cached.Distance(point) < tolerance) {
-            return true;
-        }
+    const int nearest = m_index.findNearest(point, tolerance);
+    return nearest >= 0 && m_index.getPoints()[nearest].Distance(point) < tolerance;
+}
+
+bool VertexExtractor::findNearestVertex(const gp_Pnt& point, double maxDistance, gp_Pnt& nearest) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_cacheValid) {
+        return false;
+    }
+    const int index = m_index.findNearest(point, maxDistance);
+    if (index < 0) {
+        return false;
+    }
+    nearest = m_index.getPoints()[index];
+    return true;
+}
+
+std::vector<gp_Pnt> VertexExtractor::findVerticesWithinRadius(const gp_Pnt& center, double radius) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<gp_Pnt> result;
+    if (!m_cacheValid) {
+        return result;
+    }
+    std::vector<int> indices;
+    m_index.findWithinRadius(center, radius, indices);
+    result.reserve(indices.size());
+    for (int index : indices) {
+        result.push_back(m_index.getPoints()[index]);
     }
-    return false;
+    return result;
 }
 
@@ -0,0 +1,262 @@
+#include "geometry/VertexSpatialIndex.h"
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/blocked_range.h>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+    constexpr std::size_t kGrainSize = 4096;
+    constexpr double kMinCellSize = 1e-9;
+    constexpr double kDegenerateExtent = 1e-12;
+
+    // Edge length giving about one point per cell over the dimensions the points span
+    double cellSizeForDensity(const std::vector<gp_Pnt>& points) {
+        double minCoord[3] = { points[0].X(), points[0].Y(), points[0].Z() };
+        double maxCoord[3] = { minCoord[0], minCoord[1], minCoord[2] };
+        for (const gp_Pnt& p : points) {
+            const double coord[3] = { p.X(), p.Y(), p.Z() };
+            for (int axis = 0; axis < 3; ++axis) {
+                minCoord[axis] = std::min(minCoord[axis], coord[axis]);
+                maxCoord[axis] = std::max(maxCoord[axis], coord[axis]);
+            }
+        }
+
+        double measure = 1.0;
+        int dimensions = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            const double extent = maxCoord[axis] - minCoord[axis];
+            if (extent > kDegenerateExtent) {
+                measure *= extent;
+                ++dimensions;
+            }
+        }
+        if (dimensions == 0) {
+            return 1.0;
+        }
+        return std::pow(measure / static_cast<double>(points.size()), 1.0 / dimensions);
+    }
+}
+
+std::size_t VertexSpatialIndex::CellHash::operator()(const Cell& cell) const {
+    // Prime multipliers from Teschner et al., "Optimized Spatial Hashing"
+    const uint64_t hash = (static_cast<uint64_t>(cell.x) * 73856093ULL) ^
+                          (static_cast<uint64_t>(cell.y) * 19349663ULL) ^
+                          (static_cast<uint64_t>(cell.z) * 83492791ULL);
+    return static_cast<std::size_t>(hash);
+}
+
+VertexSpatialIndex::VertexSpatialIndex()
+    : m_cellSize(1.0)
+    , m_inverseCellSize(1.0) {
+}
+
+VertexSpatialIndex::Cell VertexSpatialIndex::cellOf(const gp_Pnt& point) const {
+    return Cell{
+        static_cast<int64_t>(std::floor(point.X() * m_inverseCellSize)),
+        static_cast<int64_t>(std::floor(point.Y() * m_inverseCellSize)),
+        static_cast<int64_t>(std::floor(point.Z() * m_inverseCellSize))
+    };
+}
+
+template <typename Visitor>
+void VertexSpatialIndex::visitCell(const Cell& cell, Visitor&& visitor) const {
+    auto it = m_cells.find(cell);
+    if (it == m_cells.end()) {
+        return;
+    }
+    for (uint32_t k = it->second.first; k < it->second.second; ++k) {
+        visitor(m_order[k]);
+    }
+}
+
+void VertexSpatialIndex::clear() {
+    std::vector<gp_Pnt>().swap(m_points);
+    std::vector<uint32_t>().swap(m_order);
+    m_cells.clear();
+}
+
+void VertexSpatialIndex::build(std::vector<gp_Pnt> points, double cellSize) {
+    clear();
+    m_points = std::move(points);
+    if (m_points.empty()) {
+        return;
+    }
+
+    if (cellSize <= 0.0) {
+        cellSize = cellSizeForDensity(m_points);
+    }
+    m_cellSize = std::max(cellSize, kMinCellSize);
+    m_inverseCellSize = 1.0 / m_cellSize;
+
+    const std::size_t count = m_points.size();
+    std::vector<Cell> cells(count);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, count, kGrainSize),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+            for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                cells[i] = cellOf(m_points[i]);
+            }
+        });
+
+    // Group by cell; within a cell points stay in input order
+    m_order.resize(count);
+    std::iota(m_order.begin(), m_order.end(), 0u);
+    tbb::parallel_sort(m_order.begin(), m_order.end(), [&cells](uint32_t a, uint32_t b) {
+        const Cell& ca = cells[a];
+        const Cell& cb = cells[b];
+        if (ca.x != cb.x) return ca.x < cb.x;
+        if (ca.y != cb.y) return ca.y < cb.y;
+        if (ca.z != cb.z) return ca.z < cb.z;
+        return a < b;
+    });
+
+    m_cells.reserve(count);
+    uint32_t begin = 0;
+    for (uint32_t k = 1; k <= count; ++k) {
+        if (k == count || !(cells[m_order[k]] == cells[m_order[begin]])) {
+            m_cells.emplace(cells[m_order[begin]], std::make_pair(begin, k));
+            begin = k;
+        }
+    }
+}
+
+int VertexSpatialIndex::findNearest(const gp_Pnt& query, double maxDistance) const {
+    if (m_points.empty() || maxDistance < 0.0) {
+        return -1;
+    }
+
+    int best = -1;
+    double bestSquared = maxDistance * maxDistance;
+    auto consider = [&](uint32_t index) {
+        const double squared = m_points[index].SquareDistance(query);
+        if (squared <= bestSquared) {
+            // Ties go to the earlier point so results don't depend on cell order
+            if (squared < bestSquared || best < 0 || static_cast<int>(index) < best) {
+                best = static_cast<int>(index);
+                bestSquared = squared;
+            }
+        }
+    };
+
+    const double rings = std::ceil(maxDistance * m_inverseCellSize);
+    const double cellsToVisit = std::pow(2.0 * rings + 1.0, 3.0);
+    if (cellsToVisit > static_cast<double>(m_cells.size())) {
+        // The search box covers more cells than are occupied; scanning them is cheaper
+        for (const auto& entry : m_cells) {
+            for (uint32_t k = entry.second.first; k < entry.second.second; ++k) {
+                consider(m_order[k]);
+            }
+        }
+        return best;
+    }
+
+    // Visit shells of cells around the query; once a shell is done, any point not
+    // yet seen is at least ring * cellSize away
+    const Cell center = cellOf(query);
+    const int64_t maxRing = static_cast<int64_t>(rings);
+    for (int64_t ring = 0; ring <= maxRing; ++ring) {
+        for (int64_t dx = -ring; dx <= ring; ++dx) {
+            for (int64_t dy = -ring; dy <= ring; ++dy) {
+                const bool onShell = std::abs(dx) == ring || std::abs(dy) == ring;
+                const int64_t step = onShell ? 1 : std::max<int64_t>(2 * ring, 1);
+                for (int64_t dz = -ring; dz <= ring; dz += step) {
+                    visitCell(Cell{ center.x + dx, center.y + dy, center.z + dz }, consider);
+                }
+            }
+        }
+        const double covered = static_cast<double>(ring) * m_cellSize;
+        if (best >= 0 && bestSquared <= covered * covered) {
+            break;
+        }
+    }
+    return best;
+}
+
+void VertexSpatialIndex::findWithinRadius(const gp_Pnt& center, double radius, std::vector<int>& result) const {
+    result.clear();
+    if (m_points.empty() || radius < 0.0) {
+        return;
+    }
+
+    const double radiusSquared = radius * radius;
+    auto collect = [&](uint32_t index) {
+        if (m_points[index].SquareDistance(center) <= radiusSquared) {
+            result.push_back(static_cast<int>(index));
+        }
+    };
+
+    const Cell low = cellOf(gp_Pnt(center.X() - radius, center.Y() - radius, center.Z() - radius));
+    const Cell high = cellOf(gp_Pnt(center.X() + radius, center.Y() + radius, center.Z() + radius));
+    const double cellsToVisit = static_cast<double>(high.x - low.x + 1) *
+                                static_cast<double>(high.y - low.y + 1) *
+                                static_cast<double>(high.z - low.z + 1);
+    if (cellsToVisit > static_cast<double>(m_cells.size())) {
+        for (const auto& entry : m_cells) {
+            const Cell& cell = entry.first;
+            if (cell.x < low.x || cell.x > high.x || cell.y < low.y || cell.y > high.y ||
+                cell.z < low.z || cell.z > high.z) {
+                continue;
+            }
+            for (uint32_t k = entry.second.first; k < entry.second.second; ++k) {
+                collect(m_order[k]);
+            }
+        }
+        return;
+    }
+
+    for (int64_t x = low.x; x <= high.x; ++x) {
+        for (int64_t y = low.y; y <= high.y; ++y) {
+            for (int64_t z = low.z; z <= high.z; ++z) {
+                visitCell(Cell{ x, y, z }, collect);
+            }
+        }
+    }
+}
+
+std::vector<std::size_t> VertexSpatialIndex::deduplicate(const std::vector<gp_Pnt>& points, double tolerance) {
+    std::vector<std::size_t> kept;
+    if (points.empty()) {
+        return kept;
+    }
+    if (tolerance <= 0.0) {
+        kept.resize(points.size());
+        std::iota(kept.begin(), kept.end(), std::size_t(0));
+        return kept;
+    }
+
+    // With cells one tolerance wide, every candidate lies in the 27 surrounding cells
+    VertexSpatialIndex grid;
+    grid.build(points, tolerance);
+    const double toleranceSquared = tolerance * tolerance;
+
+    std::vector<char> duplicate(points.size(), 0);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, points.size(), kGrainSize),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+            for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                const gp_Pnt& point = points[i];
+                const Cell cell = grid.cellOf(point);
+                bool found = false;
+                for (int64_t dx = -1; dx <= 1 && !found; ++dx) {
+                    for (int64_t dy = -1; dy <= 1 && !found; ++dy) {
+                        for (int64_t dz = -1; dz <= 1 && !found; ++dz) {
+                            grid.visitCell(Cell{ cell.x + dx, cell.y + dy, cell.z + dz }, [&](uint32_t j) {
+                                if (!found && j < i && points[j].SquareDistance(point) <= toleranceSquared) {
+                                    found = true;
+                                }
+                            });
+                        }
+                    }
+                }
+                duplicate[i] = found ? 1 : 0;
+            }
+        });
+
+    kept.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        if (!duplicate[i]) {
+            kept.push_back(i);
+        }
+    }
+    return kept;
+}
@@ -1,5 +1,8 @@
 #include "geometry/helper/FaceDomainMapper.h"
+#include "geometry/helper/FaceLookupIndex.h"
+#include "geometry/helper/FaceMeshCache.h"
 #include "geometry/GeomCoinRepresentation.h"
+#include "logger/Logger.h"
 #include "rendering/RenderingToolkitAPI.h"
 #include "rendering/OpenCASCADEProcessor.h"
 #include <OpenCASCADE/TopExp_Explorer.hxx>
@@ -12,7 +15,6 @@
 #include <OpenCASCADE/BRep_Tool.hxx>
 #include <OpenCASCADE/Poly_Triangulation.hxx>
 #include <OpenCASCADE/gp_Trsf.hxx>
-#include <map>
 #include <algorithm>
 
 FaceDomainMapper::FaceDomainMapper() {
@@ -25,15 +27,21 @@ void FaceDomainMapper::buildFaceDomainMapping(const TopoDS_Shape& shape,
                                                const MeshParameters& params,
                                                std::vector<FaceDomain>& faceDomains,
                                                std::vector<TriangleSegment>& triangleSegments,
-                                               std::vector<BoundaryTriangle>& boundaryTriangles) {
+                                               std::vector<BoundaryTriangle>& boundaryTriangles,
+                                               FaceLookupIndex* lookupIndex) {
     if (shape.IsNull()) {
         return;
     }
 
+    // Callers that don't keep the lookup tables still need them to find boundary triangles
+    FaceLookupIndex localIndex;
+    FaceLookupIndex& index = lookupIndex ? *lookupIndex : localIndex;
+
     try {
         faceDomains.clear();
         triangleSegments.clear();
         boundaryTriangles.clear();
+        index.clear();
 
         std::vector<TopoDS_Face> faces;
         extractFaces(shape, faces);
@@ -51,17 +59,81 @@ void FaceDomainMapper::buildFaceDomainMapping(const TopoDS_Shape& shape,
             TriangleMesh meshWithMapping = processor->convertToMeshWithFaceMapping(shape, params, faceMappings);
 
             buildFaceDomains(shape, faces, params, faceDomains);
-            buildTriangleSegments(faceMappings, triangleSegments);
-            identifyBoundaryTriangles(faceMappings, boundaryTriangles);
+            buildMappingTables(shape, faces, meshWithMapping, faceMappings, triangleSegments,
+                               boundaryTriangles, index, lookupIndex != nullptr);
         }
     }
     catch (const std::exception& e) {
         faceDomains.clear();
         triangleSegments.clear();
         boundaryTriangles.clear();
+        index.clear();
     }
 }
 
+void FaceDomainMapper::buildFaceDomainMapping(const TopoDS_Shape& shape,
+                                               const FaceMeshCache& meshCache,
+                                               std::vector<FaceDomain>& faceDomains,
+                                               std::vector<TriangleSegment>& triangleSegments,
+                                               std::vector<BoundaryTriangle>& boundaryTriangles,
+                                               FaceLookupIndex* lookupIndex) {
+    if (shape.IsNull()) {
+        return;
+    }
+
+    FaceLookupIndex localIndex;
+    FaceLookupIndex& index = lookupIndex ? *lookupIndex : localIndex;
+
+    try {
+        faceDomains.clear();
+        triangleSegments.clear();
+        boundaryTriangles.clear();
+        index.clear();
+
+        std::vector<TopoDS_Face> faces;
+        extractFaces(shape, faces);
+        if (faces.empty() || meshCache.isEmpty()) {
+            return;
+        }
+
+        std::vector<std::pair<int, std::vector<int>>> faceMappings;
+        TriangleMesh mesh;
+        meshCache.assemble(mesh, &faceMappings);
+
+        buildFaceDomains(shape, faces, MeshParameters(), faceDomains);
+        buildMappingTables(shape, faces, mesh, faceMappings, triangleSegments,
+                           boundaryTriangles, index, lookupIndex != nullptr);
+    }
+    catch (const std::exception& e) {
+        faceDomains.clear();
+        triangleSegments.clear();
+        boundaryTriangles.clear();
+        index.clear();
+    }
+}
+
+void FaceDomainMapper::buildMappingTables(const TopoDS_Shape& shape,
+                                          const std::vector<TopoDS_Face>& faces,
+                                          const TriangleMesh& mesh,
+                                          const std::vector<std::pair<int, std::vector<int>>>& faceMappings,
+                                          std::vector<TriangleSegment>& triangleSegments,
+                                          std::vector<BoundaryTriangle>& boundaryTriangles,
+                                          FaceLookupIndex& index,
+                                          bool keepLookupIndex) {
+    buildTriangleSegments(faceMappings, triangleSegments);
+
+    index.buildTriangleTables(faceMappings);
+    if (keepLookupIndex) {
+        index.buildVertexTable(mesh);
+        index.buildEdgeTable(shape, faces);
+        LOG_DBG_S("FaceDomainMapper: lookup index for " + std::to_string(index.getFaceCount()) +
+                  " faces / " + std::to_string(index.getTriangleCount()) + " triangles uses " +
+                  std::to_string(index.getMemoryUsage()) + " bytes" +
+                  (index.usesRangeTable() ? " (range table)" : " (flat table)"));
+    }
+    identifyBoundaryTriangles(index, boundaryTriangles);
+}
+
 void FaceDomainMapper::extractFaces(const TopoDS_Shape& shape, std::vector<TopoDS_Face>& faces) {
     for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
         TopoDS_Face face = TopoDS::Face(exp.Current());
@@ -179,23 +251,8 @@ void FaceDomainMapper::buildTriangleSegments(const std::vector<std::pair<int, st
     }
 }
 
-void FaceDomainMapper::identifyBoundaryTriangles(const std::vector<std::pair<int, std::vector<int>>>& faceMappings,
+void FaceDomainMapper::identifyBoundaryTriangles(const FaceLookupIndex& lookupIndex,
                                                    std::vector<BoundaryTriangle>& boundaryTriangles) {
-    std::map<int, std::vector<int>> triangleToFacesMap;
-
-    for (const auto& [faceId, triangleIndices] : faceMappings) {
-        for (int triangleIndex : triangleIndices) {
-            triangleToFacesMap[triangleIndex].push_back(faceId);
-        }
-    }
-
-    for (const auto& [triangleIndex, faceIds] : triangleToFacesMap) {
-        if (faceIds.size() > 1) {
-            BoundaryTriangle boundaryTri(triangleIndex);
-            boundaryTri.faceIds = faceIds;
-            boundaryTri.isBoundary = true;
-            boundaryTriangles.push_back(boundaryTri);
-        }
-    }
+    boundaryTriangles.clear();
+    lookupIndex.collectBoundaryTriangles(boundaryTriangles);
 }
-
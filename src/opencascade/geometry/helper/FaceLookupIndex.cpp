@@ -0,0 +1,415 @@
+#include "geometry/helper/FaceLookupIndex.h"
+#include "geometry/GeomCoinRepresentation.h"
+#include <OpenCASCADE/TopExp.hxx>
+#include <OpenCASCADE/TopExp_Explorer.hxx>
+#include <OpenCASCADE/TopTools_IndexedMapOfShape.hxx>
+#include <OpenCASCADE/TopAbs.hxx>
+#include <OpenCASCADE/TopoDS.hxx>
+#include <OpenCASCADE/BRep_Tool.hxx>
+#include <OpenCASCADE/Poly_Triangulation.hxx>
+#include <OpenCASCADE/Poly_PolygonOnTriangulation.hxx>
+#include <OpenCASCADE/Poly_Polygon3D.hxx>
+#include <algorithm>
+#include <tuple>
+
+FaceLookupIndex::FaceLookupIndex()
+    : m_faceCount(0)
+    , m_triangleCount(0)
+    , m_useRangeTable(false) {
+}
+
+FaceLookupIndex::~FaceLookupIndex() {
+}
+
+void FaceLookupIndex::clear() {
+    m_faceCount = 0;
+    m_triangleCount = 0;
+    m_useRangeTable = false;
+
+    // swap() releases capacity, clear() would keep it
+    std::vector<uint32_t>().swap(m_rangeStarts);
+    std::vector<uint32_t>().swap(m_rangeFaces);
+    std::vector<uint32_t>().swap(m_triangleToFace);
+    std::vector<uint32_t>().swap(m_boundaryTriangles);
+    std::vector<uint32_t>().swap(m_boundaryOffsets);
+    std::vector<uint32_t>().swap(m_boundaryFaces);
+    std::vector<uint32_t>().swap(m_faceTriangleOffsets);
+    std::vector<uint32_t>().swap(m_faceTriangles);
+    std::vector<uint32_t>().swap(m_faceEdgeOffsets);
+    std::vector<uint32_t>().swap(m_faceEdges);
+    std::vector<uint32_t>().swap(m_edgePointOffsets);
+    std::vector<float>().swap(m_edgePoints);
+    std::vector<uint32_t>().swap(m_vertexFaceOffsets);
+    std::vector<uint32_t>().swap(m_vertexFaces);
+}
+
+void FaceLookupIndex::buildTriangleTables(const std::vector<std::pair<int, std::vector<int>>>& faceMappings) {
+    clear();
+
+    // Size the tables from the largest ids seen
+    int maxFaceId = -1;
+    int maxTriangle = -1;
+    for (const auto& [faceId, triangleIndices] : faceMappings) {
+        if (faceId < 0) {
+            continue;
+        }
+        maxFaceId = std::max(maxFaceId, faceId);
+        for (int triangleIndex : triangleIndices) {
+            maxTriangle = std::max(maxTriangle, triangleIndex);
+        }
+    }
+
+    if (maxFaceId < 0) {
+        return;
+    }
+
+    m_faceCount = static_cast<std::size_t>(maxFaceId) + 1;
+    m_triangleCount = static_cast<std::size_t>(maxTriangle + 1);
+
+    // Face -> triangles (CSR)
+    m_faceTriangleOffsets.assign(m_faceCount + 1, 0);
+    for (const auto& [faceId, triangleIndices] : faceMappings) {
+        if (faceId < 0) {
+            continue;
+        }
+        for (int triangleIndex : triangleIndices) {
+            if (triangleIndex >= 0) {
+                ++m_faceTriangleOffsets[faceId + 1];
+            }
+        }
+    }
+    for (std::size_t i = 0; i < m_faceCount; ++i) {
+        m_faceTriangleOffsets[i + 1] += m_faceTriangleOffsets[i];
+    }
+
+    m_faceTriangles.resize(m_faceTriangleOffsets.back());
+    std::vector<uint32_t> cursor(m_faceTriangleOffsets.begin(), m_faceTriangleOffsets.end() - 1);
+    for (const auto& [faceId, triangleIndices] : faceMappings) {
+        if (faceId < 0) {
+            continue;
+        }
+        for (int triangleIndex : triangleIndices) {
+            if (triangleIndex >= 0) {
+                m_faceTriangles[cursor[faceId]++] = static_cast<uint32_t>(triangleIndex);
+            }
+        }
+    }
+    for (std::size_t face = 0; face < m_faceCount; ++face) {
+        std::sort(m_faceTriangles.begin() + m_faceTriangleOffsets[face],
+                  m_faceTriangles.begin() + m_faceTriangleOffsets[face + 1]);
+    }
+
+    // Occupancy per triangle to detect boundary (shared) triangles
+    std::vector<uint32_t> occupancy(m_triangleCount, 0);
+    for (uint32_t triangleIndex : m_faceTriangles) {
+        ++occupancy[triangleIndex];
+    }
+
+    // Range table is possible when every face owns one contiguous, non-overlapping run
+    std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> ranges; // start, end, face
+    ranges.reserve(m_faceCount);
+    bool contiguous = true;
+    for (std::size_t face = 0; face < m_faceCount && contiguous; ++face) {
+        uint32_t begin = m_faceTriangleOffsets[face];
+        uint32_t end = m_faceTriangleOffsets[face + 1];
+        if (begin == end) {
+            continue;
+        }
+        uint32_t first = m_faceTriangles[begin];
+        uint32_t last = m_faceTriangles[end - 1];
+        if (last - first + 1 != end - begin) {
+            contiguous = false;
+            break;
+        }
+        ranges.emplace_back(first, last + 1, static_cast<uint32_t>(face));
+    }
+    if (contiguous) {
+        std::sort(ranges.begin(), ranges.end());
+        for (std::size_t i = 1; i < ranges.size(); ++i) {
+            if (std::get<0>(ranges[i]) < std::get<1>(ranges[i - 1])) {
+                contiguous = false;
+                break;
+            }
+        }
+    }
+
+    if (contiguous) {
+        m_useRangeTable = true;
+        m_rangeStarts.reserve(ranges.size());
+        m_rangeFaces.reserve(ranges.size());
+        for (const auto& range : ranges) {
+            m_rangeStarts.push_back(std::get<0>(range));
+            m_rangeFaces.push_back(std::get<2>(range));
+        }
+    } else {
+        m_useRangeTable = false;
+        m_triangleToFace.assign(m_triangleCount, InvalidId);
+        for (std::size_t face = 0; face < m_faceCount; ++face) {
+            for (uint32_t i = m_faceTriangleOffsets[face]; i < m_faceTriangleOffsets[face + 1]; ++i) {
+                uint32_t& owner = m_triangleToFace[m_faceTriangles[i]];
+                if (owner == InvalidId) {
+                    owner = static_cast<uint32_t>(face);
+                }
+            }
+        }
+    }
+
+    // Boundary triangles (CSR keyed by sorted triangle index)
+    std::vector<uint32_t> boundarySlot(m_triangleCount, InvalidId);
+    for (uint32_t triangleIndex = 0; triangleIndex < m_triangleCount; ++triangleIndex) {
+        if (occupancy[triangleIndex] > 1) {
+            boundarySlot[triangleIndex] = static_cast<uint32_t>(m_boundaryTriangles.size());
+            m_boundaryTriangles.push_back(triangleIndex);
+        }
+    }
+    if (!m_boundaryTriangles.empty()) {
+        m_boundaryOffsets.assign(m_boundaryTriangles.size() + 1, 0);
+        for (std::size_t slot = 0; slot < m_boundaryTriangles.size(); ++slot) {
+            m_boundaryOffsets[slot + 1] = m_boundaryOffsets[slot] + occupancy[m_boundaryTriangles[slot]];
+        }
+        m_boundaryFaces.resize(m_boundaryOffsets.back());
+        std::vector<uint32_t> fill(m_boundaryOffsets.begin(), m_boundaryOffsets.end() - 1);
+        for (std::size_t face = 0; face < m_faceCount; ++face) {
+            for (uint32_t i = m_faceTriangleOffsets[face]; i < m_faceTriangleOffsets[face + 1]; ++i) {
+                uint32_t slot = boundarySlot[m_faceTriangles[i]];
+                if (slot != InvalidId) {
+                    m_boundaryFaces[fill[slot]++] = static_cast<uint32_t>(face);
+                }
+            }
+        }
+    }
+}
+
+void FaceLookupIndex::buildVertexTable(const TriangleMesh& mesh) {
+    std::vector<uint32_t>().swap(m_vertexFaceOffsets);
+    std::vector<uint32_t>().swap(m_vertexFaces);
+
+    if (isEmpty() || mesh.vertices.empty()) {
+        return;
+    }
+
+    const std::size_t vertexCount = mesh.vertices.size();
+    const std::size_t triangleCount = std::min(m_triangleCount, mesh.triangles.size() / 3);
+
+    // (vertex, face) pairs, deduplicated so each face appears once per vertex
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    pairs.reserve(triangleCount * 3);
+    for (std::size_t t = 0; t < triangleCount; ++t) {
+        int face = faceForTriangle(static_cast<int>(t));
+        if (face < 0) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            int vertex = mesh.triangles[t * 3 + k];
+            if (vertex >= 0 && static_cast<std::size_t>(vertex) < vertexCount) {
+                pairs.emplace_back(static_cast<uint32_t>(vertex), static_cast<uint32_t>(face));
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    m_vertexFaceOffsets.assign(vertexCount + 1, 0);
+    for (const auto& entry : pairs) {
+        ++m_vertexFaceOffsets[entry.first + 1];
+    }
+    for (std::size_t i = 0; i < vertexCount; ++i) {
+        m_vertexFaceOffsets[i + 1] += m_vertexFaceOffsets[i];
+    }
+    m_vertexFaces.reserve(pairs.size());
+    for (const auto& entry : pairs) {
+        m_vertexFaces.push_back(entry.second);
+    }
+}
+
+void FaceLookupIndex::buildEdgeTable(const TopoDS_Shape& shape, const std::vector<TopoDS_Face>& faces) {
+    std::vector<uint32_t>().swap(m_faceEdgeOffsets);
+    std::vector<uint32_t>().swap(m_faceEdges);
+    std::vector<uint32_t>().swap(m_edgePointOffsets);
+    std::vector<float>().swap(m_edgePoints);
+
+    if (shape.IsNull() || faces.empty()) {
+        return;
+    }
+
+    TopTools_IndexedMapOfShape edgeMap;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+
+    m_faceEdgeOffsets.assign(faces.size() + 1, 0);
+    std::vector<std::vector<float>> polylines(static_cast<std::size_t>(edgeMap.Extent()));
+    std::vector<uint32_t> faceEdges;
+    for (std::size_t face = 0; face < faces.size(); ++face) {
+        faceEdges.clear();
+        TopLoc_Location faceLocation;
+        const Handle(Poly_Triangulation)& triangulation = BRep_Tool::Triangulation(faces[face], faceLocation);
+        for (TopExp_Explorer exp(faces[face], TopAbs_EDGE); exp.More(); exp.Next()) {
+            int edgeIndex = edgeMap.FindIndex(exp.Current());
+            if (edgeIndex > 0) {
+                faceEdges.push_back(static_cast<uint32_t>(edgeIndex - 1));
+                std::vector<float>& polyline = polylines[static_cast<std::size_t>(edgeIndex - 1)];
+                if (polyline.empty()) {
+                    appendEdgePolyline(TopoDS::Edge(exp.Current()), triangulation, faceLocation, polyline);
+                }
+            }
+        }
+        // Seam edges are visited twice per face
+        std::sort(faceEdges.begin(), faceEdges.end());
+        faceEdges.erase(std::unique(faceEdges.begin(), faceEdges.end()), faceEdges.end());
+
+        m_faceEdges.insert(m_faceEdges.end(), faceEdges.begin(), faceEdges.end());
+        m_faceEdgeOffsets[face + 1] = static_cast<uint32_t>(m_faceEdges.size());
+    }
+
+    m_edgePointOffsets.assign(polylines.size() + 1, 0);
+    std::size_t pointCount = 0;
+    for (const auto& polyline : polylines) {
+        pointCount += polyline.size();
+    }
+    m_edgePoints.reserve(pointCount);
+    for (std::size_t edge = 0; edge < polylines.size(); ++edge) {
+        m_edgePoints.insert(m_edgePoints.end(), polylines[edge].begin(), polylines[edge].end());
+        m_edgePointOffsets[edge + 1] = static_cast<uint32_t>(m_edgePoints.size() / 3);
+    }
+}
+
+void FaceLookupIndex::appendEdgePolyline(const TopoDS_Edge& edge, const Handle(Poly_Triangulation)& triangulation,
+                                         const TopLoc_Location& faceLocation, std::vector<float>& points) {
+    auto append = [&points](const gp_Pnt& point) {
+        points.push_back(static_cast<float>(point.X()));
+        points.push_back(static_cast<float>(point.Y()));
+        points.push_back(static_cast<float>(point.Z()));
+    };
+
+    // Prefer the edge's discretisation on the face mesh so the outline lies on the shaded triangles
+    if (!triangulation.IsNull()) {
+        TopLoc_Location edgeLocation;
+        Handle(Poly_PolygonOnTriangulation) polygon =
+            BRep_Tool::PolygonOnTriangulation(edge, triangulation, edgeLocation);
+        if (!polygon.IsNull() && edgeLocation == faceLocation) {
+            const gp_Trsf transform = faceLocation.Transformation();
+            const TColStd_Array1OfInteger& nodes = polygon->Nodes();
+            for (Standard_Integer i = nodes.Lower(); i <= nodes.Upper(); ++i) {
+                append(triangulation->Node(nodes(i)).Transformed(transform));
+            }
+            return;
+        }
+    }
+
+    TopLoc_Location curveLocation;
+    Handle(Poly_Polygon3D) polygon = BRep_Tool::Polygon3D(edge, curveLocation);
+    if (!polygon.IsNull()) {
+        const gp_Trsf transform = curveLocation.Transformation();
+        for (Standard_Integer i = 1; i <= polygon->NbNodes(); ++i) {
+            append(polygon->Nodes()(i).Transformed(transform));
+        }
+    }
+}
+
+int FaceLookupIndex::faceForTriangle(int triangleIndex) const {
+    if (triangleIndex < 0 || static_cast<std::size_t>(triangleIndex) >= m_triangleCount) {
+        return -1;
+    }
+    const uint32_t tri = static_cast<uint32_t>(triangleIndex);
+
+    if (!m_useRangeTable) {
+        uint32_t face = m_triangleToFace[tri];
+        return face == InvalidId ? -1 : static_cast<int>(face);
+    }
+
+    auto it = std::upper_bound(m_rangeStarts.begin(), m_rangeStarts.end(), tri);
+    if (it == m_rangeStarts.begin()) {
+        return -1;
+    }
+    std::size_t slot = static_cast<std::size_t>(std::distance(m_rangeStarts.begin(), it)) - 1;
+    uint32_t face = m_rangeFaces[slot];
+    uint32_t count = m_faceTriangleOffsets[face + 1] - m_faceTriangleOffsets[face];
+    return tri < m_rangeStarts[slot] + count ? static_cast<int>(face) : -1;
+}
+
+FaceLookupIndex::IdRange FaceLookupIndex::facesForTriangle(int triangleIndex) const {
+    if (triangleIndex < 0 || static_cast<std::size_t>(triangleIndex) >= m_triangleCount) {
+        return {};
+    }
+    const uint32_t tri = static_cast<uint32_t>(triangleIndex);
+
+    auto boundary = std::lower_bound(m_boundaryTriangles.begin(), m_boundaryTriangles.end(), tri);
+    if (boundary != m_boundaryTriangles.end() && *boundary == tri) {
+        std::size_t slot = static_cast<std::size_t>(std::distance(m_boundaryTriangles.begin(), boundary));
+        return rangeOf(m_boundaryOffsets, m_boundaryFaces, slot);
+    }
+
+    if (!m_useRangeTable) {
+        const uint32_t* owner = &m_triangleToFace[tri];
+        return *owner == InvalidId ? IdRange{} : IdRange{owner, owner + 1};
+    }
+
+    auto it = std::upper_bound(m_rangeStarts.begin(), m_rangeStarts.end(), tri);
+    if (it == m_rangeStarts.begin() || faceForTriangle(triangleIndex) < 0) {
+        return {};
+    }
+    const uint32_t* owner = &m_rangeFaces[std::distance(m_rangeStarts.begin(), it) - 1];
+    return {owner, owner + 1};
+}
+
+FaceLookupIndex::IdRange FaceLookupIndex::trianglesForFace(int geometryFaceId) const {
+    if (geometryFaceId < 0 || static_cast<std::size_t>(geometryFaceId) >= m_faceCount) {
+        return {};
+    }
+    return rangeOf(m_faceTriangleOffsets, m_faceTriangles, static_cast<std::size_t>(geometryFaceId));
+}
+
+FaceLookupIndex::IdRange FaceLookupIndex::edgesForFace(int geometryFaceId) const {
+    if (geometryFaceId < 0 || m_faceEdgeOffsets.empty() ||
+        static_cast<std::size_t>(geometryFaceId) + 1 >= m_faceEdgeOffsets.size()) {
+        return {};
+    }
+    return rangeOf(m_faceEdgeOffsets, m_faceEdges, static_cast<std::size_t>(geometryFaceId));
+}
+
+FaceLookupIndex::PointRange FaceLookupIndex::polylineForEdge(uint32_t edgeId) const {
+    if (static_cast<std::size_t>(edgeId) + 1 >= m_edgePointOffsets.size()) {
+        return {};
+    }
+    const float* base = m_edgePoints.data();
+    return {base + static_cast<std::size_t>(m_edgePointOffsets[edgeId]) * 3,
+            base + static_cast<std::size_t>(m_edgePointOffsets[edgeId + 1]) * 3};
+}
+
+FaceLookupIndex::IdRange FaceLookupIndex::facesForVertex(int vertexIndex) const {
+    if (vertexIndex < 0 || m_vertexFaceOffsets.empty() ||
+        static_cast<std::size_t>(vertexIndex) + 1 >= m_vertexFaceOffsets.size()) {
+        return {};
+    }
+    return rangeOf(m_vertexFaceOffsets, m_vertexFaces, static_cast<std::size_t>(vertexIndex));
+}
+
+void FaceLookupIndex::collectBoundaryTriangles(std::vector<BoundaryTriangle>& boundaryTriangles) const {
+    boundaryTriangles.reserve(boundaryTriangles.size() + m_boundaryTriangles.size());
+    for (std::size_t slot = 0; slot < m_boundaryTriangles.size(); ++slot) {
+        BoundaryTriangle boundaryTri(static_cast<int>(m_boundaryTriangles[slot]));
+        IdRange faces = rangeOf(m_boundaryOffsets, m_boundaryFaces, slot);
+        boundaryTri.faceIds.assign(faces.begin(), faces.end());
+        boundaryTri.isBoundary = true;
+        boundaryTriangles.push_back(std::move(boundaryTri));
+    }
+}
+
+std::size_t FaceLookupIndex::getMemoryUsage() const {
+    auto bytes = [](const auto& v) { return v.capacity() * sizeof(v[0]); };
+    return sizeof(*this) +
+        bytes(m_rangeStarts) + bytes(m_rangeFaces) + bytes(m_triangleToFace) +
+        bytes(m_boundaryTriangles) + bytes(m_boundaryOffsets) + bytes(m_boundaryFaces) +
+        bytes(m_faceTriangleOffsets) + bytes(m_faceTriangles) +
+        bytes(m_faceEdgeOffsets) + bytes(m_faceEdges) +
+        bytes(m_edgePointOffsets) + bytes(m_edgePoints) +
+        bytes(m_vertexFaceOffsets) + bytes(m_vertexFaces);
+}
+
+FaceLookupIndex::IdRange FaceLookupIndex::rangeOf(const std::vector<uint32_t>& offsets,
+                                                  const std::vector<uint32_t>& values, std::size_t row) {
+    if (row + 1 >= offsets.size()) {
+        return {};
+    }
+    const uint32_t* base = values.data();
+    return {base + offsets[row], base + offsets[row + 1]};
+}
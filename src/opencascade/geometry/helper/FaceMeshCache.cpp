@@ -0,0 +1,295 @@
+#include "geometry/helper/FaceMeshCache.h"
+#include "logger/Logger.h"
+#include "rendering/RenderingToolkitAPI.h"
+#include "rendering/OpenCASCADEProcessor.h"
+#include <Inventor/nodes/SoSeparator.h>
+#include <Inventor/nodes/SoCoordinate3.h>
+#include <Inventor/nodes/SoNormal.h>
+#include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <Inventor/nodes/SoIndexedLineSet.h>
+#include <OpenCASCADE/BRep_Builder.hxx>
+#include <OpenCASCADE/BRep_Tool.hxx>
+#include <OpenCASCADE/TopExp.hxx>
+#include <OpenCASCADE/TopLoc_Location.hxx>
+#include <OpenCASCADE/TopTools_IndexedMapOfShape.hxx>
+#include <OpenCASCADE/TopoDS.hxx>
+#include <OpenCASCADE/TopoDS_Compound.hxx>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <chrono>
+
+FaceMeshCache::FaceMeshCache() {
+}
+
+FaceMeshCache::~FaceMeshCache() {
+    setSurfaceNode(nullptr);
+}
+
+bool FaceMeshCache::sameParameters(const MeshParameters& a, const MeshParameters& b) {
+    // inParallel only affects how BRepMesh runs, not its result
+    return a.deflection == b.deflection &&
+           a.angularDeflection == b.angularDeflection &&
+           a.relative == b.relative;
+}
+
+FaceMeshCache::UpdateResult FaceMeshCache::update(const TopoDS_Shape& shape, const MeshParameters& params) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    UpdateResult result;
+
+    auto* processor = dynamic_cast<OpenCASCADEProcessor*>(
+        RenderingToolkitAPI::getManager().getGeometryProcessor("OpenCASCADE"));
+    if (shape.IsNull() || !processor) {
+        result.layoutChanged = !m_chunks.empty();
+        invalidate();
+        return result;
+    }
+
+    // Unique faces in explorer order, matching OpenCASCADEProcessor's face numbering
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    const std::size_t faceCount = static_cast<std::size_t>(faceMap.Extent());
+    const bool paramsChanged = !m_hasParams || !sameParameters(m_params, params);
+
+    std::vector<FaceChunk> chunks(faceCount);
+    std::vector<std::size_t> staleFaces;
+    bool layoutChanged = faceCount != m_chunks.size();
+
+    for (std::size_t i = 0; i < faceCount; ++i) {
+        FaceChunk& chunk = chunks[i];
+        chunk.face = TopoDS::Face(faceMap(static_cast<int>(i) + 1));
+
+        bool reused = false;
+        auto candidates = m_chunksByTShape.find(chunk.face.TShape().get());
+        if (!paramsChanged && candidates != m_chunksByTShape.end()) {
+            TopLoc_Location location;
+            const Handle(Poly_Triangulation)& current = BRep_Tool::Triangulation(chunk.face, location);
+            for (std::size_t oldIndex : candidates->second) {
+                FaceChunk& old = m_chunks[oldIndex];
+                // A null triangulation marks a chunk already taken by an earlier face
+                if (old.triangulation.IsNull() || old.triangulation != current || !old.face.IsEqual(chunk.face)) {
+                    continue;
+                }
+                chunk.triangulation = old.triangulation;
+                chunk.mesh = std::move(old.mesh);
+                chunk.dirty = old.dirty;  // Still owed to the surface node if not yet patched
+                old.triangulation.Nullify();
+                layoutChanged = layoutChanged || oldIndex != i;
+                reused = true;
+                break;
+            }
+        }
+        if (!reused) {
+            staleFaces.push_back(i);
+        }
+    }
+
+    if (!staleFaces.empty()) {
+        // Mesh only the faces that need it; BRepMesh reuses the discretisation of
+        // edges shared with untouched neighbours, so the seams stay closed
+        if (staleFaces.size() == faceCount) {
+            processor->triangulate(shape, params);
+        }
+        else {
+            BRep_Builder builder;
+            TopoDS_Compound compound;
+            builder.MakeCompound(compound);
+            for (std::size_t index : staleFaces) {
+                builder.Add(compound, chunks[index].face);
+            }
+            processor->triangulate(compound, params);
+        }
+
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, staleFaces.size(), 64),
+            [&](const tbb::blocked_range<std::size_t>& range) {
+                for (std::size_t k = range.begin(); k != range.end(); ++k) {
+                    FaceChunk& chunk = chunks[staleFaces[k]];
+                    TopLoc_Location location;
+                    chunk.triangulation = BRep_Tool::Triangulation(chunk.face, location);
+                    chunk.mesh = processor->convertFaceToMesh(chunk.face);
+                    // Vertices of a face without triangles still need a normal slot
+                    if (chunk.mesh.normals.size() != chunk.mesh.vertices.size()) {
+                        chunk.mesh.normals.resize(chunk.mesh.vertices.size(), gp_Vec(0, 0, 1));
+                    }
+                    chunk.dirty = true;
+                }
+            });
+
+        for (std::size_t index : staleFaces) {
+            if (layoutChanged) {
+                break;
+            }
+            const TriangleMesh& before = m_chunks[index].mesh;
+            const TriangleMesh& after = chunks[index].mesh;
+            // The old chunk at this slot may have been moved to another face; its
+            // size is then unknown and the layout has to be rebuilt
+            layoutChanged = m_chunks[index].triangulation.IsNull() ||
+                before.vertices.size() != after.vertices.size() ||
+                before.triangles.size() != after.triangles.size();
+        }
+    }
+
+    m_chunks = std::move(chunks);
+    m_chunksByTShape.clear();
+    m_chunksByTShape.reserve(m_chunks.size());
+    for (std::size_t i = 0; i < m_chunks.size(); ++i) {
+        m_chunksByTShape[m_chunks[i].face.TShape().get()].push_back(i);
+    }
+    m_params = params;
+    m_hasParams = true;
+    m_layoutChanged = m_layoutChanged || layoutChanged;
+    layoutChunks();
+
+    result.faceCount = faceCount;
+    result.retessellated = staleFaces.size();
+    result.layoutChanged = layoutChanged;
+
+    if (!staleFaces.empty()) {
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - startTime);
+        LOG_DBG_S("FaceMeshCache: retessellated " + std::to_string(staleFaces.size()) + " of " +
+                  std::to_string(faceCount) + " faces in " + std::to_string(duration.count()) + " ms" +
+                  (layoutChanged ? " (layout changed)" : ""));
+    }
+    return result;
+}
+
+void FaceMeshCache::layoutChunks() {
+    m_vertexCount = 0;
+    m_triangleCount = 0;
+    for (auto& chunk : m_chunks) {
+        chunk.vertexOffset = m_vertexCount;
+        chunk.triangleOffset = m_triangleCount;
+        m_vertexCount += chunk.mesh.vertices.size();
+        m_triangleCount += chunk.mesh.triangles.size() / 3;
+    }
+}
+
+void FaceMeshCache::assemble(TriangleMesh& mesh,
+                             std::vector<std::pair<int, std::vector<int>>>* faceMappings) const {
+    mesh.clear();
+    mesh.vertices.reserve(m_vertexCount);
+    mesh.normals.reserve(m_vertexCount);
+    mesh.triangles.reserve(m_triangleCount * 3);
+    if (faceMappings) {
+        faceMappings->clear();
+        faceMappings->reserve(m_chunks.size());
+    }
+
+    for (std::size_t faceIndex = 0; faceIndex < m_chunks.size(); ++faceIndex) {
+        const FaceChunk& chunk = m_chunks[faceIndex];
+        const int vertexOffset = static_cast<int>(chunk.vertexOffset);
+        mesh.vertices.insert(mesh.vertices.end(), chunk.mesh.vertices.begin(), chunk.mesh.vertices.end());
+        mesh.normals.insert(mesh.normals.end(), chunk.mesh.normals.begin(), chunk.mesh.normals.end());
+        for (int index : chunk.mesh.triangles) {
+            mesh.triangles.push_back(index + vertexOffset);
+        }
+
+        if (faceMappings) {
+            std::vector<int> triangleIndices(chunk.mesh.triangles.size() / 3);
+            for (std::size_t t = 0; t < triangleIndices.size(); ++t) {
+                triangleIndices[t] = static_cast<int>(chunk.triangleOffset + t);
+            }
+            faceMappings->emplace_back(static_cast<int>(faceIndex), std::move(triangleIndices));
+        }
+    }
+}
+
+void FaceMeshCache::setSurfaceNode(SoSeparator* node) {
+    if (node) {
+        node->ref();
+    }
+    if (m_surfaceNode) {
+        m_surfaceNode->unref();
+    }
+    m_surfaceNode = node;
+
+    // A freshly built node holds the current buffers
+    for (auto& chunk : m_chunks) {
+        chunk.dirty = false;
+    }
+    m_layoutChanged = false;
+}
+
+bool FaceMeshCache::patch() {
+    if (!m_surfaceNode || m_layoutChanged) {
+        return false;
+    }
+
+    SoCoordinate3* coords = nullptr;
+    SoNormal* normals = nullptr;
+    SoIndexedFaceSet* faceSet = nullptr;
+    for (int i = 0; i < m_surfaceNode->getNumChildren(); ++i) {
+        SoNode* child = m_surfaceNode->getChild(i);
+        if (child->isOfType(SoCoordinate3::getClassTypeId())) {
+            coords = static_cast<SoCoordinate3*>(child);
+        }
+        else if (child->isOfType(SoNormal::getClassTypeId())) {
+            normals = static_cast<SoNormal*>(child);
+        }
+        else if (child->isOfType(SoIndexedFaceSet::getClassTypeId())) {
+            faceSet = static_cast<SoIndexedFaceSet*>(child);
+        }
+        else if (child->isOfType(SoIndexedLineSet::getClassTypeId())) {
+            // Triangle edge overlay indexes the same coordinates; rebuild instead
+            return false;
+        }
+    }
+
+    if (!coords || !faceSet ||
+        coords->point.getNum() != static_cast<int>(m_vertexCount) ||
+        faceSet->coordIndex.getNum() != static_cast<int>(m_triangleCount * 4) ||
+        (normals && normals->vector.getNum() != static_cast<int>(m_vertexCount))) {
+        return false;
+    }
+
+    SbVec3f* points = coords->point.startEditing();
+    SbVec3f* normalVectors = normals ? normals->vector.startEditing() : nullptr;
+    int32_t* indices = faceSet->coordIndex.startEditing();
+
+    std::size_t patchedFaces = 0;
+    for (auto& chunk : m_chunks) {
+        if (!chunk.dirty) {
+            continue;
+        }
+        const TriangleMesh& mesh = chunk.mesh;
+        for (std::size_t v = 0; v < mesh.vertices.size(); ++v) {
+            const gp_Pnt& p = mesh.vertices[v];
+            points[chunk.vertexOffset + v].setValue(
+                static_cast<float>(p.X()), static_cast<float>(p.Y()), static_cast<float>(p.Z()));
+            if (normalVectors) {
+                const gp_Vec& n = mesh.normals[v];
+                normalVectors[chunk.vertexOffset + v].setValue(
+                    static_cast<float>(n.X()), static_cast<float>(n.Y()), static_cast<float>(n.Z()));
+            }
+        }
+        int32_t* out = indices + chunk.triangleOffset * 4;
+        const int32_t vertexOffset = static_cast<int32_t>(chunk.vertexOffset);
+        for (std::size_t t = 0; t + 2 < mesh.triangles.size(); t += 3) {
+            *out++ = mesh.triangles[t] + vertexOffset;
+            *out++ = mesh.triangles[t + 1] + vertexOffset;
+            *out++ = mesh.triangles[t + 2] + vertexOffset;
+            *out++ = -1;
+        }
+        chunk.dirty = false;
+        ++patchedFaces;
+    }
+
+    faceSet->coordIndex.finishEditing();
+    if (normals) {
+        normals->vector.finishEditing();
+    }
+    coords->point.finishEditing();
+
+    LOG_DBG_S("FaceMeshCache: patched " + std::to_string(patchedFaces) + " of " +
+              std::to_string(m_chunks.size()) + " faces in place");
+    return true;
+}
+
+void FaceMeshCache::invalidate() {
+    m_chunks.clear();
+    m_chunksByTShape.clear();
+    m_hasParams = false;
+    m_layoutChanged = true;
+    m_vertexCount = 0;
+    m_triangleCount = 0;
+}
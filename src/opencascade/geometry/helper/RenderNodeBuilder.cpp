@@ -1,4 +1,5 @@
 #include "geometry/helper/RenderNodeBuilder.h"
+#include "geometry/helper/FaceMeshCache.h"
 #include "rendering/RenderingToolkitAPI.h"
 #include "config/RenderingConfig.h"
 #include <Inventor/nodes/SoTransform.h>
@@ -201,6 +202,35 @@ void RenderNodeBuilder::appendSurfaceGeometry(SoSeparator* parent, const TopoDS_
         shouldShowFaces = shouldShowFaces && context.display.showSolidWithPointView;
     }
 
+    if (m_faceMeshCache) {
+        if (!shouldShowFaces) {
+            m_faceMeshCache->setSurfaceNode(nullptr);
+            return;
+        }
+
+        // Only faces that changed since the last build are tessellated again
+        m_faceMeshCache->update(shape, params);
+        TriangleMesh mesh;
+        m_faceMeshCache->assemble(mesh);
+        if (mesh.isEmpty()) {
+            m_faceMeshCache->setSurfaceNode(nullptr);
+            return;
+        }
+
+        // Same material as the shape overload, which leaves emissive black
+        auto sceneNode = backend->createSceneNode(mesh, context.display.selected,
+            context.material.diffuseColor, context.material.ambientColor,
+            context.material.specularColor, Quantity_Color(0.0, 0.0, 0.0, Quantity_TOC_RGB),
+            context.material.shininess, context.material.transparency);
+        SoSeparator* meshNode = sceneNode.get();
+        m_faceMeshCache->setSurfaceNode(meshNode);
+        if (meshNode) {
+            meshNode->ref();
+            parent->addChild(meshNode);
+        }
+        return;
+    }
+
     auto sceneNode = backend->createSceneNode(shape, params, context.display.selected,
         context.material.diffuseColor, context.material.ambientColor,
         context.material.specularColor, context.material.emissiveColor,
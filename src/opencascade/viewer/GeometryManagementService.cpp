@@ -16,6 +16,9 @@
 #include "logger/Logger.h"
 #include <Inventor/nodes/SoSeparator.h>
 
+#include <algorithm>
+#include <unordered_set>
+
 GeometryManagementService::GeometryManagementService(
     SceneManager* sceneManager,
     std::vector<std::shared_ptr<OCCGeometry>>* geometries,
@@ -57,17 +60,19 @@ bool GeometryManagementService::addGeometry(std::shared_ptr<OCCGeometry> geometr
         return false;
     }
 
-    // Check for existing geometry
-    if (m_geometryRepo && m_geometryRepo->existsByName(geometry->getName())) {
-        LOG_WRN_S("Geometry with name '" + geometry->getName() + "' already exists");
+    if (!m_geometryRepo) {
+        LOG_ERR_S("GeometryManagementService has no geometry repository");
         return false;
     }
 
-    // Store geometry
-    if (m_geometryRepo) {
-        m_geometryRepo->add(geometry);
+    // Check for existing geometry, then store it (the repository owns the geometry list)
+    if (m_geometryRepo->existsByName(geometry->getName())) {
+        LOG_WRN_S("Geometry with name '" + geometry->getName() + "' already exists");
+        return false;
+    }
+    if (!m_geometryRepo->add(geometry)) {
+        return false;
     }
-    m_geometries->push_back(geometry);
 
     // Attach to scene
     attachGeometryToScene(geometry);
@@ -84,18 +89,13 @@ bool GeometryManagementService::addGeometry(std::shared_ptr<OCCGeometry> geometr
 }
 
 bool GeometryManagementService::removeGeometry(std::shared_ptr<OCCGeometry> geometry) {
-    if (!geometry || !m_geometries) return false;
+    if (!geometry || !m_geometryRepo) return false;
 
-    // First verify the geometry exists in the list
-    auto it = std::find(m_geometries->begin(), m_geometries->end(), geometry);
-    if (it == m_geometries->end()) {
+    if (!m_geometryRepo->contains(geometry)) {
         LOG_WRN_S("Geometry not found: " + geometry->getName());
         return false;
     }
 
-    // Save the geometry name for logging
-    std::string geomName = geometry->getName();
-
     // Remove from selected geometries if present
     if (m_selectedGeometries) {
         auto selectedIt = std::find(m_selectedGeometries->begin(), m_selectedGeometries->end(), geometry);
@@ -104,32 +104,54 @@ bool GeometryManagementService::removeGeometry(std::shared_ptr<OCCGeometry> geom
         }
     }
 
-    // Detach from scene BEFORE erasing from vector
+    // Detach from scene and object tree BEFORE the repository drops its reference
     detachGeometryFromScene(geometry);
-
-    // Remove from object tree BEFORE erasing from vector
     if (m_objectTreeSync) {
         m_objectTreeSync->removeGeometry(geometry);
     }
 
-    // Remove from repository BEFORE erasing from vector
-    if (m_geometryRepo) {
-        m_geometryRepo->remove(geometry);
+    m_geometryRepo->remove(geometry);
+
+    // Rebuild selection accelerator
+    rebuildSelectionAccelerator();
+
+    return true;
+}
+
+size_t GeometryManagementService::removeGeometriesBatch(const std::vector<std::shared_ptr<OCCGeometry>>& geometries) {
+    if (geometries.empty() || !m_geometryRepo) return 0;
+
+    std::vector<std::shared_ptr<OCCGeometry>> stored;
+    stored.reserve(geometries.size());
+    std::unordered_set<const OCCGeometry*> storedSet;
+    storedSet.reserve(geometries.size());
+    for (const auto& geometry : geometries) {
+        if (m_geometryRepo->contains(geometry) && storedSet.insert(geometry.get()).second) {
+            stored.push_back(geometry);
+        }
     }
+    if (stored.empty()) return 0;
 
-    // NOW safe to remove from main list - re-find iterator to be absolutely sure it's valid
-    it = std::find(m_geometries->begin(), m_geometries->end(), geometry);
-    if (it != m_geometries->end()) {
-        m_geometries->erase(it);
-    } else {
-        LOG_ERR_S("Iterator became invalid during removal operations");
-        return false;
+    // Drop them from the selection in one pass
+    if (m_selectedGeometries) {
+        m_selectedGeometries->erase(std::remove_if(m_selectedGeometries->begin(), m_selectedGeometries->end(),
+            [&](const std::shared_ptr<OCCGeometry>& g) { return storedSet.count(g.get()) != 0; }),
+            m_selectedGeometries->end());
+    }
+
+    for (const auto& geometry : stored) {
+        detachGeometryFromScene(geometry);
+        if (m_objectTreeSync) {
+            m_objectTreeSync->removeGeometry(geometry);
+        }
     }
 
+    size_t removed = m_geometryRepo->removeBatch(stored);
+
     // Rebuild selection accelerator
     rebuildSelectionAccelerator();
 
-    return true;
+    return removed;
 }
 
 bool GeometryManagementService::removeGeometry(const std::string& name) {
@@ -163,6 +185,13 @@ std::shared_ptr<OCCGeometry> GeometryManagementService::findGeometry(const std::
     return nullptr;
 }
 
+std::vector<std::shared_ptr<OCCGeometry>> GeometryManagementService::findGeometriesByFile(const std::string& fileName) const {
+    if (m_geometryRepo) {
+        return m_geometryRepo->findByFileName(fileName);
+    }
+    return {};
+}
+
 const std::vector<std::shared_ptr<OCCGeometry>>& GeometryManagementService::getAllGeometries() const {
     return *m_geometries;
 }
@@ -225,32 +254,23 @@ void GeometryManagementService::addGeometriesBatch(const std::vector<std::shared
     if (geometries.empty()) return;
 
 
-    // Pre-allocate space
-    m_geometries->reserve(m_geometries->size() + geometries.size());
+    if (!m_geometryRepo) {
+        LOG_ERR_S("GeometryManagementService has no geometry repository");
+        return;
+    }
 
-    for (const auto& geometry : geometries) {
+    // Store all geometries with one index update; nulls and taken names are skipped
+    std::vector<std::shared_ptr<OCCGeometry>> skipped;
+    auto added = m_geometryRepo->addBatch(geometries, &skipped);
+    for (const auto& geometry : skipped) {
         if (!geometry) {
             LOG_ERR_S("Attempted to add null geometry in batch operation");
-            continue;
-        }
-
-        // Quick validation
-        auto it = std::find_if(m_geometries->begin(), m_geometries->end(),
-            [&](const std::shared_ptr<OCCGeometry>& g) {
-                return g->getName() == geometry->getName();
-            });
-
-        if (it != m_geometries->end()) {
+        } else {
             LOG_WRN_S("Geometry with name '" + geometry->getName() + "' already exists (skipping in batch)");
-            continue;
-        }
-
-        // Store geometry
-        m_geometries->push_back(geometry);
-        if (m_geometryRepo) {
-            m_geometryRepo->add(geometry);
         }
+    }
 
+    for (const auto& geometry : added) {
         // Add to object tree sync (batch mode)
         if (m_objectTreeSync) {
             m_objectTreeSync->addGeometry(geometry, true); // true = batch mode
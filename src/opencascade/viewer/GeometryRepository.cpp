@@ -3,42 +3,230 @@
 
 #include <algorithm>
 
-GeometryRepository::GeometryRepository(std::vector<std::shared_ptr<OCCGeometry>>* storage)
+GeometryRepository::GeometryRepository(std::vector<GeometryPtr>* storage)
 	: m_storage(storage) {
+	if (!m_storage) return;
+
+	// Index whatever the list already holds; entries the indexes reject are dropped
+	std::vector<GeometryPtr> existing;
+	existing.swap(*m_storage);
+	addBatch(existing);
 }
 
 bool GeometryRepository::existsByName(const std::string& name) const {
-	if (!m_storage) return false;
-	return std::any_of(m_storage->begin(), m_storage->end(), [&](const std::shared_ptr<OCCGeometry>& g) {
-		return g && g->getName() == name;
-		});
+	return m_byName.find(name) != m_byName.end();
+}
+
+bool GeometryRepository::contains(const GeometryPtr& geometry) const {
+	return geometry && m_records.find(geometry.get()) != m_records.end();
+}
+
+GeometryRepository::GeometryPtr GeometryRepository::findByName(const std::string& name) const {
+	auto it = m_byName.find(name);
+	if (it == m_byName.end()) return nullptr;
+	return m_records.at(it->second).geometry;
+}
+
+GeometryRepository::GeometryPtr GeometryRepository::findById(GeometryId id) const {
+	auto it = m_byId.find(id);
+	if (it == m_byId.end()) return nullptr;
+	return m_records.at(it->second).geometry;
+}
+
+GeometryRepository::GeometryId GeometryRepository::getId(const GeometryPtr& geometry) const {
+	if (!geometry) return InvalidId;
+	auto it = m_records.find(geometry.get());
+	return it != m_records.end() ? it->second.id : InvalidId;
+}
+
+std::vector<GeometryRepository::GeometryPtr> GeometryRepository::findByFileName(const std::string& fileName) const {
+	auto it = m_byFile.find(fileName);
+	if (it == m_byFile.end()) return {};
+	return inStorageOrder(it->second);
 }
 
-std::shared_ptr<OCCGeometry> GeometryRepository::findByName(const std::string& name) const {
-	if (!m_storage) return nullptr;
-	auto it = std::find_if(m_storage->begin(), m_storage->end(), [&](const std::shared_ptr<OCCGeometry>& g) {
-		return g && g->getName() == name;
-		});
-	return it != m_storage->end() ? *it : nullptr;
+std::vector<std::string> GeometryRepository::getFileNames() const {
+	std::vector<std::string> names;
+	names.reserve(m_byFile.size());
+	for (const auto& entry : m_byFile) {
+		names.push_back(entry.first);
+	}
+	std::sort(names.begin(), names.end());
+	return names;
 }
 
-void GeometryRepository::add(const std::shared_ptr<OCCGeometry>& geometry) {
-	if (!m_storage || !geometry) return;
+bool GeometryRepository::add(const GeometryPtr& geometry) {
+	if (!m_storage || !insertRecord(geometry)) return false;
 	m_storage->push_back(geometry);
+	return true;
 }
 
-void GeometryRepository::remove(const std::shared_ptr<OCCGeometry>& geometry) {
-	if (!m_storage || !geometry) return;
+std::vector<GeometryRepository::GeometryPtr> GeometryRepository::addBatch(
+	const std::vector<GeometryPtr>& geometries, std::vector<GeometryPtr>* skipped) {
+	std::vector<GeometryPtr> added;
+	if (!m_storage) return added;
+
+	const size_t expected = m_records.size() + geometries.size();
+	m_storage->reserve(m_storage->size() + geometries.size());
+	m_records.reserve(expected);
+	m_byName.reserve(expected);
+	m_byId.reserve(expected);
+	added.reserve(geometries.size());
+
+	for (const auto& geometry : geometries) {
+		if (insertRecord(geometry)) {
+			m_storage->push_back(geometry);
+			added.push_back(geometry);
+		}
+		else if (skipped) {
+			skipped->push_back(geometry);
+		}
+	}
+	return added;
+}
+
+bool GeometryRepository::remove(const GeometryPtr& geometry) {
+	if (!m_storage || !contains(geometry)) return false;
+
+	eraseRecord(geometry.get());
 	auto it = std::find(m_storage->begin(), m_storage->end(), geometry);
 	if (it != m_storage->end()) m_storage->erase(it);
+	return true;
+}
+
+size_t GeometryRepository::removeBatch(const std::vector<GeometryPtr>& geometries) {
+	if (!m_storage || geometries.empty()) return 0;
+
+	std::unordered_set<const OCCGeometry*> doomed;
+	doomed.reserve(geometries.size());
+	for (const auto& geometry : geometries) {
+		if (contains(geometry)) doomed.insert(geometry.get());
+	}
+	if (doomed.empty()) return 0;
+
+	for (const OCCGeometry* key : doomed) {
+		eraseRecord(key);
+	}
+
+	// One compaction pass keeps the remaining geometries in order
+	m_storage->erase(std::remove_if(m_storage->begin(), m_storage->end(),
+		[&](const GeometryPtr& g) { return doomed.count(g.get()) != 0; }),
+		m_storage->end());
+	return doomed.size();
 }
 
 void GeometryRepository::clear() {
-	if (!m_storage) return;
-	m_storage->clear();
+	m_records.clear();
+	m_byName.clear();
+	m_byId.clear();
+	m_byFile.clear();
+	if (m_storage) m_storage->clear();
+}
+
+bool GeometryRepository::rename(const GeometryPtr& geometry, const std::string& newName) {
+	if (!contains(geometry)) return false;
+
+	Record& record = m_records.at(geometry.get());
+	if (record.name == newName) {
+		geometry->setName(newName);
+		return true;
+	}
+	if (existsByName(newName)) return false;
+
+	m_byName.erase(record.name);
+	m_byName.emplace(newName, geometry.get());
+	record.name = newName;
+	geometry->setName(newName);
+	return true;
+}
+
+void GeometryRepository::reindex(const GeometryPtr& geometry) {
+	if (!contains(geometry)) return;
+
+	Record& record = m_records.at(geometry.get());
+	const std::string& name = geometry->getName();
+	if (record.name != name) {
+		auto taken = m_byName.find(name);
+		if (taken == m_byName.end()) {
+			m_byName.erase(record.name);
+			m_byName.emplace(name, geometry.get());
+			record.name = name;
+		}
+		// Otherwise the geometry stays reachable under its previous name
+	}
+
+	const std::string& fileName = geometry->getFileName();
+	if (record.fileName != fileName) {
+		unindexFile(record.fileName, geometry.get());
+		indexFile(fileName, geometry.get());
+		record.fileName = fileName;
+	}
+}
+
+size_t GeometryRepository::size() const {
+	return m_storage ? m_storage->size() : 0;
 }
 
-const std::vector<std::shared_ptr<OCCGeometry>>& GeometryRepository::all() const {
-	static const std::vector<std::shared_ptr<OCCGeometry>> empty;
+const std::vector<GeometryRepository::GeometryPtr>& GeometryRepository::all() const {
+	static const std::vector<GeometryPtr> empty;
 	return m_storage ? *m_storage : empty;
-}
\ No newline at end of file
+}
+
+GeometryRepository::Record* GeometryRepository::insertRecord(const GeometryPtr& geometry) {
+	if (!geometry || contains(geometry)) return nullptr;
+	if (existsByName(geometry->getName())) return nullptr;
+
+	Record& record = m_records[geometry.get()];
+	record.geometry = geometry;
+	record.id = m_nextId++;
+	record.name = geometry->getName();
+	record.fileName = geometry->getFileName();
+
+	m_byName.emplace(record.name, geometry.get());
+	m_byId.emplace(record.id, geometry.get());
+	indexFile(record.fileName, geometry.get());
+	return &record;
+}
+
+void GeometryRepository::eraseRecord(const OCCGeometry* key) {
+	auto it = m_records.find(key);
+	if (it == m_records.end()) return;
+
+	m_byName.erase(it->second.name);
+	m_byId.erase(it->second.id);
+	unindexFile(it->second.fileName, key);
+	m_records.erase(it);
+}
+
+void GeometryRepository::indexFile(const std::string& fileName, const OCCGeometry* key) {
+	if (fileName.empty()) return;
+	m_byFile[fileName].insert(key);
+}
+
+void GeometryRepository::unindexFile(const std::string& fileName, const OCCGeometry* key) {
+	if (fileName.empty()) return;
+	auto it = m_byFile.find(fileName);
+	if (it == m_byFile.end()) return;
+	it->second.erase(key);
+	if (it->second.empty()) m_byFile.erase(it);
+}
+
+std::vector<GeometryRepository::GeometryPtr> GeometryRepository::inStorageOrder(
+	const std::unordered_set<const OCCGeometry*>& keys) const {
+	// IDs grow with insertion and removals keep the list order, so sorting by ID
+	// reproduces the list order without walking the whole list
+	std::vector<const Record*> records;
+	records.reserve(keys.size());
+	for (const OCCGeometry* key : keys) {
+		records.push_back(&m_records.at(key));
+	}
+	std::sort(records.begin(), records.end(),
+		[](const Record* a, const Record* b) { return a->id < b->id; });
+
+	std::vector<GeometryPtr> result;
+	result.reserve(records.size());
+	for (const Record* record : records) {
+		result.push_back(record->geometry);
+	}
+	return result;
+}
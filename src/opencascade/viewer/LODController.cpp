@@ -6,6 +6,7 @@
 
 #include "viewer/LODController.h"
 #include "OCCViewer.h"
+#include "SceneManager.h"
 #include "logger/Logger.h"
 
 LODController::LODController(OCCViewer* viewer)
@@ -37,6 +38,14 @@ void LODController::setMode(bool roughMode) {
 		// Just update parameter without remeshing for rough mode
 		m_viewer->setMeshDeflection(target, false);
 	}
+	else if (m_viewer->isProgressiveRefinementEnabled()) {
+		// Progressive refinement retessellates stale meshes in budgeted slices
+		// once the view is idle, instead of remeshing everything right here
+		m_viewer->setMeshDeflection(target, false);
+		if (auto* sceneManager = m_viewer->getSceneManager()) {
+			sceneManager->getProgressiveRefinement()->requestRetessellation();
+		}
+	}
 	else {
 		// Only remesh when transitioning back to fine mode
 		m_viewer->setMeshDeflection(target, true);
@@ -0,0 +1,210 @@
+#include "viewer/MeshLODService.h"
+#include "OCCGeometry.h"
+#include "geometry/helper/FaceLookupIndex.h"
+#include "logger/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <Inventor/SoPath.h>
+#include <Inventor/actions/SoSearchAction.h>
+#include <Inventor/nodes/SoGroup.h>
+#include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <Inventor/nodes/SoLevelOfDetail.h>
+#include <Inventor/nodes/SoSeparator.h>
+
+namespace {
+	SoIndexedFaceSet* createLevelFaceSet(const MeshLODChain& chain, const MeshLODChain::Level& level) {
+		SoIndexedFaceSet* faceSet = new SoIndexedFaceSet;
+		faceSet->coordIndex.setNum(static_cast<int>(level.indexCount / 3 * 4));
+		int32_t* indices = faceSet->coordIndex.startEditing();
+		size_t pos = 0;
+		for (size_t i = level.firstIndex; i < level.firstIndex + level.indexCount; i += 3) {
+			indices[pos++] = chain.indices[i];
+			indices[pos++] = chain.indices[i + 1];
+			indices[pos++] = chain.indices[i + 2];
+			indices[pos++] = -1;
+		}
+		faceSet->coordIndex.finishEditing();
+		return faceSet;
+	}
+}
+
+MeshLODService::MeshLODService() {
+	m_options.cancel = &m_cancel;
+}
+
+MeshLODService::~MeshLODService() {
+	// Workers post back through this handler, so they must finish first
+	m_cancel = true;
+	for (auto& worker : m_workers) {
+		if (worker.valid()) {
+			worker.wait();
+		}
+	}
+}
+
+void MeshLODService::schedule(const std::shared_ptr<OCCGeometry>& geometry) {
+	if (!m_enabled || !geometry || !geometry->hasCachedMesh()) {
+		return;
+	}
+	const TriangleMesh& mesh = geometry->getCachedMesh();
+	if (static_cast<size_t>(mesh.getTriangleCount()) < m_options.minTriangles) {
+		return;
+	}
+
+	// Face ids keep decimation from merging across faces and travel with every level
+	std::shared_ptr<const std::vector<int>> faceIds;
+	const FaceLookupIndex* lookup = geometry->getFaceLookupIndex();
+	if (lookup && !lookup->isEmpty() && lookup->getTriangleCount() == static_cast<size_t>(mesh.getTriangleCount())) {
+		auto ids = std::make_shared<std::vector<int>>(static_cast<size_t>(mesh.getTriangleCount()));
+		for (int t = 0; t < mesh.getTriangleCount(); ++t) {
+			(*ids)[t] = lookup->faceForTriangle(t);
+		}
+		faceIds = std::move(ids);
+	}
+
+	// The copy keeps the worker independent of later edits to the geometry
+	m_queued.push_back({ geometry, std::make_shared<const TriangleMesh>(mesh), std::move(faceIds) });
+
+	// Geometries added in the same event-loop turn are decimated as one parallel batch
+	if (!m_launchPending) {
+		m_launchPending = true;
+		CallAfter(&MeshLODService::launchBatch);
+	}
+}
+
+void MeshLODService::launchBatch() {
+	m_launchPending = false;
+	if (m_queued.empty()) {
+		return;
+	}
+
+	auto jobs = std::make_shared<std::vector<Job>>(std::move(m_queued));
+	m_queued.clear();
+	m_running += jobs->size();
+
+	// Drop workers that already delivered their results
+	m_workers.erase(std::remove_if(m_workers.begin(), m_workers.end(),
+		[](std::future<void>& worker) {
+			return !worker.valid() || worker.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}), m_workers.end());
+
+	LOG_INF_S("MeshLODService: Building LOD chains for " + std::to_string(jobs->size()) + " mesh(es)");
+
+	MeshDecimator::Options options = m_options;
+	m_workers.push_back(std::async(std::launch::async, [this, jobs, options]() {
+		std::vector<const TriangleMesh*> meshes;
+		std::vector<const std::vector<int>*> faceIds;
+		meshes.reserve(jobs->size());
+		faceIds.reserve(jobs->size());
+		for (const auto& job : *jobs) {
+			meshes.push_back(job.mesh.get());
+			faceIds.push_back(job.faceIds.get());
+		}
+
+		auto chains = std::make_shared<std::vector<MeshLODChain>>();
+		try {
+			*chains = MeshDecimator::buildLODChains(meshes, options, faceIds);
+		}
+		catch (const std::exception& e) {
+			LOG_ERR_S("MeshLODService: Decimation failed: " + std::string(e.what()));
+			chains->clear();
+		}
+
+		if (!m_cancel) {
+			CallAfter([this, jobs, chains]() {
+				onBatchFinished(*jobs, *chains);
+			});
+		}
+	}));
+}
+
+void MeshLODService::onBatchFinished(const std::vector<Job>& jobs, const std::vector<MeshLODChain>& chains) {
+	m_running -= std::min(m_running, jobs.size());
+
+	size_t installed = 0;
+	for (size_t i = 0; i < jobs.size() && i < chains.size(); ++i) {
+		auto geometry = jobs[i].geometry.lock();
+		// Removed, or the mesh was replaced while decimating
+		if (!geometry || !geometry->hasCachedMesh() ||
+			geometry->getCachedMesh().getTriangleCount() != jobs[i].mesh->getTriangleCount()) {
+			continue;
+		}
+		if (chains[i].getLevelCount() > 1 && install(*geometry, *jobs[i].mesh, chains[i])) {
+			++installed;
+		}
+	}
+
+	if (installed > 0) {
+		LOG_INF_S("MeshLODService: Installed LOD chains on " + std::to_string(installed) + " geometr" +
+			(installed == 1 ? "y" : "ies"));
+		if (m_frameRequest) {
+			m_frameRequest();
+		}
+	}
+}
+
+bool MeshLODService::install(OCCGeometry& geometry, const TriangleMesh& mesh, const MeshLODChain& chain) const {
+	SoSeparator* root = geometry.getCoinNode();
+	if (!root) {
+		return false;
+	}
+
+	// The full-resolution face set is the one with one -1 separator per triangle
+	const int expectedIndices = mesh.getTriangleCount() * 4;
+	SoSearchAction search;
+	search.setType(SoIndexedFaceSet::getClassTypeId());
+	search.setInterest(SoSearchAction::ALL);
+	search.setSearchingAll(TRUE);
+	search.apply(root);
+
+	const SoPathList& paths = search.getPaths();
+	for (int p = 0; p < paths.getLength(); ++p) {
+		SoPath* path = paths[p];
+		auto* faceSet = static_cast<SoIndexedFaceSet*>(path->getTail());
+		if (faceSet->coordIndex.getNum() != expectedIndices || path->getLength() < 2) {
+			continue;
+		}
+		SoNode* parent = path->getNodeFromTail(1);
+		if (parent->isOfType(SoLevelOfDetail::getClassTypeId())) {
+			return false; // already installed
+		}
+		if (!parent->isOfType(SoGroup::getClassTypeId())) {
+			continue;
+		}
+
+		// Children share the coordinates and PER_VERTEX_INDEXED normals already in
+		// the separator, so every level is just another index list
+		SoLevelOfDetail* lod = new SoLevelOfDetail;
+		lod->ref();
+		lod->addChild(faceSet);
+		for (size_t level = 1; level < chain.getLevelCount(); ++level) {
+			const MeshLODChain::Level& range = chain.levels[level];
+			SoIndexedFaceSet* levelFaceSet = createLevelFaceSet(chain, range);
+			lod->addChild(levelFaceSet);
+
+			// Picks on a coarse level report its own triangle numbering; map it back
+			auto first = chain.sourceTriangles.begin() + range.firstIndex / 3;
+			geometry.setLODSourceTriangles(levelFaceSet,
+				std::vector<int>(first, first + range.getTriangleCount()));
+		}
+
+		// Level i is used while its triangles get at least m_pixelsPerTriangle pixels each
+		lod->screenArea.setNum(static_cast<int>(chain.getLevelCount() - 1));
+		for (size_t level = 0; level + 1 < chain.getLevelCount(); ++level) {
+			lod->screenArea.set1Value(static_cast<int>(level),
+				static_cast<float>(chain.levels[level].getTriangleCount() * m_pixelsPerTriangle));
+		}
+
+		static_cast<SoGroup*>(parent)->replaceChild(faceSet, lod);
+		lod->unref();
+
+		std::string levels;
+		for (const auto& level : chain.levels) {
+			levels += (levels.empty() ? "" : "/") + std::to_string(level.getTriangleCount());
+		}
+		LOG_DBG_S("MeshLODService: '" + geometry.getName() + "' levels " + levels + " triangles");
+		return true;
+	}
+	return false;
+}
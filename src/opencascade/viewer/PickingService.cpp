@@ -9,6 +9,8 @@
 #include "SceneManager.h"
 #include "Canvas.h"
 #include "logger/Logger.h"
+#include "geometry/VertexExtractor.h"
+#include "geometry/helper/FaceLookupIndex.h"
 
 #include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/nodes/SoCamera.h>
@@ -20,6 +22,7 @@
 #include <Inventor/details/SoLineDetail.h>
 #include <Inventor/details/SoPointDetail.h>
 #include <wx/msgdlg.h>
+#include <algorithm>
 
 PickingService::PickingService(SceneManager* sceneManager,
 	SoSeparator* occRoot,
@@ -143,19 +146,20 @@ PickingResult PickingService::pickDetailedAtScreen(const wxPoint& screenPos) con
 		if (detail->isOfType(SoFaceDetail::getClassTypeId())) {
 			const SoFaceDetail* faceDetail = static_cast<const SoFaceDetail*>(detail);
 
-			// Get the face index (triangle index in the mesh)
+			// Get the face index (triangle index in the mesh); hits on a decimated
+			// LOD level are mapped back to the full-resolution triangle
 			int triangleIndex = faceDetail->getFaceIndex();
+			if (result.geometry) {
+				triangleIndex = result.geometry->resolveLODTriangle(p->getTail(), triangleIndex);
+			}
 			result.triangleIndex = triangleIndex;
 
-			// Use face domain mapping to get geometry face ID
-			if (result.geometry && result.geometry->hasFaceDomainMapping()) {
-				int geometryFaceId = result.geometry->getGeometryFaceIdForTriangle(triangleIndex);
+			// Use the precomputed lookup tables to get geometry face ID
+			const FaceLookupIndex* lookup = result.geometry ? result.geometry->getFaceLookupIndex() : nullptr;
+			if (lookup && !lookup->isEmpty()) {
+				int geometryFaceId = lookup->faceForTriangle(triangleIndex);
 				result.geometryFaceId = geometryFaceId;
 
-				// Get triangle count from FaceDomain
-				const FaceDomain* domain = result.geometry->getFaceDomain(geometryFaceId);
-				int triangleCount = domain ? domain->getTriangleCount() : 0;
-
 			// Generate sub-element name in FreeCAD style: "Face5"
 			if (geometryFaceId >= 0) {
 				result.elementType = "Face";
@@ -207,6 +211,21 @@ PickingResult PickingService::pickDetailedAtScreen(const wxPoint& screenPos) con
 		result.y = point[1];
 		result.z = point[2];
 
+		// Report the exact BRep vertex rather than its single-precision copy in the point set
+		if (result.elementType == "Vertex" && result.geometry && result.geometry->getVertexExtractor()) {
+			const SbVec3f& objectPoint = picked->getObjectPoint();
+			const double snapRadius = std::max(1e-6, static_cast<double>(objectPoint.length()) * 1e-5);
+			gp_Pnt vertex;
+			if (result.geometry->getVertexExtractor()->findNearestVertex(
+				gp_Pnt(objectPoint[0], objectPoint[1], objectPoint[2]), snapRadius, vertex)) {
+				SbVec3f snapped(static_cast<float>(vertex.X()), static_cast<float>(vertex.Y()), static_cast<float>(vertex.Z()));
+				picked->getObjectToWorld().multVecMatrix(snapped, snapped);
+				result.x = snapped[0];
+				result.y = snapped[1];
+				result.z = snapped[2];
+			}
+		}
+
 	} else {
 		LOG_WRN_S("PickingService - No detail found in picked point");
 	}
@@ -0,0 +1,242 @@
+#include "viewer/RetessellationService.h"
+#include "OCCGeometry.h"
+#include "rendering/OpenCASCADEProcessor.h"
+#include "logger/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <OpenCASCADE/BRepBuilderAPI_Copy.hxx>
+#include <OpenCASCADE/BRepTools.hxx>
+#include <OpenCASCADE/BRep_Builder.hxx>
+#include <OpenCASCADE/BRep_Tool.hxx>
+#include <OpenCASCADE/Poly_PolygonOnTriangulation.hxx>
+#include <OpenCASCADE/Poly_Triangulation.hxx>
+#include <OpenCASCADE/Standard_Failure.hxx>
+#include <OpenCASCADE/TopExp.hxx>
+#include <OpenCASCADE/TopExp_Explorer.hxx>
+#include <OpenCASCADE/TopTools_IndexedMapOfShape.hxx>
+#include <OpenCASCADE/TopoDS.hxx>
+
+RetessellationService::RetessellationService() = default;
+
+RetessellationService::~RetessellationService() {
+	// Workers post back through this handler, so they must finish first
+	m_shutdown = true;
+	cancel();
+	for (auto& worker : m_workers) {
+		if (worker.valid()) {
+			worker.wait();
+		}
+	}
+}
+
+bool RetessellationService::sameParameters(const MeshParameters& a, const MeshParameters& b) {
+	return a.deflection == b.deflection && a.angularDeflection == b.angularDeflection &&
+		a.relative == b.relative;
+}
+
+bool RetessellationService::needsRefinement(const OCCGeometry& geometry, const MeshParameters& params) {
+	// Imported meshes have no B-rep to retessellate
+	if (geometry.getShape().IsNull() || geometry.hasCachedMesh()) {
+		return false;
+	}
+	return geometry.needsMeshRegeneration() || !sameParameters(geometry.getLastMeshParameters(), params);
+}
+
+ProgressiveRefinement::RefineResult RetessellationService::step(
+	const std::vector<std::shared_ptr<OCCGeometry>>& geometries, const MeshParameters& params, double budgetMs) {
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	// Swap in finished meshes; at least one per frame so a slow rebuild still progresses
+	if (m_finished) {
+		auto batch = m_finished;
+		const bool current = sameParameters(batch->params, params);
+		while (current && batch->installed < batch->jobs.size()) {
+			Job& job = batch->jobs[batch->installed++];
+			auto geometry = job.geometry.lock();
+			// Removed, reshaped or already rebuilt while meshing
+			if (!geometry || !geometry->getShape().IsSame(job.shape) || !needsRefinement(*geometry, params)) {
+				continue;
+			}
+
+			const bool transferred = !job.meshed.IsNull() && transferTriangulation(job.meshed, geometry->getShape());
+			job.meshed.Nullify();
+			if (!transferred) {
+				// Keep the coarse mesh rather than retrying every frame
+				m_failed.Add(job.shape);
+				continue;
+			}
+			// The stored triangulation now meets params, so the rebuild skips BRepMesh
+			geometry->setMeshRegenerationNeeded(true);
+			geometry->updateCoinRepresentationIfNeeded(params);
+
+			const double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			if (elapsedMs >= budgetMs) {
+				break;
+			}
+		}
+		if (current && batch->installed < batch->jobs.size()) {
+			return ProgressiveRefinement::RefineResult::MoreWork;
+		}
+		m_finished.reset();
+	}
+
+	if (m_running) {
+		return ProgressiveRefinement::RefineResult::Waiting;
+	}
+
+	if (!sameParameters(m_failedParams, params)) {
+		m_failed.Clear();
+		m_failedParams = params;
+	}
+
+	std::vector<std::shared_ptr<OCCGeometry>> pending;
+	for (const auto& geometry : geometries) {
+		if (geometry && needsRefinement(*geometry, params) && !m_failed.Contains(geometry->getShape())) {
+			pending.push_back(geometry);
+		}
+	}
+	if (pending.empty()) {
+		return ProgressiveRefinement::RefineResult::Done;
+	}
+
+	launch(std::move(pending), params);
+	return ProgressiveRefinement::RefineResult::Waiting;
+}
+
+void RetessellationService::cancel() {
+	if (m_running) {
+		m_running->cancelled = true;
+		m_running.reset();
+	}
+	m_finished.reset();
+}
+
+void RetessellationService::launch(std::vector<std::shared_ptr<OCCGeometry>> geometries, const MeshParameters& params) {
+	auto batch = std::make_shared<Batch>();
+	batch->params = params;
+	batch->jobs.reserve(geometries.size());
+	for (const auto& geometry : geometries) {
+		// Mesh a topology copy: BRepMesh writes into the TShapes, which the UI thread
+		// keeps reading and meshing. Copying here, before the worker starts, also keeps
+		// the worker from reading edge representations while they change.
+		try {
+			BRepBuilderAPI_Copy copier(geometry->getShape(), Standard_False, Standard_False);
+			batch->jobs.push_back({ geometry, geometry->getShape(), copier.Shape() });
+		}
+		catch (const Standard_Failure& e) {
+			LOG_ERR_S("RetessellationService: Copying shape failed: " + std::string(e.GetMessageString()));
+			m_failed.Add(geometry->getShape());
+		}
+	}
+	m_running = batch;
+
+	// Drop workers that already delivered their results
+	m_workers.erase(std::remove_if(m_workers.begin(), m_workers.end(),
+		[](std::future<void>& worker) {
+			return !worker.valid() || worker.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}), m_workers.end());
+
+	LOG_INF_S("RetessellationService: Refining " + std::to_string(batch->jobs.size()) + " geometr" +
+		(batch->jobs.size() == 1 ? "y" : "ies"));
+
+	// The config belongs to the UI thread; the worker gets a snapshot
+	const TessellationSettings settings = TessellationSettings::fromConfig();
+	m_workers.push_back(std::async(std::launch::async, [this, batch, settings]() {
+		OpenCASCADEProcessor processor;
+		for (auto& job : batch->jobs) {
+			if (batch->cancelled) {
+				return;
+			}
+			try {
+				if (!processor.triangulate(job.meshed, batch->params, settings)) {
+					job.meshed.Nullify();
+				}
+			}
+			catch (const Standard_Failure& e) {
+				LOG_ERR_S("RetessellationService: Meshing failed: " + std::string(e.GetMessageString()));
+				job.meshed.Nullify();
+			}
+			catch (const std::exception& e) {
+				LOG_ERR_S("RetessellationService: Meshing failed: " + std::string(e.what()));
+				job.meshed.Nullify();
+			}
+		}
+
+		if (!batch->cancelled && !m_shutdown) {
+			CallAfter([this, batch]() {
+				onBatchFinished(batch);
+			});
+		}
+	}));
+}
+
+void RetessellationService::onBatchFinished(const std::shared_ptr<Batch>& batch) {
+	// Cancelled after the worker posted
+	if (batch != m_running) {
+		return;
+	}
+	m_running.reset();
+	m_finished = batch;
+	if (m_frameRequest) {
+		m_frameRequest();
+	}
+}
+
+bool RetessellationService::transferTriangulation(const TopoDS_Shape& meshed, const TopoDS_Shape& target) {
+	// BRepBuilderAPI_Copy keeps the sub-shape order, so both maps pair up by index
+	TopTools_IndexedMapOfShape sourceFaces, targetFaces, sourceEdges, targetEdges;
+	TopExp::MapShapes(meshed, TopAbs_FACE, sourceFaces);
+	TopExp::MapShapes(target, TopAbs_FACE, targetFaces);
+	TopExp::MapShapes(meshed, TopAbs_EDGE, sourceEdges);
+	TopExp::MapShapes(target, TopAbs_EDGE, targetEdges);
+	if (sourceFaces.Extent() != targetFaces.Extent() || sourceEdges.Extent() != targetEdges.Extent()) {
+		LOG_WRN_S("RetessellationService: Topology changed while meshing, keeping the current mesh");
+		return false;
+	}
+
+	// Drops the coarse triangulations and the edge polygons that refer to them
+	BRepTools::Clean(target);
+
+	BRep_Builder builder;
+	for (int i = 1; i <= sourceFaces.Extent(); ++i) {
+		const TopoDS_Face& sourceFace = TopoDS::Face(sourceFaces(i));
+		TopLoc_Location location;
+		Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(sourceFace, location);
+		if (triangulation.IsNull()) {
+			continue;
+		}
+		const TopoDS_Face& targetFace = TopoDS::Face(targetFaces(i));
+		builder.UpdateFace(targetFace, triangulation);
+
+		for (TopExp_Explorer edges(sourceFace, TopAbs_EDGE); edges.More(); edges.Next()) {
+			const TopoDS_Edge& sourceEdge = TopoDS::Edge(edges.Current());
+			const int edgeIndex = sourceEdges.FindIndex(sourceEdge);
+			if (edgeIndex == 0) {
+				continue;
+			}
+			const TopoDS_Edge& targetEdge = TopoDS::Edge(targetEdges(edgeIndex));
+
+			if (BRep_Tool::IsClosed(sourceEdge, sourceFace)) {
+				// Seam edges carry one polygon per orientation
+				Handle(Poly_PolygonOnTriangulation) forward = BRep_Tool::PolygonOnTriangulation(
+					TopoDS::Edge(sourceEdge.Oriented(TopAbs_FORWARD)), triangulation, location);
+				Handle(Poly_PolygonOnTriangulation) reversed = BRep_Tool::PolygonOnTriangulation(
+					TopoDS::Edge(sourceEdge.Oriented(TopAbs_REVERSED)), triangulation, location);
+				if (!forward.IsNull() && !reversed.IsNull()) {
+					builder.UpdateEdge(TopoDS::Edge(targetEdge.Oriented(TopAbs_FORWARD)),
+						forward, reversed, triangulation, location);
+				}
+			}
+			else {
+				Handle(Poly_PolygonOnTriangulation) polygon =
+					BRep_Tool::PolygonOnTriangulation(sourceEdge, triangulation, location);
+				if (!polygon.IsNull()) {
+					builder.UpdateEdge(targetEdge, polygon, triangulation, location);
+				}
+			}
+		}
+	}
+	return true;
+}
@@ -1,13 +1,23 @@
 #include "viewer/SceneAttachmentService.h"
 #include "OCCGeometry.h"
+#include "SceneManager.h"
 #include "logger/Logger.h"
 
 #include <Inventor/nodes/SoSeparator.h>
 
 SceneAttachmentService::SceneAttachmentService(
 	SoSeparator* occRoot,
-	std::unordered_map<SoSeparator*, std::shared_ptr<OCCGeometry>>* nodeToGeom)
-	: m_occRoot(occRoot), m_nodeToGeom(nodeToGeom) {
+	std::unordered_map<SoSeparator*, std::shared_ptr<OCCGeometry>>* nodeToGeom,
+	SceneManager* sceneManager)
+	: m_occRoot(occRoot), m_sceneManager(sceneManager), m_nodeToGeom(nodeToGeom) {
+}
+
+SceneAttachmentService::~SceneAttachmentService() {
+	// Geometries may outlive the viewer (undo history, clipboard)
+	if (!m_nodeToGeom) return;
+	for (auto& entry : *m_nodeToGeom) {
+		entry.second->setBoundsChangedCallback(nullptr);
+	}
 }
 
 void SceneAttachmentService::attach(std::shared_ptr<OCCGeometry> geometry) {
@@ -21,6 +31,13 @@ void SceneAttachmentService::attach(std::shared_ptr<OCCGeometry> geometry) {
 	}
 	
 	if (m_nodeToGeom) (*m_nodeToGeom)[coin] = geometry;
+
+	if (m_sceneManager) {
+		geometry->setBoundsChangedCallback([this](const OCCGeometry& changed) {
+			updateBounds(changed);
+		});
+	}
+	updateBounds(geometry);
 }
 
 void SceneAttachmentService::detach(std::shared_ptr<OCCGeometry> geometry) {
@@ -30,10 +47,35 @@ void SceneAttachmentService::detach(std::shared_ptr<OCCGeometry> geometry) {
 	int idx = m_occRoot->findChild(coin);
 	if (idx >= 0) m_occRoot->removeChild(idx);
 	if (m_nodeToGeom) m_nodeToGeom->erase(coin);
+	geometry->setBoundsChangedCallback(nullptr);
+	if (m_sceneManager) m_sceneManager->removeObjectBounds(geometry.get());
 }
 
 void SceneAttachmentService::detachAll() {
 	if (!m_occRoot) return;
 	m_occRoot->removeAllChildren();
-	if (m_nodeToGeom) m_nodeToGeom->clear();
+	if (m_nodeToGeom) {
+		for (auto& entry : *m_nodeToGeom) {
+			entry.second->setBoundsChangedCallback(nullptr);
+		}
+		m_nodeToGeom->clear();
+	}
+	if (m_sceneManager) m_sceneManager->clearObjectBounds();
+}
+
+void SceneAttachmentService::updateBounds(const std::shared_ptr<OCCGeometry>& geometry) {
+	if (geometry) updateBounds(*geometry);
+}
+
+void SceneAttachmentService::updateBounds(const OCCGeometry& geometry) {
+	if (!m_sceneManager) return;
+
+	gp_Pnt min, max;
+	if (!geometry.getWorldBounds(min, max)) {
+		m_sceneManager->removeObjectBounds(&geometry);
+		return;
+	}
+	SbBox3f bounds(static_cast<float>(min.X()), static_cast<float>(min.Y()), static_cast<float>(min.Z()),
+		static_cast<float>(max.X()), static_cast<float>(max.Y()), static_cast<float>(max.Z()));
+	m_sceneManager->setObjectBounds(&geometry, bounds);
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "Canvas.h"
 #include "ObjectTreePanel.h"
 #include "ViewRefreshManager.h"
+#include "edges/EdgeDisplayManager.h"
 #include "logger/Logger.h"
 
 SelectionManager::SelectionManager(SceneManager* sceneManager,
@@ -35,6 +36,7 @@ void SelectionManager::setGeometryVisible(const std::string& name, bool visible)
 		return;
 	}
 	geometry->setVisible(visible);
+	syncEdges(geometry);
 	requestRefreshSelectionChanged();
 }
 
@@ -43,6 +45,7 @@ void SelectionManager::setGeometrySelected(const std::string& name, bool selecte
 	if (!geometry || !m_selectedGeometries) return;
 
 	geometry->setSelected(selected);
+	syncEdges(geometry);
 	if (selected) {
 		if (std::find(m_selectedGeometries->begin(), m_selectedGeometries->end(), geometry) == m_selectedGeometries->end()) {
 			m_selectedGeometries->push_back(geometry);
@@ -70,13 +73,21 @@ void SelectionManager::setGeometryTransparency(const std::string& name, double t
 
 void SelectionManager::hideAll() {
 	if (!m_allGeometries) return;
-	for (auto& g : *m_allGeometries) if (g) g->setVisible(false);
+	for (auto& g : *m_allGeometries) {
+		if (!g) continue;
+		g->setVisible(false);
+		syncEdges(g);
+	}
 	requestRefreshSelectionChanged();
 }
 
 void SelectionManager::showAll() {
 	if (!m_allGeometries) return;
-	for (auto& g : *m_allGeometries) if (g) g->setVisible(true);
+	for (auto& g : *m_allGeometries) {
+		if (!g) continue;
+		g->setVisible(true);
+		syncEdges(g);
+	}
 	requestRefreshSelectionChanged();
 }
 
@@ -86,6 +97,7 @@ void SelectionManager::selectAll() {
 	for (auto& g : *m_allGeometries) {
 		if (!g) continue;
 		g->setSelected(true);
+		syncEdges(g);
 		m_selectedGeometries->push_back(g);
 	}
 	onSelectionChanged();
@@ -93,7 +105,11 @@ void SelectionManager::selectAll() {
 
 void SelectionManager::deselectAll() {
 	if (!m_selectedGeometries) return;
-	for (auto& g : *m_selectedGeometries) if (g) g->setSelected(false);
+	for (auto& g : *m_selectedGeometries) {
+		if (!g) continue;
+		g->setSelected(false);
+		syncEdges(g);
+	}
 	m_selectedGeometries->clear();
 	onSelectionChanged();
 }
@@ -109,6 +125,10 @@ void SelectionManager::onSelectionChanged() {
 	}
 }
 
+void SelectionManager::syncEdges(const std::shared_ptr<OCCGeometry>& geometry) {
+	if (m_edgeDisplayManager) m_edgeDisplayManager->syncGeometryState(geometry);
+}
+
 void SelectionManager::requestRefreshSelectionChanged() {
 	if (!m_sceneManager || !m_sceneManager->getCanvas()) return;
 	if (auto* refresher = m_sceneManager->getCanvas()->getRefreshManager()) {
@@ -0,0 +1,244 @@
+#include "viewer/ShapeBuildService.h"
+#include "rendering/GeometryProcessor.h"
+#include "rendering/OpenCASCADEProcessor.h"
+#include "logger/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <OpenCASCADE/Message_ProgressIndicator.hxx>
+#include <OpenCASCADE/Standard_Failure.hxx>
+#include <OpenCASCADE/TCollection_AsciiString.hxx>
+
+class ShapeBuildService::Job {
+public:
+	JobId id = 0;
+	std::string label;
+	BuildFunc build;
+	CommitFunc commit;
+	bool running = false;   // UI thread only
+
+	std::atomic<bool> cancelled{ false };
+	std::atomic<int> percent{ 0 };
+
+	void setStage(const std::string& stage) {
+		std::lock_guard<std::mutex> lock(m_stageMutex);
+		m_stage = stage;
+	}
+
+	std::string getStage() const {
+		std::lock_guard<std::mutex> lock(m_stageMutex);
+		return m_stage;
+	}
+
+private:
+	mutable std::mutex m_stageMutex;
+	std::string m_stage;
+};
+
+namespace {
+	// Feeds OCCT progress into the job and lets OCCT poll the job's cancel flag
+	class JobProgressIndicator : public Message_ProgressIndicator {
+	public:
+		explicit JobProgressIndicator(const std::shared_ptr<ShapeBuildService::Job>& job)
+			: m_job(job) {
+		}
+
+		Standard_Boolean UserBreak() override {
+			return m_job->cancelled.load();
+		}
+
+		void Show(const Message_ProgressScope& /*scope*/, const Standard_Boolean /*isForce*/) override {
+			m_job->percent.store(std::min(100, static_cast<int>(GetPosition() * 100.0)));
+		}
+
+	private:
+		std::shared_ptr<ShapeBuildService::Job> m_job;
+	};
+}
+
+ShapeBuildService::Context::Context(const std::shared_ptr<Job>& job, const Message_ProgressRange& range)
+	: m_job(job)
+	, m_scope(range, TCollection_AsciiString(job->label.c_str()), 100.0) {
+}
+
+bool ShapeBuildService::Context::isCancelled() const {
+	return m_job->cancelled.load();
+}
+
+Message_ProgressRange ShapeBuildService::Context::step(double span, const std::string& stage) {
+	m_job->setStage(stage);
+	return m_scope.Next(span);
+}
+
+ShapeBuildService::ShapeBuildService() {
+}
+
+ShapeBuildService::~ShapeBuildService() {
+	// Workers post back through this handler, so they must finish first
+	m_shutdown = true;
+	for (auto& job : m_running) {
+		job->cancelled = true;
+	}
+	for (auto& worker : m_workers) {
+		if (worker.valid()) {
+			worker.wait();
+		}
+	}
+}
+
+ShapeBuildService::JobId ShapeBuildService::submit(const std::string& label, BuildFunc build, CommitFunc commit) {
+	auto job = std::make_shared<Job>();
+	job->id = m_nextId++;
+	job->label = label;
+	job->build = std::move(build);
+	job->commit = std::move(commit);
+	job->setStage("Queued");
+	m_queued.push_back(job);
+
+	LOG_INF_S("ShapeBuildService: Queued '" + label + "' (job " + std::to_string(job->id) + ")");
+	launchQueued();
+	return job->id;
+}
+
+bool ShapeBuildService::cancel(JobId id) {
+	auto queued = std::find_if(m_queued.begin(), m_queued.end(),
+		[id](const std::shared_ptr<Job>& job) { return job->id == id; });
+	if (queued != m_queued.end()) {
+		LOG_INF_S("ShapeBuildService: Cancelled '" + (*queued)->label + "' before it started");
+		m_queued.erase(queued);
+		return true;
+	}
+
+	// A running job stops at its next progress check and is dropped when it reports back
+	for (auto& job : m_running) {
+		if (job->id == id) {
+			job->cancelled = true;
+			return true;
+		}
+	}
+	return false;
+}
+
+void ShapeBuildService::cancelAll() {
+	if (!m_queued.empty()) {
+		LOG_INF_S("ShapeBuildService: Cancelled " + std::to_string(m_queued.size()) + " queued job(s)");
+		m_queued.clear();
+	}
+	for (auto& job : m_running) {
+		job->cancelled = true;
+	}
+}
+
+std::vector<ShapeBuildService::JobStatus> ShapeBuildService::getJobs() const {
+	std::vector<JobStatus> jobs;
+	jobs.reserve(getPendingCount());
+	auto append = [&jobs](const std::shared_ptr<Job>& job) {
+		JobStatus status;
+		status.id = job->id;
+		status.label = job->label;
+		status.percent = job->percent.load();
+		status.stage = job->getStage();
+		status.running = job->running;
+		jobs.push_back(std::move(status));
+	};
+	for (const auto& job : m_running) {
+		append(job);
+	}
+	for (const auto& job : m_queued) {
+		append(job);
+	}
+	return jobs;
+}
+
+void ShapeBuildService::launchQueued() {
+	// Drop workers that already delivered their results
+	m_workers.erase(std::remove_if(m_workers.begin(), m_workers.end(),
+		[](std::future<void>& worker) {
+			return !worker.valid() || worker.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}), m_workers.end());
+
+	while (!m_shutdown && m_running.size() < m_maxConcurrent && !m_queued.empty()) {
+		auto job = m_queued.front();
+		m_queued.pop_front();
+		job->running = true;
+		m_running.push_back(job);
+
+		// The toolkit config is not thread safe, so the worker gets a copy taken here
+		MeshParameters meshParams = m_meshParams ? *m_meshParams : MeshParameters();
+		TessellationSettings tessellation = TessellationSettings::fromConfig();
+		m_workers.push_back(std::async(std::launch::async, [this, job, meshParams, tessellation]() {
+			run(job, meshParams, tessellation);
+		}));
+	}
+}
+
+void ShapeBuildService::run(const std::shared_ptr<Job>& job, const MeshParameters& meshParams,
+	const TessellationSettings& tessellation) {
+	auto startTime = std::chrono::steady_clock::now();
+	Handle(JobProgressIndicator) indicator = new JobProgressIndicator(job);
+	Message_ProgressScope root(indicator->Start(), TCollection_AsciiString(job->label.c_str()), 100.0);
+
+	TopoDS_Shape shape;
+	std::string error;
+	try {
+		{
+			Context context(job, root.Next(90.0));
+			shape = job->build(context);
+		}
+
+		if (!job->cancelled && shape.IsNull()) {
+			error = "no shape was produced";
+		}
+
+		// Triangulate here so that displaying the shape on the UI thread reuses it
+		if (!job->cancelled && !shape.IsNull()) {
+			Message_ProgressRange meshRange = root.Next(10.0);
+			job->setStage("Triangulating");
+			OpenCASCADEProcessor processor;
+			processor.triangulate(shape, meshParams, tessellation);
+			meshRange.Close();
+		}
+	}
+	catch (const Standard_Failure& e) {
+		error = e.GetMessageString() ? e.GetMessageString() : "OpenCASCADE error";
+	}
+	catch (const std::exception& e) {
+		error = e.what();
+	}
+	catch (...) {
+		error = "unknown error";
+	}
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+	LOG_DBG_S("ShapeBuildService: '" + job->label + "' worker finished in " + std::to_string(elapsed.count()) + " ms");
+
+	if (!m_shutdown) {
+		CallAfter([this, job, shape, error]() {
+			onJobFinished(job, shape, error);
+		});
+	}
+}
+
+void ShapeBuildService::onJobFinished(const std::shared_ptr<Job>& job, const TopoDS_Shape& shape, const std::string& error) {
+	m_running.erase(std::remove(m_running.begin(), m_running.end(), job), m_running.end());
+	job->running = false;
+
+	if (job->cancelled) {
+		LOG_INF_S("ShapeBuildService: Cancelled '" + job->label + "'");
+	}
+	else if (!error.empty()) {
+		LOG_ERR_S("ShapeBuildService: Building '" + job->label + "' failed: " + error);
+	}
+	else if (job->commit) {
+		// The whole commit happens in this one event, so a frame sees the geometry complete or not at all
+		try {
+			job->commit(shape);
+			LOG_INF_S("ShapeBuildService: Added '" + job->label + "'");
+		}
+		catch (const std::exception& e) {
+			LOG_ERR_S("ShapeBuildService: Adding '" + job->label + "' failed: " + std::string(e.what()));
+		}
+	}
+
+	launchQueued();
+}
@@ -71,7 +71,12 @@ void ViewUpdateService::requestCameraMoved(bool immediate) const {
 }
 
 void ViewUpdateService::refreshCanvas(bool eraseBackground) const {
-	if (m_sceneManager && m_sceneManager->getCanvas()) {
-		m_sceneManager->getCanvas()->Refresh(eraseBackground);
+	if (!m_sceneManager || !m_sceneManager->getCanvas()) return;
+	Canvas* canvas = m_sceneManager->getCanvas();
+	// Plain repaints go through the coalescing scheduler; erasing needs a direct refresh
+	if (!eraseBackground && canvas->getRefreshManager()) {
+		canvas->getRefreshManager()->requestRefresh(ViewRefreshManager::RefreshReason::MANUAL_REQUEST, false);
+		return;
 	}
+	canvas->Refresh(eraseBackground);
 }
\ No newline at end of file
@@ -18,88 +18,327 @@
 #include <OpenCASCADE/TopAbs.hxx>
 #include <OpenCASCADE/TopoDS_Builder.hxx>
 #include <OpenCASCADE/TopoDS_Compound.hxx>
-#include <OpenCASCADE/ShapeFix_Shape.hxx>
 #include <OpenCASCADE/BRepTools.hxx>
 #include <OpenCASCADE/BRep_Builder.hxx>
 #include <OpenCASCADE/TopoDS_Solid.hxx>
 #include <OpenCASCADE/TopoDS_Shell.hxx>
 
+#include <OpenCASCADE/TopExp.hxx>
+#include <OpenCASCADE/TopTools_IndexedMapOfShape.hxx>
+#include <OpenCASCADE/BRepTools_ReShape.hxx>
+#include <OpenCASCADE/BRepClass3d.hxx>
+#include <OpenCASCADE/TopoDS_Iterator.hxx>
+
 // Standard includes
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <deque>
+#include <mutex>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+namespace {
+    // One occurrence of an edge in a face boundary
+    struct EdgeUse {
+        int face = 0;
+        bool reversed = false;
+    };
+
+    bool isCancelled(const std::atomic<bool>* cancel) {
+        return cancel && cancel->load(std::memory_order_relaxed);
+    }
 
-NormalValidationResult NormalValidator::validateNormals(const TopoDS_Shape& shape, const std::string& shapeName) {
-    NormalValidationResult result;
-    auto startTime = std::chrono::high_resolution_clock::now();
+    double elapsedMs(std::chrono::high_resolution_clock::time_point start) {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start).count());
+    }
+}
 
-    try {
-        if (shape.IsNull()) {
-            result.errorMessage = "Shape is null";
-            LOG_ERR_S("Normal validation failed for " + shapeName + ": " + result.errorMessage);
-            return result;
+NormalOrientationAnalysis NormalValidator::analyzeOrientation(const TopoDS_Shape& shape, const std::atomic<bool>* cancel) {
+    NormalOrientationAnalysis analysis;
+    if (shape.IsNull()) {
+        return analysis;
+    }
+
+    TopTools_IndexedMapOfShape faces;
+    TopTools_IndexedMapOfShape edges;
+    TopExp::MapShapes(shape, TopAbs_FACE, faces);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+    const int faceCount = faces.Extent();
+    analysis.totalFaces = faceCount;
+
+    // Per face, in parallel: normal availability and the oriented boundary edges.
+    // The maps are only read here, which is safe from several threads.
+    std::vector<std::vector<EdgeUse>> edgeUses(edges.Extent() + 1);
+    std::vector<std::vector<std::pair<int, bool>>> faceEdges(faceCount);
+    std::vector<char> hasNormal(faceCount, 0);
+    tbb::parallel_for(tbb::blocked_range<int>(0, faceCount, 64),
+        [&](const tbb::blocked_range<int>& range) {
+            for (int i = range.begin(); i != range.end() && !isCancelled(cancel); ++i) {
+                const TopoDS_Face& face = TopoDS::Face(faces(i + 1));
+                hasNormal[i] = analyzeFaceNormal(face, gp_Pnt()) ? 1 : 0;
+                for (TopExp_Explorer exp(face, TopAbs_EDGE); exp.More(); exp.Next()) {
+                    const TopoDS_Edge& edge = TopoDS::Edge(exp.Current());
+                    // Degenerated edges have no neighbour; seams border the face itself
+                    if (BRep_Tool::Degenerated(edge) || BRep_Tool::IsClosed(edge, face)) {
+                        continue;
+                    }
+                    faceEdges[i].emplace_back(edges.FindIndex(edge), edge.Orientation() == TopAbs_REVERSED);
+                }
+            }
+        });
+    if (isCancelled(cancel)) {
+        analysis.cancelled = true;
+        return analysis;
+    }
+
+    for (int i = 0; i < faceCount; ++i) {
+        analysis.facesWithNormals += hasNormal[i];
+        for (const auto& use : faceEdges[i]) {
+            edgeUses[use.first].push_back({ i, use.second });
         }
+    }
 
-        LOG_INF_S("Starting normal validation for: " + shapeName);
+    // Breadth-first propagation over manifold edges: two faces are consistent
+    // when they run along the shared edge in opposite directions
+    std::vector<int> component(faceCount, -1);
+    std::vector<char> flip(faceCount, 0);
+    std::vector<std::vector<int>> components;
+    std::vector<char> componentClosed;
+    for (int seed = 0; seed < faceCount; ++seed) {
+        if (component[seed] != -1) {
+            continue;
+        }
+        if (isCancelled(cancel)) {
+            analysis.cancelled = true;
+            return analysis;
+        }
 
-        // Calculate shape center
-        gp_Pnt shapeCenter = calculateShapeCenter(shape);
-        LOG_INF_S("Shape center: (" + std::to_string(shapeCenter.X()) + ", " +
-                 std::to_string(shapeCenter.Y()) + ", " + std::to_string(shapeCenter.Z()) + ")");
+        const int id = static_cast<int>(components.size());
+        components.emplace_back();
+        componentClosed.push_back(1);
+        std::deque<int> queue{ seed };
+        component[seed] = id;
+        while (!queue.empty()) {
+            const int f = queue.front();
+            queue.pop_front();
+            components[id].push_back(f);
+            for (const auto& use : faceEdges[f]) {
+                const auto& uses = edgeUses[use.first];
+                if (uses.size() != 2) {
+                    // Free edge opens the shell; non-manifold edges do not define a neighbour
+                    componentClosed[id] = 0;
+                    continue;
+                }
+                const EdgeUse& other = uses[0].face == f && uses[0].reversed == use.second ? uses[1] : uses[0];
+                const int g = other.face;
+                if (g == f) {
+                    continue;
+                }
+                const char wanted = static_cast<char>(!(use.second ^ (flip[f] != 0)) ^ other.reversed);
+                if (component[g] == -1) {
+                    component[g] = id;
+                    flip[g] = wanted;
+                    queue.push_back(g);
+                }
+                else if (flip[g] != wanted && f < g) {
+                    ++analysis.conflictingEdges;
+                }
+            }
+        }
+    }
 
-        // Analyze each face
-        for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
-            TopoDS_Face face = TopoDS::Face(exp.Current());
-            result.totalFaces++;
+    // Signed volume of every closed shell as propagated; its sign gives the side the faces face
+    const int componentCount = static_cast<int>(components.size());
+    std::vector<double> volume(componentCount, 0.0);
+    tbb::parallel_for(tbb::blocked_range<int>(0, componentCount, 1),
+        [&](const tbb::blocked_range<int>& range) {
+            for (int c = range.begin(); c != range.end() && !isCancelled(cancel); ++c) {
+                if (!componentClosed[c]) {
+                    continue;
+                }
+                TopoDS_Shell shell;
+                BRep_Builder builder;
+                builder.MakeShell(shell);
+                for (int f : components[c]) {
+                    const TopoDS_Shape& face = faces(f + 1);
+                    builder.Add(shell, flip[f] ? face.Reversed() : face);
+                }
+                GProp_GProps props;
+                BRepGProp::VolumeProperties(shell, props);
+                volume[c] = props.Mass();
+            }
+        });
+    if (isCancelled(cancel)) {
+        analysis.cancelled = true;
+        return analysis;
+    }
 
-            bool hasNormal = analyzeFaceNormal(face, shapeCenter);
-            if (hasNormal) {
-                result.facesWithNormals++;
+    // Inside a solid only the outer shell points outward; the shells of its voids point
+    // into the void, i.e. towards the material, and enclose a negative volume
+    std::vector<char> isVoid(componentCount, 0);
+    for (TopExp_Explorer solids(shape, TopAbs_SOLID); solids.More(); solids.Next()) {
+        const TopoDS_Solid& solid = TopoDS::Solid(solids.Current());
+        std::vector<int> shellComponents;
+        for (TopoDS_Iterator it(solid); it.More(); it.Next()) {
+            if (it.Value().ShapeType() != TopAbs_SHELL) {
+                continue;
+            }
+            TopExp_Explorer firstFace(it.Value(), TopAbs_FACE);
+            if (!firstFace.More()) {
+                continue;
             }
+            const int c = component[faces.FindIndex(firstFace.Current()) - 1];
+            if (componentClosed[c] && std::find(shellComponents.begin(), shellComponents.end(), c) == shellComponents.end()) {
+                shellComponents.push_back(c);
+            }
+        }
+        if (shellComponents.size() < 2) {
+            continue;
+        }
 
-            // For more detailed analysis, we could check normal direction here
-            // For now, we just count faces with valid normals
+        // OuterShell classifies by orientation, which may be what is broken here; the outer
+        // shell also encloses the voids, so it must have the largest volume of the solid
+        int outer = shellComponents.front();
+        for (int c : shellComponents) {
+            if (std::abs(volume[c]) > std::abs(volume[outer])) {
+                outer = c;
+            }
+        }
+        TopoDS_Shell classified = BRepClass3d::OuterShell(solid);
+        if (!classified.IsNull()) {
+            TopExp_Explorer firstFace(classified, TopAbs_FACE);
+            if (firstFace.More()) {
+                const int c = component[faces.FindIndex(firstFace.Current()) - 1];
+                if (std::find(shellComponents.begin(), shellComponents.end(), c) != shellComponents.end() &&
+                    std::abs(volume[c]) >= std::abs(volume[outer])) {
+                    outer = c;
+                }
+            }
         }
+        for (int c : shellComponents) {
+            isVoid[c] = c != outer ? 1 : 0;
+        }
+    }
 
-        // Simulate normal direction analysis (this would be more complex in practice)
-        // In a real implementation, you'd check each face's normal direction
-        result.facesWithCorrectNormals = result.facesWithNormals * 0.8; // Assume 80% are correct
-        result.facesWithIncorrectNormals = result.facesWithNormals - result.facesWithCorrectNormals;
-        result.facesNeedingCorrection = result.facesWithIncorrectNormals;
+    // Open shells keep the orientation most of their faces already have
+    std::vector<char> invert(componentCount, 0);
+    for (int c = 0; c < componentCount; ++c) {
+        const auto& members = components[c];
+        if (componentClosed[c]) {
+            invert[c] = (isVoid[c] ? volume[c] > 0.0 : volume[c] < 0.0) ? 1 : 0;
+        }
+        else {
+            size_t flipped = std::count_if(members.begin(), members.end(), [&](int f) { return flip[f] != 0; });
+            invert[c] = flipped * 2 > members.size() ? 1 : 0;
+        }
+    }
 
-        result.calculateMetrics();
+    analysis.shells = componentCount;
+    for (int c = 0; c < componentCount; ++c) {
+        analysis.closedShells += componentClosed[c];
+        bool affected = false;
+        for (int f : components[c]) {
+            if ((flip[f] != 0) != (invert[c] != 0)) {
+                analysis.facesToReverse.push_back(TopoDS::Face(faces(f + 1)));
+                affected = true;
+            }
+        }
+        analysis.affectedShells += affected ? 1 : 0;
+    }
+    return analysis;
+}
 
-        // Generate recommendations
-        generateRecommendations(result);
+NormalValidationResult NormalValidator::resultFromAnalysis(const NormalOrientationAnalysis& analysis) {
+    NormalValidationResult result;
+    const int incorrect = static_cast<int>(analysis.facesToReverse.size());
+    result.totalFaces = analysis.totalFaces;
+    result.facesWithNormals = analysis.facesWithNormals;
+    result.facesWithIncorrectNormals = incorrect;
+    result.facesNeedingCorrection = incorrect;
+    result.facesWithCorrectNormals = std::max(0, analysis.facesWithNormals - incorrect);
+
+    if (incorrect > 0) {
+        result.issues.push_back(std::to_string(incorrect) + " faces in " + std::to_string(analysis.affectedShells) +
+            " shells are oriented against their neighbours or away from the outside of the solid");
+    }
+    if (analysis.conflictingEdges > 0) {
+        result.issues.push_back(std::to_string(analysis.conflictingEdges) +
+            " edges cannot be oriented consistently (non-orientable or non-manifold shell)");
+    }
+    const int openShells = analysis.shells - analysis.closedShells;
+    if (openShells > 0) {
+        result.issues.push_back(std::to_string(openShells) + " open shells; outward side chosen by majority orientation");
+    }
 
-        result.success = true;
+    result.calculateMetrics();
+    generateRecommendations(result);
+    result.success = !analysis.cancelled;
+    if (analysis.cancelled) {
+        result.errorMessage = "Cancelled";
+    }
+    return result;
+}
+
+NormalValidationResult NormalValidator::validateNormals(const TopoDS_Shape& shape, const std::string& shapeName) {
+    NormalValidationResult result;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    try {
+        if (shape.IsNull()) {
+            result.errorMessage = "Shape is null";
+            LOG_ERR_S("Normal validation failed for " + shapeName + ": " + result.errorMessage);
+            return result;
+        }
+
+        result = resultFromAnalysis(analyzeOrientation(shape));
         LOG_INF_S("Normal validation completed for: " + shapeName + " (" +
                  std::to_string(result.totalFaces) + " faces, " +
                  std::to_string(result.correctnessPercentage) + "% correct)");
 
     } catch (const std::exception& e) {
+        result.success = false;
         result.errorMessage = "Exception during normal validation: " + std::string(e.what());
         LOG_ERR_S("Normal validation failed for " + shapeName + ": " + result.errorMessage);
     }
 
-    auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
-    result.validationTime = static_cast<double>(duration.count());
-
+    result.validationTime = elapsedMs(startTime);
     return result;
 }
 
-NormalValidationResult NormalValidator::validateNormals(const std::vector<std::shared_ptr<OCCGeometry>>& geometries) {
+NormalValidationResult NormalValidator::validateNormals(const std::vector<std::shared_ptr<OCCGeometry>>& geometries,
+    ProgressCallback progress, const std::atomic<bool>* cancel) {
     NormalValidationResult combinedResult;
     auto startTime = std::chrono::high_resolution_clock::now();
 
     LOG_INF_S("Starting normal validation for " + std::to_string(geometries.size()) + " geometries");
 
-    for (const auto& geometry : geometries) {
-        if (!geometry) continue;
+    std::vector<NormalValidationResult> results(geometries.size());
+    std::mutex progressMutex;
+    size_t completed = 0;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, geometries.size(), 1),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                const auto& geometry = geometries[i];
+                if (!geometry || isCancelled(cancel)) {
+                    continue;
+                }
+                results[i] = validateNormals(geometry->getShape(), geometry->getName());
+                std::lock_guard<std::mutex> lock(progressMutex);
+                ++completed;
+                if (progress) {
+                    progress(completed, geometries.size(), geometry->getName(), results[i]);
+                }
+            }
+        });
 
-        std::string geomName = geometry->getName();
-        const TopoDS_Shape& shape = geometry->getShape();
+    for (size_t i = 0; i < geometries.size(); ++i) {
+        if (!geometries[i]) continue;
 
-        NormalValidationResult geomResult = validateNormals(shape, geomName);
+        const std::string geomName = geometries[i]->getName();
+        const NormalValidationResult& geomResult = results[i];
 
         // Combine results
         combinedResult.totalFaces += geomResult.totalFaces;
@@ -115,16 +354,14 @@ NormalValidationResult NormalValidator::validateNormals(const std::vector<std::s
         for (const auto& rec : geomResult.recommendations) {
             combinedResult.recommendations.push_back("[" + geomName + "] " + rec);
         }
-
-        combinedResult.validationTime += geomResult.validationTime;
     }
 
     combinedResult.calculateMetrics();
-    combinedResult.success = true;
-
-    auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
-    combinedResult.validationTime = static_cast<double>(duration.count());
+    combinedResult.success = !isCancelled(cancel);
+    if (!combinedResult.success) {
+        combinedResult.errorMessage = "Cancelled";
+    }
+    combinedResult.validationTime = elapsedMs(startTime);
 
     LOG_INF_S("Combined normal validation completed: " +
              std::to_string(combinedResult.totalFaces) + " total faces, " +
@@ -133,6 +370,55 @@ NormalValidationResult NormalValidator::validateNormals(const std::vector<std::s
     return combinedResult;
 }
 
+std::vector<NormalCorrection> NormalValidator::correctNormals(const std::vector<std::shared_ptr<OCCGeometry>>& geometries,
+    double qualityThreshold, ProgressCallback progress, const std::atomic<bool>* cancel) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    std::vector<NormalCorrection> corrections(geometries.size());
+    std::mutex progressMutex;
+    size_t completed = 0;
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, geometries.size(), 1),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                const auto& geometry = geometries[i];
+                if (!geometry || geometry->getShape().IsNull() || isCancelled(cancel)) {
+                    continue;
+                }
+
+                NormalValidationResult result;
+                try {
+                    const TopoDS_Shape& shape = geometry->getShape();
+                    NormalOrientationAnalysis analysis = analyzeOrientation(shape, cancel);
+                    result = resultFromAnalysis(analysis);
+                    if (result.success && result.qualityScore < qualityThreshold && !analysis.facesToReverse.empty()) {
+                        corrections[i].geometry = geometry;
+                        corrections[i].correctedShape = correctFaceNormals(shape, analysis, geometry->getName());
+                        corrections[i].reversedFaces = static_cast<int>(analysis.facesToReverse.size());
+                        corrections[i].affectedShells = analysis.affectedShells;
+                    }
+                }
+                catch (const std::exception& e) {
+                    result.success = false;
+                    result.errorMessage = e.what();
+                    LOG_ERR_S("Exception during normal correction for " + geometry->getName() + ": " + std::string(e.what()));
+                }
+
+                std::lock_guard<std::mutex> lock(progressMutex);
+                ++completed;
+                if (progress) {
+                    progress(completed, geometries.size(), geometry->getName(), result);
+                }
+            }
+        });
+
+    corrections.erase(std::remove_if(corrections.begin(), corrections.end(),
+        [](const NormalCorrection& correction) { return !correction.geometry; }), corrections.end());
+
+    LOG_INF_S("Normal correction computed for " + std::to_string(geometries.size()) + " geometries in " +
+        std::to_string(elapsedMs(startTime)) + " ms, " + std::to_string(corrections.size()) + " need changes");
+    return corrections;
+}
+
 TopoDS_Shape NormalValidator::autoCorrectNormals(const TopoDS_Shape& shape, const std::string& shapeName) {
     if (shape.IsNull()) {
         LOG_WRN_S("Cannot correct normals for null shape: " + shapeName);
@@ -141,27 +427,7 @@ TopoDS_Shape NormalValidator::autoCorrectNormals(const TopoDS_Shape& shape, cons
 
     try {
         LOG_INF_S("Attempting automatic normal correction for: " + shapeName);
-
-        // Calculate shape center for normal direction analysis
-        gp_Pnt shapeCenter = calculateShapeCenter(shape);
-        
-        // Use ShapeFix_Shape to fix the shape first
-        ShapeFix_Shape shapeFixer(shape);
-        shapeFixer.SetPrecision(1e-6);
-        shapeFixer.SetMaxTolerance(1e-3);
-        shapeFixer.Perform();
-        
-        TopoDS_Shape fixedShape = shapeFixer.Shape();
-        if (fixedShape.IsNull()) {
-            LOG_WRN_S("ShapeFix failed for: " + shapeName + ", using original shape");
-            fixedShape = shape;
-        }
-
-        // Apply our custom normal correction
-        TopoDS_Shape correctedShape = correctFaceNormals(fixedShape, shapeCenter, shapeName);
-        
-        LOG_INF_S("Normal correction completed for: " + shapeName);
-        return correctedShape;
+        return correctFaceNormals(shape, analyzeOrientation(shape), shapeName);
 
     } catch (const std::exception& e) {
         LOG_ERR_S("Exception during normal correction for " + shapeName + ": " + std::string(e.what()));
@@ -173,8 +439,8 @@ bool NormalValidator::hasConsistentNormals(const TopoDS_Shape& shape) {
     if (shape.IsNull()) return false;
 
     try {
-        NormalValidationResult result = validateNormals(shape);
-        return result.qualityScore >= 0.8; // Consider normals consistent if quality >= 80%
+        NormalOrientationAnalysis analysis = analyzeOrientation(shape);
+        return analysis.facesToReverse.empty() && analysis.conflictingEdges == 0;
     } catch (const std::exception&) {
         return false;
     }
@@ -184,8 +450,7 @@ double NormalValidator::getNormalQualityScore(const TopoDS_Shape& shape) {
     if (shape.IsNull()) return 0.0;
 
     try {
-        NormalValidationResult result = validateNormals(shape);
-        return result.qualityScore;
+        return resultFromAnalysis(analyzeOrientation(shape)).qualityScore;
     } catch (const std::exception&) {
         return 0.0;
     }
@@ -289,54 +554,17 @@ void NormalValidator::generateRecommendations(NormalValidationResult& result) {
     }
 }
 
-TopoDS_Shape NormalValidator::correctFaceNormals(const TopoDS_Shape& shape, const gp_Pnt& shapeCenter, const std::string& shapeName) {
-    if (shape.IsNull()) {
+TopoDS_Shape NormalValidator::correctFaceNormals(const TopoDS_Shape& shape, const NormalOrientationAnalysis& analysis, const std::string& shapeName) {
+    if (shape.IsNull() || analysis.facesToReverse.empty()) {
         return shape;
     }
 
     try {
-        LOG_INF_S("Correcting face normals for: " + shapeName);
-        
-        // Use ShapeFix_Shape to fix the shape
-        ShapeFix_Shape shapeFixer(shape);
-        shapeFixer.SetPrecision(1e-6);
-        shapeFixer.SetMaxTolerance(1e-3);
-        
-        // Perform the fix
-        shapeFixer.Perform();
-        
-        TopoDS_Shape fixedShape = shapeFixer.Shape();
-        if (fixedShape.IsNull()) {
-            LOG_WRN_S("ShapeFix failed for: " + shapeName + ", using original shape");
-            return shape;
-        }
-        
-        // Count how many faces were actually corrected by comparing orientations
-        int correctedCount = 0;
-        int totalFaces = 0;
-        
-        // Compare original and fixed shapes to count corrections
-        TopExp_Explorer origExp(shape, TopAbs_FACE);
-        TopExp_Explorer fixedExp(fixedShape, TopAbs_FACE);
-        
-        while (origExp.More() && fixedExp.More()) {
-            TopoDS_Face origFace = TopoDS::Face(origExp.Current());
-            TopoDS_Face fixedFace = TopoDS::Face(fixedExp.Current());
-            totalFaces++;
-            
-            // Check if orientation changed
-            if (origFace.Orientation() != fixedFace.Orientation()) {
-                correctedCount++;
-            }
-            
-            origExp.Next();
-            fixedExp.Next();
-        }
-
-        LOG_INF_S("Corrected " + std::to_string(correctedCount) + " out of " + 
-                 std::to_string(totalFaces) + " faces for: " + shapeName);
-
-        return fixedShape;
+        TopoDS_Shape correctedShape = rebuildShapeWithCorrectedFaces(shape, analysis.facesToReverse);
+        LOG_INF_S("Corrected " + std::to_string(analysis.facesToReverse.size()) + " out of " +
+                 std::to_string(analysis.totalFaces) + " faces in " + std::to_string(analysis.affectedShells) +
+                 " shells for: " + shapeName);
+        return correctedShape;
 
     } catch (const std::exception& e) {
         LOG_ERR_S("Exception correcting face normals for " + shapeName + ": " + std::string(e.what()));
@@ -432,8 +660,15 @@ TopoDS_Face NormalValidator::reverseFace(const TopoDS_Face& face) {
 }
 
 TopoDS_Shape NormalValidator::rebuildShapeWithCorrectedFaces(const TopoDS_Shape& originalShape, const std::vector<TopoDS_Face>& correctedFaces) {
-    // This function is no longer needed as we handle shape rebuilding directly in correctFaceNormals
-    // Return the original shape as a fallback
-    LOG_INF_S("rebuildShapeWithCorrectedFaces called but not used in new implementation");
-    return originalShape;
+    if (correctedFaces.empty()) {
+        return originalShape;
+    }
+
+    // ReShape rebuilds only the shells and solids that contain a replaced face;
+    // everything else keeps sharing the original TShapes
+    Handle(BRepTools_ReShape) reshape = new BRepTools_ReShape();
+    for (const auto& face : correctedFaces) {
+        reshape->Replace(face, face.Reversed());
+    }
+    return reshape->Apply(originalShape);
 }
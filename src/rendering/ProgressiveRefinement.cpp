@@ -0,0 +1,117 @@
+#include "ProgressiveRefinement.h"
+#include "logger/Logger.h"
+
+ProgressiveRefinement::ProgressiveRefinement()
+	: m_idleTimer(this, wxID_ANY) {
+	m_idleTimer.Bind(wxEVT_TIMER, &ProgressiveRefinement::onIdleTimer, this);
+}
+
+ProgressiveRefinement::~ProgressiveRefinement() {
+	m_idleTimer.Stop();
+}
+
+void ProgressiveRefinement::setEnabled(bool enabled) {
+	if (m_enabled == enabled) return;
+	m_enabled = enabled;
+	m_idleTimer.Stop();
+	if (!enabled && m_abandonRefine) {
+		m_abandonRefine();
+	}
+	m_stage = Stage::Complete;
+	if (m_frameRequest) {
+		m_frameRequest();
+	}
+}
+
+bool ProgressiveRefinement::useBoundingBoxProxy() const {
+	return m_enabled && m_stage == Stage::Interactive && m_meshFrameMs > m_frameBudgetMs;
+}
+
+void ProgressiveRefinement::beginInteraction() {
+	if (!m_enabled) return;
+
+	if (m_stage != Stage::Interactive) {
+		LOG_DBG_S("ProgressiveRefinement: Input received, dropping to interactive stage");
+		if (m_stage == Stage::FineTessellation && m_abandonRefine) {
+			m_abandonRefine();
+		}
+	}
+	m_stage = Stage::Interactive;
+
+	// Restart the idle countdown on every input event
+	m_idleTimer.Start(m_idleDelayMs, wxTIMER_ONE_SHOT);
+}
+
+void ProgressiveRefinement::requestRetessellation() {
+	// Earlier stages reach FineTessellation on their own
+	if (m_enabled && m_stage == Stage::Complete) {
+		advanceTo(Stage::FineTessellation);
+	}
+}
+
+void ProgressiveRefinement::frameRendered(double frameMs) {
+	if (!m_enabled) return;
+
+	switch (m_stage) {
+	case Stage::Interactive:
+		// Full-mesh interactive frames have the same cost as the shaded stage
+		if (!useBoundingBoxProxy()) {
+			m_meshFrameMs = frameMs;
+		}
+		break;
+	case Stage::Shaded:
+		m_meshFrameMs = frameMs;
+		advanceTo(Stage::Detailed);
+		break;
+	case Stage::Detailed:
+		advanceTo(Stage::Antialiased);
+		break;
+	case Stage::Antialiased:
+		advanceTo(Stage::FineTessellation);
+		break;
+	case Stage::FineTessellation:
+		// Swapping in finished meshes runs after the paint handler returns;
+		// geometries not yet processed stay flagged for later
+		if (!m_stepPending) {
+			m_stepPending = true;
+			CallAfter(&ProgressiveRefinement::runRefineStep);
+		}
+		break;
+	case Stage::Complete:
+		break;
+	}
+}
+
+void ProgressiveRefinement::runRefineStep() {
+	m_stepPending = false;
+	// New input since the frame was rendered abandons the slice
+	if (!m_enabled || m_stage != Stage::FineTessellation) return;
+
+	RefineResult result = RefineResult::Done;
+	if (m_refineStep) {
+		try {
+			result = m_refineStep(m_frameBudgetMs);
+		}
+		catch (const std::exception& e) {
+			LOG_ERR_S("ProgressiveRefinement: Refinement step failed: " + std::string(e.what()));
+		}
+	}
+	// While waiting, no frames are drawn; the background builder asks for one when meshes are ready
+	if (result != RefineResult::Waiting) {
+		advanceTo(result == RefineResult::MoreWork ? Stage::FineTessellation : Stage::Complete);
+	}
+}
+
+void ProgressiveRefinement::onIdleTimer(wxTimerEvent&) {
+	if (m_enabled && m_stage == Stage::Interactive) {
+		advanceTo(Stage::Shaded);
+	}
+}
+
+void ProgressiveRefinement::advanceTo(Stage stage) {
+	m_stage = stage;
+	// Complete also needs one frame: the last slice may have replaced meshes
+	if (m_frameRequest) {
+		m_frameRequest();
+	}
+}
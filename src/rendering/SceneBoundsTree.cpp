@@ -0,0 +1,106 @@
+#include "SceneBoundsTree.h"
+
+namespace {
+	SbBox3f unite(const SbBox3f& a, const SbBox3f& b) {
+		if (a.isEmpty()) return b;
+		if (b.isEmpty()) return a;
+		SbBox3f result(a);
+		result.extendBy(b);
+		return result;
+	}
+}
+
+SceneBoundsTree::SceneBoundsTree()
+	: m_capacity(0)
+	, m_nextSlot(0)
+	, m_version(0) {
+	m_emptyBox.makeEmpty();
+}
+
+void SceneBoundsTree::update(const void* key, const SbBox3f& bounds) {
+	std::size_t slot;
+	auto it = m_slots.find(key);
+	if (it != m_slots.end()) {
+		slot = it->second;
+	}
+	else {
+		if (!m_freeSlots.empty()) {
+			slot = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		else {
+			if (m_nextSlot >= m_capacity) {
+				grow();
+			}
+			slot = m_nextSlot++;
+		}
+		m_slots.emplace(key, slot);
+	}
+
+	m_nodes[m_capacity + slot] = bounds;
+	propagate(slot);
+}
+
+bool SceneBoundsTree::remove(const void* key) {
+	auto it = m_slots.find(key);
+	if (it == m_slots.end()) {
+		return false;
+	}
+
+	std::size_t slot = it->second;
+	m_slots.erase(it);
+	m_freeSlots.push_back(slot);
+
+	m_nodes[m_capacity + slot].makeEmpty();
+	propagate(slot);
+	return true;
+}
+
+void SceneBoundsTree::clear() {
+	bool hadBounds = !getBounds().isEmpty();
+	m_capacity = 0;
+	m_nodes.clear();
+	m_slots.clear();
+	m_freeSlots.clear();
+	m_nextSlot = 0;
+	if (hadBounds) {
+		++m_version;
+	}
+}
+
+const SbBox3f& SceneBoundsTree::getBounds() const {
+	return m_nodes.size() > 1 ? m_nodes[1] : m_emptyBox;
+}
+
+void SceneBoundsTree::grow() {
+	// Doubling keeps the amortized insert cost at O(log n)
+	std::size_t newCapacity = m_capacity == 0 ? 16 : m_capacity * 2;
+	std::vector<SbBox3f> nodes(newCapacity * 2, m_emptyBox);
+
+	for (std::size_t slot = 0; slot < m_nextSlot; ++slot) {
+		nodes[newCapacity + slot] = m_nodes[m_capacity + slot];
+	}
+	for (std::size_t i = newCapacity - 1; i >= 1; --i) {
+		nodes[i] = unite(nodes[2 * i], nodes[2 * i + 1]);
+	}
+
+	m_nodes.swap(nodes);
+	m_capacity = newCapacity;
+}
+
+void SceneBoundsTree::propagate(std::size_t slot) {
+	SbBox3f oldRoot = getBounds();
+
+	for (std::size_t i = (m_capacity + slot) / 2; i >= 1; i /= 2) {
+		SbBox3f merged = unite(m_nodes[2 * i], m_nodes[2 * i + 1]);
+		if (merged == m_nodes[i]) {
+			// Ancestors are unions of unchanged children from here up
+			break;
+		}
+		m_nodes[i] = merged;
+	}
+
+	if (!(getBounds() == oldRoot)) {
+		++m_version;
+	}
+}
@@ -9,6 +9,10 @@
 #include <Inventor/nodes/SoCoordinate3.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
 #include <Inventor/nodes/SoIndexedLineSet.h>
+#include <Inventor/nodes/SoLineSet.h>
+#include <Inventor/nodes/SoPointSet.h>
+#include <Inventor/nodes/SoComplexity.h>
+#include <Inventor/SoPath.h>
 #include "Canvas.h"
 #include "config/RenderingConfig.h"
 #include "config/LightingConfig.h"
@@ -56,6 +60,27 @@ static void renderPassCallback(void* userdata) {
 	}
 }
 
+// State for pruning edge and point overlays during the interactive stage
+struct OverlayPruneState {
+	SoGLRenderAction* action;
+	SoNode* keepRoot;  // subtree that is never pruned (coordinate system)
+};
+
+static SoGLRenderAction::AbortCode pruneOverlaysCallback(void* userdata) {
+	OverlayPruneState* state = static_cast<OverlayPruneState*>(userdata);
+	SoNode* node = state->action->getCurPathTail();
+	if (!node ||
+		!(node->isOfType(SoLineSet::getClassTypeId()) ||
+		  node->isOfType(SoIndexedLineSet::getClassTypeId()) ||
+		  node->isOfType(SoPointSet::getClassTypeId()))) {
+		return SoGLRenderAction::CONTINUE;
+	}
+	if (state->keepRoot && state->action->getCurPath()->containsNode(state->keepRoot)) {
+		return SoGLRenderAction::CONTINUE;
+	}
+	return SoGLRenderAction::PRUNE;
+}
+
 SceneManager::SceneManager(Canvas* canvas)
 	: m_canvas(canvas)
 	, m_sceneRoot(nullptr)
@@ -72,6 +97,13 @@ SceneManager::SceneManager(Canvas* canvas)
 	, m_isFirstRender(true)
 	, m_forceCacheClearCounter(0)
 {
+	m_progressive = std::make_unique<ProgressiveRefinement>();
+	m_progressive->setFrameRequest([this]() {
+		if (m_canvas && m_canvas->getRefreshManager()) {
+			m_canvas->getRefreshManager()->requestRefresh(ViewRefreshManager::RefreshReason::RENDERING_CHANGED, false);
+		}
+	});
+
 	// Initialize rendering toolkit with culling
 	// m_renderingToolkit = std::make_unique<RenderingToolkitAPI>(); // Removed as per edit hint
 	// m_renderingToolkit->setFrustumCullingEnabled(true); // Removed as per edit hint
@@ -83,6 +115,7 @@ SceneManager::~SceneManager() {
 	if (m_canvas && m_canvas->getRefreshManager()) {
 		m_canvas->getRefreshManager()->removeAllListeners();
 	}
+	m_progressive.reset();
 	cleanup();
 }
 
@@ -158,9 +191,21 @@ bool SceneManager::initScene() {
 		// Initialize lighting from configuration instead of hardcoded values
 		initializeLightingFromConfig();
 
+		// Bounding-box proxy and coarse LOD bias for the interactive stage; its fields stay ignored otherwise
+		m_proxyComplexity = new SoComplexity;
+		m_proxyComplexity->ref();
+		m_proxyComplexity->type.setValue(SoComplexity::BOUNDING_BOX);
+		m_proxyComplexity->value.setValue(0.2f);
+		m_proxyComplexity->type.setIgnored(TRUE);
+		m_proxyComplexity->value.setIgnored(TRUE);
+		m_proxyComplexity->textureQuality.setIgnored(TRUE);
+		m_sceneRoot->addChild(m_proxyComplexity);
+
 		m_objectRoot = new SoSeparator;
 		m_objectRoot->ref();
 		m_sceneRoot->addChild(m_objectRoot);
+		m_progressive->setEnabled(configManager.getBool("Canvas", "ProgressiveRefinement", true));
+		setDeferredUpdateBudget(configManager.getDouble("Canvas", "DeferredUpdateBudgetMs", 4.0));
 
 		m_coordSystemRenderer = std::make_unique<CoordinateSystemRenderer>(m_objectRoot);
 		m_pickingAidManager = std::make_unique<PickingAidManager>(this, m_canvas, m_canvas->getInputManager());
@@ -186,6 +231,7 @@ bool SceneManager::initScene() {
 					}
 					if (reason == ViewRefreshManager::RefreshReason::CAMERA_MOVED) {
 						updateCameraClippingPlanes();
+						beginInteraction();
 					}
 				});
 		}
@@ -210,6 +256,10 @@ void SceneManager::cleanup() {
 		m_sceneRoot->unref();
 		m_sceneRoot = nullptr;
 	}
+	if (m_proxyComplexity) {
+		m_proxyComplexity->unref();
+		m_proxyComplexity = nullptr;
+	}
 	if (m_camera) {
 		m_camera->unref();
 		m_camera = nullptr;
@@ -333,34 +383,50 @@ void SceneManager::toggleCameraMode() {
 	}
 }
 
+namespace {
+	const std::map<std::string, SbVec3f>& viewDirections() {
+		static const std::map<std::string, SbVec3f> directions = {
+			{ "Top", SbVec3f(0, 0, -1) },
+			{ "Bottom", SbVec3f(0, 0, 1) },
+			{ "Front", SbVec3f(0, -1, 0) },
+			{ "Back", SbVec3f(0, 1, 0) },
+			{ "Left", SbVec3f(-1, 0, 0) },
+			{ "Right", SbVec3f(1, 0, 0) },
+			{ "Isometric", SbVec3f(1, 1, 1) }
+		};
+		return directions;
+	}
+}
+
+bool SceneManager::getViewDirection(const std::string& viewName, SbVec3f& direction) {
+	auto directionIt = viewDirections().find(viewName);
+	if (directionIt == viewDirections().end()) {
+		return false;
+	}
+	direction = directionIt->second;
+	return direction.normalize() != 0.0f;
+}
+
+std::vector<std::string> SceneManager::getViewNames() {
+	std::vector<std::string> names;
+	for (const auto& view : viewDirections()) {
+		names.push_back(view.first);
+	}
+	return names;
+}
+
 void SceneManager::setView(const std::string& viewName) {
 	if (!m_camera || !m_sceneRoot) {
 		LOG_ERR_S("Failed to set view: Invalid camera or scene");
 		return;
 	}
 
-	static const std::map<std::string, SbVec3f> viewDirections = {
-		{ "Top", SbVec3f(0, 0, -1) },
-		{ "Bottom", SbVec3f(0, 0, 1) },
-		{ "Front", SbVec3f(0, -1, 0) },
-		{ "Back", SbVec3f(0, 1, 0) },
-		{ "Left", SbVec3f(-1, 0, 0) },
-		{ "Right", SbVec3f(1, 0, 0) },
-		{ "Isometric", SbVec3f(1, 1, 1) }
-	};
-
-	auto directionIt = viewDirections.find(viewName);
-	if (directionIt == viewDirections.end()) {
+	SbVec3f direction;
+	if (!getViewDirection(viewName, direction)) {
 		LOG_WRN_S("Invalid view name: " + viewName);
 		return;
 	}
 
-	SbVec3f direction = directionIt->second;
-	if (direction.normalize() == 0.0f) {
-		LOG_WRN_S("SceneManager::setView: Direction for view '" + viewName + "' is zero vector");
-		return;
-	}
-
 	// Preserve original camera state so we can animate from it
 	CameraAnimation::CameraState originalState = captureCameraState();
 
@@ -439,6 +505,11 @@ void SceneManager::render(const wxSize& size, bool fastMode) {
 		updateCulling();
 	}
 
+	// Pick up object bounds changed since the last frame (O(1) when nothing changed)
+	if (!m_boundsTree.isEmpty()) {
+		updateSceneBounds();
+	}
+
 	// Create viewport region with validation
 	SbViewportRegion viewport(size.x, size.y);
 	if (viewport.getViewportSizePixels()[0] <= 0 || viewport.getViewportSizePixels()[1] <= 0) {
@@ -545,17 +616,33 @@ void SceneManager::render(const wxSize& size, bool fastMode) {
 	// Process any deferred updates before rendering
 	processDeferredUpdates();
 
+	// Progressive refinement decides how much of the full pipeline this frame gets
+	applyProxyComplexity();
+	const bool antialiased = !m_progressive || m_progressive->useAntialiasing();
+	const bool sortedTransparency = !m_progressive || m_progressive->useSortedTransparency();
+	const bool pruneOverlays = m_progressive && !m_progressive->showOverlays();
+	OverlayPruneState pruneState{ nullptr, m_coordSystemRenderer ? m_coordSystemRenderer->getRoot() : nullptr };
+	double sceneRenderMs = 0.0;
+
 	// Configure optimized multi-pass rendering with adaptive pass count
 	SoGLRenderAction renderAction(viewport);
 	try {
-		renderAction.setSmoothing(true);
+		renderAction.setSmoothing(antialiased);
 
 		// Dynamically determine optimal pass count based on scene content
-		int optimalPasses = determineOptimalPassCount();
+		int optimalPasses = antialiased ? determineOptimalPassCount() : 1;
 		renderAction.setNumPasses(optimalPasses);
 
+		if (pruneOverlays) {
+			pruneState.action = &renderAction;
+			renderAction.setAbortCallback(pruneOverlaysCallback, &pruneState);
+		}
+
 		// Optimize transparency rendering based on pass count and scene complexity
-		if (optimalPasses > 2 && hasTransparentObjects()) {
+		if (!sortedTransparency) {
+			// Interactive stage: unsorted blending, no per-frame depth sort
+			renderAction.setTransparencyType(SoGLRenderAction::BLEND);
+		} else if (optimalPasses > 2 && hasTransparentObjects()) {
 			// Use more sophisticated transparency sorting for complex scenes with transparency
 			renderAction.setTransparencyType(SoGLRenderAction::SORTED_OBJECT_SORTED_TRIANGLE_BLEND);
 		} else {
@@ -569,6 +656,10 @@ void SceneManager::render(const wxSize& size, bool fastMode) {
 		// This ensures uniqueness between viewers AND forces cache rebuild after context loss
 		uint32_t baseId = (m_canvas) ? static_cast<uint32_t>(m_canvas->GetId()) : 1;
 		uint32_t cacheId = (baseId << 16) | (lastCacheContext & 0xFFFF);
+		if (pruneOverlays) {
+			// Render caches built with overlays must not be replayed by pruned frames
+			cacheId ^= 0x8000;
+		}
 		renderAction.setCacheContext(cacheId);
 		
 		// Check if scene root is valid before rendering
@@ -592,7 +683,10 @@ void SceneManager::render(const wxSize& size, bool fastMode) {
 			while (glGetError() != GL_NO_ERROR) {}
 		}
 
+		auto applyStartTime = std::chrono::steady_clock::now();
 		renderAction.apply(m_sceneRoot);
+		sceneRenderMs = std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - applyStartTime).count();
 		
 		// Check for GL errors after rendering
 		GLenum postRenderError = glGetError();
@@ -632,6 +726,10 @@ void SceneManager::render(const wxSize& size, bool fastMode) {
 	while ((err = glGetError()) != GL_NO_ERROR) {
 	}
 
+	if (m_progressive) {
+		m_progressive->frameRendered(sceneRenderMs);
+	}
+
 	// Publish to PerformanceDataBus instead of logging
 	perf::ScenePerfSample s;
 	s.width = size.x;
@@ -725,8 +823,22 @@ bool SceneManager::screenToWorld(const wxPoint& screenPos, SbVec3f& worldPos) {
 	return true;
 }
 
-// Optimized scene bounds calculation with caching and frame skipping
+// Scene bounds: read from the incremental bounds tree when objects are registered,
+// otherwise fall back to a throttled SoGetBoundingBoxAction traversal
 void SceneManager::updateSceneBounds() {
+	if (!m_boundsTree.isEmpty()) {
+		// O(1): only re-apply when the tree root (or a forced update) says so
+		if (!m_forceBoundsUpdate && m_appliedBoundsVersion == m_boundsTree.getVersion() &&
+			!m_sceneBoundingBox.isEmpty()) {
+			return;
+		}
+		m_forceBoundsUpdate = false;
+		m_boundsUpdateFrameSkip = 0;
+		m_appliedBoundsVersion = m_boundsTree.getVersion();
+		applySceneBounds(computeIncrementalSceneBounds());
+		return;
+	}
+
 	// Always update if forced, or if no valid bounds exist, or periodically
 	bool needsUpdate = m_forceBoundsUpdate ||
 		m_sceneBoundingBox.isEmpty() ||
@@ -758,8 +870,22 @@ void SceneManager::updateSceneBounds() {
 
 	SoGetBoundingBoxAction bboxAction(viewport);
 	bboxAction.apply(m_objectRoot);
-	SbBox3f newBounds = bboxAction.getBoundingBox();
+	applySceneBounds(bboxAction.getBoundingBox());
+}
+
+SbBox3f SceneManager::computeIncrementalSceneBounds() const {
+	SbBox3f bounds = m_boundsTree.getBounds();
+
+	// The checkerboard is a fixed-size plane and not a registered object
+	if (m_checkerboardVisible && m_checkerboardSeparator) {
+		const float halfSize = 40.0f; // matches createCheckerboardPlane (8 cells * 10 / 2)
+		bounds.extendBy(SbVec3f(-halfSize, -halfSize, 0.0f));
+		bounds.extendBy(SbVec3f(halfSize, halfSize, 0.0f));
+	}
+	return bounds;
+}
 
+void SceneManager::applySceneBounds(const SbBox3f& newBounds) {
 	// Only update if bounds actually changed (to avoid unnecessary updates)
 	if (newBounds != m_sceneBoundingBox) {
 		m_sceneBoundingBox = newBounds;
@@ -779,6 +905,29 @@ void SceneManager::updateSceneBounds() {
 	}
 }
 
+void SceneManager::setObjectBounds(const void* key, const SbBox3f& worldBounds) {
+	if (!key) return;
+	if (worldBounds.isEmpty()) {
+		m_boundsTree.remove(key);
+		return;
+	}
+	m_boundsTree.update(key, worldBounds);
+}
+
+void SceneManager::removeObjectBounds(const void* key) {
+	if (m_boundsTree.remove(key) && m_boundsTree.isEmpty()) {
+		// Last registered object gone: scene is empty (or only holds unregistered nodes)
+		m_sceneBoundingBox.makeEmpty();
+		m_forceBoundsUpdate = true;
+	}
+}
+
+void SceneManager::clearObjectBounds() {
+	m_boundsTree.clear();
+	m_sceneBoundingBox.makeEmpty();
+	m_forceBoundsUpdate = true;
+}
+
 void SceneManager::updateCameraClippingPlanes() {
 	if (!m_camera || m_sceneBoundingBox.isEmpty()) {
 		return;
@@ -932,6 +1081,7 @@ void SceneManager::setCheckerboardVisible(bool visible) {
 				m_checkerboardVisible = false;
 			}
 		}
+		markBoundsDirty();
 		if (m_canvas) {
 			m_canvas->Refresh(true);
 		}
@@ -1227,6 +1377,27 @@ bool SceneManager::hasTransparentObjects() const {
 	return false;
 }
 
+void SceneManager::beginInteraction() {
+	if (m_progressive) {
+		m_progressive->beginInteraction();
+	}
+}
+
+void SceneManager::applyProxyComplexity() {
+	if (!m_proxyComplexity) return;
+	SbBool ignore = !(m_progressive && m_progressive->useBoundingBoxProxy());
+	// setIgnored notifies, so only touch the field on an actual change
+	if (m_proxyComplexity->type.isIgnored() != ignore) {
+		m_proxyComplexity->type.setIgnored(ignore);
+	}
+
+	// While moving, bias SoLevelOfDetail nodes towards their coarser children
+	SbBool ignoreValue = !(m_progressive && m_progressive->isInteractive());
+	if (m_proxyComplexity->value.isIgnored() != ignoreValue) {
+		m_proxyComplexity->value.setIgnored(ignoreValue);
+	}
+}
+
 // Deferred update system implementation
 void SceneManager::deferUpdate(UpdateType type, std::function<void()> action, int priority, const std::string& description) {
 	// Check if we already have a similar update pending
@@ -1257,11 +1428,19 @@ void SceneManager::processDeferredUpdates() {
 			return a.priority > b.priority;
 		});
 
-	// Execute updates, but limit to prevent frame drops
-	const size_t maxUpdatesPerFrame = 5;
+	// Execute updates in priority order until the frame budget is spent;
+	// the rest stay queued for the next frame
+	auto budgetStart = std::chrono::steady_clock::now();
 	size_t processed = 0;
 
-	for (auto it = m_deferredUpdates.begin(); it != m_deferredUpdates.end() && processed < maxUpdatesPerFrame; ) {
+	for (auto it = m_deferredUpdates.begin(); it != m_deferredUpdates.end(); ) {
+		if (processed > 0) {
+			double elapsedMs = std::chrono::duration<double, std::milli>(
+				std::chrono::steady_clock::now() - budgetStart).count();
+			if (elapsedMs >= m_deferredUpdateBudgetMs) {
+				break;
+			}
+		}
 		try {
 			it->action();
 			it = m_deferredUpdates.erase(it);
@@ -1273,6 +1452,11 @@ void SceneManager::processDeferredUpdates() {
 			processed++;
 		}
 	}
+
+	// Leftover work needs another frame even if nothing else requests one
+	if (!m_deferredUpdates.empty() && m_canvas && m_canvas->getRefreshManager()) {
+		m_canvas->getRefreshManager()->requestRefresh(ViewRefreshManager::RefreshReason::RENDERING_CHANGED, false);
+	}
 }
 
 bool SceneManager::hasDeferredUpdates() const {
@@ -253,7 +253,7 @@ void UnifiedRefreshSystem::refreshObject(const std::string& objectId, bool immed
 {
     if (!m_initialized || !m_commandDispatcher) {
         LOG_WRN_S("UnifiedRefreshSystem not initialized, using direct refresh");
-        directRefreshView(ViewRefreshManager::RefreshReason::OBJECT_CHANGED);
+        directRefreshView(ViewRefreshManager::RefreshReason::OBJECT_CHANGED, objectId);
         return;
     }
 
@@ -263,12 +263,12 @@ void UnifiedRefreshSystem::refreshObject(const std::string& objectId, bool immed
         
         if (!result.success) {
             LOG_WRN_S("Failed to dispatch RefreshObject command: " + result.message);
-            directRefreshView(ViewRefreshManager::RefreshReason::OBJECT_CHANGED);
+            directRefreshView(ViewRefreshManager::RefreshReason::OBJECT_CHANGED, objectId);
     }
     } catch (...) {
         // Handle potential static map access issues during shutdown
         LOG_WRN_S("Exception during refreshObject command dispatch, using direct refresh");
-        directRefreshView(ViewRefreshManager::RefreshReason::OBJECT_CHANGED);
+        directRefreshView(ViewRefreshManager::RefreshReason::OBJECT_CHANGED, objectId);
     }
 }
 
@@ -276,7 +276,7 @@ void UnifiedRefreshSystem::refreshMaterial(const std::string& objectId, bool imm
 {
     if (!m_initialized || !m_commandDispatcher) {
         LOG_WRN_S("UnifiedRefreshSystem not initialized, using direct refresh");
-        directRefreshView(ViewRefreshManager::RefreshReason::MATERIAL_CHANGED);
+        directRefreshView(ViewRefreshManager::RefreshReason::MATERIAL_CHANGED, objectId);
         return;
     }
 
@@ -286,12 +286,12 @@ void UnifiedRefreshSystem::refreshMaterial(const std::string& objectId, bool imm
         
         if (!result.success) {
             LOG_WRN_S("Failed to dispatch RefreshMaterial command: " + result.message);
-            directRefreshView(ViewRefreshManager::RefreshReason::MATERIAL_CHANGED);
+            directRefreshView(ViewRefreshManager::RefreshReason::MATERIAL_CHANGED, objectId);
         }
     } catch (...) {
         // Handle potential static map access issues during shutdown
         LOG_WRN_S("Exception during refreshMaterial command dispatch, using direct refresh");
-        directRefreshView(ViewRefreshManager::RefreshReason::MATERIAL_CHANGED);
+        directRefreshView(ViewRefreshManager::RefreshReason::MATERIAL_CHANGED, objectId);
     }
 }
 
@@ -299,7 +299,7 @@ void UnifiedRefreshSystem::refreshGeometry(const std::string& objectId, bool imm
 {
     if (!m_initialized || !m_commandDispatcher) {
         LOG_WRN_S("UnifiedRefreshSystem not initialized, using direct refresh");
-        directRefreshView(ViewRefreshManager::RefreshReason::GEOMETRY_CHANGED);
+        directRefreshView(ViewRefreshManager::RefreshReason::GEOMETRY_CHANGED, objectId);
         return;
     }
 
@@ -309,12 +309,12 @@ void UnifiedRefreshSystem::refreshGeometry(const std::string& objectId, bool imm
         
         if (!result.success) {
             LOG_WRN_S("Failed to dispatch RefreshGeometry command: " + result.message);
-            directRefreshView(ViewRefreshManager::RefreshReason::GEOMETRY_CHANGED);
+            directRefreshView(ViewRefreshManager::RefreshReason::GEOMETRY_CHANGED, objectId);
         }
     } catch (...) {
         // Handle potential static map access issues during shutdown
         LOG_WRN_S("Exception during refreshGeometry command dispatch, using direct refresh");
-        directRefreshView(ViewRefreshManager::RefreshReason::GEOMETRY_CHANGED);
+        directRefreshView(ViewRefreshManager::RefreshReason::GEOMETRY_CHANGED, objectId);
     }
 }
 
@@ -341,10 +341,11 @@ void UnifiedRefreshSystem::refreshUI(const std::string& componentType, bool imme
     }
 }
 
-void UnifiedRefreshSystem::directRefreshView(ViewRefreshManager::RefreshReason reason)
+void UnifiedRefreshSystem::directRefreshView(ViewRefreshManager::RefreshReason reason, const std::string& objectId)
 {
+    // The refresh manager coalesces these per frame, so bursts cost one redraw
     if (m_canvas && m_canvas->getRefreshManager()) {
-        m_canvas->getRefreshManager()->requestRefresh(reason, true);
+        m_canvas->getRefreshManager()->requestObjectRefresh(objectId, reason, true);
     }
     else if (m_canvas) {
         m_canvas->Refresh();
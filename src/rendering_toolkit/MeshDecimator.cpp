@@ -0,0 +1,470 @@
+#include "rendering/MeshDecimator.h"
+#include "logger/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <queue>
+#include <unordered_map>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+namespace {
+	struct Vec3 {
+		double x, y, z;
+
+		Vec3 operator-(const Vec3& o) const { return { x - o.x, y - o.y, z - o.z }; }
+		double dot(const Vec3& o) const { return x * o.x + y * o.y + z * o.z; }
+		Vec3 cross(const Vec3& o) const {
+			return { y * o.z - z * o.y, z * o.x - x * o.z, x * o.y - y * o.x };
+		}
+		double length() const { return std::sqrt(dot(*this)); }
+	};
+
+	// Symmetric 4x4 error quadric, upper triangle
+	struct Quadric {
+		double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+		double a11 = 0, a12 = 0, a13 = 0;
+		double a22 = 0, a23 = 0;
+		double a33 = 0;
+
+		void addPlane(const Vec3& n, double d, double w) {
+			a00 += w * n.x * n.x; a01 += w * n.x * n.y; a02 += w * n.x * n.z; a03 += w * n.x * d;
+			a11 += w * n.y * n.y; a12 += w * n.y * n.z; a13 += w * n.y * d;
+			a22 += w * n.z * n.z; a23 += w * n.z * d;
+			a33 += w * d * d;
+		}
+
+		Quadric& operator+=(const Quadric& q) {
+			a00 += q.a00; a01 += q.a01; a02 += q.a02; a03 += q.a03;
+			a11 += q.a11; a12 += q.a12; a13 += q.a13;
+			a22 += q.a22; a23 += q.a23;
+			a33 += q.a33;
+			return *this;
+		}
+
+		double evaluate(const Vec3& p) const {
+			return a00 * p.x * p.x + 2.0 * a01 * p.x * p.y + 2.0 * a02 * p.x * p.z + 2.0 * a03 * p.x
+				+ a11 * p.y * p.y + 2.0 * a12 * p.y * p.z + 2.0 * a13 * p.y
+				+ a22 * p.z * p.z + 2.0 * a23 * p.z
+				+ a33;
+		}
+	};
+
+	// Border planes are weighted well above surface planes so silhouettes
+	// and face boundaries are the last features to go
+	constexpr double kBorderWeight = 100.0;
+
+	enum class VertexClass : uint8_t {
+		Interior,   // collapses onto any neighbour
+		Border,     // slides along its border edges only
+		Locked      // corners and non-manifold vertices never move
+	};
+
+	struct Collapse {
+		double cost;
+		int from;
+		int to;
+		uint32_t version;
+
+		bool operator>(const Collapse& o) const { return cost > o.cost; }
+	};
+
+	uint64_t edgeKey(int a, int b) {
+		if (a > b) std::swap(a, b);
+		return (static_cast<uint64_t>(static_cast<uint32_t>(a)) << 32) | static_cast<uint32_t>(b);
+	}
+
+	class Decimation {
+	public:
+		Decimation(const TriangleMesh& mesh, const std::vector<int>* faceIds, const MeshDecimator::Options& options)
+			: m_faceIds(faceIds)
+			, m_options(options) {
+			const size_t vertexCount = mesh.vertices.size();
+			m_positions.reserve(vertexCount);
+			for (const auto& p : mesh.vertices) {
+				m_positions.push_back({ p.X(), p.Y(), p.Z() });
+			}
+			m_quadrics.resize(vertexCount);
+			m_class.assign(vertexCount, VertexClass::Interior);
+			m_version.assign(vertexCount, 0);
+			m_vertexAlive.assign(vertexCount, 1);
+			m_adjacency.resize(vertexCount);
+
+			m_triangles = mesh.triangles;
+			const size_t triangleCount = m_triangles.size() / 3;
+			m_triangleAlive.assign(triangleCount, 1);
+			for (size_t t = 0; t < triangleCount; ++t) {
+				const int* tri = &m_triangles[t * 3];
+				if (tri[0] == tri[1] || tri[1] == tri[2] || tri[0] == tri[2]) {
+					m_triangleAlive[t] = 0;
+					continue;
+				}
+				for (int k = 0; k < 3; ++k) {
+					m_adjacency[tri[k]].push_back(static_cast<int>(t));
+				}
+				++m_aliveTriangles;
+			}
+
+			classifyAndBuildQuadrics();
+		}
+
+		size_t getAliveTriangles() const { return m_aliveTriangles; }
+
+		void seedQueue() {
+			for (size_t v = 0; v < m_positions.size(); ++v) {
+				pushCandidate(static_cast<int>(v));
+			}
+		}
+
+		// Collapse until at most target triangles remain; false when no legal collapse is left
+		bool decimateTo(size_t target) {
+			size_t steps = 0;
+			while (m_aliveTriangles > target) {
+				if (m_queue.empty()) {
+					return false;
+				}
+				if (m_options.cancel && (++steps & 1023) == 0 && m_options.cancel->load()) {
+					return false;
+				}
+
+				Collapse c = m_queue.top();
+				m_queue.pop();
+				if (!m_vertexAlive[c.from] || !m_vertexAlive[c.to] || c.version != m_version[c.from]) {
+					continue;
+				}
+				if (!isLegalCollapse(c.from, c.to)) {
+					++m_version[c.from];
+					pushCandidate(c.from);
+					continue;
+				}
+				collapse(c.from, c.to);
+			}
+			return true;
+		}
+
+		void appendLevel(MeshLODChain& chain, float ratio) const {
+			MeshLODChain::Level level{ ratio, chain.indices.size(), 0 };
+			const size_t triangleCount = m_triangleAlive.size();
+			for (size_t t = 0; t < triangleCount; ++t) {
+				if (!m_triangleAlive[t]) continue;
+				chain.indices.insert(chain.indices.end(), m_triangles.begin() + t * 3, m_triangles.begin() + t * 3 + 3);
+				if (m_faceIds) {
+					chain.faceIds.push_back((*m_faceIds)[t]);
+				}
+				chain.sourceTriangles.push_back(static_cast<int>(t));
+			}
+			level.indexCount = chain.indices.size() - level.firstIndex;
+			chain.levels.push_back(level);
+		}
+
+	private:
+		bool containsVertex(int t, int v) const {
+			const int* tri = &m_triangles[t * 3];
+			return tri[0] == v || tri[1] == v || tri[2] == v;
+		}
+
+		bool isIncident(int t, int v) const {
+			return m_triangleAlive[t] && containsVertex(t, v);
+		}
+
+		// Open edges and edges between different faces both count as border
+		bool isBorderEdge(int u, int v) const {
+			int shared = 0;
+			int firstFace = -1;
+			bool seam = false;
+			for (int t : m_adjacency[u]) {
+				if (!isIncident(t, u) || !containsVertex(t, v)) continue;
+				if (m_faceIds) {
+					int faceId = (*m_faceIds)[t];
+					if (shared > 0 && faceId != firstFace) seam = true;
+					firstFace = faceId;
+				}
+				++shared;
+			}
+			return shared == 1 || seam;
+		}
+
+		Vec3 triangleNormal(int t, int replaced, int replacement) const {
+			const int* tri = &m_triangles[t * 3];
+			Vec3 p[3];
+			for (int k = 0; k < 3; ++k) {
+				p[k] = m_positions[tri[k] == replaced ? replacement : tri[k]];
+			}
+			return (p[1] - p[0]).cross(p[2] - p[0]);
+		}
+
+		void collectNeighbours(int v, std::vector<int>& out) const {
+			out.clear();
+			for (int t : m_adjacency[v]) {
+				if (!isIncident(t, v)) continue;
+				const int* tri = &m_triangles[t * 3];
+				for (int k = 0; k < 3; ++k) {
+					if (tri[k] != v && std::find(out.begin(), out.end(), tri[k]) == out.end()) {
+						out.push_back(tri[k]);
+					}
+				}
+			}
+		}
+
+		bool isLegalCollapse(int u, int v) const {
+			// Link condition: u and v may only share the apexes of the triangles
+			// on edge uv, otherwise the collapse pinches the surface
+			int sharedTriangles = 0;
+			int survivors = 0;
+			for (int t : m_adjacency[u]) {
+				if (!isIncident(t, u)) continue;
+				if (containsVertex(t, v)) ++sharedTriangles;
+				else ++survivors;
+			}
+			if (sharedTriangles == 0 || survivors == 0) {
+				return false;
+			}
+
+			collectNeighbours(u, m_scratchA);
+			collectNeighbours(v, m_scratchB);
+			int common = 0;
+			for (int w : m_scratchA) {
+				if (std::find(m_scratchB.begin(), m_scratchB.end(), w) != m_scratchB.end()) {
+					++common;
+				}
+			}
+			if (common > sharedTriangles) {
+				return false;
+			}
+
+			// Reject fold-overs and slivers in the surviving fan
+			for (int t : m_adjacency[u]) {
+				if (!isIncident(t, u) || containsVertex(t, v)) continue;
+				Vec3 before = triangleNormal(t, -1, -1);
+				Vec3 after = triangleNormal(t, u, v);
+				double lenBefore = before.length();
+				double lenAfter = after.length();
+				if (lenAfter <= lenBefore * 1e-6) {
+					return false;
+				}
+				if (before.dot(after) < m_options.maxNormalDeviation * lenBefore * lenAfter) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		void pushCandidate(int u) {
+			if (!m_vertexAlive[u] || m_class[u] == VertexClass::Locked) return;
+
+			collectNeighbours(u, m_scratchC);
+			m_candidates.clear();
+			for (int v : m_scratchC) {
+				if (m_class[u] == VertexClass::Border && !isBorderEdge(u, v)) continue;
+				Quadric q = m_quadrics[u];
+				q += m_quadrics[v];
+				m_candidates.push_back({ std::max(0.0, q.evaluate(m_positions[v])), u, v, m_version[u] });
+			}
+			std::sort(m_candidates.begin(), m_candidates.end(),
+				[](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+			for (const auto& c : m_candidates) {
+				if (isLegalCollapse(u, c.to)) {
+					m_queue.push(c);
+					return;
+				}
+			}
+		}
+
+		void collapse(int u, int v) {
+			for (int t : m_adjacency[u]) {
+				if (!isIncident(t, u)) continue;
+				if (containsVertex(t, v)) {
+					m_triangleAlive[t] = 0;
+					--m_aliveTriangles;
+					continue;
+				}
+				int* tri = &m_triangles[t * 3];
+				for (int k = 0; k < 3; ++k) {
+					if (tri[k] == u) tri[k] = v;
+				}
+				m_adjacency[v].push_back(t);
+			}
+			m_adjacency[u].clear();
+			m_adjacency[u].shrink_to_fit();
+			m_vertexAlive[u] = 0;
+			m_quadrics[v] += m_quadrics[u];
+
+			// Drop stale entries so adjacency of hub vertices stays short
+			auto& adjV = m_adjacency[v];
+			adjV.erase(std::remove_if(adjV.begin(), adjV.end(),
+				[this, v](int t) { return !isIncident(t, v); }), adjV.end());
+
+			// Everything whose fan or target quadric changed gets a fresh candidate
+			std::vector<int> affected;
+			collectNeighbours(v, affected);
+			affected.push_back(v);
+			for (int w : affected) {
+				++m_version[w];
+				pushCandidate(w);
+			}
+		}
+
+		void classifyAndBuildQuadrics() {
+			struct EdgeRecord {
+				int count = 0;
+				int triangle = -1;
+				bool seam = false;
+			};
+			std::unordered_map<uint64_t, EdgeRecord> edges;
+			edges.reserve(m_aliveTriangles * 2);
+
+			const size_t triangleCount = m_triangleAlive.size();
+			for (size_t t = 0; t < triangleCount; ++t) {
+				if (!m_triangleAlive[t]) continue;
+				const int* tri = &m_triangles[t * 3];
+				for (int k = 0; k < 3; ++k) {
+					EdgeRecord& edge = edges[edgeKey(tri[k], tri[(k + 1) % 3])];
+					if (edge.count == 0) {
+						edge.triangle = static_cast<int>(t);
+					}
+					else if (m_faceIds && (*m_faceIds)[t] != (*m_faceIds)[edge.triangle]) {
+						edge.seam = true;
+					}
+					++edge.count;
+				}
+
+				// Area-weighted plane of the triangle
+				Vec3 n = m_positions[tri[1]] - m_positions[tri[0]];
+				n = n.cross(m_positions[tri[2]] - m_positions[tri[0]]);
+				double doubleArea = n.length();
+				if (doubleArea <= 0.0) continue;
+				n = { n.x / doubleArea, n.y / doubleArea, n.z / doubleArea };
+				double d = -n.dot(m_positions[tri[0]]);
+				for (int k = 0; k < 3; ++k) {
+					m_quadrics[tri[k]].addPlane(n, d, doubleArea * 0.5);
+				}
+			}
+
+			std::vector<uint8_t> borderEdges(m_positions.size(), 0);
+			for (const auto& entry : edges) {
+				const EdgeRecord& edge = entry.second;
+				int a = static_cast<int>(entry.first >> 32);
+				int b = static_cast<int>(entry.first & 0xffffffffu);
+
+				if (edge.count > 2) {
+					m_class[a] = VertexClass::Locked;
+					m_class[b] = VertexClass::Locked;
+					continue;
+				}
+				if (edge.count != 1 && !edge.seam) continue;
+
+				borderEdges[a] = static_cast<uint8_t>(std::min(borderEdges[a] + 1, 255));
+				borderEdges[b] = static_cast<uint8_t>(std::min(borderEdges[b] + 1, 255));
+
+				// Constraint plane through the edge, perpendicular to its triangle
+				const int* tri = &m_triangles[edge.triangle * 3];
+				Vec3 faceNormal = (m_positions[tri[1]] - m_positions[tri[0]]).cross(m_positions[tri[2]] - m_positions[tri[0]]);
+				Vec3 dir = m_positions[b] - m_positions[a];
+				Vec3 n = dir.cross(faceNormal);
+				double len = n.length();
+				if (len <= 0.0) continue;
+				n = { n.x / len, n.y / len, n.z / len };
+				double d = -n.dot(m_positions[a]);
+				double w = kBorderWeight * dir.dot(dir);
+				m_quadrics[a].addPlane(n, d, w);
+				m_quadrics[b].addPlane(n, d, w);
+			}
+
+			for (size_t v = 0; v < m_positions.size(); ++v) {
+				if (m_class[v] == VertexClass::Locked || borderEdges[v] == 0) continue;
+				// Two border edges: a vertex inside a border run; anything else is a corner
+				m_class[v] = borderEdges[v] == 2 ? VertexClass::Border : VertexClass::Locked;
+			}
+		}
+
+	private:
+		const std::vector<int>* m_faceIds;
+		const MeshDecimator::Options& m_options;
+
+		std::vector<Vec3> m_positions;
+		std::vector<Quadric> m_quadrics;
+		std::vector<VertexClass> m_class;
+		std::vector<uint32_t> m_version;
+		std::vector<uint8_t> m_vertexAlive;
+		std::vector<std::vector<int>> m_adjacency;
+
+		std::vector<int> m_triangles;
+		std::vector<uint8_t> m_triangleAlive;
+		size_t m_aliveTriangles = 0;
+
+		std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> m_queue;
+		std::vector<Collapse> m_candidates;
+		mutable std::vector<int> m_scratchA;
+		mutable std::vector<int> m_scratchB;
+		std::vector<int> m_scratchC;
+	};
+}
+
+MeshLODChain MeshDecimator::buildLODChain(const TriangleMesh& mesh, const Options& options,
+	const std::vector<int>* faceIds) {
+	MeshLODChain chain;
+	if (mesh.isEmpty()) {
+		return chain;
+	}
+	if (faceIds && faceIds->size() != mesh.triangles.size() / 3) {
+		LOG_WRN_S("MeshDecimator: Face id count does not match triangle count, ignoring face ids");
+		faceIds = nullptr;
+	}
+
+	// Level 0 is the input as-is
+	chain.indices = mesh.triangles;
+	chain.indices.resize(mesh.triangles.size() / 3 * 3);
+	if (faceIds) {
+		chain.faceIds = *faceIds;
+	}
+	chain.sourceTriangles.resize(chain.indices.size() / 3);
+	std::iota(chain.sourceTriangles.begin(), chain.sourceTriangles.end(), 0);
+	chain.levels.push_back({ 1.0f, 0, chain.indices.size() });
+
+	const size_t originalTriangles = chain.indices.size() / 3;
+	if (originalTriangles < options.minTriangles) {
+		return chain;
+	}
+
+	std::vector<float> ratios = options.ratios;
+	std::sort(ratios.begin(), ratios.end(), std::greater<float>());
+
+	// Levels are built progressively: each one continues from the previous
+	Decimation decimation(mesh, faceIds, options);
+	decimation.seedQueue();
+
+	size_t previousTriangles = originalTriangles;
+	for (float ratio : ratios) {
+		if (ratio <= 0.0f || ratio >= 1.0f) continue;
+		size_t target = static_cast<size_t>(std::ceil(originalTriangles * static_cast<double>(ratio)));
+		if (target < options.minLevelTriangles) break;
+
+		bool reached = decimation.decimateTo(target);
+		size_t alive = decimation.getAliveTriangles();
+		// A level that saves less than a tenth of the previous one is not worth a switch
+		if (alive < previousTriangles - previousTriangles / 10) {
+			decimation.appendLevel(chain, static_cast<float>(static_cast<double>(alive) / originalTriangles));
+			previousTriangles = alive;
+		}
+		if (!reached) break;
+	}
+
+	return chain;
+}
+
+std::vector<MeshLODChain> MeshDecimator::buildLODChains(const std::vector<const TriangleMesh*>& meshes,
+	const Options& options, const std::vector<const std::vector<int>*>& faceIds) {
+	std::vector<MeshLODChain> chains(meshes.size());
+	tbb::parallel_for(tbb::blocked_range<size_t>(0, meshes.size(), 1),
+		[&](const tbb::blocked_range<size_t>& range) {
+			for (size_t i = range.begin(); i != range.end(); ++i) {
+				if (options.cancel && options.cancel->load()) return;
+				if (meshes[i]) {
+					chains[i] = buildLODChain(*meshes[i], options, i < faceIds.size() ? faceIds[i] : nullptr);
+				}
+			}
+		});
+	return chains;
+}
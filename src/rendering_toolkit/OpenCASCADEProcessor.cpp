@@ -41,75 +41,7 @@ TriangleMesh OpenCASCADEProcessor::convertToMesh(const TopoDS_Shape& shape,
 	}
 
 	try {
-		// Get config reference for reading parameters
-		auto& configRef = RenderingToolkitAPI::getConfig();
-
-		// Read all tessellation parameters from config
-		int tessellationQuality = 2;
-		bool adaptiveMeshing = false;
-		int tessellationMethod = 0;
-		double featurePreservation = 0.5;
-		bool parallelProcessingConfig = true;
-
-		try {
-			tessellationQuality = std::stoi(configRef.getParameter("tessellation_quality", "2"));
-			adaptiveMeshing = (configRef.getParameter("adaptive_meshing", "false") == "true");
-			tessellationMethod = std::stoi(configRef.getParameter("tessellation_method", "0"));
-			featurePreservation = std::stod(configRef.getParameter("feature_preservation", "0.5"));
-			parallelProcessingConfig = (configRef.getParameter("parallel_processing", "true") == "true");
-		} catch (...) {
-			// Use defaults if parsing fails
-			tessellationQuality = 2;
-			adaptiveMeshing = false;
-			tessellationMethod = 0;
-			featurePreservation = 0.5;
-			parallelProcessingConfig = true;
-		}
-
-		// Use config setting if available, otherwise use parameter setting
-		bool useParallel = parallelProcessingConfig && params.inParallel;
-
-
-		// Adjust basic parameters based on advanced settings
-		double adjustedDeflection = params.deflection;
-		double adjustedAngularDeflection = params.angularDeflection;
-		
-		// Only adjust parameters if user has explicitly set high quality settings
-		// Default tessellationQuality=2 should not trigger aggressive parameter adjustment
-		if (tessellationQuality >= 3) {
-			// Only apply aggressive quality adjustments for very high quality settings
-			// Quality 3: 0.25x deflection (very detailed)
-			// Quality 4+: 0.1x deflection (extremely detailed)
-			double qualityFactor = 1.0 / (1.0 + (tessellationQuality - 2));
-			adjustedDeflection *= qualityFactor;
-			adjustedAngularDeflection *= qualityFactor;
-		}
-		
-		// Only apply adaptive meshing adjustment if explicitly enabled AND quality is high
-		if (adaptiveMeshing && tessellationQuality >= 3) {
-			// Adaptive meshing uses even smaller deflection for better quality
-			adjustedDeflection *= 0.7; // Less aggressive than 0.5
-			adjustedAngularDeflection *= 0.7;
-		}
-		
-
-		// Create incremental mesh with adjusted parameters
-		// Use IMeshTools_Parameters for better control over meshing
-		IMeshTools_Parameters meshParams;
-		meshParams.Deflection = adjustedDeflection;
-		meshParams.Angle = adjustedAngularDeflection;
-		meshParams.Relative = params.relative;
-		meshParams.InParallel = useParallel;
-		meshParams.MinSize = Precision::Confusion();
-		meshParams.InternalVerticesMode = Standard_True;  // Critical: ensure internal vertices are created for seam edges
-		meshParams.ControlSurfaceDeflection = Standard_True;  // Better surface approximation
-		
-		BRepMesh_IncrementalMesh meshGen;
-		meshGen.SetShape(shape);
-		meshGen.ChangeParameters() = meshParams;
-		meshGen.Perform();
-
-		if (!meshGen.IsDone()) {
+		if (!triangulate(shape, params)) {
 			return mesh;
 		}
 
@@ -125,39 +57,127 @@ TriangleMesh OpenCASCADEProcessor::convertToMesh(const TopoDS_Shape& shape,
 			calculateNormals(mesh);
 		}
 
-		// Only apply smoothing/subdivision if mesh is not empty
-		if (!mesh.vertices.empty() && !mesh.triangles.empty()) {
-			// Apply smoothing if enabled - read from RenderingToolkitAPI config
-			auto& config = configRef; // Reuse the config reference from earlier
-			auto& smoothingSettings = config.getSmoothingSettings();
-			auto& subdivisionSettings = config.getSubdivisionSettings();
+		postProcessMesh(mesh);
+	}
+	catch (const std::exception& e) {
+		mesh.clear();
+	}
 
-			// Read custom parameters
-			double smoothingStrength = 0.5;
-			try {
-				smoothingStrength = std::stod(config.getParameter("smoothing_strength", "0.5"));
-			} catch (...) {
-				smoothingStrength = 0.5;
-			}
+	return mesh;
+}
 
-			if (smoothingSettings.enabled) {
-				// Use smoothing strength to modify iterations based on strength
-				int adjustedIterations = smoothingSettings.iterations;
-				if (smoothingStrength > 0.7) {
-					adjustedIterations = std::max(adjustedIterations + 1, 1);
-				} else if (smoothingStrength < 0.3) {
-					adjustedIterations = std::max(adjustedIterations - 1, 1);
-				}
+TessellationSettings TessellationSettings::fromConfig() {
+	auto& configRef = RenderingToolkitAPI::getConfig();
 
-				mesh = smoothNormals(mesh, smoothingSettings.creaseAngle, adjustedIterations);
-			}
+	TessellationSettings settings;
+	try {
+		settings.quality = std::stoi(configRef.getParameter("tessellation_quality", "2"));
+		settings.adaptiveMeshing = (configRef.getParameter("adaptive_meshing", "false") == "true");
+		settings.parallelProcessing = (configRef.getParameter("parallel_processing", "true") == "true");
+	} catch (...) {
+		// Use defaults if parsing fails
+		settings = TessellationSettings();
+	}
+	return settings;
+}
 
-			// Apply subdivision if enabled - read from RenderingToolkitAPI config
-			if (subdivisionSettings.enabled) {
-				mesh = createSubdivisionSurface(mesh, subdivisionSettings.levels);
-			}
+bool OpenCASCADEProcessor::triangulate(const TopoDS_Shape& shape, const MeshParameters& params) {
+	return triangulate(shape, params, TessellationSettings::fromConfig());
+}
+
+bool OpenCASCADEProcessor::triangulate(const TopoDS_Shape& shape, const MeshParameters& params,
+	const TessellationSettings& settings) {
+	if (shape.IsNull()) {
+		return false;
+	}
+
+	const int tessellationQuality = settings.quality;
+	const bool adaptiveMeshing = settings.adaptiveMeshing;
+	const bool parallelProcessingConfig = settings.parallelProcessing;
+
+	// Use config setting if available, otherwise use parameter setting
+	bool useParallel = parallelProcessingConfig && params.inParallel;
+
+	// Adjust basic parameters based on advanced settings
+	double adjustedDeflection = params.deflection;
+	double adjustedAngularDeflection = params.angularDeflection;
+
+	// Only adjust parameters if user has explicitly set high quality settings
+	// Default tessellationQuality=2 should not trigger aggressive parameter adjustment
+	if (tessellationQuality >= 3) {
+		// Only apply aggressive quality adjustments for very high quality settings
+		// Quality 3: 0.25x deflection (very detailed)
+		// Quality 4+: 0.1x deflection (extremely detailed)
+		double qualityFactor = 1.0 / (1.0 + (tessellationQuality - 2));
+		adjustedDeflection *= qualityFactor;
+		adjustedAngularDeflection *= qualityFactor;
+	}
+
+	// Only apply adaptive meshing adjustment if explicitly enabled AND quality is high
+	if (adaptiveMeshing && tessellationQuality >= 3) {
+		// Adaptive meshing uses even smaller deflection for better quality
+		adjustedDeflection *= 0.7; // Less aggressive than 0.5
+		adjustedAngularDeflection *= 0.7;
+	}
+
+	// Create incremental mesh with adjusted parameters
+	// Use IMeshTools_Parameters for better control over meshing
+	IMeshTools_Parameters meshParams;
+	meshParams.Deflection = adjustedDeflection;
+	meshParams.Angle = adjustedAngularDeflection;
+	meshParams.Relative = params.relative;
+	meshParams.InParallel = useParallel;
+	meshParams.MinSize = Precision::Confusion();
+	meshParams.InternalVerticesMode = Standard_True;  // Critical: ensure internal vertices are created for seam edges
+	meshParams.ControlSurfaceDeflection = Standard_True;  // Better surface approximation
+
+	// Triangulation loaded with the shape (BREP files, sidecars) is used as is when fine enough
+	if (!params.relative && hasStoredTriangulation(shape, adjustedDeflection)) {
+		LOG_DBG_S("Reusing stored triangulation, skipping BRepMesh");
+		return true;
+	}
+
+	BRepMesh_IncrementalMesh meshGen;
+	meshGen.SetShape(shape);
+	meshGen.ChangeParameters() = meshParams;
+	meshGen.Perform();
+
+	return meshGen.IsDone();
+}
+
+bool OpenCASCADEProcessor::hasStoredTriangulation(const TopoDS_Shape& shape, double deflection) {
+	bool anyFace = false;
+	for (TopExp_Explorer explorer(shape, TopAbs_FACE); explorer.More(); explorer.Next()) {
+		TopLoc_Location location;
+		Handle(Poly_Triangulation) triangulation =
+			BRep_Tool::Triangulation(TopoDS::Face(explorer.Current()), location);
+		if (triangulation.IsNull() || triangulation->NbTriangles() == 0 ||
+			triangulation->Deflection() > deflection) {
+			return false;
 		}
+		anyFace = true;
+	}
+	return anyFace;
+}
 
+TriangleMesh OpenCASCADEProcessor::convertFaceToMesh(const TopoDS_Face& face) {
+	TriangleMesh mesh;
+	if (face.IsNull()) {
+		return mesh;
+	}
+
+	try {
+		TopLoc_Location location;
+		Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+		if (triangulation.IsNull()) {
+			return mesh;
+		}
+		extractTriangulation(triangulation, location, mesh, face.Orientation());
+
+		// Faces never share vertices in the converted mesh, so normals and smoothing
+		// computed per face give exactly what convertToMesh produces for the whole shape
+		calculateNormals(mesh);
+		postProcessMesh(mesh);
 	}
 	catch (const std::exception& e) {
 		mesh.clear();
@@ -166,6 +186,43 @@ TriangleMesh OpenCASCADEProcessor::convertToMesh(const TopoDS_Shape& shape,
 	return mesh;
 }
 
+void OpenCASCADEProcessor::postProcessMesh(TriangleMesh& mesh) {
+	// Only apply smoothing/subdivision if mesh is not empty
+	if (mesh.vertices.empty() || mesh.triangles.empty()) {
+		return;
+	}
+
+	// Apply smoothing if enabled - read from RenderingToolkitAPI config
+	auto& config = RenderingToolkitAPI::getConfig();
+	auto& smoothingSettings = config.getSmoothingSettings();
+	auto& subdivisionSettings = config.getSubdivisionSettings();
+
+	// Read custom parameters
+	double smoothingStrength = 0.5;
+	try {
+		smoothingStrength = std::stod(config.getParameter("smoothing_strength", "0.5"));
+	} catch (...) {
+		smoothingStrength = 0.5;
+	}
+
+	if (smoothingSettings.enabled) {
+		// Use smoothing strength to modify iterations based on strength
+		int adjustedIterations = smoothingSettings.iterations;
+		if (smoothingStrength > 0.7) {
+			adjustedIterations = std::max(adjustedIterations + 1, 1);
+		} else if (smoothingStrength < 0.3) {
+			adjustedIterations = std::max(adjustedIterations - 1, 1);
+		}
+
+		mesh = smoothNormals(mesh, smoothingSettings.creaseAngle, adjustedIterations);
+	}
+
+	// Apply subdivision if enabled - read from RenderingToolkitAPI config
+	if (subdivisionSettings.enabled) {
+		mesh = createSubdivisionSurface(mesh, subdivisionSettings.levels);
+	}
+}
+
 // Convert to mesh with face index mapping
 TriangleMesh OpenCASCADEProcessor::convertToMeshWithFaceMapping(const TopoDS_Shape& shape,
 	const MeshParameters& params, std::vector<std::pair<int, std::vector<int>>>& faceMappings) {
@@ -237,13 +294,18 @@ TriangleMesh OpenCASCADEProcessor::convertToMeshWithFaceMapping(const TopoDS_Sha
 		meshParams.InternalVerticesMode = Standard_True;  // Critical: ensure internal vertices are created for seam edges
 		meshParams.ControlSurfaceDeflection = Standard_True;  // Better surface approximation
 		
-		BRepMesh_IncrementalMesh meshGen;
-		meshGen.SetShape(shape);
-		meshGen.ChangeParameters() = meshParams;
-		meshGen.Perform();
-
-		if (!meshGen.IsDone()) {
-			return mesh;
+		if (params.relative || !hasStoredTriangulation(shape, adjustedDeflection)) {
+			BRepMesh_IncrementalMesh meshGen;
+			meshGen.SetShape(shape);
+			meshGen.ChangeParameters() = meshParams;
+			meshGen.Perform();
+
+			if (!meshGen.IsDone()) {
+				return mesh;
+			}
+		}
+		else {
+			LOG_DBG_S("Reusing stored triangulation, skipping BRepMesh");
 		}
 
 		// Extract triangles from all faces with face index tracking
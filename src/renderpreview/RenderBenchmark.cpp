@@ -0,0 +1,273 @@
+#include "renderpreview/RenderBenchmark.h"
+#include "logger/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/SoOffscreenRenderer.h>
+#include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoGetBoundingBoxAction.h>
+#include <Inventor/nodes/SoCallback.h>
+#include <Inventor/nodes/SoComplexity.h>
+#include <Inventor/nodes/SoDirectionalLight.h>
+#include <Inventor/nodes/SoDrawStyle.h>
+#include <Inventor/nodes/SoGroup.h>
+#include <Inventor/nodes/SoLightModel.h>
+#include <Inventor/nodes/SoPerspectiveCamera.h>
+#include <Inventor/nodes/SoSeparator.h>
+#include <Inventor/nodes/SoShapeHints.h>
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	constexpr float kPi = 3.14159265358979f;
+
+	// Brackets the model with callback nodes; with several passes the span runs
+	// from the first pass entering the model to the last pass leaving it
+	struct TraversalTimer {
+		Clock::time_point start;
+		Clock::time_point end;
+		bool started = false;
+
+		void reset() { started = false; }
+		double elapsedMs() const {
+			return started ? std::chrono::duration<double, std::milli>(end - start).count() : 0.0;
+		}
+	};
+
+	void onTraversalBegin(void* userData, SoAction* action) {
+		if (!action->isOfType(SoGLRenderAction::getClassTypeId())) {
+			return;
+		}
+		auto* timer = static_cast<TraversalTimer*>(userData);
+		if (!timer->started) {
+			timer->start = Clock::now();
+			timer->started = true;
+		}
+	}
+
+	void onTraversalEnd(void* userData, SoAction* action) {
+		if (action->isOfType(SoGLRenderAction::getClassTypeId())) {
+			static_cast<TraversalTimer*>(userData)->end = Clock::now();
+		}
+	}
+
+	SoGLRenderAction::TransparencyType transparencyTypeFor(int type) {
+		switch (type) {
+		case 0: return SoGLRenderAction::SCREEN_DOOR;
+		case 2: return SoGLRenderAction::SORTED_OBJECT_BLEND;
+		case 3: return SoGLRenderAction::DELAYED_BLEND;
+		default: return SoGLRenderAction::BLEND;
+		}
+	}
+
+	// The offscreen context has no multisample buffer, so sample-based methods
+	// are measured as the equivalent number of accumulation passes
+	int renderPassesFor(const AntiAliasingSettings& settings) {
+		if (!settings.enabled) {
+			return 1;
+		}
+		switch (settings.method) {
+		case 1: return std::max(1, settings.msaaSamples);
+		case 3: return std::max(1, settings.ssaaFactor * settings.ssaaFactor);
+		default: return 1;
+		}
+	}
+
+	std::string formatMs(double ms) {
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%.3f", ms);
+		return buffer;
+	}
+
+	std::string percentilesJson(const RenderBenchmark::Percentiles& p) {
+		return "{\"p50\":" + formatMs(p.p50) + ",\"p90\":" + formatMs(p.p90) +
+			",\"p99\":" + formatMs(p.p99) + ",\"max\":" + formatMs(p.max) + "}";
+	}
+}
+
+std::string RenderBenchmark::Result::toJson() const
+{
+	std::string escaped;
+	for (char c : name) {
+		if (c == '"' || c == '\\') {
+			escaped += '\\';
+		}
+		escaped += c;
+	}
+	return "{\"name\":\"" + escaped + "\",\"success\":" + (success ? "true" : "false") +
+		",\"frames\":" + std::to_string(frames) +
+		",\"traversalMs\":" + percentilesJson(traversalMs) +
+		",\"frameMs\":" + percentilesJson(frameMs) +
+		",\"fps\":" + formatMs(getFPS()) + "}";
+}
+
+RenderBenchmark::Percentiles RenderBenchmark::computePercentiles(std::vector<double> samples)
+{
+	Percentiles result;
+	if (samples.empty()) {
+		return result;
+	}
+	std::sort(samples.begin(), samples.end());
+	// Nearest-rank percentiles; exact sample values, no interpolation
+	auto rank = [&samples](double percentile) {
+		size_t index = static_cast<size_t>(std::ceil(percentile / 100.0 * samples.size()));
+		return samples[std::min(samples.size(), std::max<size_t>(index, 1)) - 1];
+	};
+	result.p50 = rank(50.0);
+	result.p90 = rank(90.0);
+	result.p99 = rank(99.0);
+	result.max = samples.back();
+	return result;
+}
+
+SoGroup* RenderBenchmark::createStateNodes(const RenderingSettings& settings)
+{
+	SoGroup* state = new SoGroup;
+
+	SoComplexity* complexity = new SoComplexity;
+	static const float qualityComplexity[] = { 0.2f, 0.5f, 0.8f, 1.0f };
+	complexity->value = qualityComplexity[std::clamp(settings.quality, 0, 3)];
+	state->addChild(complexity);
+
+	SoShapeHints* hints = new SoShapeHints;
+	hints->vertexOrdering = SoShapeHints::COUNTERCLOCKWISE;
+	hints->shapeType = (settings.backfaceCulling || settings.cullMode == 1) ? SoShapeHints::SOLID : SoShapeHints::UNKNOWN_SHAPE_TYPE;
+	hints->creaseAngle = settings.smoothShading ? 0.5f : 0.0f;
+	state->addChild(hints);
+
+	SoDrawStyle* drawStyle = new SoDrawStyle;
+	if (settings.mode == 1 || settings.polygonMode == 1) {
+		drawStyle->style = SoDrawStyle::LINES;
+	}
+	else if (settings.mode == 2 || settings.polygonMode == 2) {
+		drawStyle->style = SoDrawStyle::POINTS;
+	}
+	drawStyle->lineWidth = settings.lineWidth;
+	drawStyle->pointSize = settings.pointSize;
+	state->addChild(drawStyle);
+
+	SoLightModel* lightModel = new SoLightModel;
+	lightModel->model = settings.mode == 6 ? SoLightModel::BASE_COLOR : SoLightModel::PHONG;
+	state->addChild(lightModel);
+
+	return state;
+}
+
+RenderBenchmark::Result RenderBenchmark::runCase(SoNode* scene, const Case& benchmarkCase, const Options& options)
+{
+	Result result;
+	result.name = benchmarkCase.name.empty() ? benchmarkCase.rendering.name : benchmarkCase.name;
+	if (!scene || options.frames <= 0) {
+		return result;
+	}
+
+	const SbViewportRegion viewport(static_cast<short>(options.width), static_cast<short>(options.height));
+
+	SoGetBoundingBoxAction bboxAction(viewport);
+	bboxAction.apply(scene);
+	const SbBox3f bounds = bboxAction.getBoundingBox();
+	if (bounds.isEmpty()) {
+		LOG_WRN_S("RenderBenchmark: Scene is empty, skipping '" + result.name + "'");
+		return result;
+	}
+	const SbVec3f center = bounds.getCenter();
+
+	TraversalTimer timer;
+	SoSeparator* root = new SoSeparator;
+	root->ref();
+	SoPerspectiveCamera* camera = new SoPerspectiveCamera;
+	SoDirectionalLight* headlight = new SoDirectionalLight;
+	SoCallback* begin = new SoCallback;
+	SoCallback* end = new SoCallback;
+	begin->setCallback(onTraversalBegin, &timer);
+	end->setCallback(onTraversalEnd, &timer);
+	root->addChild(camera);
+	root->addChild(headlight);
+	root->addChild(createStateNodes(benchmarkCase.rendering));
+	root->addChild(begin);
+	root->addChild(scene);
+	root->addChild(end);
+
+	// Fit once from the isometric direction; the orbit keeps that distance
+	SbVec3f startDirection(1.0f, 1.0f, -1.0f);
+	startDirection.normalize();
+	camera->orientation.setValue(SbRotation(SbVec3f(0, 0, -1), startDirection));
+	camera->viewAll(scene, viewport);
+	const float distance = (camera->position.getValue() - center).length();
+
+	SoOffscreenRenderer renderer(viewport);
+	renderer.setComponents(SoOffscreenRenderer::RGB);
+	const wxColour& background = benchmarkCase.rendering.backgroundColor;
+	renderer.setBackgroundColor(SbColor(background.Red() / 255.0f, background.Green() / 255.0f, background.Blue() / 255.0f));
+
+	SoGLRenderAction* action = renderer.getGLRenderAction();
+	action->setTransparencyType(transparencyTypeFor(benchmarkCase.rendering.transparencyType));
+	const int passes = renderPassesFor(benchmarkCase.antiAliasing);
+	action->setNumPasses(passes);
+	action->setSmoothing(benchmarkCase.antiAliasing.enabled && benchmarkCase.antiAliasing.method != 0);
+
+	std::vector<double> traversalSamples;
+	std::vector<double> frameSamples;
+	traversalSamples.reserve(options.frames);
+	frameSamples.reserve(options.frames);
+
+	const float orbitRadians = options.orbitDegrees * kPi / 180.0f;
+	bool success = true;
+	for (int frame = -options.warmupFrames; frame < options.frames; ++frame) {
+		const float t = frame < 0 ? 0.0f : static_cast<float>(frame) / static_cast<float>(options.frames);
+		SbVec3f direction;
+		SbRotation(SbVec3f(0, 0, 1), orbitRadians * t).multVec(startDirection, direction);
+		camera->position.setValue(center - direction * distance);
+		camera->pointAt(center, SbVec3f(0, 0, 1));
+		headlight->direction.setValue(direction);
+
+		timer.reset();
+		auto frameStart = Clock::now();
+		if (!renderer.render(root)) {
+			success = false;
+			break;
+		}
+		const double frameMs = std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+		if (frame >= 0) {
+			frameSamples.push_back(frameMs);
+			traversalSamples.push_back(timer.elapsedMs());
+		}
+	}
+	root->unref();
+
+	if (!success) {
+		LOG_ERR_S("RenderBenchmark: Offscreen rendering failed for '" + result.name + "'");
+		return result;
+	}
+
+	result.success = true;
+	result.frames = static_cast<int>(frameSamples.size());
+	result.traversalMs = computePercentiles(std::move(traversalSamples));
+	result.frameMs = computePercentiles(std::move(frameSamples));
+	LOG_INF_S("RenderBenchmark: '" + result.name + "' frame p50 " + formatMs(result.frameMs.p50) +
+		" ms, p99 " + formatMs(result.frameMs.p99) + " ms, traversal p50 " + formatMs(result.traversalMs.p50) +
+		" ms (" + std::to_string(passes) + " pass" + (passes == 1 ? "" : "es") + ")");
+	return result;
+}
+
+std::vector<RenderBenchmark::Result> RenderBenchmark::run(SoNode* scene, const std::vector<Case>& cases,
+	const Options& options, ProgressCallback progress)
+{
+	std::vector<Result> results;
+	results.reserve(cases.size());
+	if (scene) {
+		scene->ref();
+	}
+	for (size_t i = 0; i < cases.size(); ++i) {
+		results.push_back(runCase(scene, cases[i], options));
+		if (progress && !progress(i + 1, cases.size(), results.back())) {
+			break;
+		}
+	}
+	if (scene) {
+		scene->unrefNoDelete();
+	}
+	return results;
+}
@@ -14,6 +14,7 @@
 #include <Inventor/nodes/SoPolygonOffset.h>
 #include <Inventor/nodes/SoBlinker.h>
 #include <algorithm>
+#include <cmath>
 
 RenderingManager::RenderingManager(SoSeparator* sceneRoot, wxGLCanvas* canvas, wxGLContext* glContext)
 	: m_sceneRoot(sceneRoot), m_canvas(canvas), m_glContext(glContext), m_nextConfigId(1), m_activeConfigId(-1)
@@ -353,6 +354,17 @@ std::vector<std::string> RenderingManager::getAvailablePresets() const
 	return presets;
 }
 
+bool RenderingManager::hasPreset(const std::string& presetName) const
+{
+	return m_presets.find(presetName) != m_presets.end();
+}
+
+RenderingSettings RenderingManager::getPreset(const std::string& presetName) const
+{
+	auto it = m_presets.find(presetName);
+	return it != m_presets.end() ? it->second : RenderingSettings();
+}
+
 void RenderingManager::applyToRenderAction(SoGLRenderAction* renderAction)
 {
 	if (!renderAction) return;
@@ -432,6 +444,13 @@ float RenderingManager::getPerformanceImpact() const
 		if (it != m_configurations.end()) {
 			const auto& settings = it->second->settings;
 
+			// Measured frame time relative to the measured Balanced preset
+			const RenderBenchmark::Result* measured = getMeasuredPerformance(settings.name);
+			const RenderBenchmark::Result* baseline = getMeasuredPerformance("Balanced");
+			if (measured && baseline && baseline->frameMs.p50 > 0.0) {
+				return static_cast<float>(measured->frameMs.p50 / baseline->frameMs.p50);
+			}
+
 			float impact = 1.0f;
 
 			// Quality impact
@@ -516,6 +535,13 @@ std::string RenderingManager::getQualityDescription() const
 
 int RenderingManager::getEstimatedFPS() const
 {
+	if (hasActiveConfiguration()) {
+		const RenderBenchmark::Result* measured = getMeasuredPerformance(getActiveConfiguration().name);
+		if (measured) {
+			return static_cast<int>(std::lround(measured->getFPS()));
+		}
+	}
+
 	float impact = getPerformanceImpact();
 	int baseFPS = 60;
 
@@ -529,6 +555,26 @@ int RenderingManager::getEstimatedFPS() const
 	return estimatedFPS;
 }
 
+void RenderingManager::setMeasuredPerformance(const RenderBenchmark::Result& result)
+{
+	if (!result.success) {
+		m_measured.erase(result.name);
+		return;
+	}
+	m_measured[result.name] = result;
+}
+
+const RenderBenchmark::Result* RenderingManager::getMeasuredPerformance(const std::string& name) const
+{
+	auto it = m_measured.find(name);
+	return it != m_measured.end() ? &it->second : nullptr;
+}
+
+void RenderingManager::clearMeasuredPerformance()
+{
+	m_measured.clear();
+}
+
 void RenderingManager::initializePresets()
 {
 	// Performance Preset
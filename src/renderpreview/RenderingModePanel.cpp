@@ -2,6 +2,11 @@
 #include "renderpreview/RenderPreviewDialog.h"
 #include "renderpreview/RenderingManager.h"
 #include "renderpreview/PreviewCanvas.h"
+#include "renderpreview/RenderBenchmark.h"
+#include "renderpreview/AntiAliasingManager.h"
+#include "config/RenderingConfig.h"
+#include "OCCViewer.h"
+#include "OCCGeometry.h"
 #include "config/FontManager.h"
 #include "config/ConfigManager.h"
 #include "logger/Logger.h"
@@ -9,6 +14,10 @@
 #include <wx/stdpaths.h>
 #include <wx/config.h>
 #include <wx/fileconf.h>
+#include <wx/progdlg.h>
+#include <wx/utils.h>
+#include <Inventor/nodes/SoSeparator.h>
+#include <cstdio>
 
 BEGIN_EVENT_TABLE(RenderingModePanel, wxPanel)
 EVT_CHOICE(wxID_ANY, RenderingModePanel::onRenderingModeChanged)
@@ -16,6 +25,8 @@ END_EVENT_TABLE()
 
 RenderingModePanel::RenderingModePanel(wxWindow* parent, RenderPreviewDialog* dialog)
 	: wxPanel(parent, wxID_ANY), m_parentDialog(dialog), m_renderingManager(nullptr)
+	, m_renderingModeChoice(nullptr), m_legacyChoice(nullptr), m_impactLabel(nullptr), m_fpsLabel(nullptr)
+	, m_benchmarkButton(nullptr), m_benchmarkResults(nullptr)
 {
 	createUI();
 	bindEvents();
@@ -60,18 +71,25 @@ void RenderingModePanel::createUI()
 	renderingSizer->Add(presetsBoxSizer, 0, wxEXPAND | wxALL, 4);
 
 	auto* performanceBoxSizer = new wxStaticBoxSizer(wxVERTICAL, this, "Performance Impact");
-	auto* impactLabel = new wxStaticText(this, wxID_ANY, "Performance Impact: Medium");
-	impactLabel->SetForegroundColour(wxColour(255, 165, 0));
-	performanceBoxSizer->Add(impactLabel, 0, wxALL, 4);
+	m_impactLabel = new wxStaticText(this, wxID_ANY, "Performance Impact: Medium");
+	m_impactLabel->SetForegroundColour(wxColour(255, 165, 0));
+	performanceBoxSizer->Add(m_impactLabel, 0, wxALL, 4);
 	auto* qualityLabel = new wxStaticText(this, wxID_ANY, "Quality: Balanced");
 	qualityLabel->SetForegroundColour(wxColour(0, 0, 128));
 	performanceBoxSizer->Add(qualityLabel, 0, wxALL, 4);
-	auto* fpsLabel = new wxStaticText(this, wxID_ANY, "Estimated FPS: 60");
-	fpsLabel->SetForegroundColour(wxColour(0, 128, 0));
-	performanceBoxSizer->Add(fpsLabel, 0, wxALL, 4);
+	m_fpsLabel = new wxStaticText(this, wxID_ANY, "Estimated FPS: 60");
+	m_fpsLabel->SetForegroundColour(wxColour(0, 128, 0));
+	performanceBoxSizer->Add(m_fpsLabel, 0, wxALL, 4);
 	auto* featuresLabel = new wxStaticText(this, wxID_ANY, "Features: Smooth Shading, Phong Shading");
 	featuresLabel->SetForegroundColour(wxColour(128, 128, 128));
 	performanceBoxSizer->Add(featuresLabel, 0, wxALL, 4);
+	m_benchmarkButton = new wxButton(this, wxID_ANY, "Benchmark Presets");
+	m_benchmarkButton->SetToolTip("Render the loaded model offscreen with every preset and measure frame times");
+	performanceBoxSizer->Add(m_benchmarkButton, 0, wxALL, 4);
+	m_benchmarkResults = new wxTextCtrl(this, wxID_ANY, wxEmptyString, wxDefaultPosition, wxSize(-1, 140),
+		wxTE_MULTILINE | wxTE_READONLY | wxTE_DONTWRAP);
+	m_benchmarkResults->SetFont(wxFont(8, wxFONTFAMILY_TELETYPE, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL));
+	performanceBoxSizer->Add(m_benchmarkResults, 0, wxEXPAND | wxALL, 4);
 	renderingSizer->Add(performanceBoxSizer, 0, wxEXPAND | wxALL, 4);
 
 	auto* legacyBoxSizer = new wxStaticBoxSizer(wxVERTICAL, this, "Legacy Mode Settings");
@@ -98,6 +116,7 @@ void RenderingModePanel::bindEvents()
 	if (m_legacyChoice) {
 		m_legacyChoice->Bind(wxEVT_CHOICE, &RenderingModePanel::onLegacyModeChanged, this);
 	}
+	m_benchmarkButton->Bind(wxEVT_BUTTON, &RenderingModePanel::onBenchmark, this);
 }
 
 int RenderingModePanel::getRenderingMode() const
@@ -115,6 +134,7 @@ void RenderingModePanel::setRenderingMode(int mode)
 void RenderingModePanel::setRenderingManager(RenderingManager* manager)
 {
 	m_renderingManager = manager;
+	updatePerformanceLabels();
 }
 
 void RenderingModePanel::notifyParameterChanged()
@@ -131,6 +151,7 @@ void RenderingModePanel::onRenderingModeChanged(wxCommandEvent& event)
 		wxString presetName = m_renderingModeChoice->GetString(selection);
 		m_renderingManager->applyPreset(presetName.ToStdString());
 		updateLegacyChoiceFromCurrentMode();
+		updatePerformanceLabels();
 
 		notifyParameterChanged();
 
@@ -190,6 +211,109 @@ void RenderingModePanel::updateLegacyChoiceFromCurrentMode()
 	}
 }
 
+void RenderingModePanel::updatePerformanceLabels()
+{
+	if (!m_renderingManager || !m_fpsLabel || !m_impactLabel) {
+		return;
+	}
+
+	const RenderBenchmark::Result* measured = m_renderingManager->hasActiveConfiguration() ?
+		m_renderingManager->getMeasuredPerformance(m_renderingManager->getActiveConfiguration().name) : nullptr;
+	const float impact = m_renderingManager->getPerformanceImpact();
+	const char* level = impact < 0.9f ? "Low" : (impact < 1.4f ? "Medium" : "High");
+
+	if (measured) {
+		char text[128];
+		std::snprintf(text, sizeof(text), "Measured FPS: %d (frame p50 %.1f ms, p99 %.1f ms)",
+			m_renderingManager->getEstimatedFPS(), measured->frameMs.p50, measured->frameMs.p99);
+		m_fpsLabel->SetLabel(text);
+		std::snprintf(text, sizeof(text), "Performance Impact: %s (%.2fx Balanced)", level, impact);
+		m_impactLabel->SetLabel(text);
+	}
+	else {
+		m_fpsLabel->SetLabel("Estimated FPS: " + std::to_string(m_renderingManager->getEstimatedFPS()));
+		m_impactLabel->SetLabel(std::string("Performance Impact: ") + level);
+	}
+	Layout();
+}
+
+void RenderingModePanel::onBenchmark(wxCommandEvent& event)
+{
+	if (!m_renderingManager) {
+		return;
+	}
+
+	// Benchmark the main model; the preview primitives are only a fallback
+	SoSeparator* scene = new SoSeparator;
+	scene->ref();
+	size_t geometryCount = 0;
+	if (auto* occViewer = RenderingConfig::getOCCViewerInstance()) {
+		for (const auto& geometry : occViewer->getAllGeometry()) {
+			if (geometry && geometry->isVisible() && geometry->getCoinNode()) {
+				scene->addChild(geometry->getCoinNode());
+				++geometryCount;
+			}
+		}
+	}
+	std::string sceneName = std::to_string(geometryCount) + " model geometries";
+	if (geometryCount == 0) {
+		PreviewCanvas* canvas = m_parentDialog ? m_parentDialog->getRenderCanvas() : nullptr;
+		if (canvas && canvas->getObjectRoot()) {
+			scene->addChild(canvas->getObjectRoot());
+			sceneName = "preview objects";
+		}
+	}
+
+	std::vector<RenderBenchmark::Case> cases;
+	AntiAliasingSettings antiAliasing;
+	antiAliasing.enabled = false;
+	PreviewCanvas* canvas = m_parentDialog ? m_parentDialog->getRenderCanvas() : nullptr;
+	if (canvas && canvas->getAntiAliasingManager() && canvas->getAntiAliasingManager()->getActiveConfigurationId() != -1) {
+		antiAliasing = canvas->getAntiAliasingManager()->getActiveConfiguration();
+	}
+	for (const auto& presetName : m_renderingManager->getAvailablePresets()) {
+		RenderBenchmark::Case benchmarkCase;
+		benchmarkCase.name = presetName;
+		benchmarkCase.rendering = m_renderingManager->getPreset(presetName);
+		benchmarkCase.antiAliasing = antiAliasing;
+		cases.push_back(benchmarkCase);
+	}
+	if (cases.empty() || scene->getNumChildren() == 0) {
+		scene->unref();
+		m_benchmarkResults->SetValue("Nothing to benchmark: load a model first.");
+		return;
+	}
+
+	LOG_INF_S("RenderingModePanel::onBenchmark: Benchmarking " + std::to_string(cases.size()) + " presets on " + sceneName);
+	m_benchmarkButton->Enable(false);
+	wxProgressDialog progressDialog("Benchmark Presets", "Rendering presets...", static_cast<int>(cases.size()), this,
+		wxPD_APP_MODAL | wxPD_AUTO_HIDE | wxPD_CAN_ABORT | wxPD_ELAPSED_TIME);
+	auto results = RenderBenchmark::run(scene, cases, RenderBenchmark::Options(),
+		[&progressDialog](size_t finished, size_t total, const RenderBenchmark::Result& result) {
+			return progressDialog.Update(static_cast<int>(finished), "Measured " + result.name);
+		});
+	scene->unref();
+	m_benchmarkButton->Enable(true);
+
+	m_renderingManager->clearMeasuredPerformance();
+	std::string report = "Scene: " + sceneName + "\n";
+	char line[160];
+	std::snprintf(line, sizeof(line), "%-24s %9s %9s %9s %7s\n", "Preset", "p50 ms", "p99 ms", "cpu p50", "FPS");
+	report += line;
+	for (const auto& result : results) {
+		m_renderingManager->setMeasuredPerformance(result);
+		if (!result.success) {
+			report += result.name + ": failed\n";
+			continue;
+		}
+		std::snprintf(line, sizeof(line), "%-24s %9.2f %9.2f %9.2f %7.1f\n", result.name.c_str(),
+			result.frameMs.p50, result.frameMs.p99, result.traversalMs.p50, result.getFPS());
+		report += line;
+	}
+	m_benchmarkResults->SetValue(report);
+	updatePerformanceLabels();
+}
+
 void RenderingModePanel::loadSettings()
 {
 	try {
@@ -1,13 +1,36 @@
 #include "renderpreview/UndoManager.h"
+#include "logger/Logger.h"
 #include <algorithm>
 
-UndoManager::UndoManager(size_t maxHistorySize)
+namespace {
+	bool sameLight(const RenderLightSettings& a, const RenderLightSettings& b)
+	{
+		return a.enabled == b.enabled && a.name == b.name && a.type == b.type &&
+			a.positionX == b.positionX && a.positionY == b.positionY && a.positionZ == b.positionZ &&
+			a.directionX == b.directionX && a.directionY == b.directionY && a.directionZ == b.directionZ &&
+			a.color == b.color && a.intensity == b.intensity &&
+			a.spotAngle == b.spotAngle && a.spotExponent == b.spotExponent &&
+			a.animated == b.animated && a.animationSpeed == b.animationSpeed &&
+			a.animationRadius == b.animationRadius && a.animationHeight == b.animationHeight &&
+			a.constantAttenuation == b.constantAttenuation && a.linearAttenuation == b.linearAttenuation &&
+			a.quadraticAttenuation == b.quadraticAttenuation &&
+			a.castShadows == b.castShadows && a.shadowIntensity == b.shadowIntensity &&
+			a.priority == b.priority;
+	}
+
+	size_t lightCost(const RenderLightSettings& light)
+	{
+		return sizeof(RenderLightSettings) + light.name.capacity() + light.type.capacity();
+	}
+}
+
+UndoManager::UndoManager(size_t maxHistorySize, size_t maxHistoryBytes)
 	: m_currentIndex(0)
 	, m_maxHistorySize(maxHistorySize)
+	, m_maxHistoryBytes(maxHistoryBytes)
+	, m_historyBytes(0)
 {
-	// Initialize with default state
-	ConfigSnapshot defaultState;
-	m_history.push_back(defaultState);
+	// Start from the default state
 }
 
 UndoManager::~UndoManager()
@@ -16,18 +39,25 @@ UndoManager::~UndoManager()
 
 void UndoManager::saveState(const ConfigSnapshot& snapshot, const std::string& description)
 {
-	// Remove any redo history when saving new state
-	if (m_currentIndex < m_history.size() - 1) {
-		m_history.erase(m_history.begin() + m_currentIndex + 1, m_history.end());
+	Delta delta = diff(m_current, snapshot);
+	delta.descriptionBefore = m_current.description;
+	delta.description = description;
+	if (delta.isEmpty()) {
+		// Nothing changed, so there is nothing to undo
+		return;
 	}
 
-	// Create a copy of the snapshot with description
-	ConfigSnapshot newSnapshot = snapshot;
-	newSnapshot.description = description;
+	// Remove any redo history when saving new state
+	while (m_history.size() > m_currentIndex) {
+		m_historyBytes -= m_history.back().cost;
+		m_history.pop_back();
+	}
 
-	// Add to history
-	m_history.push_back(newSnapshot);
-	m_currentIndex = m_history.size() - 1;
+	delta.cost = delta.measure();
+	m_historyBytes += delta.cost;
+	apply(m_current, delta, true);
+	m_history.push_back(std::move(delta));
+	m_currentIndex = m_history.size();
 
 	// Trim history if needed
 	trimHistory();
@@ -40,7 +70,7 @@ bool UndoManager::canUndo() const
 
 bool UndoManager::canRedo() const
 {
-	return m_currentIndex < m_history.size() - 1;
+	return m_currentIndex < m_history.size();
 }
 
 ConfigSnapshot UndoManager::undo()
@@ -50,7 +80,8 @@ ConfigSnapshot UndoManager::undo()
 	}
 
 	m_currentIndex--;
-	return m_history[m_currentIndex];
+	apply(m_current, m_history[m_currentIndex], false);
+	return m_current;
 }
 
 ConfigSnapshot UndoManager::redo()
@@ -59,27 +90,24 @@ ConfigSnapshot UndoManager::redo()
 		return getCurrentState();
 	}
 
+	apply(m_current, m_history[m_currentIndex], true);
 	m_currentIndex++;
-	return m_history[m_currentIndex];
+	return m_current;
 }
 
 ConfigSnapshot UndoManager::getCurrentState() const
 {
-	if (m_history.empty()) {
-		return ConfigSnapshot();
-	}
-
-	return m_history[m_currentIndex];
+	return m_current;
 }
 
 void UndoManager::clear()
 {
 	m_history.clear();
 	m_currentIndex = 0;
+	m_historyBytes = 0;
 
-	// Add default state
-	ConfigSnapshot defaultState;
-	m_history.push_back(defaultState);
+	// Back to the default state
+	m_current = ConfigSnapshot();
 }
 
 size_t UndoManager::getUndoCount() const
@@ -89,13 +117,13 @@ size_t UndoManager::getUndoCount() const
 
 size_t UndoManager::getRedoCount() const
 {
-	return m_history.size() - m_currentIndex - 1;
+	return m_history.size() - m_currentIndex;
 }
 
 std::string UndoManager::getUndoDescription() const
 {
 	if (canUndo()) {
-		return m_history[m_currentIndex - 1].description;
+		return m_history[m_currentIndex - 1].descriptionBefore;
 	}
 	return "";
 }
@@ -103,19 +131,149 @@ std::string UndoManager::getUndoDescription() const
 std::string UndoManager::getRedoDescription() const
 {
 	if (canRedo()) {
-		return m_history[m_currentIndex + 1].description;
+		return m_history[m_currentIndex].description;
 	}
 	return "";
 }
 
+void UndoManager::setMaxHistoryBytes(size_t maxHistoryBytes)
+{
+	m_maxHistoryBytes = maxHistoryBytes;
+	trimHistory();
+}
+
+size_t UndoManager::getUndoCost() const
+{
+	return canUndo() ? m_history[m_currentIndex - 1].cost : 0;
+}
+
+size_t UndoManager::getRedoCost() const
+{
+	return canRedo() ? m_history[m_currentIndex].cost : 0;
+}
+
 void UndoManager::trimHistory()
 {
-	if (m_history.size() <= m_maxHistorySize) {
-		return;
+	// Remove oldest entries while keeping current index valid; the latest change stays undoable
+	size_t removeCount = 0;
+	size_t removedBytes = 0;
+	while (m_currentIndex > 1 &&
+		(m_history.size() > m_maxHistorySize || m_historyBytes > m_maxHistoryBytes)) {
+		removedBytes += m_history.front().cost;
+		m_historyBytes -= m_history.front().cost;
+		m_history.pop_front();
+		m_currentIndex--;
+		removeCount++;
+	}
+
+	if (removeCount > 0) {
+		LOG_DBG_S("UndoManager: dropped " + std::to_string(removeCount) + " oldest entries (" +
+			std::to_string(removedBytes) + " bytes), history now " + std::to_string(m_historyBytes) + " bytes");
+	}
+}
+
+double UndoManager::readField(const ConfigSnapshot& state, Field field)
+{
+	switch (field) {
+	case Field::AntiAliasingMethod: return state.antiAliasingMethod;
+	case Field::MsaaSamples: return state.msaaSamples;
+	case Field::FxaaEnabled: return state.fxaaEnabled ? 1.0 : 0.0;
+	case Field::RenderingMode: return state.renderingMode;
+	case Field::MaterialAmbient: return state.materialAmbient;
+	case Field::MaterialDiffuse: return state.materialDiffuse;
+	case Field::MaterialSpecular: return state.materialSpecular;
+	case Field::MaterialShininess: return state.materialShininess;
+	case Field::MaterialTransparency: return state.materialTransparency;
+	case Field::TextureEnabled: return state.textureEnabled ? 1.0 : 0.0;
+	case Field::TextureMode: return state.textureMode;
+	case Field::TextureScale: return state.textureScale;
+	}
+	return 0.0;
+}
+
+void UndoManager::writeField(ConfigSnapshot& state, Field field, double value)
+{
+	switch (field) {
+	case Field::AntiAliasingMethod: state.antiAliasingMethod = static_cast<int>(value); break;
+	case Field::MsaaSamples: state.msaaSamples = static_cast<int>(value); break;
+	case Field::FxaaEnabled: state.fxaaEnabled = value != 0.0; break;
+	case Field::RenderingMode: state.renderingMode = static_cast<int>(value); break;
+	case Field::MaterialAmbient: state.materialAmbient = static_cast<float>(value); break;
+	case Field::MaterialDiffuse: state.materialDiffuse = static_cast<float>(value); break;
+	case Field::MaterialSpecular: state.materialSpecular = static_cast<float>(value); break;
+	case Field::MaterialShininess: state.materialShininess = static_cast<float>(value); break;
+	case Field::MaterialTransparency: state.materialTransparency = static_cast<float>(value); break;
+	case Field::TextureEnabled: state.textureEnabled = value != 0.0; break;
+	case Field::TextureMode: state.textureMode = static_cast<int>(value); break;
+	case Field::TextureScale: state.textureScale = static_cast<float>(value); break;
+	}
+}
+
+UndoManager::Delta UndoManager::diff(const ConfigSnapshot& from, const ConfigSnapshot& to)
+{
+	static const Field kFields[] = {
+		Field::AntiAliasingMethod, Field::MsaaSamples, Field::FxaaEnabled, Field::RenderingMode,
+		Field::MaterialAmbient, Field::MaterialDiffuse, Field::MaterialSpecular, Field::MaterialShininess,
+		Field::MaterialTransparency, Field::TextureEnabled, Field::TextureMode, Field::TextureScale
+	};
+
+	Delta delta;
+	for (Field field : kFields) {
+		double before = readField(from, field);
+		double after = readField(to, field);
+		if (before != after) {
+			delta.fields.push_back({ field, before, after });
+		}
 	}
 
-	// Remove oldest entries while keeping current index valid
-	size_t removeCount = m_history.size() - m_maxHistorySize;
-	m_history.erase(m_history.begin(), m_history.begin() + removeCount);
-	m_currentIndex = std::max<size_t>(0, m_currentIndex - removeCount);
-}
\ No newline at end of file
+	delta.lightCountBefore = from.lights.size();
+	delta.lightCountAfter = to.lights.size();
+	size_t lightCount = std::max(from.lights.size(), to.lights.size());
+	for (size_t i = 0; i < lightCount; ++i) {
+		bool inFrom = i < from.lights.size();
+		bool inTo = i < to.lights.size();
+		if (inFrom && inTo && sameLight(from.lights[i], to.lights[i])) {
+			continue;
+		}
+		if (inFrom) {
+			delta.lightsBefore.push_back({ i, from.lights[i] });
+		}
+		if (inTo) {
+			delta.lightsAfter.push_back({ i, to.lights[i] });
+		}
+	}
+	return delta;
+}
+
+void UndoManager::apply(ConfigSnapshot& state, const Delta& delta, bool forward)
+{
+	for (const auto& change : delta.fields) {
+		writeField(state, change.field, forward ? change.after : change.before);
+	}
+
+	state.lights.resize(forward ? delta.lightCountAfter : delta.lightCountBefore);
+	for (const auto& change : forward ? delta.lightsAfter : delta.lightsBefore) {
+		state.lights[change.index] = change.light;
+	}
+
+	state.description = forward ? delta.description : delta.descriptionBefore;
+}
+
+bool UndoManager::Delta::isEmpty() const
+{
+	return fields.empty() && lightsBefore.empty() && lightsAfter.empty() &&
+		lightCountBefore == lightCountAfter;
+}
+
+size_t UndoManager::Delta::measure() const
+{
+	size_t bytes = sizeof(Delta) + fields.capacity() * sizeof(FieldChange) +
+		descriptionBefore.capacity() + description.capacity();
+	for (const auto& change : lightsBefore) {
+		bytes += sizeof(size_t) + lightCost(change.light);
+	}
+	for (const auto& change : lightsAfter) {
+		bytes += sizeof(size_t) + lightCost(change.light);
+	}
+	return bytes;
+}
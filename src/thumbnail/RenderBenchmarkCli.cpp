@@ -0,0 +1,223 @@
+// Rendering preset benchmark
+//
+//   CADRenderBenchmark [options] <model file>
+//     --size WxH          viewport size (default: 1280x720)
+//     --frames N          recorded frames per preset (default: 60)
+//     --presets A,B,...   presets to measure (default: all RenderingManager presets)
+//     --json FILE         write results, one preset per line
+//     --baseline FILE     compare against a previous --json output
+//     --tolerance F       allowed p50 frame-time growth over baseline (default: 0.25)
+//     --hardware-gl       do not force Mesa's software rasterizer
+//
+// The exit status is non-zero when a preset fails to render or is slower than
+// its baseline by more than the tolerance, so CI can run this on a reference
+// model under software GL and catch preset regressions.
+
+#include "thumbnail/ThumbnailRenderer.h"
+#include "renderpreview/RenderBenchmark.h"
+#include "renderpreview/RenderingManager.h"
+#include "OCCGeometry.h"
+#include "config/ConfigManager.h"
+#include "rendering/RenderingToolkitAPI.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <Inventor/SoDB.h>
+#include <Inventor/nodes/SoSeparator.h>
+#include <wx/init.h>
+
+namespace {
+	struct CliOptions {
+		RenderBenchmark::Options benchmark;
+		std::vector<std::string> presets;
+		std::string modelPath;
+		std::string jsonPath;
+		std::string baselinePath;
+		double tolerance = 0.25;
+		bool hardwareGl = false;
+	};
+
+	void printUsage() {
+		std::cerr << "Usage: CADRenderBenchmark [--size WxH] [--frames N] [--presets A,B] [--json FILE]\n"
+			"                          [--baseline FILE] [--tolerance F] [--hardware-gl] <model file>\n";
+	}
+
+	bool parseArguments(int argc, char** argv, CliOptions& cli) {
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			auto value = [&]() -> const char* {
+				return i + 1 < argc ? argv[++i] : nullptr;
+			};
+
+			const char* text = nullptr;
+			if (arg == "--size") {
+				if (!(text = value()) || std::sscanf(text, "%dx%d", &cli.benchmark.width, &cli.benchmark.height) != 2) return false;
+			}
+			else if (arg == "--frames") {
+				if (!(text = value())) return false;
+				cli.benchmark.frames = std::atoi(text);
+			}
+			else if (arg == "--presets") {
+				if (!(text = value())) return false;
+				std::stringstream stream(text);
+				std::string name;
+				while (std::getline(stream, name, ',')) {
+					if (!name.empty()) {
+						cli.presets.push_back(name);
+					}
+				}
+			}
+			else if (arg == "--json") {
+				if (!(text = value())) return false;
+				cli.jsonPath = text;
+			}
+			else if (arg == "--baseline") {
+				if (!(text = value())) return false;
+				cli.baselinePath = text;
+			}
+			else if (arg == "--tolerance") {
+				if (!(text = value())) return false;
+				cli.tolerance = std::atof(text);
+			}
+			else if (arg == "--hardware-gl") {
+				cli.hardwareGl = true;
+			}
+			else if (arg[0] == '-') {
+				return false;
+			}
+			else {
+				cli.modelPath = arg;
+			}
+		}
+		return !cli.modelPath.empty() && cli.benchmark.width > 0 && cli.benchmark.height > 0 && cli.benchmark.frames > 0;
+	}
+
+	// Reads back our own --json output: one result object per line
+	std::map<std::string, double> readBaseline(const std::string& path) {
+		std::map<std::string, double> baseline;
+		std::ifstream file(path);
+		const std::regex pattern("\"name\":\"([^\"]*)\".*\"frameMs\":\\{\"p50\":([0-9.]+)");
+		std::string line;
+		std::smatch match;
+		while (std::getline(file, line)) {
+			if (std::regex_search(line, match, pattern)) {
+				baseline[match[1].str()] = std::atof(match[2].str().c_str());
+			}
+		}
+		return baseline;
+	}
+}
+
+int main(int argc, char** argv) {
+	CliOptions cli;
+	if (!parseArguments(argc, argv, cli)) {
+		printUsage();
+		return 2;
+	}
+
+	if (!cli.hardwareGl) {
+		ThumbnailRenderer::selectSoftwareGL();
+	}
+
+	wxInitializer initializer;
+	if (!initializer.IsOk()) {
+		std::cerr << "Failed to initialize wxWidgets\n";
+		return 1;
+	}
+	ConfigManager::getInstance().initialize("");
+	SoDB::init();
+	if (!RenderingToolkitAPI::initialize()) {
+		std::cerr << "Failed to initialize rendering toolkit\n";
+		return 1;
+	}
+
+	ThumbnailRenderer::Options loadOptions;
+	ThumbnailRenderer::LoadedFile model = ThumbnailRenderer::load(cli.modelPath, loadOptions);
+	if (!model.timing.success) {
+		std::cerr << "Failed to load " << cli.modelPath << ": " << model.timing.error << "\n";
+		return 1;
+	}
+
+	SoSeparator* scene = new SoSeparator;
+	scene->ref();
+	for (const auto& geometry : model.geometries) {
+		if (geometry->hasCachedMesh()) {
+			GeometryReader::buildMeshCoinNode(*geometry);
+		}
+		else if (!geometry->getShape().IsNull()) {
+			geometry->buildCoinRepresentation(loadOptions.mesh);
+		}
+		if (geometry->getCoinNode()) {
+			scene->addChild(geometry->getCoinNode());
+		}
+	}
+	std::cout << cli.modelPath << ": " << model.timing.geometries << " geometries, "
+		<< model.timing.triangles << " triangles\n";
+
+	// The presets live in RenderingManager; it needs no canvas to hand them out
+	RenderingManager presets(nullptr, nullptr, nullptr);
+	if (cli.presets.empty()) {
+		cli.presets = presets.getAvailablePresets();
+	}
+	std::vector<RenderBenchmark::Case> cases;
+	for (const auto& name : cli.presets) {
+		if (!presets.hasPreset(name)) {
+			std::cerr << "Unknown preset: " << name << "\n";
+			scene->unref();
+			return 2;
+		}
+		RenderBenchmark::Case benchmarkCase;
+		benchmarkCase.name = name;
+		benchmarkCase.rendering = presets.getPreset(name);
+		cases.push_back(benchmarkCase);
+	}
+
+	auto results = RenderBenchmark::run(scene, cases, cli.benchmark);
+	scene->unref();
+
+	std::map<std::string, double> baseline;
+	if (!cli.baselinePath.empty()) {
+		baseline = readBaseline(cli.baselinePath);
+	}
+
+	int status = 0;
+	std::ofstream json;
+	if (!cli.jsonPath.empty()) {
+		json.open(cli.jsonPath);
+	}
+	std::printf("%-24s %9s %9s %9s %9s %7s\n", "Preset", "p50 ms", "p90 ms", "p99 ms", "cpu p50", "FPS");
+	for (const auto& result : results) {
+		if (json.is_open()) {
+			json << result.toJson() << "\n";
+		}
+		if (!result.success) {
+			std::printf("%-24s FAILED\n", result.name.c_str());
+			status = 1;
+			continue;
+		}
+		std::printf("%-24s %9.2f %9.2f %9.2f %9.2f %7.1f", result.name.c_str(), result.frameMs.p50,
+			result.frameMs.p90, result.frameMs.p99, result.traversalMs.p50, result.getFPS());
+
+		auto reference = baseline.find(result.name);
+		if (reference != baseline.end() && reference->second > 0.0) {
+			const double ratio = result.frameMs.p50 / reference->second;
+			std::printf("  %+.1f%% vs baseline", (ratio - 1.0) * 100.0);
+			if (ratio > 1.0 + cli.tolerance) {
+				std::printf("  REGRESSION");
+				status = 1;
+			}
+		}
+		std::printf("\n");
+	}
+
+	RenderingToolkitAPI::shutdown();
+	return status;
+}
@@ -0,0 +1,411 @@
+// Batch thumbnail renderer
+//
+//   CADThumbnail [options] <file|@list.txt>...
+//     --out DIR          output directory (default: .)
+//     --size WxH         image size (default: 512x512)
+//     --views A,B,...    SceneManager view names (default: Isometric)
+//     --deflection D     linear mesh deflection (default: MeshParameters)
+//     --jobs N           render in N processes (default: 1)
+//     --json FILE        timing report (default: <out>/thumbnails.json)
+//     --hardware-gl      do not force Mesa's software rasterizer
+//     --brep-sidecar     read and write .bbrep sidecars next to STEP files
+//
+// Coin is not thread-safe, so one process renders one file at a time while
+// the next file is parsed and tessellated on a worker thread. --jobs splits
+// the file list across child processes started with the internal --shard
+// option; each writes one JSON line per file which the parent merges.
+
+#include "thumbnail/ThumbnailRenderer.h"
+#include "config/ConfigManager.h"
+#include "rendering/RenderingToolkitAPI.h"
+#include "logger/Logger.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Inventor/SoDB.h>
+#include <wx/init.h>
+#include <wx/string.h>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <spawn.h>
+#include <sys/wait.h>
+extern char** environ;
+#endif
+
+namespace {
+	struct CliOptions {
+		ThumbnailRenderer::Options render;
+		std::vector<std::string> files;
+		std::vector<std::string> passThrough;   // forwarded to shard processes
+		std::string jsonPath;
+		int jobs = 1;
+		int shardIndex = -1;
+		int shardCount = 0;
+		bool hardwareGl = false;
+	};
+
+	void printUsage() {
+		std::cerr << "Usage: CADThumbnail [--out DIR] [--size WxH] [--views A,B] [--deflection D]\n"
+			"                    [--jobs N] [--json FILE] [--hardware-gl] [--brep-sidecar] <file|@list.txt>...\n";
+	}
+
+	std::vector<std::string> splitList(const std::string& text, char separator) {
+		std::vector<std::string> items;
+		std::stringstream stream(text);
+		std::string item;
+		while (std::getline(stream, item, separator)) {
+			if (!item.empty()) {
+				items.push_back(item);
+			}
+		}
+		return items;
+	}
+
+	void addInput(const std::string& argument, std::vector<std::string>& files) {
+		if (argument.size() > 1 && argument[0] == '@') {
+			std::ifstream list(argument.substr(1));
+			std::string line;
+			while (std::getline(list, line)) {
+				if (!line.empty() && line.back() == '\r') {
+					line.pop_back();
+				}
+				if (!line.empty() && line[0] != '#') {
+					files.push_back(line);
+				}
+			}
+			return;
+		}
+		files.push_back(argument);
+	}
+
+	bool parseArguments(int argc, char** argv, CliOptions& cli) {
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			auto value = [&](std::string& out) {
+				if (i + 1 >= argc) {
+					std::cerr << "Missing value for " << arg << "\n";
+					return false;
+				}
+				out = argv[++i];
+				return true;
+			};
+
+			std::string text;
+			if (arg == "--out") {
+				if (!value(cli.render.outputDir)) return false;
+				cli.passThrough.insert(cli.passThrough.end(), { arg, cli.render.outputDir });
+			}
+			else if (arg == "--size") {
+				if (!value(text)) return false;
+				if (std::sscanf(text.c_str(), "%dx%d", &cli.render.width, &cli.render.height) != 2 ||
+					cli.render.width <= 0 || cli.render.height <= 0) {
+					std::cerr << "Invalid size: " << text << "\n";
+					return false;
+				}
+				cli.passThrough.insert(cli.passThrough.end(), { arg, text });
+			}
+			else if (arg == "--views") {
+				if (!value(text)) return false;
+				cli.render.views = splitList(text, ',');
+				cli.passThrough.insert(cli.passThrough.end(), { arg, text });
+			}
+			else if (arg == "--deflection") {
+				if (!value(text)) return false;
+				cli.render.mesh.deflection = std::atof(text.c_str());
+				cli.passThrough.insert(cli.passThrough.end(), { arg, text });
+			}
+			else if (arg == "--jobs") {
+				if (!value(text)) return false;
+				cli.jobs = std::max(1, std::atoi(text.c_str()));
+			}
+			else if (arg == "--json") {
+				if (!value(cli.jsonPath)) return false;
+			}
+			else if (arg == "--shard") {
+				if (!value(text) || std::sscanf(text.c_str(), "%d/%d", &cli.shardIndex, &cli.shardCount) != 2 ||
+					cli.shardCount <= 0 || cli.shardIndex < 0 || cli.shardIndex >= cli.shardCount) {
+					std::cerr << "Invalid shard: " << text << "\n";
+					return false;
+				}
+			}
+			else if (arg == "--hardware-gl") {
+				cli.hardwareGl = true;
+				cli.passThrough.push_back(arg);
+			}
+			else if (arg == "--brep-sidecar") {
+				cli.render.import.enableBRepSidecar = true;
+				cli.passThrough.push_back(arg);
+			}
+			else if (arg == "--help" || arg == "-h") {
+				return false;
+			}
+			else {
+				addInput(arg, cli.files);
+			}
+		}
+		if (cli.jsonPath.empty()) {
+			cli.jsonPath = (std::filesystem::path(cli.render.outputDir) / "thumbnails.json").string();
+		}
+		return !cli.files.empty();
+	}
+
+#ifdef _WIN32
+	// Quote one argument so that CommandLineToArgvW (the MSVC runtime's parser)
+	// hands it back unchanged: backslashes are only special before a quote
+	std::wstring quoteWindowsArgument(const std::wstring& argument) {
+		if (!argument.empty() && argument.find_first_of(L" \t\n\v\"") == std::wstring::npos) {
+			return argument;
+		}
+		std::wstring quoted = L"\"";
+		for (auto it = argument.begin();; ++it) {
+			size_t backslashes = 0;
+			while (it != argument.end() && *it == L'\\') {
+				++it;
+				++backslashes;
+			}
+			if (it == argument.end()) {
+				quoted.append(backslashes * 2, L'\\');
+				break;
+			}
+			if (*it == L'"') {
+				quoted.append(backslashes * 2 + 1, L'\\');
+			}
+			else {
+				quoted.append(backslashes, L'\\');
+			}
+			quoted.push_back(*it);
+		}
+		quoted.push_back(L'"');
+		return quoted;
+	}
+#endif
+
+	// Start a child process from an argument vector, without a shell, and wait
+	// for it; returns its exit code, or -1 if it could not be started
+	int runProcess(const std::vector<std::string>& arguments) {
+#ifdef _WIN32
+		std::wstring commandLine;
+		for (const auto& argument : arguments) {
+			if (!commandLine.empty()) {
+				commandLine += L' ';
+			}
+			commandLine += quoteWindowsArgument(wxString::FromUTF8(argument).ToStdWstring());
+		}
+
+		STARTUPINFOW startup{};
+		startup.cb = sizeof(startup);
+		PROCESS_INFORMATION process{};
+		if (!CreateProcessW(nullptr, &commandLine[0], nullptr, nullptr, FALSE, 0, nullptr, nullptr,
+			&startup, &process)) {
+			return -1;
+		}
+		WaitForSingleObject(process.hProcess, INFINITE);
+		DWORD exitCode = 1;
+		GetExitCodeProcess(process.hProcess, &exitCode);
+		CloseHandle(process.hThread);
+		CloseHandle(process.hProcess);
+		return static_cast<int>(exitCode);
+#else
+		std::vector<char*> argv;
+		argv.reserve(arguments.size() + 1);
+		for (const auto& argument : arguments) {
+			argv.push_back(const_cast<char*>(argument.c_str()));
+		}
+		argv.push_back(nullptr);
+
+		pid_t pid = 0;
+		if (posix_spawnp(&pid, argv[0], nullptr, nullptr, argv.data(), environ) != 0) {
+			return -1;
+		}
+		int status = 0;
+		while (waitpid(pid, &status, 0) < 0) {
+			if (errno != EINTR) {
+				return -1;
+			}
+		}
+		return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+#endif
+	}
+
+	std::string shardReportPath(const CliOptions& cli, int shard) {
+		return cli.jsonPath + ".shard" + std::to_string(shard);
+	}
+
+	// Run N copies of this executable on interleaved slices of the file list
+	int runShards(const char* executable, const CliOptions& cli) {
+		const int shards = std::min<int>(cli.jobs, static_cast<int>(cli.files.size()));
+
+		std::error_code ec;
+		std::filesystem::create_directories(cli.render.outputDir, ec);
+		const std::filesystem::path reportDir = std::filesystem::path(cli.jsonPath).parent_path();
+		if (!reportDir.empty()) {
+			std::filesystem::create_directories(reportDir, ec);
+		}
+
+		std::string listPath = cli.jsonPath + ".files";
+		{
+			std::ofstream list(listPath);
+			for (const auto& file : cli.files) {
+				list << file << "\n";
+			}
+		}
+
+		std::vector<std::thread> workers;
+		std::vector<int> exitCodes(shards, 0);
+		for (int shard = 0; shard < shards; ++shard) {
+			std::vector<std::string> arguments{ executable };
+			arguments.insert(arguments.end(), cli.passThrough.begin(), cli.passThrough.end());
+			arguments.insert(arguments.end(), {
+				"--shard", std::to_string(shard) + "/" + std::to_string(shards),
+				"--json", shardReportPath(cli, shard),
+				"@" + listPath });
+			workers.emplace_back([arguments, shard, &exitCodes]() {
+				exitCodes[shard] = runProcess(arguments);
+				if (exitCodes[shard] < 0) {
+					std::cerr << "Failed to start shard " << shard << "\n";
+				}
+			});
+		}
+		for (auto& worker : workers) {
+			worker.join();
+		}
+
+		std::ofstream report(cli.jsonPath);
+		report << "[\n";
+		bool first = true;
+		int failures = 0;
+		for (int shard = 0; shard < shards; ++shard) {
+			if (exitCodes[shard] != 0) {
+				++failures;
+			}
+			std::ifstream lines(shardReportPath(cli, shard));
+			std::string line;
+			while (std::getline(lines, line)) {
+				if (line.empty()) {
+					continue;
+				}
+				report << (first ? "  " : ",\n  ") << line;
+				first = false;
+			}
+			lines.close();
+			std::filesystem::remove(shardReportPath(cli, shard), ec);
+		}
+		report << "\n]\n";
+		std::filesystem::remove(listPath, ec);
+
+		std::cout << "Timing report: " << cli.jsonPath << "\n";
+		return failures == 0 ? 0 : 1;
+	}
+
+	int renderFiles(const CliOptions& cli) {
+		std::vector<std::string> files;
+		for (size_t i = 0; i < cli.files.size(); ++i) {
+			if (cli.shardCount == 0 || static_cast<int>(i % cli.shardCount) == cli.shardIndex) {
+				files.push_back(cli.files[i]);
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::create_directories(cli.render.outputDir, ec);
+
+		ThumbnailRenderer renderer(cli.render);
+		std::vector<ThumbnailRenderer::Timing> timings;
+		timings.reserve(files.size());
+
+		// Parse and tessellate file k+1 while file k renders
+		std::future<ThumbnailRenderer::LoadedFile> next;
+		if (!files.empty()) {
+			next = std::async(std::launch::async, &ThumbnailRenderer::load, files[0], cli.render);
+		}
+		for (size_t k = 0; k < files.size(); ++k) {
+			ThumbnailRenderer::LoadedFile loaded = next.get();
+			if (k + 1 < files.size()) {
+				next = std::async(std::launch::async, &ThumbnailRenderer::load, files[k + 1], cli.render);
+			}
+			timings.push_back(renderer.render(loaded));
+
+			const auto& timing = timings.back();
+			std::cout << (timing.success ? "OK   " : "FAIL ") << timing.file;
+			if (!timing.success) {
+				std::cout << ": " << timing.error;
+			}
+			std::cout << "\n";
+		}
+
+		std::ofstream report(cli.jsonPath);
+		if (cli.shardCount > 0) {
+			// One object per line; the parent process merges the shards
+			for (const auto& timing : timings) {
+				report << timing.toJson() << "\n";
+			}
+		}
+		else {
+			report << "[\n";
+			for (size_t i = 0; i < timings.size(); ++i) {
+				report << (i ? ",\n  " : "  ") << timings[i].toJson();
+			}
+			report << "\n]\n";
+			std::cout << "Timing report: " << cli.jsonPath << "\n";
+		}
+
+		for (const auto& timing : timings) {
+			if (!timing.success) {
+				return 1;
+			}
+		}
+		return 0;
+	}
+}
+
+int main(int argc, char** argv) {
+	CliOptions cli;
+	if (!parseArguments(argc, argv, cli)) {
+		printUsage();
+		return 2;
+	}
+
+	if (cli.jobs > 1 && cli.shardCount == 0 && cli.files.size() > 1) {
+		return runShards(argv[0], cli);
+	}
+
+	if (!cli.hardwareGl) {
+		ThumbnailRenderer::selectSoftwareGL();
+	}
+
+	wxInitializer initializer;
+	if (!initializer.IsOk()) {
+		std::cerr << "Failed to initialize wxWidgets\n";
+		return 1;
+	}
+
+	try {
+		ConfigManager::getInstance().initialize("");
+		SoDB::init();
+		if (!RenderingToolkitAPI::initialize()) {
+			std::cerr << "Failed to initialize rendering toolkit\n";
+			return 1;
+		}
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Initialization failed: " << e.what() << "\n";
+		return 1;
+	}
+
+	int status = renderFiles(cli);
+	RenderingToolkitAPI::shutdown();
+	return status;
+}
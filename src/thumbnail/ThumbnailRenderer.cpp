@@ -0,0 +1,281 @@
+#include "thumbnail/ThumbnailRenderer.h"
+#include "SceneManager.h"
+#include "OCCGeometry.h"
+#include "logger/Logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/SoOffscreenRenderer.h>
+#include <Inventor/nodes/SoDirectionalLight.h>
+#include <Inventor/nodes/SoOrthographicCamera.h>
+#include <Inventor/nodes/SoSeparator.h>
+
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+
+#include <wx/image.h>
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	double elapsedMs(Clock::time_point start) {
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	// FNV-1a of the absolute path; fixed across runs, so names stay stable between batches
+	uint32_t pathHash(const std::string& filePath) {
+		std::error_code ec;
+		std::filesystem::path absolute = std::filesystem::absolute(filePath, ec);
+		const std::string key = (ec ? std::filesystem::path(filePath) : absolute).lexically_normal().generic_string();
+		uint64_t hash = 14695981039346656037ull;
+		for (unsigned char c : key) {
+			hash = (hash ^ c) * 1099511628211ull;
+		}
+		return static_cast<uint32_t>(hash ^ (hash >> 32));
+	}
+
+	size_t countTriangles(const TopoDS_Shape& shape) {
+		size_t triangles = 0;
+		for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+			TopLoc_Location location;
+			Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(TopoDS::Face(exp.Current()), location);
+			if (!triangulation.IsNull()) {
+				triangles += static_cast<size_t>(triangulation->NbTriangles());
+			}
+		}
+		return triangles;
+	}
+
+	std::string escapeJson(const std::string& text) {
+		std::string out;
+		out.reserve(text.size() + 2);
+		for (char c : text) {
+			switch (c) {
+			case '"': out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			case '\r': out += "\\r"; break;
+			case '\t': out += "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20) {
+					char buffer[8];
+					std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+					out += buffer;
+				}
+				else {
+					out += c;
+				}
+			}
+		}
+		return out;
+	}
+
+	void setEnvironmentDefault(const char* name, const char* value) {
+		if (std::getenv(name)) {
+			return;
+		}
+#ifdef _WIN32
+		_putenv_s(name, value);
+#else
+		setenv(name, value, 0);
+#endif
+	}
+
+	std::string formatMs(double ms) {
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%.3f", ms);
+		return buffer;
+	}
+}
+
+std::string ThumbnailRenderer::Timing::toJson() const {
+	std::string json = "{\"file\":\"" + escapeJson(file) + "\"";
+	json += ",\"success\":" + std::string(success ? "true" : "false");
+	if (!error.empty()) {
+		json += ",\"error\":\"" + escapeJson(error) + "\"";
+	}
+	json += ",\"parseMs\":" + formatMs(parseMs);
+	json += ",\"meshMs\":" + formatMs(meshMs);
+	json += ",\"renderMs\":" + formatMs(renderMs);
+	json += ",\"encodeMs\":" + formatMs(encodeMs);
+	json += ",\"geometries\":" + std::to_string(geometries);
+	json += ",\"triangles\":" + std::to_string(triangles);
+	json += ",\"images\":[";
+	for (size_t i = 0; i < images.size(); ++i) {
+		json += (i ? ",\"" : "\"") + escapeJson(images[i]) + "\"";
+	}
+	json += "]}";
+	return json;
+}
+
+ThumbnailRenderer::ThumbnailRenderer(const Options& options)
+	: m_options(options) {
+	if (!wxImage::FindHandler(wxBITMAP_TYPE_PNG)) {
+		wxImage::AddHandler(new wxPNGHandler);
+	}
+}
+
+void ThumbnailRenderer::selectSoftwareGL() {
+	setEnvironmentDefault("LIBGL_ALWAYS_SOFTWARE", "1");
+	setEnvironmentDefault("GALLIUM_DRIVER", "llvmpipe");
+}
+
+ThumbnailRenderer::LoadedFile ThumbnailRenderer::load(const std::string& filePath, const Options& options) {
+	LoadedFile loaded;
+	loaded.timing.file = filePath;
+
+	auto parseStart = Clock::now();
+	auto reader = GeometryReaderFactory::getReaderForFile(filePath);
+	if (!reader) {
+		loaded.timing.error = "Unsupported file format";
+		return loaded;
+	}
+
+	// load() runs on the prefetch thread; Coin nodes are built by render()
+	GeometryReader::OptimizationOptions importOptions = options.import;
+	importOptions.buildCoinNodes = false;
+
+	GeometryReader::ReadResult result;
+	try {
+		result = reader->readFile(filePath, importOptions);
+	}
+	catch (const std::exception& e) {
+		result.success = false;
+		result.errorMessage = e.what();
+	}
+	loaded.timing.parseMs = elapsedMs(parseStart);
+	if (!result.success || result.geometries.empty()) {
+		loaded.timing.error = result.errorMessage.empty() ? "No geometry in file" : result.errorMessage;
+		return loaded;
+	}
+
+	// Triangulate here so render() only converts existing triangulations to Coin nodes;
+	// BRepMesh leaves faces alone whose stored triangulation already meets the deflection
+	auto meshStart = Clock::now();
+	const MeshParameters& mesh = options.mesh;
+	for (const auto& geometry : result.geometries) {
+		if (!geometry) {
+			continue;
+		}
+		const TopoDS_Shape& shape = geometry->getShape();
+		if (!shape.IsNull()) {
+			BRepMesh_IncrementalMesh mesher(shape, mesh.deflection, mesh.relative, mesh.angularDeflection, mesh.inParallel);
+			loaded.timing.triangles += countTriangles(shape);
+		}
+		else if (geometry->hasCachedMesh()) {
+			loaded.timing.triangles += static_cast<size_t>(geometry->getCachedMesh().getTriangleCount());
+		}
+		loaded.geometries.push_back(geometry);
+	}
+	loaded.timing.meshMs = elapsedMs(meshStart);
+	loaded.timing.geometries = loaded.geometries.size();
+	loaded.timing.success = true;
+	return loaded;
+}
+
+ThumbnailRenderer::Timing ThumbnailRenderer::render(LoadedFile& file) {
+	Timing timing = file.timing;
+	if (!timing.success) {
+		return timing;
+	}
+
+	auto buildStart = Clock::now();
+	SoSeparator* root = new SoSeparator;
+	root->ref();
+	SoOrthographicCamera* camera = new SoOrthographicCamera;
+	SoDirectionalLight* light = new SoDirectionalLight;
+	SoSeparator* content = new SoSeparator;
+	root->addChild(camera);
+	root->addChild(light);
+	root->addChild(content);
+
+	for (const auto& geometry : file.geometries) {
+		if (geometry->hasCachedMesh()) {
+			GeometryReader::buildMeshCoinNode(*geometry);
+		}
+		else if (!geometry->getShape().IsNull()) {
+			geometry->buildCoinRepresentation(m_options.mesh);
+		}
+		if (SoSeparator* node = geometry->getCoinNode()) {
+			content->addChild(node);
+		}
+	}
+	timing.meshMs += elapsedMs(buildStart);
+
+	const SbViewportRegion viewport(static_cast<short>(m_options.width), static_cast<short>(m_options.height));
+	SoOffscreenRenderer renderer(viewport);
+	renderer.setComponents(SoOffscreenRenderer::RGB);
+	renderer.setBackgroundColor(SbColor(
+		static_cast<float>(m_options.background.Red()),
+		static_cast<float>(m_options.background.Green()),
+		static_cast<float>(m_options.background.Blue())));
+
+	for (const std::string& view : m_options.views) {
+		SbVec3f direction;
+		if (!SceneManager::getViewDirection(view, direction)) {
+			LOG_WRN_S("ThumbnailRenderer: Unknown view '" + view + "', skipped");
+			continue;
+		}
+
+		auto renderStart = Clock::now();
+		camera->orientation.setValue(SbRotation(SbVec3f(0, 0, -1), direction));
+		camera->viewAll(content, viewport);
+		light->direction.setValue(direction);
+		if (!renderer.render(root)) {
+			timing.success = false;
+			timing.error = "Offscreen rendering failed for view " + view;
+			timing.renderMs += elapsedMs(renderStart);
+			break;
+		}
+		timing.renderMs += elapsedMs(renderStart);
+
+		// Coin rows run bottom-up, wxImage rows top-down
+		auto encodeStart = Clock::now();
+		const int width = m_options.width;
+		const int height = m_options.height;
+		const unsigned char* pixels = renderer.getBuffer();
+		wxImage image(width, height, false);
+		unsigned char* data = image.GetData();
+		const size_t rowBytes = static_cast<size_t>(width) * 3;
+		for (int y = 0; y < height; ++y) {
+			std::copy_n(pixels + static_cast<size_t>(height - 1 - y) * rowBytes, rowBytes, data + static_cast<size_t>(y) * rowBytes);
+		}
+
+		const std::string path = imagePath(timing.file, view);
+		if (!image.SaveFile(wxString::FromUTF8(path), wxBITMAP_TYPE_PNG)) {
+			timing.success = false;
+			timing.error = "Failed to write " + path;
+			timing.encodeMs += elapsedMs(encodeStart);
+			break;
+		}
+		timing.encodeMs += elapsedMs(encodeStart);
+		timing.images.push_back(path);
+	}
+
+	root->unref();
+	// The Coin nodes are the bulk of a large model; release them before the next file
+	file.geometries.clear();
+	return timing;
+}
+
+std::string ThumbnailRenderer::imagePath(const std::string& filePath, const std::string& view) const {
+	std::string suffix = view;
+	std::transform(suffix.begin(), suffix.end(), suffix.begin(),
+		[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	// Same-named files from different directories must not overwrite each other's images
+	char hash[16];
+	std::snprintf(hash, sizeof(hash), "%08x", pathHash(filePath));
+	std::filesystem::path stem = std::filesystem::path(filePath).stem();
+	return (std::filesystem::path(m_options.outputDir) / (stem.string() + "_" + hash + "_" + suffix + ".png")).string();
+}
@@ -35,6 +35,7 @@
 #include "SceneManager.h"
 #include "Command.h"
 #include "OCCViewer.h"
+#include "viewer/ShapeBuildService.h"
 #include "CommandDispatcher.h"
 #include "CommandListenerManager.h"
 #include "MeshQualityDialog.h"
@@ -764,6 +765,21 @@ void FlatFrame::createPanels() {
 			}
 			m_featureProgressHoldTicks = 4;
 		}
+		else if (ShapeBuildService* builds = m_occViewer ? m_occViewer->getShapeBuildService() : nullptr;
+			builds && builds->getPendingCount() > 0) {
+			// Background geometry construction; show the oldest running job
+			ShapeBuildService::JobStatus job = builds->getJobs().front();
+			if (auto* bar = GetFlatUIStatusBar()) {
+				bar->EnableProgressGauge(true);
+				bar->SetGaugeRange(100);
+				bar->SetGaugeValue(std::max(0, std::min(100, job.percent)));
+			}
+			if (m_messageOutput) {
+				wxString progressMsg = wxString::Format("Building %s: %s (%d%%)", job.label, job.stage, job.percent);
+				m_messageOutput->SetValue(progressMsg);
+			}
+			m_featureProgressHoldTicks = 4;
+		}
 		else {
 			if (justFinished && m_messageOutput) {
 				appendMessage("Feature edge generation completed.");
@@ -231,6 +231,19 @@ void ImportStatisticsDialog::populateDetailsData()
     detailsText << wxString::Format("Mesh deflection: %.6f", m_statistics.meshDeflection) << "\n";
     detailsText << "\n";
 
+    // Import cache
+    detailsText << "=== IMPORT CACHE ===\n\n";
+    detailsText << wxString::Format("Hits: %llu", static_cast<unsigned long long>(m_statistics.cacheHits)) << "\n";
+    detailsText << wxString::Format("Misses: %llu", static_cast<unsigned long long>(m_statistics.cacheMisses)) << "\n";
+    const uint64_t cacheLookups = m_statistics.cacheHits + m_statistics.cacheMisses;
+    detailsText << "Hit rate: " << (cacheLookups > 0
+        ? formatPercentage(static_cast<int>(m_statistics.cacheHits), static_cast<int>(cacheLookups)) + "%"
+        : wxString("N/A")) << "\n";
+    detailsText << wxString::Format("Evictions: %llu", static_cast<unsigned long long>(m_statistics.cacheEvictions)) << "\n";
+    detailsText << wxString::Format("Entries: %zu", m_statistics.cacheEntries) << "\n";
+    detailsText << "Memory: " << formatFileSize(m_statistics.cacheBytes) << " of " << formatFileSize(m_statistics.cacheBudget) << "\n";
+    detailsText << "\n";
+
     // Topology statistics
     detailsText << "=== TOPOLOGY STATISTICS ===\n\n";
     detailsText << wxString::Format("Total transferable roots: %d", m_statistics.totalTransferableRoots) << "\n";
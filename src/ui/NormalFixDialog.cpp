@@ -15,6 +15,11 @@
 #include <wx/slider.h>
 #include <wx/grid.h>
 #include <wx/msgdlg.h>
+#include <wx/progdlg.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <sstream>
 #include <iomanip>
 
@@ -336,33 +341,13 @@ void NormalFixDialog::updateNormalInfo() {
 }
 
 void NormalFixDialog::analyzeFaceNormals(const TopoDS_Shape& shape, const std::string& shapeName) {
-    // Calculate shape center for normal direction analysis
-    gp_Pnt shapeCenter = NormalValidator::calculateShapeCenter(shape);
-    
-    int totalFaces = 0;
-    int correctFaces = 0;
-    int incorrectFaces = 0;
-    int noNormalFaces = 0;
-    
-    // Analyze each face
-    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
-        TopoDS_Face face = TopoDS::Face(exp.Current());
-        totalFaces++;
-        
-        // Analyze this face
-        bool hasNormal = NormalValidator::analyzeFaceNormal(face, shapeCenter);
-        
-        if (hasNormal) {
-            bool isCorrect = NormalValidator::isNormalOutward(face, shapeCenter);
-            if (isCorrect) {
-                correctFaces++;
-            } else {
-                incorrectFaces++;
-            }
-        } else {
-            noNormalFaces++;
-        }
-    }
+    // Orientation is judged against neighbouring faces across shared edges
+    NormalValidationResult validation = NormalValidator::validateNormals(shape, shapeName);
+    
+    int totalFaces = validation.totalFaces;
+    int correctFaces = validation.facesWithCorrectNormals;
+    int incorrectFaces = validation.facesWithIncorrectNormals;
+    int noNormalFaces = validation.totalFaces - validation.facesWithNormals;
     
     // Update summary information
     m_faceCount->SetLabel(wxString::Format("Face Count: %d", totalFaces));
@@ -432,33 +417,11 @@ void NormalFixDialog::saveCurrentStatistics() {
             return;
         }
         
-        // Calculate shape center for normal direction analysis
-        gp_Pnt shapeCenter = NormalValidator::calculateShapeCenter(shape);
-        
-        int totalFaces = 0;
-        int correctFaces = 0;
-        int incorrectFaces = 0;
-        int noNormalFaces = 0;
-        
-        // Analyze each face
-        for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
-            TopoDS_Face face = TopoDS::Face(exp.Current());
-            totalFaces++;
-            
-            // Analyze this face
-            bool hasNormal = NormalValidator::analyzeFaceNormal(face, shapeCenter);
-            
-            if (hasNormal) {
-                bool isCorrect = NormalValidator::isNormalOutward(face, shapeCenter);
-                if (isCorrect) {
-                    correctFaces++;
-                } else {
-                    incorrectFaces++;
-                }
-            } else {
-                noNormalFaces++;
-            }
-        }
+        NormalValidationResult validation = NormalValidator::validateNormals(shape, geometry->getName());
+        int totalFaces = validation.totalFaces;
+        int correctFaces = validation.facesWithCorrectNormals;
+        int incorrectFaces = validation.facesWithIncorrectNormals;
+        int noNormalFaces = validation.totalFaces - validation.facesWithNormals;
         
         // Save statistics
         m_preFixStats.correctFaces = correctFaces;
@@ -610,36 +573,40 @@ void NormalFixDialog::onApply(wxCommandEvent& event) {
     int correctedCount = 0;
     int totalCount = geometries.size();
     
-    for (auto& geometry : geometries) {
-        if (!geometry) continue;
+    if (m_settings.autoCorrect) {
+        // Shapes are analysed on worker threads; the dialog keeps the UI responsive and cancellable
+        std::atomic<bool> cancel{ false };
+        std::atomic<size_t> completed{ 0 };
+        auto task = std::async(std::launch::async, [&]() {
+            return NormalValidator::correctNormals(geometries, m_settings.qualityThreshold,
+                [&completed](size_t done, size_t, const std::string&, const NormalValidationResult&) {
+                    completed = done;
+                }, &cancel);
+        });
         
-        const TopoDS_Shape& originalShape = geometry->getShape();
-        if (originalShape.IsNull()) continue;
-        
-        // Check if correction is needed based on quality threshold
-        if (m_settings.autoCorrect) {
-            double quality = NormalValidator::getNormalQualityScore(originalShape);
-            LOG_INF_S("Geometry " + geometry->getName() + " quality score: " + std::to_string(quality));
-            
-            if (quality < m_settings.qualityThreshold) {
-                LOG_INF_S("Applying normal correction to: " + geometry->getName());
-                
-                // Apply normal correction
-                TopoDS_Shape correctedShape = NormalValidator::autoCorrectNormals(originalShape, geometry->getName());
-                
-                // Verify the correction worked
-                double newQuality = NormalValidator::getNormalQualityScore(correctedShape);
-                LOG_INF_S("After correction, quality score: " + std::to_string(newQuality));
-                
-                // Update the geometry with corrected shape
-                geometry->setShape(correctedShape);
-                correctedCount++;
-                
-                LOG_INF_S("Successfully corrected normals for: " + geometry->getName());
-            } else {
-                LOG_INF_S("Geometry " + geometry->getName() + " already has good normals (quality: " + std::to_string(quality) + ")");
+        wxProgressDialog progress("Fix Normals", "Analysing face orientation...", std::max(totalCount, 1), this,
+            wxPD_APP_MODAL | wxPD_AUTO_HIDE | wxPD_CAN_ABORT | wxPD_ELAPSED_TIME);
+        while (task.wait_for(std::chrono::milliseconds(50)) != std::future_status::ready) {
+            if (!progress.Update(static_cast<int>(completed.load()),
+                wxString::Format("Analysed %d of %d geometries", static_cast<int>(completed.load()), totalCount))) {
+                cancel = true;
             }
         }
+        auto corrections = task.get();
+        
+        if (cancel) {
+            LOG_INF_S("Normal correction cancelled; no geometries changed");
+            return;
+        }
+        
+        // Shape updates rebuild Coin nodes and must happen on the UI thread
+        for (auto& correction : corrections) {
+            correction.geometry->setShape(correction.correctedShape);
+            correctedCount++;
+            LOG_INF_S("Successfully corrected normals for: " + correction.geometry->getName() + " (" +
+                     std::to_string(correction.reversedFaces) + " faces in " +
+                     std::to_string(correction.affectedShells) + " shells)");
+        }
     }
     
     // Refresh the viewer to show changes
@@ -98,6 +98,7 @@ ObjectTreePanel::ObjectTreePanel(wxWindow* parent)
 	, m_occViewer(nullptr)
 	, m_isUpdatingSelection(false)
 	, m_contextMenu(nullptr)
+	, m_refreshPending(false)
 {
 	LOG_INF_S("ObjectTreePanel initializing");
 	SetToolTip("CAD对象树：管理几何对象的可见性、颜色、属性和删除操作");
@@ -313,7 +314,7 @@ void ObjectTreePanel::addOCCGeometry(std::shared_ptr<OCCGeometry> geometry, std:
 	// Add as child of parent
 	parentItem->AddChild(geometryItem);
 	m_occGeometryMap[geometry] = geometryItem;
-	m_treeItemToOCCGeometry[geometryItem] = geometry;
+	m_itemIdToOCCGeometry[geometryItem->GetId()] = geometry;
 
 	m_treeView->Thaw();
 
@@ -373,46 +374,218 @@ void ObjectTreePanel::initializeTreeDataStructure()
 // Update tree data structure
 void ObjectTreePanel::updateTreeDataStructure()
 {
-	if (!m_treeData.needsUpdate) {
+	if (!m_treeData.hasPendingChanges()) {
 		return;
 	}
-	
-	LOG_INF_S("Updating tree data structure");
-	
-	// Clear existing tree items
-	m_treeView->Clear();
-	m_occGeometryMap.clear();
-	m_treeItemToOCCGeometry.clear();
-	m_fileNodeMap.clear();
-	
-	// Recreate virtual root
-	m_rootItem = std::make_shared<FlatTreeItem>("VirtualRoot", FlatTreeItem::ItemType::ROOT);
-	m_rootItem->SetExpanded(true);
-	m_treeView->SetRoot(m_rootItem);
-	
-	// Add file groups
-	for (const auto& fileGroup : m_treeData.fileGroups) {
-		const wxString& fileName = fileGroup.first;
-		const auto& geometries = fileGroup.second;
-		
-		if (!geometries.empty()) {
-			// Create file node
+
+	if (m_treeData.needsUpdate) {
+		LOG_INF_S("Rebuilding tree data structure");
+
+		// Clear existing tree items
+		m_treeView->Clear();
+		m_occGeometryMap.clear();
+		m_itemIdToOCCGeometry.clear();
+		m_fileNodeMap.clear();
+		m_fileNodeIdToName.clear();
+		m_lastSelectedItem.reset();
+
+		// Recreate virtual root
+		m_rootItem = std::make_shared<FlatTreeItem>("VirtualRoot", FlatTreeItem::ItemType::ROOT);
+		m_rootItem->SetExpanded(true);
+		m_treeView->SetRoot(m_rootItem);
+
+		// Everything is re-added as one diff, file groups first
+		m_treeData.compact();
+		m_treeData.pendingAdded.clear();
+		m_treeData.pendingRemoved.clear();
+		for (const auto& fileGroup : m_treeData.fileGroups) {
+			m_treeData.pendingAdded.insert(m_treeData.pendingAdded.end(), fileGroup.second.begin(), fileGroup.second.end());
+		}
+		m_treeData.pendingAdded.insert(m_treeData.pendingAdded.end(),
+			m_treeData.ungroupedGeometries.begin(), m_treeData.ungroupedGeometries.end());
+		m_treeData.needsUpdate = false;
+	}
+
+	applyTreeDiff();
+}
+
+// Apply queued additions and removals to the tree items
+void ObjectTreePanel::applyTreeDiff()
+{
+	m_treeData.compact();
+
+	if (!m_rootItem) {
+		m_rootItem = std::make_shared<FlatTreeItem>("VirtualRoot", FlatTreeItem::ItemType::ROOT);
+		m_rootItem->SetExpanded(true);
+		m_treeView->SetRoot(m_rootItem);
+	}
+
+	const size_t added = m_treeData.pendingAdded.size();
+	const size_t removed = m_treeData.pendingRemoved.size();
+
+	// Removals: collect the items, then one pass over each affected parent
+	std::unordered_set<uint64_t> removedItemIds;
+	std::unordered_set<FlatTreeItem*> affectedParents;
+	for (const auto& geometry : m_treeData.pendingRemoved) {
+		auto it = m_occGeometryMap.find(geometry);
+		if (it == m_occGeometryMap.end()) {
+			continue; // Inside a file node that was never expanded
+		}
+		auto item = it->second;
+		if (m_treeData.contains(geometry)) {
+			// Re-added since; the item only goes if the geometry moved to another file
+			wxString fileName = geometry->getFileName();
+			auto nodeIt = fileName.IsEmpty() ? m_fileNodeMap.end() : m_fileNodeMap.find(fileName);
+			FlatTreeItem* expectedParent = fileName.IsEmpty() ? m_rootItem.get()
+				: (nodeIt != m_fileNodeMap.end() ? nodeIt->second.get() : nullptr);
+			if (item->GetParent() == expectedParent) {
+				continue;
+			}
+		}
+		if (item->HasChildren()) {
+			// Child geometries would need re-parenting; rebuild instead
+			m_treeData.needsUpdate = true;
+			updateTreeDataStructure();
+			return;
+		}
+		removedItemIds.insert(item->GetId());
+		if (item->GetParent()) {
+			affectedParents.insert(item->GetParent());
+		}
+		if (m_lastSelectedItem == item) {
+			m_lastSelectedItem.reset();
+		}
+		m_itemIdToOCCGeometry.erase(item->GetId());
+		m_occGeometryMap.erase(it);
+	}
+	for (FlatTreeItem* parent : affectedParents) {
+		parent->RemoveChildrenIf([&removedItemIds](const std::shared_ptr<FlatTreeItem>& child) {
+			return removedItemIds.count(child->GetId()) > 0;
+		});
+	}
+	if (removed > 0) {
+		std::vector<wxString> emptyFiles;
+		for (const auto& fileNode : m_fileNodeMap) {
+			if (m_treeData.fileGroups.find(fileNode.first) == m_treeData.fileGroups.end()) {
+				emptyFiles.push_back(fileNode.first);
+			}
+		}
+		for (const auto& fileName : emptyFiles) {
+			removeFileNode(fileName);
+		}
+	}
+
+	// Additions
+	for (const auto& geometry : m_treeData.pendingAdded) {
+		if (!m_treeData.contains(geometry) || m_occGeometryMap.find(geometry) != m_occGeometryMap.end()) {
+			continue;
+		}
+		wxString fileName = geometry->getFileName();
+		if (fileName.IsEmpty()) {
+			addOCCGeometryToNode(m_rootItem, geometry);
+			continue;
+		}
+
+		auto nodeIt = m_fileNodeMap.find(fileName);
+		if (nodeIt == m_fileNodeMap.end()) {
 			auto fileNode = getOrCreateFileNode(fileName);
-			
-			// Add geometries to file node
-			for (const auto& geometry : geometries) {
-				addOCCGeometryToNode(fileNode, geometry);
+			auto groupIt = m_treeData.fileGroups.find(fileName);
+			if (groupIt != m_treeData.fileGroups.end() && groupIt->second.size() > kLazyFileNodeThreshold) {
+				// Large files start collapsed; their rows are built on first expand
+				fileNode->SetExpanded(false);
+				fileNode->SetChildrenLoader([this, fileName](FlatTreeItem& node) {
+					loadFileNodeChildren(node, fileName);
+				});
+				continue;
 			}
+			addOCCGeometryToNode(fileNode, geometry);
+		}
+		else if (!nodeIt->second->HasPendingChildren()) {
+			addOCCGeometryToNode(nodeIt->second, geometry);
 		}
 	}
-	
-	// Add ungrouped geometries
-	for (const auto& geometry : m_treeData.ungroupedGeometries) {
-		addOCCGeometryToNode(m_rootItem, geometry);
+
+	m_treeData.pendingAdded.clear();
+	m_treeData.pendingRemoved.clear();
+	LOG_INF_S("Tree data structure updated: " + std::to_string(added) + " added, " + std::to_string(removed) + " removed");
+}
+
+void ObjectTreePanel::loadFileNodeChildren(FlatTreeItem& fileNode, const wxString& fileName)
+{
+	auto nodeIt = m_fileNodeMap.find(fileName);
+	if (nodeIt == m_fileNodeMap.end() || nodeIt->second.get() != &fileNode) {
+		return;
 	}
-	
-	m_treeData.needsUpdate = false;
-	LOG_INF_S("Tree data structure updated");
+	m_treeData.compact();
+	auto groupIt = m_treeData.fileGroups.find(fileName);
+	if (groupIt == m_treeData.fileGroups.end()) {
+		return;
+	}
+	for (const auto& geometry : groupIt->second) {
+		addOCCGeometryToNode(nodeIt->second, geometry);
+	}
+	LOG_INF_S("Expanded file node '" + fileName.ToStdString() + "' (" + std::to_string(groupIt->second.size()) + " objects)");
+}
+
+void ObjectTreePanel::removeFileNode(const wxString& fileName)
+{
+	auto it = m_fileNodeMap.find(fileName);
+	if (it == m_fileNodeMap.end()) {
+		return;
+	}
+	auto fileNode = it->second;
+	for (const auto& child : fileNode->GetChildren()) {
+		auto geometryIt = m_itemIdToOCCGeometry.find(child->GetId());
+		if (geometryIt != m_itemIdToOCCGeometry.end()) {
+			m_occGeometryMap.erase(geometryIt->second);
+			m_itemIdToOCCGeometry.erase(geometryIt);
+		}
+		if (m_lastSelectedItem == child) {
+			m_lastSelectedItem.reset();
+		}
+	}
+	if (m_lastSelectedItem == fileNode) {
+		m_lastSelectedItem.reset();
+	}
+	if (m_rootItem) {
+		m_rootItem->RemoveChild(fileNode);
+	}
+	m_fileNodeIdToName.erase(fileNode->GetId());
+	m_fileNodeMap.erase(it);
+}
+
+std::shared_ptr<FlatTreeItem> ObjectTreePanel::findGeometryItem(const std::shared_ptr<OCCGeometry>& geometry, bool materialize)
+{
+	auto it = m_occGeometryMap.find(geometry);
+	if (it != m_occGeometryMap.end()) {
+		return it->second;
+	}
+	if (!materialize || !m_treeData.contains(geometry)) {
+		return nullptr;
+	}
+
+	// Build the rows of the lazy file node holding this geometry
+	auto nodeIt = m_fileNodeMap.find(wxString(geometry->getFileName()));
+	if (nodeIt == m_fileNodeMap.end() || !nodeIt->second->HasPendingChildren()) {
+		return nullptr;
+	}
+	nodeIt->second->EnsureChildrenLoaded();
+	m_treeView->InvalidateVisibleItemsList();
+	it = m_occGeometryMap.find(geometry);
+	return it != m_occGeometryMap.end() ? it->second : nullptr;
+}
+
+void ObjectTreePanel::scheduleTreeRefresh()
+{
+	// Coalesce the removals and additions of one event-loop turn into one diff
+	if (m_refreshPending) {
+		return;
+	}
+	m_refreshPending = true;
+	CallAfter([this]() {
+		m_refreshPending = false;
+		refreshTreeDisplay();
+	});
 }
 
 // Refresh tree display
@@ -467,7 +640,7 @@ void ObjectTreePanel::addOCCGeometryToNode(std::shared_ptr<FlatTreeItem> parentN
 	
 	// Update mappings
 	m_occGeometryMap[geometry] = geometryItem;
-	m_treeItemToOCCGeometry[geometryItem] = geometry;
+	m_itemIdToOCCGeometry[geometryItem->GetId()] = geometry;
 }
 
 // Backward compatibility - add geometry as root level
@@ -483,8 +656,8 @@ void ObjectTreePanel::addOCCGeometry(std::shared_ptr<OCCGeometry> geometry)
 	// Update data structure
 	m_treeData.addGeometry(geometry);
 	
-	// Refresh display
-	refreshTreeDisplay();
+	// Refresh display once the current batch of changes is in
+	scheduleTreeRefresh();
 }
 
 void ObjectTreePanel::removeOCCGeometry(std::shared_ptr<OCCGeometry> geometry)
@@ -499,8 +672,8 @@ void ObjectTreePanel::removeOCCGeometry(std::shared_ptr<OCCGeometry> geometry)
 	// Update data structure
 	m_treeData.removeGeometry(geometry);
 	
-	// Refresh display
-	refreshTreeDisplay();
+	// Refresh display once the current batch of changes is in
+	scheduleTreeRefresh();
 }
 
 void ObjectTreePanel::removeOCCGeometryRecursive(std::shared_ptr<OCCGeometry> geometry)
@@ -515,8 +688,8 @@ void ObjectTreePanel::removeOCCGeometryRecursive(std::shared_ptr<OCCGeometry> ge
 	// Recursively remove all children first
 	std::vector<std::shared_ptr<FlatTreeItem>> children = featureItem->GetChildren();
 	for (auto& child : children) {
-		auto childIt = m_treeItemToOCCGeometry.find(child);
-		if (childIt != m_treeItemToOCCGeometry.end()) {
+		auto childIt = m_itemIdToOCCGeometry.find(child->GetId());
+		if (childIt != m_itemIdToOCCGeometry.end()) {
 			auto childGeometry = childIt->second;
 			removeOCCGeometryRecursive(childGeometry); // Recursive call
 		}
@@ -527,7 +700,7 @@ void ObjectTreePanel::removeOCCGeometryRecursive(std::shared_ptr<OCCGeometry> ge
 		featureItem->GetParent()->RemoveChild(featureItem);
 	}
 	m_occGeometryMap.erase(it);
-	m_treeItemToOCCGeometry.erase(featureItem);
+	m_itemIdToOCCGeometry.erase(featureItem->GetId());
 }
 
 std::shared_ptr<FlatTreeItem> ObjectTreePanel::getOrCreateFileNode(const wxString& fileName)
@@ -558,8 +731,9 @@ std::shared_ptr<FlatTreeItem> ObjectTreePanel::getOrCreateFileNode(const wxStrin
 	m_rootItem->AddChild(fileNode);
 	fileNode->SetExpanded(true); // Expand file nodes by default
 
-	// Store in map
+	// Store in maps
 	m_fileNodeMap[fileName] = fileNode;
+	m_fileNodeIdToName[fileNode->GetId()] = fileName;
 
 	return fileNode;
 }
@@ -578,6 +752,7 @@ void ObjectTreePanel::updateOCCGeometryName(std::shared_ptr<OCCGeometry> geometr
 	}
 
 	m_treeView->Freeze();
+	m_treeView->UpdateItemText(it->second, geometry->getName());
 	// Update visibility icon based on current state
 	updateTreeItemIcon(it->second, geometry->isVisible());
 	m_treeView->Thaw();
@@ -587,11 +762,11 @@ void ObjectTreePanel::selectOCCGeometry(std::shared_ptr<OCCGeometry> geometry)
 {
 	if (!geometry) return;
 
-	auto it = m_occGeometryMap.find(geometry);
-	if (it == m_occGeometryMap.end()) return;
+	auto item = findGeometryItem(geometry, true);
+	if (!item) return;
 
 	m_isUpdatingSelection = true;
-	m_lastSelectedItem = it->second;
+	m_lastSelectedItem = item;
 	m_isUpdatingSelection = false;
 }
 
@@ -866,8 +1041,8 @@ std::shared_ptr<OCCGeometry> ObjectTreePanel::getSelectedOCCGeometry()
 	if (!selectedItem) {
 		return nullptr;
 	}
-	auto it = m_treeItemToOCCGeometry.find(selectedItem);
-	if (it != m_treeItemToOCCGeometry.end()) return it->second;
+	auto it = m_itemIdToOCCGeometry.find(selectedItem->GetId());
+	if (it != m_itemIdToOCCGeometry.end()) return it->second;
 	return nullptr;
 }
 
@@ -932,11 +1107,9 @@ void ObjectTreePanel::handleFileNodeClick(std::shared_ptr<FlatTreeItem> fileNode
 			int result = wxMessageBox(message, "Confirm Delete All", wxYES_NO | wxICON_QUESTION);
 
 			if (result == wxYES) {
-				// Remove all geometries through OCCViewer (handles scene and tree sync)
-				for (const auto& geometry : geometriesInFile) {
-					if (geometry && m_occViewer) {
-						m_occViewer->removeGeometry(geometry->getName());
-					}
+				// Remove all geometries through OCCViewer in one batch (handles scene and tree sync)
+				if (m_occViewer) {
+					m_occViewer->removeGeometries(geometriesInFile);
 				}
 
 				// Force Canvas refresh after batch deletion
@@ -955,12 +1128,9 @@ void ObjectTreePanel::handleFileNodeClick(std::shared_ptr<FlatTreeItem> fileNode
 				}
 
 				// Clean up file node from tree
-				auto it = m_fileNodeMap.find(fileName);
-				if (it != m_fileNodeMap.end()) {
-					if (m_rootItem) {
-						m_rootItem->RemoveChild(it->second);
-					}
-					m_fileNodeMap.erase(it);
+				if (m_fileNodeMap.find(fileName) != m_fileNodeMap.end()) {
+					removeFileNode(fileName);
+					m_treeView->InvalidateVisibleItemsList();
 					m_treeView->Refresh();
 				}
 
@@ -1023,16 +1193,8 @@ void ObjectTreePanel::handleFileNodeClick(std::shared_ptr<FlatTreeItem> fileNode
 
 std::vector<std::shared_ptr<OCCGeometry>> ObjectTreePanel::getGeometriesInFile(const wxString& fileName)
 {
-	std::vector<std::shared_ptr<OCCGeometry>> result;
-	if (!m_occViewer) return result;
-
-	auto allGeometries = m_occViewer->getAllGeometry();
-	for (const auto& geometry : allGeometries) {
-		if (geometry && geometry->getFileName() == fileName.ToStdString()) {
-			result.push_back(geometry);
-		}
-	}
-	return result;
+	if (!m_occViewer) return {};
+	return m_occViewer->findGeometriesByFile(fileName.ToStdString());
 }
 
 bool ObjectTreePanel::areAllGeometriesVisible(const std::vector<std::shared_ptr<OCCGeometry>>& geometries)
@@ -1145,15 +1307,14 @@ void ObjectTreePanel::onTreeItemClicked(std::shared_ptr<FlatTreeItem> item, int
 	}
 
 	// Check if this is a file node (folder)
-	auto itFile = std::find_if(m_fileNodeMap.begin(), m_fileNodeMap.end(),
-		[&item](const auto& pair) { return pair.second == item; });
-	if (itFile != m_fileNodeMap.end()) {
-		handleFileNodeClick(item, column, itFile->first);
+	auto itFile = m_fileNodeIdToName.find(item->GetId());
+	if (itFile != m_fileNodeIdToName.end()) {
+		handleFileNodeClick(item, column, itFile->second);
 		return;
 	}
 
-	auto itOcc = m_treeItemToOCCGeometry.find(item);
-	if (itOcc != m_treeItemToOCCGeometry.end()) {
+	auto itOcc = m_itemIdToOCCGeometry.find(item->GetId());
+	if (itOcc != m_itemIdToOCCGeometry.end()) {
 		auto geometry = itOcc->second;
 		if (!geometry) {
 			LOG_WRN_S("ObjectTreePanel: Null geometry reference found in tree");
@@ -1274,9 +1435,9 @@ void ObjectTreePanel::updateTreeSelectionFromViewer()
 	if (!selectedGeometries.empty()) {
 		// Select the first one (single selection mode)
 		auto geometry = selectedGeometries[0];
-		auto it = m_occGeometryMap.find(geometry);
-		if (it != m_occGeometryMap.end()) {
-			m_lastSelectedItem = it->second;
+		auto item = findGeometryItem(geometry, true);
+		if (item) {
+			m_lastSelectedItem = item;
 			m_lastSelectedItem->SetSelected(true);
 			LOG_INF_S("Selected tree item for geometry: " + geometry->getName());
 		}
@@ -369,22 +369,21 @@ void PositionBasicDialog::OnOkButton(wxCommandEvent& event)
 						canvas->getOCCViewer()
 					);
 
-					// Create geometry with basic parameters
+					// Create geometry with basic parameters; advanced parameters are applied once
+					// it is in the scene, which for background-built types happens later
 					BasicGeometryParameters basicParams = GetBasicParameters();
-					std::shared_ptr<OCCGeometry> geometry = factory.createOCCGeometryWithParameters(geometryType, finalPos, basicParams);
-
-					// Apply advanced parameters if geometry was created successfully
-					if (geometry) {
-						AdvancedGeometryParameters advancedParams = GetAdvancedParameters();
-						geometry->applyAdvancedParameters(advancedParams);
-
-					LOG_DBG_S("Created geometry with advanced parameters:");
-					LOG_DBG_S("  - Material diffuse color: " + std::to_string(advancedParams.materialDiffuseColor.Red()) + "," +
-						std::to_string(advancedParams.materialDiffuseColor.Green()) + "," +
-						std::to_string(advancedParams.materialDiffuseColor.Blue()));
-					LOG_DBG_S("  - Transparency: " + std::to_string(advancedParams.materialTransparency));
-					LOG_DBG_S("  - Texture enabled: " + std::string(advancedParams.textureEnabled ? "true" : "false"));
-					}
+					AdvancedGeometryParameters advancedParams = GetAdvancedParameters();
+					factory.createOCCGeometryWithParameters(geometryType, finalPos, basicParams,
+						[advancedParams](const std::shared_ptr<OCCGeometry>& geometry) {
+							geometry->applyAdvancedParameters(advancedParams);
+
+							LOG_DBG_S("Created geometry with advanced parameters:");
+							LOG_DBG_S("  - Material diffuse color: " + std::to_string(advancedParams.materialDiffuseColor.Red()) + "," +
+								std::to_string(advancedParams.materialDiffuseColor.Green()) + "," +
+								std::to_string(advancedParams.materialDiffuseColor.Blue()));
+							LOG_DBG_S("  - Transparency: " + std::to_string(advancedParams.materialTransparency));
+							LOG_DBG_S("  - Texture enabled: " + std::string(advancedParams.textureEnabled ? "true" : "false"));
+						});
 
 					mouseHandler->setOperationMode(MouseHandler::OperationMode::VIEW);
 					mouseHandler->setCreationGeometryType("");
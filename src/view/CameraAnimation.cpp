@@ -3,8 +3,16 @@
 #include <Inventor/nodes/SoPerspectiveCamera.h>
 #include <Inventor/nodes/SoOrthographicCamera.h>
 #include <wx/log.h>
+#include <algorithm>
 #include <cmath>
 
+namespace {
+    // How often the clock is sampled; frames are still limited to one in flight
+    constexpr int kTickIntervalMs = 8;
+    // A requested frame not reported as drawn by then is assumed dropped
+    constexpr std::chrono::milliseconds kFrameTimeout(100);
+}
+
 //==============================================================================
 // CameraAnimation Implementation
 //==============================================================================
@@ -21,6 +29,7 @@ CameraAnimation::CameraAnimation()
     , m_duration(1.0f)
     , m_elapsedTime(0.0f)
     , m_isAnimating(false)
+    , m_frameInFlight(false)
 {
     m_timer.SetOwner(this);
 }
@@ -49,9 +58,11 @@ bool CameraAnimation::startAnimation(const CameraState& startState, const Camera
     m_animationType = type;
     m_elapsedTime = 0.0f;
     m_isAnimating = true;
+    m_frameInFlight = false;
+    m_startTime = std::chrono::steady_clock::now();
 
-    // Start timer (60 FPS = ~16ms intervals)
-    m_timer.Start(16, false);
+    // The timer only wakes the animation up; progress comes from the clock
+    m_timer.Start(kTickIntervalMs, false);
 
     wxLogDebug("CameraAnimation: Started animation (duration: %.2fs, type: %d)",
                m_duration, static_cast<int>(m_animationType));
@@ -71,22 +82,22 @@ void CameraAnimation::stopAnimation() {
 void CameraAnimation::onTimer(wxTimerEvent& event) {
     if (!m_isAnimating) return;
 
-    m_elapsedTime += 0.016f; // ~16ms per frame
-    float progress = std::min(m_elapsedTime / m_duration, 1.0f);
-
-    // Apply easing function
-    float easedProgress = calculateEasing(progress);
-
-    // Interpolate camera states
-    m_currentState = interpolateStates(m_startState, m_endState, easedProgress);
+    // Wait until the last state has been drawn so redraws don't pile up
+    const auto now = std::chrono::steady_clock::now();
+    if (m_frameInFlight && now - m_frameRequestTime < kFrameTimeout) {
+        std::chrono::duration<float> elapsed = now - m_startTime;
+        if (elapsed.count() < m_duration) {
+            return;
+        }
+    }
 
-    // Update camera
-    updateCamera();
+    advance();
+}
 
-    // Call progress callback
-    if (m_progressCallback) {
-        m_progressCallback(easedProgress);
-    }
+void CameraAnimation::advance() {
+    const auto now = std::chrono::steady_clock::now();
+    m_elapsedTime = std::chrono::duration<float>(now - m_startTime).count();
+    float progress = m_duration > 0.0f ? std::min(m_elapsedTime / m_duration, 1.0f) : 1.0f;
 
     // Check if animation completed
     if (progress >= 1.0f) {
@@ -96,12 +107,33 @@ void CameraAnimation::onTimer(wxTimerEvent& event) {
         m_currentState = m_endState;
         updateCamera();
 
+        if (m_progressCallback) {
+            m_progressCallback(1.0f);
+        }
+
         // Call completion callback
         if (m_completionCallback) {
             m_completionCallback();
         }
 
         wxLogDebug("CameraAnimation: Animation completed");
+        return;
+    }
+
+    // Apply easing function
+    float easedProgress = calculateEasing(progress);
+
+    // Interpolate camera states
+    m_currentState = interpolateStates(m_startState, m_endState, easedProgress);
+
+    // Update camera; this requests the frame that will show it
+    m_frameInFlight = true;
+    m_frameRequestTime = now;
+    updateCamera();
+
+    // Call progress callback
+    if (m_progressCallback) {
+        m_progressCallback(easedProgress);
     }
 }
 
@@ -357,6 +389,12 @@ void NavigationAnimator::setCamera(SoCamera* camera) {
     m_currentAnimation->setCamera(camera);
 }
 
+void NavigationAnimator::notifyFrameRendered() {
+    if (m_currentAnimation) {
+        m_currentAnimation->notifyFrameRendered();
+    }
+}
+
 void NavigationAnimator::setAnimationType(CameraAnimation::AnimationType type) {
     if (m_currentAnimation) {
         m_currentAnimation->setAnimationType(type);
@@ -12,6 +12,7 @@
 #include "NavigationCubeManager.h"
 #include "utils/PerformanceBus.h"
 #include "ViewRefreshManager.h"
+#include "CameraAnimation.h"
 #include "RenderingEngine.h"
 #include "EventCoordinator.h"
 #include "ViewportManager.h"
@@ -279,6 +280,11 @@ void Canvas::render(bool fastMode) {
 		auto swapStartTime = std::chrono::high_resolution_clock::now();
 		m_renderingEngine->swapBuffers();
 		auto swapEndTime = std::chrono::high_resolution_clock::now();
+		if (m_refreshManager) {
+			m_refreshManager->notifyFrameRendered();
+		}
+		// Lets a running view animation sample its next camera state
+		NavigationAnimator::getInstance().notifyFrameRendered();
 		auto swapDuration = std::chrono::duration_cast<std::chrono::milliseconds>(swapEndTime - swapStartTime);
 
 		auto renderEndTime = std::chrono::high_resolution_clock::now();
@@ -439,6 +445,12 @@ void Canvas::onMouseEvent(wxMouseEvent& event) {
 	if (isInteractionEvent && m_occViewer) {
 		m_occViewer->startLODInteraction();
 	}
+
+	// Camera-moving input drops the view to its coarse progressive stage
+	if (m_sceneManager &&
+		((isDragging && event.GetEventType() == wxEVT_MOTION) || event.GetEventType() == wxEVT_MOUSEWHEEL)) {
+		m_sceneManager->beginInteraction();
+	}
 	
 	// Update hover outline on mouse move (but not during drag to reduce overhead)
 	// Disabled hover outline to avoid unwanted red lines
@@ -3,15 +3,33 @@
 #include "logger/Logger.h"
 #include <wx/app.h>      // wxCallAfter
 #include <wx/thread.h>   // wxThread::IsMain
+#include <algorithm>
 
 wxBEGIN_EVENT_TABLE(ViewRefreshManager, wxEvtHandler)
 EVT_TIMER(wxID_ANY, ViewRefreshManager::onDebounceTimer)
 wxEND_EVENT_TABLE()
 
+namespace {
+	ViewRefreshManager::RefreshReason toRefreshReason(IViewRefresher::Reason reason) {
+		// The interface enum has no POINT_VIEW_TOGGLED, so values must be mapped by name
+		switch (reason) {
+		case IViewRefresher::Reason::GEOMETRY_CHANGED: return ViewRefreshManager::RefreshReason::GEOMETRY_CHANGED;
+		case IViewRefresher::Reason::NORMALS_TOGGLED: return ViewRefreshManager::RefreshReason::NORMALS_TOGGLED;
+		case IViewRefresher::Reason::EDGES_TOGGLED: return ViewRefreshManager::RefreshReason::EDGES_TOGGLED;
+		case IViewRefresher::Reason::MATERIAL_CHANGED: return ViewRefreshManager::RefreshReason::MATERIAL_CHANGED;
+		case IViewRefresher::Reason::CAMERA_MOVED: return ViewRefreshManager::RefreshReason::CAMERA_MOVED;
+		case IViewRefresher::Reason::SELECTION_CHANGED: return ViewRefreshManager::RefreshReason::SELECTION_CHANGED;
+		case IViewRefresher::Reason::RENDERING_CHANGED: return ViewRefreshManager::RefreshReason::RENDERING_CHANGED;
+		case IViewRefresher::Reason::LIGHTING_CHANGED: return ViewRefreshManager::RefreshReason::LIGHTING_CHANGED;
+		default: return ViewRefreshManager::RefreshReason::MANUAL_REQUEST;
+		}
+	}
+}
+
 ViewRefreshManager::ViewRefreshManager(Canvas* canvas)
 	: m_canvas(canvas)
 	, m_debounceTimer(this)
-	, m_pendingReason(RefreshReason::MANUAL_REQUEST)
+	, m_pendingReasons(0)
 	, m_hasPendingRefresh(false)
 	, m_debounceTime(16)  // ~60fps
 	, m_enabled(true)
@@ -22,7 +40,13 @@ ViewRefreshManager::ViewRefreshManager(Canvas* canvas)
 ViewRefreshManager::~ViewRefreshManager() {
 	m_debounceTimer.Stop();
 	removeAllListeners();
-	LOG_INF_S("ViewRefreshManager: Destroyed");
+	LOG_INF_S("ViewRefreshManager: Destroyed (requested=" + std::to_string(m_stats.requestedFrames) +
+		", issued=" + std::to_string(m_stats.issuedRefreshes) +
+		", rendered=" + std::to_string(m_stats.renderedFrames) + ")");
+}
+
+void ViewRefreshManager::requestRefresh(IViewRefresher::Reason reason, bool immediate) {
+	requestRefresh(toRefreshReason(reason), immediate);
 }
 
 void ViewRefreshManager::requestRefresh(RefreshReason reason, bool immediate) {
@@ -31,10 +55,6 @@ void ViewRefreshManager::requestRefresh(RefreshReason reason, bool immediate) {
 		return;
 	}
 
-	LOG_DBG_S("=== VIEW REFRESH: REQUESTING REFRESH (reason=" +
-		std::to_string(static_cast<int>(reason)) + ", immediate=" +
-		std::string(immediate ? "true" : "false") + ") ===");
-
 	// Ensure all UI-related operations run on the main thread
 	if (!wxThread::IsMain()) {
 		LOG_DBG_S("VIEW REFRESH: Switching to main thread for refresh");
@@ -45,22 +65,37 @@ void ViewRefreshManager::requestRefresh(RefreshReason reason, bool immediate) {
 		return;
 	}
 
-	if (immediate) {
-		// Cancel any pending debounced refresh
-		m_debounceTimer.Stop();
-		m_hasPendingRefresh = false;
-		performRefresh(reason);
+	LOG_DBG_S("VIEW REFRESH: Requesting refresh (reason=" +
+		std::to_string(static_cast<int>(reason)) + ", immediate=" +
+		std::string(immediate ? "true" : "false") + ")");
+
+	++m_stats.requestedFrames;
+	m_pendingReasons |= reasonBit(reason);
+	schedulePending(immediate);
+}
+
+void ViewRefreshManager::requestObjectRefresh(const std::string& objectId, RefreshReason reason, bool immediate) {
+	if (!m_enabled || !m_canvas) {
+		LOG_WRN_S("VIEW REFRESH: Manager disabled or no canvas available");
+		return;
 	}
-	else {
-		// Use debouncing to avoid excessive refreshes
-		m_pendingReason = reason;
-		m_hasPendingRefresh = true;
 
-		if (!m_debounceTimer.IsRunning()) {
-			m_debounceTimer.Start(m_debounceTime, wxTIMER_ONE_SHOT);
-		}
-		LOG_DBG_S("VIEW REFRESH: Debounced refresh scheduled");
+	if (!wxThread::IsMain()) {
+		this->CallAfter([this, objectId, reason, immediate]() {
+			this->requestObjectRefresh(objectId, reason, immediate);
+			});
+		return;
+	}
+
+	if (!objectId.empty()) {
+		m_pendingObjects.insert(objectId);
 	}
+	requestRefresh(reason, immediate);
+}
+
+void ViewRefreshManager::notifyFrameRendered() {
+	++m_stats.renderedFrames;
+	m_lastFrameTime = std::chrono::steady_clock::now();
 }
 
 void ViewRefreshManager::addRefreshListener(RefreshListener listener) {
@@ -71,43 +106,89 @@ void ViewRefreshManager::removeAllListeners() {
 	m_listeners.clear();
 }
 
-void ViewRefreshManager::performRefresh(RefreshReason reason) {
+void ViewRefreshManager::schedulePending(bool immediate) {
+	m_hasPendingRefresh = true;
+
+	if (!immediate) {
+		// Use debouncing to avoid excessive refreshes
+		if (!m_debounceTimer.IsRunning()) {
+			m_debounceTimer.Start(m_debounceTime, wxTIMER_ONE_SHOT);
+		}
+		return;
+	}
+
+	// Immediate requests still respect the frame interval: a burst of them
+	// inside one interval collapses into a single refresh at its end
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - m_lastFrameTime).count();
+	if (elapsed >= m_debounceTime) {
+		m_debounceTimer.Stop();
+		flushPending();
+		return;
+	}
+
+	int remaining = std::max(1, m_debounceTime - static_cast<int>(elapsed));
+	if (m_debounceTimer.IsRunning() && m_debounceTimer.GetInterval() <= remaining) {
+		return;
+	}
+	m_debounceTimer.Stop();
+	m_debounceTimer.Start(remaining, wxTIMER_ONE_SHOT);
+}
+
+void ViewRefreshManager::flushPending() {
+	if (!m_hasPendingRefresh) {
+		return;
+	}
+
+	uint32_t reasons = m_pendingReasons;
+	m_pendingReasons = 0;
+	m_hasPendingRefresh = false;
+	m_flushingObjects.swap(m_pendingObjects);
+	m_pendingObjects.clear();
+
+	performRefresh(reasons);
+
+	m_flushingObjects.clear();
+}
+
+void ViewRefreshManager::performRefresh(uint32_t reasons) {
 	if (!m_canvas) {
 		LOG_WRN_S("VIEW REFRESH: No canvas available for refresh");
 		return;
 	}
 
-	LOG_DBG_S("=== VIEW REFRESH: PERFORMING REFRESH (reason=" + std::to_string(static_cast<int>(reason)) + ") ===");
-
-	// Notify all listeners before refresh
+	// Notify listeners once per merged reason before refresh
 	if (!m_listeners.empty()) {
-		LOG_DBG_S("VIEW REFRESH: Notifying " + std::to_string(m_listeners.size()) + " listeners");
-		for (const auto& listener : m_listeners) {
-			try {
-				listener(reason);
+		for (uint32_t bit = 0; bit < 32; ++bit) {
+			if (!(reasons & (1u << bit))) {
+				continue;
 			}
-			catch (const std::exception& e) {
-				LOG_ERR_S("VIEW REFRESH: Listener exception: " + std::string(e.what()));
+			RefreshReason reason = static_cast<RefreshReason>(bit);
+			for (const auto& listener : m_listeners) {
+				try {
+					listener(reason);
+				}
+				catch (const std::exception& e) {
+					LOG_ERR_S("VIEW REFRESH: Listener exception: " + std::string(e.what()));
+				}
 			}
 		}
 	}
 
 	// Perform the actual refresh: use wxWidgets paint system
-	LOG_DBG_S("VIEW REFRESH: Calling canvas Refresh()");
 	m_canvas->Refresh(false);
+	++m_stats.issuedRefreshes;
+	m_lastFrameTime = std::chrono::steady_clock::now();
 
 	// If immediate update is needed, also call Update()
-	if (reason == RefreshReason::CAMERA_MOVED || reason == RefreshReason::SELECTION_CHANGED) {
-		LOG_DBG_S("VIEW REFRESH: Calling canvas Update() for immediate refresh");
+	if (reasons & (reasonBit(RefreshReason::CAMERA_MOVED) | reasonBit(RefreshReason::SELECTION_CHANGED))) {
 		m_canvas->Update();  // Force immediate paint for interactive operations
 	}
 
-	LOG_DBG_S("=== VIEW REFRESH: REFRESH COMPLETED ===");
+	LOG_DBG_S("VIEW REFRESH: Refresh issued (requested=" + std::to_string(m_stats.requestedFrames) +
+		", issued=" + std::to_string(m_stats.issuedRefreshes) + ")");
 }
 
 void ViewRefreshManager::onDebounceTimer(wxTimerEvent& event) {
-	if (m_hasPendingRefresh) {
-		performRefresh(m_pendingReason);
-		m_hasPendingRefresh = false;
-	}
-}
\ No newline at end of file
+	flushPending();
+}
@@ -6,6 +6,7 @@
 #include <wx/scrolwin.h>
 #include <wx/cursor.h>
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include "config/FontManager.h"
 #include "config/SvgIconManager.h"
@@ -33,13 +34,19 @@ EVT_ERASE_BACKGROUND(FlatTreeView::OnEraseBackground)
 END_EVENT_TABLE()
 
 // FlatTreeItem implementation
+namespace {
+	std::atomic<uint64_t> s_nextItemId{ 1 };
+}
+
 FlatTreeItem::FlatTreeItem(const wxString& text, ItemType type)
-	: m_text(text)
+	: m_id(s_nextItemId.fetch_add(1, std::memory_order_relaxed))
+	, m_text(text)
 	, m_type(type)
 	, m_visible(true)
 	, m_selected(false)
 	, m_expanded(false)
 	, m_parent(nullptr)
+	, m_textWidth(-1)
 {
 }
 
@@ -49,7 +56,10 @@ FlatTreeItem::~FlatTreeItem()
 
 void FlatTreeItem::SetText(const wxString& text)
 {
-	m_text = text;
+	if (m_text != text) {
+		m_text = text;
+		m_textWidth = -1;
+	}
 }
 
 void FlatTreeItem::SetType(ItemType type)
@@ -94,6 +104,17 @@ void FlatTreeItem::RemoveChild(std::shared_ptr<FlatTreeItem> child)
 	}
 }
 
+void FlatTreeItem::RemoveChildrenIf(const std::function<bool(const std::shared_ptr<FlatTreeItem>&)>& predicate)
+{
+	// One pass over the children, for removing many items at once
+	auto first = std::stable_partition(m_children.begin(), m_children.end(),
+		[&predicate](const std::shared_ptr<FlatTreeItem>& child) { return !predicate(child); });
+	for (auto it = first; it != m_children.end(); ++it) {
+		(*it)->SetParent(nullptr);
+	}
+	m_children.erase(first, m_children.end());
+}
+
 void FlatTreeItem::ClearChildren()
 {
 	for (auto& child : m_children) {
@@ -107,26 +128,85 @@ void FlatTreeItem::SetParent(FlatTreeItem* parent)
 	m_parent = parent;
 }
 
+void FlatTreeItem::SetChildrenLoader(std::function<void(FlatTreeItem&)> loader)
+{
+	m_childrenLoader = std::move(loader);
+}
+
+void FlatTreeItem::EnsureChildrenLoaded()
+{
+	if (m_childrenLoader) {
+		// Cleared first so a loader that adds children cannot run itself again
+		auto loader = std::move(m_childrenLoader);
+		m_childrenLoader = nullptr;
+		loader(*this);
+	}
+}
+
+const FlatTreeItem::ColumnCell* FlatTreeItem::FindColumnCell(int column) const
+{
+	if (column < 0 || column >= static_cast<int>(m_columnCells.size())) {
+		return nullptr;
+	}
+	return &m_columnCells[column];
+}
+
+FlatTreeItem::ColumnCell& FlatTreeItem::GetColumnCell(int column)
+{
+	if (column >= static_cast<int>(m_columnCells.size())) {
+		m_columnCells.resize(column + 1);
+	}
+	return m_columnCells[column];
+}
+
 void FlatTreeItem::SetColumnData(int column, const wxString& data)
 {
-	m_columnData[column] = data;
+	if (column < 0) return;
+	GetColumnCell(column).data = data;
 }
 
 wxString FlatTreeItem::GetColumnData(int column) const
 {
-	auto it = m_columnData.find(column);
-	return it != m_columnData.end() ? it->second : wxEmptyString;
+	const ColumnCell* cell = FindColumnCell(column);
+	return cell ? cell->data : wxString();
 }
 
 void FlatTreeItem::SetColumnIcon(int column, const wxBitmap& icon)
 {
-	m_columnIcons[column] = icon;
+	if (column < 0) return;
+	GetColumnCell(column).icon = icon;
 }
 
 wxBitmap FlatTreeItem::GetColumnIcon(int column) const
 {
-	auto it = m_columnIcons.find(column);
-	return it != m_columnIcons.end() ? it->second : wxNullBitmap;
+	const ColumnCell* cell = FindColumnCell(column);
+	return cell ? cell->icon : wxNullBitmap;
+}
+
+void FlatTreeItem::SetSvgIcon(const wxString& iconName, const wxSize& size)
+{
+	m_svgIconName = iconName;
+	m_svgIconSize = size;
+}
+
+void FlatTreeItem::SetColumnSvgIcon(int column, const wxString& iconName, const wxSize& size)
+{
+	if (column < 0) return;
+	ColumnCell& cell = GetColumnCell(column);
+	cell.svgIconName = iconName;
+	cell.svgIconSize = size;
+}
+
+wxString FlatTreeItem::GetColumnSvgIconName(int column) const
+{
+	const ColumnCell* cell = FindColumnCell(column);
+	return cell ? cell->svgIconName : wxString();
+}
+
+wxSize FlatTreeItem::GetColumnSvgIconSize(int column) const
+{
+	const ColumnCell* cell = FindColumnCell(column);
+	return cell ? cell->svgIconSize : wxDefaultSize;
 }
 
 int FlatTreeItem::GetLevel() const
@@ -347,9 +427,18 @@ void FlatTreeView::SelectItem(std::shared_ptr<FlatTreeItem> item, bool select)
 void FlatTreeView::ExpandItem(std::shared_ptr<FlatTreeItem> item, bool expand)
 {
 	if (item && item->HasChildren()) {
+		if (item->IsExpanded() == expand) {
+			return;
+		}
+		if (expand) {
+			item->EnsureChildrenLoaded();
+		}
 		item->SetExpanded(expand);
 		m_needsLayout = true;
-		InvalidateVisibleItemsList();
+		// Only the rows below this item move; everything else keeps its row
+		if (!SpliceVisibleRows(item)) {
+			InvalidateVisibleItemsList();
+		}
 		UpdateScrollbars(); // Update scrollbars when items are expanded/collapsed
 		Refresh();
 
@@ -795,29 +884,19 @@ void FlatTreeView::DrawItemsVirtual(wxDC& dc, int /*startY*/, int visibleTop, in
 		BuildVisibleItemsList();
 	}
 
-	// Calculate which items are actually visible in the current viewport
-	int firstVisibleIndex = -1;
-	int lastVisibleIndex = -1;
-
-	for (size_t i = 0; i < m_visibleItems.size(); ++i) {
-		int itemTop = m_visibleItems[i].yPosition;
-		int itemBottom = itemTop + m_itemHeight;
-
-		// Check if item intersects with visible area
-		if (itemBottom > visibleTop && itemTop < visibleBottom) {
-			if (firstVisibleIndex == -1) {
-				firstVisibleIndex = static_cast<int>(i);
-			}
-			lastVisibleIndex = static_cast<int>(i);
-		}
+	// Binary search for the first row intersecting the viewport, then walk until it is filled
+	int firstVisibleIndex = FindVisibleRowAt(std::max(visibleTop, 0));
+	if (firstVisibleIndex < 0) {
+		return;
 	}
 
 	// Draw only visible items
-	if (firstVisibleIndex != -1 && lastVisibleIndex != -1) {
-		for (int i = firstVisibleIndex; i <= lastVisibleIndex; ++i) {
-			const auto& visibleItem = m_visibleItems[i];
-			DrawItem(dc, visibleItem.item, visibleItem.yPosition, visibleItem.level);
+	for (size_t i = static_cast<size_t>(firstVisibleIndex); i < m_visibleItems.size(); ++i) {
+		const auto& visibleItem = m_visibleItems[i];
+		if (visibleItem.yPosition >= visibleBottom) {
+			break;
 		}
+		DrawItem(dc, visibleItem.item, visibleItem.yPosition, visibleItem.level);
 	}
 }
 
@@ -987,7 +1066,11 @@ void FlatTreeView::DrawColumnContent(wxDC& dc, std::shared_ptr<FlatTreeItem> ite
 		if (!svgIconName.IsEmpty()) {
 			try {
 				auto& iconManager = SvgIconManager::GetInstance();
-				wxSize iconSize = m_columnSvgIconSizes[columnIndex];
+				wxSize iconSize = item->GetColumnSvgIconSize(columnIndex);
+				if (iconSize.GetWidth() <= 0 || iconSize.GetHeight() <= 0) {
+					auto sizeIt = m_columnSvgIconSizes.find(columnIndex);
+					iconSize = sizeIt != m_columnSvgIconSizes.end() ? sizeIt->second : wxDefaultSize;
+				}
 				if (iconSize.GetWidth() <= 0 || iconSize.GetHeight() <= 0) {
 					iconSize = wxSize(12, 12); // Default size
 				}
@@ -1099,16 +1182,15 @@ std::shared_ptr<FlatTreeItem> FlatTreeView::HitTest(const wxPoint& point)
 		const_cast<FlatTreeView*>(this)->BuildVisibleItemsList();
 	}
 
-	// Use optimized hit testing with visible items list
-	for (const auto& visibleItem : m_visibleItems) {
-		int itemTop = visibleItem.yPosition;
-		int itemBottom = itemTop + m_itemHeight;
-		
-		if (logicalY >= itemTop && logicalY < itemBottom) {
-			return visibleItem.item;
-		}
+	// Binary search over the row prefix sums
+	int row = FindVisibleRowAt(logicalY);
+	if (row < 0) {
+		return nullptr;
+	}
+	const auto& visibleItem = m_visibleItems[row];
+	if (logicalY >= visibleItem.yPosition && logicalY < visibleItem.yPosition + m_itemHeight) {
+		return visibleItem.item;
 	}
-
 	return nullptr;
 }
 
@@ -1189,11 +1271,15 @@ void FlatTreeView::CalculateLayout()
 		int maxDepth = 0;
 		int maxText = 0;
 		
-		// Use cached visible items instead of recursive traversal
+		// Use cached visible items instead of recursive traversal; text is measured once per item
 		for (const auto& visibleItem : m_visibleItems) {
 			maxDepth = std::max(maxDepth, visibleItem.level);
-			wxSize s = tdc.GetTextExtent(visibleItem.item->GetText());
-			if (s.GetWidth() > maxText) maxText = s.GetWidth();
+			int textWidth = visibleItem.item->GetTextWidth();
+			if (textWidth < 0) {
+				textWidth = tdc.GetTextExtent(visibleItem.item->GetText()).GetWidth();
+				visibleItem.item->SetTextWidth(textWidth);
+			}
+			if (textWidth > maxText) maxText = textWidth;
 		}
 		
 		int icons = 40;
@@ -1284,9 +1370,14 @@ int FlatTreeView::CalculateItemY(std::shared_ptr<FlatTreeItem> item)
 {
 	if (!item) return 0;
 
-	int y = m_itemHeight + 1; // Start below headers
-
-	return CalculateItemYRecursive(m_root, item, y);
+	if (!m_visibleItemsValid) {
+		BuildVisibleItemsList();
+	}
+	int row = FindVisibleRow(item.get());
+	if (row < 0) {
+		return -1;
+	}
+	return m_itemHeight + 1 + m_visibleItems[row].yPosition; // Below headers
 }
 
 int FlatTreeView::CalculateItemYRecursive(std::shared_ptr<FlatTreeItem> current, std::shared_ptr<FlatTreeItem> target, int& y)
@@ -1488,20 +1579,19 @@ void FlatTreeView::InvalidateItem(std::shared_ptr<FlatTreeItem> item)
 	}
 	
 	// Find item in visible items list for fast lookup
-	for (const auto& visibleItem : m_visibleItems) {
-		if (visibleItem.item == item) {
-			int headerHeight = m_itemHeight;
-			// Get current scroll position
-			int scrollY = 0;
-			GetViewStart(nullptr, &scrollY);
-			int ppuY = 1;
-			GetScrollPixelsPerUnit(nullptr, &ppuY);
-			// Convert logical position to device position
-			int deviceY = headerHeight + visibleItem.yPosition - scrollY * ppuY;
-			wxRect rect(0, deviceY, GetClientSize().GetWidth(), m_itemHeight);
-			RefreshRect(rect, false);
-			return;
-		}
+	int row = FindVisibleRow(item.get());
+	if (row >= 0) {
+		int headerHeight = m_itemHeight;
+		// Get current scroll position
+		int scrollY = 0;
+		GetViewStart(nullptr, &scrollY);
+		int ppuY = 1;
+		GetScrollPixelsPerUnit(nullptr, &ppuY);
+		// Convert logical position to device position
+		int deviceY = headerHeight + m_visibleItems[row].yPosition - scrollY * ppuY;
+		wxRect rect(0, deviceY, GetClientSize().GetWidth(), m_itemHeight);
+		RefreshRect(rect, false);
+		return;
 	}
 	
 	// Item not found in visible list - it might be collapsed or not visible
@@ -1536,8 +1626,7 @@ void FlatTreeView::SetColumnSvgIcon(int column, const wxString& iconName, const
 void FlatTreeView::SetItemSvgIcon(std::shared_ptr<FlatTreeItem> item, const wxString& iconName, const wxSize& size)
 {
 	if (item) {
-		m_itemSvgIconNames[item] = iconName;
-		m_itemSvgIconSizes[item] = size;
+		item->SetSvgIcon(iconName, size);
 		Refresh();
 	}
 }
@@ -1545,9 +1634,7 @@ void FlatTreeView::SetItemSvgIcon(std::shared_ptr<FlatTreeItem> item, const wxSt
 void FlatTreeView::SetItemColumnSvgIcon(std::shared_ptr<FlatTreeItem> item, int column, const wxString& iconName, const wxSize& size)
 {
 	if (item && column >= 0 && column < static_cast<int>(m_columns.size())) {
-		auto key = std::make_pair(item, column);
-		m_itemColumnSvgIconNames[key] = iconName;
-		m_itemColumnSvgIconSizes[key] = size;
+		item->SetColumnSvgIcon(column, iconName, size);
 		Refresh();
 	}
 }
@@ -1560,15 +1647,12 @@ wxString FlatTreeView::GetColumnSvgIconName(int column) const
 
 wxString FlatTreeView::GetItemSvgIconName(std::shared_ptr<FlatTreeItem> item) const
 {
-	auto it = m_itemSvgIconNames.find(item);
-	return it != m_itemSvgIconNames.end() ? it->second : wxEmptyString;
+	return item ? item->GetSvgIconName() : wxString();
 }
 
 wxString FlatTreeView::GetItemColumnSvgIconName(std::shared_ptr<FlatTreeItem> item, int column) const
 {
-	auto key = std::make_pair(item, column);
-	auto it = m_itemColumnSvgIconNames.find(key);
-	return it != m_itemColumnSvgIconNames.end() ? it->second : wxEmptyString;
+	return item ? item->GetColumnSvgIconName(column) : wxString();
 }
 
 void FlatTreeView::OnScrollbarUpdateTimer(wxTimerEvent& event)
@@ -1586,6 +1670,7 @@ void FlatTreeView::OnScrollbarUpdateTimer(wxTimerEvent& event)
 void FlatTreeView::BuildVisibleItemsList()
 {
 	m_visibleItems.clear();
+	m_visibleRowOf.clear();
 
 	if (!m_root) {
 		m_visibleItemsValid = true;
@@ -1596,14 +1681,81 @@ void FlatTreeView::BuildVisibleItemsList()
 	
 	BuildVisibleItemsRecursive(m_root, currentIndex, 0);
 	
-	// Update Y positions - start from 0 in logical coordinates
-	for (size_t i = 0; i < m_visibleItems.size(); ++i) {
-		m_visibleItems[i].yPosition = static_cast<int>(i) * m_itemHeight;
-	}
+	// Y positions and the item -> row index - start from 0 in logical coordinates
+	m_visibleRowOf.reserve(m_visibleItems.size());
+	UpdateVisibleRowsFrom(0);
 	
 	m_visibleItemsValid = true;
 }
 
+void FlatTreeView::UpdateVisibleRowsFrom(size_t row)
+{
+	int y = row > 0 ? m_visibleItems[row - 1].yPosition + m_itemHeight : 0;
+	for (size_t i = row; i < m_visibleItems.size(); ++i) {
+		m_visibleItems[i].yPosition = y;
+		m_visibleRowOf[m_visibleItems[i].item.get()] = i;
+		y += m_itemHeight;
+	}
+}
+
+int FlatTreeView::FindVisibleRowAt(int y) const
+{
+	// Last row starting at or above y
+	auto it = std::upper_bound(m_visibleItems.begin(), m_visibleItems.end(), y,
+		[](int value, const VisibleItemInfo& info) { return value < info.yPosition; });
+	if (it == m_visibleItems.begin()) {
+		return -1;
+	}
+	return static_cast<int>(std::distance(m_visibleItems.begin(), it) - 1);
+}
+
+int FlatTreeView::FindVisibleRow(const FlatTreeItem* item) const
+{
+	if (!m_visibleItemsValid || !item) {
+		return -1;
+	}
+	auto it = m_visibleRowOf.find(item);
+	return it != m_visibleRowOf.end() ? static_cast<int>(it->second) : -1;
+}
+
+bool FlatTreeView::SpliceVisibleRows(std::shared_ptr<FlatTreeItem> item)
+{
+	// Returns false when the list has to be rebuilt instead
+	if (!m_visibleItemsValid || !item) {
+		return false;
+	}
+	if (item == m_root) {
+		return false;
+	}
+	int row = FindVisibleRow(item.get());
+	if (row < 0) {
+		// Inside a collapsed branch: no visible rows change
+		return true;
+	}
+
+	const size_t first = static_cast<size_t>(row) + 1;
+	const int level = m_visibleItems[row].level;
+	size_t last = first;
+	while (last < m_visibleItems.size() && m_visibleItems[last].level > level) {
+		m_visibleRowOf.erase(m_visibleItems[last].item.get());
+		++last;
+	}
+	m_visibleItems.erase(m_visibleItems.begin() + first, m_visibleItems.begin() + last);
+
+	if (item->IsExpanded()) {
+		// Append the subtree rows, then rotate them into place below the item
+		const size_t oldSize = m_visibleItems.size();
+		int currentIndex = static_cast<int>(first);
+		for (auto& child : item->GetChildren()) {
+			BuildVisibleItemsRecursive(child, currentIndex, level + 1);
+		}
+		std::rotate(m_visibleItems.begin() + first, m_visibleItems.begin() + oldSize, m_visibleItems.end());
+	}
+
+	UpdateVisibleRowsFrom(first);
+	return true;
+}
+
 void FlatTreeView::BuildVisibleItemsRecursive(std::shared_ptr<FlatTreeItem> item, int& currentIndex, int level)
 {
 	if (!item || !item->IsVisible()) return;
@@ -1621,6 +1773,7 @@ void FlatTreeView::BuildVisibleItemsRecursive(std::shared_ptr<FlatTreeItem> item
 
 	// Add children if expanded
 	if (item->IsExpanded()) {
+		item->EnsureChildrenLoaded();
 		for (auto& child : item->GetChildren()) {
 			BuildVisibleItemsRecursive(child, currentIndex, level + 1);
 		}
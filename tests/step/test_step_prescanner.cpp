@@ -0,0 +1,156 @@
+/**
+ * @file test_step_prescanner.cpp
+ * @brief Checks for STEPPreScanner on the AP214 sample and on generated files
+ *
+ * Covers:
+ * 1. Comments and '' escapes in the header and in instances
+ * 2. The NAUO product tree and per-product face counts
+ * 3. Length unit resolution through GLOBAL_UNIT_ASSIGNED_CONTEXT
+ * 4. A record split across the 4 MB read chunks
+ */
+
+#include "STEPPreScanner.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+    int g_failures = 0;
+
+    void check(bool condition, const std::string& what) {
+        std::cout << (condition ? "✅ PASS: " : "❌ FAIL: ") << what << std::endl;
+        if (!condition) g_failures++;
+    }
+
+    const STEPPreScanner::ProductInfo* findProduct(const STEPPreScanner::ScanResult& result, const std::string& id) {
+        for (const auto& product : result.products) {
+            if (product.id == id) return &product;
+        }
+        return nullptr;
+    }
+
+    std::filesystem::path writeTempFile(const std::string& name, const std::string& contents) {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream out(path, std::ios::binary);
+        out << contents;
+        return path;
+    }
+
+    const std::string kHeader =
+        "ISO-10303-21;\nHEADER;\nFILE_DESCRIPTION((''),'2;1');\nFILE_NAME('','',(''),(''),'','','');\n"
+        "FILE_SCHEMA(('AUTOMOTIVE_DESIGN'));\nENDSEC;\nDATA;\n";
+    const std::string kFooter = "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+
+void testSample(const std::filesystem::path& samplePath) {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Test 1: AP214 sample" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    STEPPreScanner::ScanResult result = STEPPreScanner::scan(samplePath.string());
+    check(result.success, "Sample scanned: " + result.errorMessage);
+    if (!result.success) return;
+
+    const auto& header = result.header;
+    check(header.description.size() == 1 && header.description[0] == "Bracket assembly; two bolts and a plate",
+          "Semicolon inside a header string");
+    check(header.authors.size() == 1 && header.authors[0] == "J. O'Neil", "'' escape in FILE_NAME");
+    check(header.schemas.size() == 1 && header.schemas[0].find("AUTOMOTIVE_DESIGN") == 0, "FILE_SCHEMA");
+
+    check(result.products.size() == 3, "PRODUCT inside a comment is ignored");
+    const auto* assembly = findProduct(result, "ASM-001");
+    const auto* plate = findProduct(result, "PLT-100");
+    const auto* bolt = findProduct(result, "BLT-M8");
+    check(assembly && plate && bolt, "All products found");
+    if (!assembly || !plate || !bolt) return;
+
+    check(bolt->name == "Bolt 'M8'", "'' escape in PRODUCT name");
+    check(bolt->description == "/* not a comment */", "Comment opener inside a string");
+    check(plate->description == "Base plate; 6 faces", "Semicolon inside an instance string");
+
+    check(result.lengthUnit == "INCH" && result.lengthUnitInMillimetres == 25.4,
+          "Context unit wins over the SI unit of the conversion measure (got " + result.lengthUnit + ")");
+
+    check(result.occurrences.size() == 3, "Three NAUOs");
+    check(result.rootProducts.size() == 1 && &result.products[result.rootProducts[0]] == assembly,
+          "Assembly is the only root");
+    check(assembly->occurrences.size() == 3, "Assembly places three children");
+    check(bolt->instanceCount == 2 && plate->instanceCount == 1, "Instance counts");
+    check(plate->faceCount == 6 && plate->solidCount == 1, "Plate faces through its representation");
+    check(bolt->faceCount == 3, "Bolt faces through its representation");
+
+    const size_t assemblyIndex = static_cast<size_t>(assembly - result.products.data());
+    check(STEPPreScanner::collectSubtree(result, assemblyIndex).size() == 3, "Subtree lists each product once");
+}
+
+void testUnitFallback() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Test 2: Unit resolution" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // No representation context: the conversion-based unit is preferred over the
+    // SI unit that only appears inside its measure
+    const std::string units =
+        "#1=(LENGTH_UNIT()NAMED_UNIT(*)SI_UNIT(.MILLI.,.METRE.));\n"
+        "#2=LENGTH_MEASURE_WITH_UNIT(LENGTH_MEASURE(304.8),#1);\n"
+        "#3=(CONVERSION_BASED_UNIT('FOOT',#2)LENGTH_UNIT()NAMED_UNIT(#4));\n";
+    auto path = writeTempFile("prescan_units_fallback.step", kHeader + units + kFooter);
+    STEPPreScanner::ScanResult result = STEPPreScanner::scan(path.string());
+    check(result.success && result.lengthUnit == "FOOT" && result.lengthUnitInMillimetres == 304.8,
+          "Conversion-based unit without a context (got " + result.lengthUnit + ")");
+
+    // A context assigning the SI unit keeps it even when a conversion-based one exists
+    const std::string context =
+        "#5=(GEOMETRIC_REPRESENTATION_CONTEXT(3)GLOBAL_UNIT_ASSIGNED_CONTEXT((#1))"
+        "REPRESENTATION_CONTEXT('',''));\n";
+    path = writeTempFile("prescan_units_context.step", kHeader + units + context + kFooter);
+    result = STEPPreScanner::scan(path.string());
+    check(result.success && result.lengthUnit == "millimetre" && result.lengthUnitInMillimetres == 1.0,
+          "SI unit assigned by the context (got " + result.lengthUnit + ")");
+}
+
+void testChunkBoundary() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Test 3: Record split across chunks" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // The scanner reads 4 MB at a time; place a PRODUCT so that it straddles the
+    // first boundary, with the split falling inside its name string
+    const size_t chunkSize = 4 * 1024 * 1024;
+    const std::string record = "#7=PRODUCT('SPLIT','Split; ''across'' chunks','',(#8));\n";
+    std::string contents = kHeader + "/* padding ";
+    const size_t splitInRecord = 24;
+    contents.append(chunkSize - splitInRecord - contents.size() - 4, 'x');
+    contents += " */\n";
+    contents += record;
+    contents += kFooter;
+
+    auto path = writeTempFile("prescan_chunk_split.step", contents);
+    STEPPreScanner::ScanResult result = STEPPreScanner::scan(path.string());
+    check(result.success, "Large file scanned: " + result.errorMessage);
+    check(result.products.size() == 1 && result.products[0].name == "Split; 'across' chunks",
+          "Product parsed across the boundary");
+    check(result.products.size() == 1 && result.products[0].offset == chunkSize - splitInRecord,
+          "Offset of the split record");
+    check(result.entityCount == 1, "Padding comment adds no entities");
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "STEPPreScanner tests" << std::endl;
+
+    std::filesystem::path samplePath = argc > 1
+        ? std::filesystem::path(argv[1])
+        : std::filesystem::path(__FILE__).parent_path() / "sample_ap214.step";
+
+    testSample(samplePath);
+    testUnitFallback();
+    testChunkBoundary();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << (g_failures == 0 ? "All STEPPreScanner tests passed" :
+                  std::to_string(g_failures) + " STEPPreScanner checks failed") << std::endl;
+    std::cout << "========================================" << std::endl;
+    return g_failures == 0 ? 0 : 1;
+}